@@ -14,69 +14,61 @@
 #include "utils/kernel_util.h"
 #include "cpu_kernel_utils.h"
 #include "cpu_types.h"
+#include "aicpu/elementwise_block.h"
 
 namespace {
 const char* const kElu = "Elu";
 constexpr uint32_t kOutputNum = 1U;
 constexpr uint32_t kInputNum = 1U;
-constexpr int64_t kParallelDefaultDataNum = 60 * 1024;
-constexpr int64_t kParallelBfloat16DataNum = 10 * 1024;
 } // namespace
 
 namespace aicpu {
 template <typename T>
-T TransType(float& val)
+T TransType(const float& val)
 {
     return T(val);
 }
 
 template <>
-double TransType(float& val)
+double TransType(const float& val)
 {
     return atof(std::to_string(val).c_str());
 }
 
+// x >= 0 时负半轴项为 exp(0) - 1 = 0, x < 0 时正半轴项为 0, 与逐元素分支结果一致;
+// 避免使用 select, 使整个表达式(含 exp)可由 Eigen 向量化. max/min 的第一个参数为 x, NaN 会被保留.
 template <typename T>
-void EluDoCompute(const T* input, T* output, EluAttrInfo& eluInfo, int64_t start, int64_t end)
+void EluDoCompute(const T* input, T* output, const EluAttrInfo& eluInfo, int64_t start, int64_t end)
 {
-    const T zeroVal = static_cast<T>(0);
-    const T oneVal = static_cast<T>(1);
+    using C = typename elementwise::ComputeType<T>::Type;
+    const C zeroVal = static_cast<C>(0);
+    const C oneVal = static_cast<C>(1);
 
     // tf api, these attr defalut val 1
     if (std::fabs(eluInfo.alpha - 1.0F) < FLT_EPSILON && std::fabs(eluInfo.scale - 1.0F) < FLT_EPSILON &&
         std::fabs(eluInfo.inputScale - 1.0F) < FLT_EPSILON) {
-        for (int64_t i = start; i < end; i++) {
-            if (input[i] >= zeroVal) {
-                output[i] = input[i];
-                continue;
-            }
-            output[i] = Eigen::numext::exp(input[i]) - oneVal;
-        }
+        elementwise::UnaryBlocks(input, output, start, end, [zeroVal, oneVal](auto x, auto y) {
+            y = x.max(zeroVal) + (x.min(zeroVal).exp() - oneVal);
+        });
         return;
     }
 
-    const T alphaVal = TransType<T>(eluInfo.alpha);
-    const T scaleVal = TransType<T>(eluInfo.scale);
-    const T inputScaleVal = TransType<T>(eluInfo.inputScale);
+    const C alphaVal = TransType<C>(eluInfo.alpha);
+    const C scaleVal = TransType<C>(eluInfo.scale);
+    const C inputScaleVal = TransType<C>(eluInfo.inputScale);
     if (std::fabs(eluInfo.scale - 1.0F) < FLT_EPSILON &&
         std::fabs(eluInfo.inputScale - 1.0F) < FLT_EPSILON) { // pytorch api, scale and input scale attr default var 1
-        for (int64_t i = start; i < end; i++) {
-            if (input[i] >= zeroVal) {
-                output[i] = input[i];
-                continue;
-            }
-            output[i] = alphaVal * (Eigen::numext::exp(input[i]) - oneVal);
-        }
+        elementwise::UnaryBlocks(input, output, start, end, [zeroVal, oneVal, alphaVal](auto x, auto y) {
+            y = x.max(zeroVal) + alphaVal * (x.min(zeroVal).exp() - oneVal);
+        });
         return;
     }
 
-    for (int64_t i = start; i < end; i++) {
-        if (input[i] >= zeroVal) {
-            output[i] = input[i] * scaleVal;
-            continue;
-        }
-        output[i] = alphaVal * scaleVal * (Eigen::numext::exp(input[i] * inputScaleVal) - oneVal);
-    }
+    const C negScaleVal = alphaVal * scaleVal;
+    elementwise::UnaryBlocks(
+        input, output, start, end, [zeroVal, oneVal, scaleVal, inputScaleVal, negScaleVal](auto x, auto y) {
+            y = x.max(zeroVal) * scaleVal + negScaleVal * ((x.min(zeroVal) * inputScaleVal).exp() - oneVal);
+        });
 }
 
 template <typename T>
@@ -88,7 +80,6 @@ uint32_t EluCompute(CpuKernelContext& ctx)
         return KERNEL_STATUS_OK;
     }
 
-    auto dataType = ctx.Input(0)->GetDataType();
     AttrValue* attrAlpha = ctx.GetAttr("alpha");
     const float alpha = attrAlpha != nullptr ? attrAlpha->GetFloat() : 1.0F;
     AttrValue* attrScale = ctx.GetAttr("scale");
@@ -99,17 +90,8 @@ uint32_t EluCompute(CpuKernelContext& ctx)
 
     auto in = reinterpret_cast<T*>(ctx.Input(0)->GetData());
     auto out = reinterpret_cast<T*>(ctx.Output(0)->GetData());
-    if ((dataNum <= kParallelDefaultDataNum && dataType != DT_BFLOAT16) ||
-        (dataNum <= kParallelBfloat16DataNum && dataType == DT_BFLOAT16)) {
-        EluDoCompute(in, out, eluAttInfo, 0, dataNum);
-        return KERNEL_STATUS_OK;
-    }
-
-    const uint32_t minCoreNum = 1;
-    const int64_t maxCoreNum = std::max(minCoreNum, aicpu::CpuKernelUtils::GetCPUNum(ctx) - kResvCpuNum);
     auto sharderElu = [&](int64_t start, int64_t end) { EluDoCompute<T>(in, out, eluAttInfo, start, end); };
-    KERNEL_HANDLE_ERROR(CpuKernelUtils::ParallelFor(ctx, dataNum, dataNum / maxCoreNum, sharderElu),
-                        "Elu Compute failed.")
+    KERNEL_HANDLE_ERROR(elementwise::ParallelRun(ctx, dataNum, sharderElu), "Elu Compute failed.")
     return KERNEL_STATUS_OK;
 }
 
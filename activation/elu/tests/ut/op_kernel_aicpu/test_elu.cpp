@@ -1,3 +1,6 @@
+#include <cmath>
+#include <vector>
+
 #include "gtest/gtest.h"
 #ifndef private
 #define private public
@@ -108,4 +111,54 @@ TEST_F(TEST_ELU_UT, TestElu_not_support_int8)
         .Attr("input_scale", 0.3);
 
     RUN_KERNEL(node_def, HOST, KERNEL_STATUS_PARAM_INVALID);
-}
\ No newline at end of file
+}
+TEST_F(TEST_ELU_UT, TestElu_float16_large_blocks)
+{
+    // 非块大小整数倍, 覆盖 fp32 分块的尾块与并行切分
+    const int64_t num = 100003;
+    vector<int64_t> shape = {num};
+    vector<Eigen::half> input(num);
+    vector<Eigen::half> output(num);
+    vector<Eigen::half> outputExp(num);
+    for (int64_t i = 0; i < num; ++i) {
+        const float x = static_cast<float>(i % 2000) / 100.0F - 10.0F;
+        input[i] = Eigen::half(x);
+        const float xv = static_cast<float>(input[i]);
+        outputExp[i] = Eigen::half(xv >= 0.0F ? xv * 1.05F : 0.2F * 1.05F * (std::exp(xv * 0.5F) - 1.0F));
+    }
+
+    auto node_def = CpuKernelUtils::CpuKernelUtils::CreateNodeDef();
+    NodeDefBuilder(node_def.get(), "Elu", "Elu")
+        .Input({"x", DT_FLOAT16, shape, input.data()})
+        .Output({"y", DT_FLOAT16, shape, output.data()})
+        .Attr("alpha", 0.2)
+        .Attr("scale", 1.05)
+        .Attr("input_scale", 0.5);
+
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+    EXPECT_TRUE(CompareResult(output.data(), outputExp.data(), num));
+}
+
+TEST_F(TEST_ELU_UT, TestElu_float32_special_values)
+{
+    vector<int64_t> shape = {6};
+    float input[6] = {NAN, INFINITY, -INFINITY, 0.0F, 100.0F, -100.0F};
+    float output[6] = {0};
+
+    auto node_def = CpuKernelUtils::CpuKernelUtils::CreateNodeDef();
+    NodeDefBuilder(node_def.get(), "Elu", "Elu")
+        .Input({"x", DT_FLOAT, shape, input})
+        .Output({"y", DT_FLOAT, shape, output})
+        .Attr("alpha", 0.2)
+        .Attr("scale", 1.0)
+        .Attr("input_scale", 1.0);
+
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+
+    EXPECT_TRUE(std::isnan(output[0]));
+    EXPECT_EQ(output[1], INFINITY);
+    EXPECT_FLOAT_EQ(output[2], -0.2F);
+    EXPECT_EQ(output[3], 0.0F);
+    EXPECT_EQ(output[4], 100.0F);
+    EXPECT_FLOAT_EQ(output[5], -0.2F);
+}
@@ -10,9 +10,8 @@
 
 #include "log_softmax_v2_aicpu.h"
 
-#include <securec.h>
-#include <atomic>
-#include <functional>
+#include <algorithm>
+#include <vector>
 #include "cpu_types.h"
 #include "log.h"
 #include "utils/eigen_tensor.h"
@@ -21,10 +20,8 @@
 namespace {
 constexpr uint32_t kInputNum = 1;
 constexpr uint32_t kOutputNum = 1;
-constexpr uint32_t kDimType1 = 1;
-constexpr uint32_t kDimType2 = 2;
-constexpr uint32_t kDimType3 = 3;
 constexpr int64_t kParalleledDataSize = 4 * 1024;
+constexpr int64_t kInnerBlockSize = 1024;
 const char* const kLogSoftmaxV2 = "LogSoftmaxV2";
 
 struct SoftmaxShapeInfo {
@@ -36,6 +33,29 @@ struct SoftmaxShapeInfo {
     std::vector<int64_t> dims;
 };
 
+// half/bfloat16 在 fp32 中完成 max/exp/sum, 避免 exp 累加精度损失
+template <typename T>
+struct AccType {
+    using type = T;
+};
+
+template <>
+struct AccType<Eigen::half> {
+    using type = float;
+};
+
+template <>
+struct AccType<Eigen::bfloat16> {
+    using type = float;
+};
+
+template <typename T>
+using ConstVecMap = Eigen::Map<const Eigen::Array<T, Eigen::Dynamic, 1>>;
+template <typename T>
+using VecMap = Eigen::Map<Eigen::Array<T, Eigen::Dynamic, 1>>;
+template <typename T>
+using AccVec = Eigen::Array<typename AccType<T>::type, Eigen::Dynamic, 1>;
+
 SoftmaxShapeInfo ComputeShapeInfo(const aicpu::CpuKernelContext& ctx)
 {
     SoftmaxShapeInfo info;
@@ -62,97 +82,74 @@ SoftmaxShapeInfo ComputeShapeInfo(const aicpu::CpuKernelContext& ctx)
     return info;
 }
 
-template <typename Op>
-void IterateBatches(int64_t total, int64_t inner_size, int64_t dim_pivot, Op op)
-{
-    for (int64_t index = 0, index_dst = 0, index_batch = 0, step = 0; index < total; index++) {
-        if (index % inner_size == 0 && index != 0) {
-            step++;
-            if (step == dim_pivot) {
-                step = 0;
-                index_batch += inner_size;
-            }
-            index_dst = index_batch;
-        }
-        op(index, index_dst);
-        index_dst++;
-    }
-}
-
+// 归一化轴连续(inner_size == 1): 整行一次向量化计算
+// y = (x - max) - log(sum(exp(x - max))), 每行只需一次 log
 template <typename T>
-aicpu::KernelStatus ComputeSequential(T* input, T* output, T* dims_exp_sum, T* dims_maximum,
-                                      const SoftmaxShapeInfo& info)
+void ComputeContiguousRow(const T* input, T* output, int64_t dim_length)
 {
-    Eigen::TensorMap<Eigen::Tensor<T, kDimType3>, Eigen::Aligned> logits(
-        input, info.inner_size, static_cast<int>(info.dims[info.pivot]), info.outer_size);
-    Eigen::TensorMap<Eigen::Tensor<T, kDimType1>, Eigen::Aligned> dims_sum(dims_exp_sum, info.length);
-    Eigen::TensorMap<Eigen::Tensor<T, kDimType2>, Eigen::Aligned> dims_max(dims_maximum, info.inner_size,
-                                                                           info.outer_size);
-    Eigen::array<int, 1> softmax_axes{{1}};
-    dims_max = logits.maximum(softmax_axes);
-
-    IterateBatches(info.total, info.inner_size, info.dims[info.pivot], [&](int64_t index, int64_t index_dst) {
-        *(output + index) = Eigen::numext::exp(*(input + index) - dims_maximum[index_dst]);
-        dims_exp_sum[index_dst] += (*(output + index));
-    });
-
-    dims_sum = dims_sum.inverse();
-
-    IterateBatches(info.total, info.inner_size, info.dims[info.pivot], [&](int64_t index, int64_t index_dst) {
-        *(output + index) = (*(output + index)) * (dims_exp_sum[index_dst]);
-        *(output + index) = Eigen::numext::log(*(output + index));
-    });
-
-    return aicpu::KERNEL_STATUS_OK;
+    using AccT = typename AccType<T>::type;
+    ConstVecMap<T> x(input, dim_length);
+    VecMap<T> y(output, dim_length);
+    const AccT max_value = static_cast<AccT>(x.maxCoeff());
+    const AccT log_sum = Eigen::numext::log((x.template cast<AccT>() - max_value).exp().sum());
+    y = ((x.template cast<AccT>() - max_value) - log_sum).template cast<T>();
 }
 
+// 归一化轴非连续: 以 inner 方向连续的 width 个元素为向量, 沿归一化轴逐行归约
 template <typename T>
-void ComputeOneBatch(T* input, T* output, T* dims_exp_sum, T* dims_maximum, int64_t index, int64_t inner_size,
-                     int64_t dim_length, std::atomic<bool>& failed)
+void ComputeStridedBlock(const T* input, T* output, int64_t dim_length, int64_t inner_size, int64_t width,
+                         AccVec<T>& max_value, AccVec<T>& log_sum)
 {
-    int64_t outer_index = index / inner_size;
-    int64_t index_base = outer_index * dim_length * inner_size + index % inner_size;
-
-    dims_maximum[index] = *(input + index_base);
-    for (int64_t inner_index = 0, index_dst = index_base; inner_index < dim_length; ++inner_index) {
-        if (*(input + index_dst) > dims_maximum[index]) {
-            dims_maximum[index] = *(input + index_dst);
-        }
-        index_dst += inner_size;
-    }
-    for (int64_t inner_index = 0, index_dst = index_base; inner_index < dim_length; ++inner_index) {
-        *(output + index_dst) = Eigen::numext::exp(*(input + index_dst) - dims_maximum[index]);
-        dims_exp_sum[index] += (*(output + index_dst));
-        index_dst += inner_size;
+    using AccT = typename AccType<T>::type;
+    auto row = [&](int64_t d) { return ConstVecMap<T>(input + d * inner_size, width).template cast<AccT>(); };
+    max_value = row(0);
+    for (int64_t d = 1; d < dim_length; ++d) {
+        max_value = max_value.max(row(d));
     }
-    if (dims_exp_sum[index] == static_cast<T>(0)) {
-        KERNEL_LOG_ERROR("LogSoftmaxV2 sum of exp is zero, division by zero.");
-        failed.store(true, std::memory_order_relaxed);
-        return;
+    log_sum.setZero(width);
+    for (int64_t d = 0; d < dim_length; ++d) {
+        log_sum += (row(d) - max_value).exp();
     }
-    dims_exp_sum[index] = static_cast<T>(1.0) / dims_exp_sum[index];
-    for (int64_t inner_index = 0, index_dst = index_base; inner_index < dim_length; ++inner_index) {
-        *(output + index_dst) = *(output + index_dst) * dims_exp_sum[index];
-        *(output + index_dst) = Eigen::numext::log(*(output + index_dst));
-        index_dst += inner_size;
+    log_sum = log_sum.log();
+    for (int64_t d = 0; d < dim_length; ++d) {
+        VecMap<T>(output + d * inner_size, width) = ((row(d) - max_value) - log_sum).template cast<T>();
     }
 }
 
+// 任务划分: outer_size 个 batch, 每个 batch 的 inner 方向再按 kInnerBlockSize 切块
 template <typename T>
-aicpu::KernelStatus ComputeParallel(const aicpu::CpuKernelContext& ctx, T* input, T* output, T* dims_exp_sum,
-                                    T* dims_maximum, const SoftmaxShapeInfo& info, uint32_t cores)
+aicpu::KernelStatus ComputeLogSoftmax(const aicpu::CpuKernelContext& ctx, const T* input, T* output,
+                                      const SoftmaxShapeInfo& info, uint32_t cores)
 {
-    std::int64_t per_unit_size{info.length / std::min(std::max(1L, static_cast<int64_t>(cores) - 2L), info.length)};
-    std::atomic<bool> failed{false};
-    auto sharder = [&](std::int64_t begin, std::int64_t end) {
-        for (int64_t index = begin; index < end; ++index) {
-            ComputeOneBatch<T>(input, output, dims_exp_sum, dims_maximum, index, info.inner_size, info.dims[info.pivot],
-                               failed);
+    const int64_t dim_length = info.dims[info.pivot];
+    const int64_t block_num = (info.inner_size + kInnerBlockSize - 1) / kInnerBlockSize;
+    const int64_t task_num = info.outer_size * block_num;
+    auto sharder = [&](int64_t begin, int64_t end) {
+        AccVec<T> max_value;
+        AccVec<T> log_sum;
+        for (int64_t task = begin; task < end; ++task) {
+            const int64_t outer_index = task / block_num;
+            const int64_t col_begin = (task % block_num) * kInnerBlockSize;
+            const int64_t offset = outer_index * dim_length * info.inner_size + col_begin;
+            if (info.inner_size == 1) {
+                ComputeContiguousRow<T>(input + offset, output + offset, dim_length);
+                continue;
+            }
+            const int64_t width = std::min(kInnerBlockSize, info.inner_size - col_begin);
+            ComputeStridedBlock<T>(input + offset, output + offset, dim_length, info.inner_size, width, max_value,
+                                   log_sum);
         }
     };
-    aicpu::CpuKernelUtils::ParallelFor(ctx, info.length, per_unit_size, sharder);
-    if (failed.load(std::memory_order_relaxed)) {
-        return aicpu::KERNEL_STATUS_PARAM_INVALID;
+
+    int64_t data_size = info.total * static_cast<int64_t>(sizeof(T));
+    if (data_size <= kParalleledDataSize || task_num == 1) {
+        sharder(0, task_num);
+        return aicpu::KERNEL_STATUS_OK;
+    }
+    std::int64_t per_unit_size{task_num / std::min(std::max(1L, static_cast<int64_t>(cores) - 2L), task_num)};
+    if (aicpu::CpuKernelUtils::ParallelFor(ctx, task_num, per_unit_size, sharder) != aicpu::KERNEL_STATUS_OK) {
+        KERNEL_LOG_ERROR("LogSoftmaxV2 parallel compute failed.");
+        return aicpu::KERNEL_STATUS_INNER_ERROR;
     }
     return aicpu::KERNEL_STATUS_OK;
 }
@@ -170,6 +167,9 @@ uint32_t LogSoftmaxV2CpuKernel::Compute(CpuKernelContext& ctx)
         case (DT_FLOAT16):
             result = LogSoftmaxV2Compute<Eigen::half>(ctx);
             break;
+        case (DT_BFLOAT16):
+            result = LogSoftmaxV2Compute<Eigen::bfloat16>(ctx);
+            break;
         case (DT_FLOAT):
             result = LogSoftmaxV2Compute<float>(ctx);
             break;
@@ -216,14 +216,16 @@ KernelStatus LogSoftmaxV2CpuKernel::LogSoftmaxV2Compute(const CpuKernelContext&
     std::int64_t total = ctx.Input(0)->NumElements();
 
     if (ctx.Input(0)->GetTensorShape()->GetDims() == 0 && total == 1) {
-        output[0] = static_cast<T>(std::log(std::exp(input[0]) / std::exp(input[0])));
+        // 单元素时 log_softmax(x) = x - x, 非有限值输入时为 NaN
+        using AccT = typename AccType<T>::type;
+        output[0] = static_cast<T>(static_cast<AccT>(input[0]) - static_cast<AccT>(input[0]));
         KERNEL_LOG_DEBUG("LogSoftmaxV2 handling scalar scenarios.");
         return KERNEL_STATUS_OK;
     }
 
     auto info = ComputeShapeInfo(ctx);
-    if (info.inner_size == 0) {
-        KERNEL_LOG_INFO("LogSoftmaxV2 inner_size is 0, skip compute.");
+    if (info.total == 0) {
+        KERNEL_LOG_INFO("LogSoftmaxV2 input is empty, skip compute.");
         return KERNEL_STATUS_OK;
     }
     uint32_t cores = aicpu::CpuKernelUtils::GetCPUNum(ctx);
@@ -231,24 +233,8 @@ KernelStatus LogSoftmaxV2CpuKernel::LogSoftmaxV2Compute(const CpuKernelContext&
         return KERNEL_STATUS_INNER_ERROR;
     }
 
-    std::unique_ptr<T[]> dims_exp_sum(new (std::nothrow) T[info.length]);
-    KERNEL_CHECK_NULLPTR(dims_exp_sum, KERNEL_STATUS_INNER_ERROR, "alloc dims exp sum failed.");
-    std::unique_ptr<T[]> dims_maximum(new (std::nothrow) T[info.length]);
-    KERNEL_CHECK_NULLPTR(dims_maximum, KERNEL_STATUS_INNER_ERROR, "alloc dims max sum failed.");
-
     KERNEL_LOG_DEBUG("inner_size is %ld, outer_size is %ld", info.inner_size, info.outer_size);
-    auto ret = BiggerMemSet(dims_exp_sum.get(), static_cast<size_t>(info.length) * sizeof(T), 0,
-                            static_cast<size_t>(info.length) * sizeof(T));
-    if (!ret) {
-        KERNEL_LOG_ERROR("LogSoftmaxV2 BiggerMemSet failed.");
-        return KERNEL_STATUS_PARAM_INVALID;
-    }
-
-    int64_t data_size = info.total * static_cast<int64_t>(sizeof(T));
-    if (data_size <= kParalleledDataSize) {
-        return ComputeSequential<T>(input, output, dims_exp_sum.get(), dims_maximum.get(), info);
-    }
-    return ComputeParallel<T>(ctx, input, output, dims_exp_sum.get(), dims_maximum.get(), info, cores);
+    return ComputeLogSoftmax<T>(ctx, input, output, info, cores);
 }
 
 REGISTER_CPU_KERNEL(kLogSoftmaxV2, LogSoftmaxV2CpuKernel);
@@ -16,7 +16,7 @@ class LogSoftmaxV2 : public OpDef {
 public:
     explicit LogSoftmaxV2(const char* name) : OpDef(name)
     {
-        const std::vector<ge::DataType> data_types = {ge::DT_FLOAT16, ge::DT_FLOAT, ge::DT_DOUBLE};
+        const std::vector<ge::DataType> data_types = {ge::DT_FLOAT16, ge::DT_BF16, ge::DT_FLOAT, ge::DT_DOUBLE};
         this->Input("logits").ParamType(REQUIRED).DataType(data_types);
         this->Output("logsoftmax").ParamType(REQUIRED).DataType(data_types);
 
@@ -77,6 +77,47 @@ void RunLogSoftmaxV2Kernel(const std::vector<std::vector<int64_t>>& shapes, cons
     }
 }
 
+// 以 double 精度的 x - max - log(sum(exp(x - max))) 为参考, 校验相对误差不超过 tolerance
+template <typename T>
+void CheckAgainstDoubleReference(const std::vector<int64_t>& shape, DataType data_type, int64_t axis,
+                                 const std::vector<float>& values, double tolerance)
+{
+    const int64_t total = std::accumulate(shape.begin(), shape.end(), 1LL, std::multiplies<int64_t>());
+    const int64_t pivot = axis < 0 ? static_cast<int64_t>(shape.size()) + axis : axis;
+    const int64_t outer = std::accumulate(shape.begin(), shape.begin() + pivot, 1LL, std::multiplies<int64_t>());
+    const int64_t inner = std::accumulate(shape.begin() + pivot + 1, shape.end(), 1LL, std::multiplies<int64_t>());
+    const int64_t length = shape[pivot];
+    std::vector<T> input(total);
+    std::vector<T> output(total);
+    for (int64_t i = 0; i < total; ++i) {
+        input[i] = static_cast<T>(values[i % values.size()]);
+    }
+    std::vector<void*> datas = {static_cast<void*>(input.data()), static_cast<void*>(output.data())};
+    auto node_def = CreateLogSoftmaxV2NodeDef({shape, shape}, {data_type, data_type}, datas, {axis});
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+
+    double max_error = 0.0;
+    for (int64_t o = 0; o < outer; ++o) {
+        for (int64_t c = 0; c < inner; ++c) {
+            auto at = [&](int64_t d) { return (o * length + d) * inner + c; };
+            double max_val = static_cast<double>(static_cast<float>(input[at(0)]));
+            for (int64_t d = 1; d < length; ++d) {
+                max_val = std::max(max_val, static_cast<double>(static_cast<float>(input[at(d)])));
+            }
+            double sum = 0.0;
+            for (int64_t d = 0; d < length; ++d) {
+                sum += std::exp(static_cast<double>(static_cast<float>(input[at(d)])) - max_val);
+            }
+            for (int64_t d = 0; d < length; ++d) {
+                double expect = static_cast<double>(static_cast<float>(input[at(d)])) - max_val - std::log(sum);
+                double actual = static_cast<double>(static_cast<float>(output[at(d)]));
+                max_error = std::max(max_error, std::fabs(actual - expect) / (1.0 + std::fabs(expect)));
+            }
+        }
+    }
+    EXPECT_LE(max_error, tolerance);
+}
+
 TEST_F(TEST_LOGSOFTMAXV2_AICPU_UT, DATA_TYPE_FLOAT_SUCC)
 {
     std::vector<DataType> data_types = {DT_FLOAT, DT_FLOAT};
@@ -312,3 +353,44 @@ TEST_F(TEST_LOGSOFTMAXV2_AICPU_UT, FLOAT_LARGE_PARALLEL_NEGATIVE)
     }
     RunLogSoftmaxV2Kernel(shapes, data_types, input, expect, {-1});
 }
+
+TEST_F(TEST_LOGSOFTMAXV2_AICPU_UT, FLOAT16_LONG_ROW_PRECISION)
+{
+    // 2 万个元素的 exp 累加在 fp16 中会严重丢失精度, 需 fp32 累加
+    std::vector<float> values;
+    for (int i = 0; i < 97; ++i) {
+        values.push_back(static_cast<float>(i % 13) * 0.5f - 3.0f);
+    }
+    CheckAgainstDoubleReference<Eigen::half>({4, 20000}, DT_FLOAT16, -1, values, 1e-3);
+}
+
+TEST_F(TEST_LOGSOFTMAXV2_AICPU_UT, FLOAT16_STRIDED_AXIS_PRECISION)
+{
+    std::vector<float> values;
+    for (int i = 0; i < 31; ++i) {
+        values.push_back(static_cast<float>(i) * 0.25f - 4.0f);
+    }
+    CheckAgainstDoubleReference<Eigen::half>({3, 3000, 7}, DT_FLOAT16, 1, values, 1e-3);
+}
+
+TEST_F(TEST_LOGSOFTMAXV2_AICPU_UT, BFLOAT16_STRIDED_AXIS_PRECISION)
+{
+    std::vector<float> values = {-2.0f, -0.5f, 0.0f, 1.0f, 3.5f, 6.0f, -7.0f};
+    CheckAgainstDoubleReference<Eigen::bfloat16>({2, 64, 1500}, DT_BFLOAT16, 1, values, 8e-3);
+}
+
+TEST_F(TEST_LOGSOFTMAXV2_AICPU_UT, FLOAT_WIDE_INNER_PARALLEL_PRECISION)
+{
+    // inner 方向超过单个向量块, 覆盖 inner 切块与并行路径
+    std::vector<float> values;
+    for (int i = 0; i < 101; ++i) {
+        values.push_back(static_cast<float>(i % 17) * 1.5f - 10.0f);
+    }
+    CheckAgainstDoubleReference<float>({5, 16, 2500}, DT_FLOAT, 1, values, 1e-6);
+}
+
+TEST_F(TEST_LOGSOFTMAXV2_AICPU_UT, FLOAT_LARGE_MAGNITUDE_STABLE)
+{
+    std::vector<float> values = {10000.0f, 10001.0f, 9990.0f, -10000.0f, 10002.5f};
+    CheckAgainstDoubleReference<float>({64, 125}, DT_FLOAT, -1, values, 1e-6);
+}
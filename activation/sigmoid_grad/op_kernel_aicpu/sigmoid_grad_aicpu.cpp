@@ -14,6 +14,7 @@
 #include "cpu_types.h"
 #include "log.h"
 #include "utils/eigen_tensor.h"
+#include "aicpu/elementwise_block.h"
 
 namespace {
 constexpr uint32_t kInputNum = 2;
@@ -51,11 +52,11 @@ uint32_t SigmoidGradCpuKernel::Compute(CpuKernelContext& ctx)
             }
             return SigmoidGradCompute<std::complex<double>>(ctx);
         case DT_FLOAT:
-            return SigmoidGradCompute<float>(ctx);
+            return SigmoidGradComputeReal<float>(ctx);
         case DT_FLOAT16:
-            return SigmoidGradCompute<Eigen::half>(ctx);
+            return SigmoidGradComputeReal<Eigen::half>(ctx);
         case DT_DOUBLE:
-            return SigmoidGradCompute<double>(ctx);
+            return SigmoidGradComputeReal<double>(ctx);
         default:
             KERNEL_LOG_ERROR("SigmoidGrad kernel data type [%s] not support.", DTypeStr(data_type).c_str());
             return KERNEL_STATUS_PARAM_INVALID;
@@ -115,6 +116,25 @@ uint32_t SigmoidGradCpuKernel::SigmoidGradCompute(const CpuKernelContext& ctx)
     return KERNEL_STATUS_OK;
 }
 
+// 实数类型: half 在 fp32 块上计算, 只在写回时舍入一次
+template <typename T>
+uint32_t SigmoidGradCpuKernel::SigmoidGradComputeReal(const CpuKernelContext& ctx)
+{
+    auto input_y = reinterpret_cast<T*>(ctx.Input(0)->GetData());
+    auto input_dy = reinterpret_cast<T*>(ctx.Input(1)->GetData());
+    auto output_z = reinterpret_cast<T*>(ctx.Output(0)->GetData());
+    int64_t data_num = ctx.Input(0)->NumElements();
+
+    using C = typename elementwise::ComputeType<T>::Type;
+    const C one_trans = static_cast<C>(1.0);
+    auto shard_sigmoid_grad = [input_y, input_dy, output_z, one_trans](int64_t start, int64_t end) {
+        elementwise::BinaryBlocks(input_y, input_dy, output_z, start, end,
+                                  [one_trans](auto y, auto dy, auto z) { z = dy * (one_trans - y) * y; });
+    };
+    KERNEL_HANDLE_ERROR(elementwise::ParallelRun(ctx, data_num, shard_sigmoid_grad), "SigmoidGrad Compute failed.")
+    return KERNEL_STATUS_OK;
+}
+
 template <typename T>
 uint32_t SigmoidGradCpuKernel::SigmoidGradComputeConj(const CpuKernelContext& ctx)
 {
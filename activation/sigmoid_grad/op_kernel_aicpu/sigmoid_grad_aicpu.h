@@ -29,6 +29,9 @@ private:
     template <typename T>
     uint32_t SigmoidGradCompute(const CpuKernelContext& ctx);
 
+    template <typename T>
+    uint32_t SigmoidGradComputeReal(const CpuKernelContext& ctx);
+
     template <typename T>
     uint32_t SigmoidGradComputeConj(const CpuKernelContext& ctx);
 };
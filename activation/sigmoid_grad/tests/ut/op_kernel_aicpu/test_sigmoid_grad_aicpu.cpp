@@ -158,6 +158,23 @@ TEST_F(TEST_SIGMOIDGRAD_AICPU_UT, FLOAT_LARGE_PARALLEL_SUCC)
     RunSigmoidGradKernel(shapes, data_types, y, dy, expect);
 }
 
+TEST_F(TEST_SIGMOIDGRAD_AICPU_UT, FLOAT16_LARGE_BLOCKS_SUCC)
+{
+    const int64_t num = 100003;
+    vector<DataType> data_types = {DT_FLOAT16, DT_FLOAT16, DT_FLOAT16};
+    vector<vector<int64_t>> shapes = {{num}, {num}, {num}};
+    vector<Eigen::half> y(num);
+    vector<Eigen::half> dy(num);
+    vector<Eigen::half> expect(num);
+    for (int64_t i = 0; i < num; ++i) {
+        y[i] = Eigen::half(static_cast<float>(i % 100) * 0.01f);
+        dy[i] = Eigen::half(static_cast<float>(i % 7) - 3.0f);
+        const float y_val = static_cast<float>(y[i]);
+        expect[i] = Eigen::half(static_cast<float>(dy[i]) * (1.0f - y_val) * y_val);
+    }
+    RunSigmoidGradKernel(shapes, data_types, y, dy, expect);
+}
+
 TEST_F(TEST_SIGMOIDGRAD_AICPU_UT, EMPTY_TENSOR_SUCC)
 {
     vector<DataType> data_types = {DT_FLOAT, DT_FLOAT, DT_FLOAT};
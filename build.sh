@@ -24,7 +24,7 @@ SUPPORTED_SHORT_OPTS="hj:vO:uf:-:"
 
 # 所有支持的长选项
 SUPPORTED_LONG_OPTS=(
-  "help" "ops=" "soc=" "vendor_name=" "build-type=" "cov" "noexec" "noaicpu" "opkernel" "opkernel_aicpu" "opkernel_aicpu_test" "static"
+  "help" "ops=" "soc=" "vendor_name=" "build-type=" "cov" "noexec" "noaicpu" "opkernel" "opkernel_aicpu" "opkernel_aicpu_test" "opkernel_aicpu_benchmark" "static"
    "jit" "pkg" "asan" "make_clean_all" "make_clean" "no_force"
   "ophost" "opgraph" "opapi" "run_example" "example_name=" "genop=" "genop_aicpu=" "experimental" "cann_3rd_lib_path=" "oom" "onnxplugin" "tfplugin" "dump_cce"
   "simulator" "bisheng_flags=" "kernel_template_input=" "module_extension=" "noaclnn" "mssanitizer" "rule_launch=" "ccache=" "torch_extension" "pkg-type="
@@ -406,6 +406,7 @@ usage() {
   echo "    --opkernel build binary kernel"
   echo "    --opkernel_aicpu build aicpu kernel"
   echo "    --opkernel_aicpu_test build and run aicpu opkernel unit tests"
+  echo "    --opkernel_aicpu_benchmark build aicpu opkernel unit tests and benchmark_op_kernel_aicpu"
   echo "    --pkg build run pkg"
   echo "    --jit build run pkg without kernel bin"
   echo "    --torch_extension Build torch_extension whl only, support --ops for single op packaging"
@@ -660,6 +661,9 @@ set_ut_mode() {
   if [[ "$UT_TEST_ALL" == "TRUE" ]] || [[ "$OP_KERNEL_AICPU_UT" == "TRUE" ]]; then
     UT_TARGES+=("${REPOSITORY_NAME}_aicpu_op_kernel_ut")
   fi
+  if [[ "$OP_KERNEL_AICPU_BENCHMARK" == "TRUE" ]]; then
+    UT_TARGES+=("benchmark_op_kernel_aicpu")
+  fi
 }
 
 make_clean() {
@@ -731,6 +735,7 @@ checkopts() {
   TF_PLUGIN=FALSE
   OP_KERNEL_UT=FALSE
   OP_KERNEL_AICPU_UT=FALSE
+  OP_KERNEL_AICPU_BENCHMARK=FALSE
   OP_API=FALSE
   OP_HOST=FALSE
   OP_GRAPH=FALSE
@@ -906,6 +911,11 @@ checkopts() {
           OP_KERNEL_AICPU_UT=TRUE
           ENABLE_TEST=TRUE
           ;;
+        opkernel_aicpu_benchmark)
+          OP_KERNEL_AICPU_UT=TRUE
+          OP_KERNEL_AICPU_BENCHMARK=TRUE
+          ENABLE_TEST=TRUE
+          ;;
         static)
           ENABLE_STATIC=TRUE
           ENABLE_BINARY=TRUE
@@ -1109,6 +1119,7 @@ assemble_cmake_args() {
   CMAKE_ARGS="$CMAKE_ARGS -DOP_API_UT=${OP_API_UT}"
   CMAKE_ARGS="$CMAKE_ARGS -DOP_KERNEL_UT=${OP_KERNEL_UT}"
   CMAKE_ARGS="$CMAKE_ARGS -DOP_KERNEL_AICPU_UT=${OP_KERNEL_AICPU_UT}"
+  CMAKE_ARGS="$CMAKE_ARGS -DOP_KERNEL_AICPU_BENCHMARK=${OP_KERNEL_AICPU_BENCHMARK}"
   CMAKE_ARGS="$CMAKE_ARGS -DUT_TEST_ALL=${UT_TEST_ALL}"
   CMAKE_ARGS="$CMAKE_ARGS -DENABLE_UT_SYMBOLIZE=${ENABLE_UT_SYMBOLIZE}"
   CMAKE_ARGS="$CMAKE_ARGS -DUT_CASE_TIMEOUT=${UT_CASE_TIMEOUT}"
@@ -843,5 +843,27 @@ if(UT_TEST_ALL OR OP_KERNEL_AICPU_UT)
             c_sec
             Eigen3::Eigen
             )
+
+    ## add object: ${opName}_bench_obj, 仅含 kernel 源码且不带 asan 插桩, 由 aicpu 微基准直接链接
+    if(OP_KERNEL_AICPU_BENCHMARK AND KernelFile)
+      add_library(${opName}_bench_obj OBJECT
+              ${KernelFile}
+              )
+      target_compile_options(${opName}_bench_obj PRIVATE
+              -O2
+              )
+      target_include_directories(${opName}_bench_obj PRIVATE
+              ${AICPU_INCLUDE}
+              ${OPBASE_INC_DIRS}
+              ${AICPU_INC_DIRS}
+              ${ASCEND_DIR}/pkg_inc/base
+              )
+      target_link_libraries(${opName}_bench_obj PRIVATE
+              $<BUILD_INTERFACE:intf_llt_pub>
+              c_sec
+              Eigen3::Eigen
+              )
+      set_property(GLOBAL APPEND PROPERTY AICPU_BENCHMARK_KERNEL_OBJS $<TARGET_OBJECTS:${opName}_bench_obj>)
+    endif()
   endfunction()
 endif()
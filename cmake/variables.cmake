@@ -214,6 +214,7 @@ set(AICPU_INCLUDE
   ${NNOPBASE_INCLUDE_DIRS}
   ${HCCL_EXTERNAL_INCLUDE}
   ${OPS_NN_DIR}/common/include/common
+  ${OPS_NN_COMMON_INC}
   ${METADEF_INCLUDE_DIRS}
 )
 
@@ -0,0 +1,176 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file elementwise_block.h
+ * \brief AICPU 逐元素算子公共的分块计算与自适应并行工具
+ *
+ * 计算函数以 Eigen Array 表达式描述, 由 Eigen 完成 exp 等运算的向量化:
+ *   - float / double 直接映射原数据计算;
+ *   - half / bfloat16 按 kBlockSize 分块转换到 fp32 栈缓冲, 块上计算完成后再一次性转换回原类型.
+ * 是否并行不再使用固定元素数门限: 每个调用点(kernel 与数据类型的组合)首次处理超过 kProbeSize 个元素时,
+ * 串行计算首段并计时得到单元素开销并缓存, 之后只按元素数与缓存的开销估算串行耗时, 不再计时.
+ * 估算耗时超过 kParallelMinSerialNs 才切分给多核, 分片数按每片不少于 kMinShardNs 的工作量确定.
+ * 因此门限随数据类型的实际单元素开销变化, 且同一进程内对相同元素数的并行决策固定.
+ */
+
+#ifndef OPS_NN_COMMON_AICPU_ELEMENTWISE_BLOCK_H
+#define OPS_NN_COMMON_AICPU_ELEMENTWISE_BLOCK_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <type_traits>
+
+#include "Eigen/Core"
+#include "cpu_kernel_utils.h"
+#include "status.h"
+
+namespace aicpu {
+namespace elementwise {
+// fp32 缓冲块大小, 单个缓冲 4KB, 常驻 L1
+constexpr int64_t kBlockSize = 1024;
+// 用于估算单元素开销的首段元素数
+constexpr int64_t kProbeSize = 4 * kBlockSize;
+// 剩余串行耗时低于该值时不并行, 与 ParallelFor 的调度开销同量级
+constexpr double kParallelMinSerialNs = 100.0 * 1000.0;
+// 每个分片的最小工作量
+constexpr double kMinShardNs = 25.0 * 1000.0;
+
+// 块上计算使用的类型: 半精度类型提升到 fp32, 其余保持不变
+template <typename T>
+struct ComputeType {
+    using Type = T;
+};
+
+template <>
+struct ComputeType<Eigen::half> {
+    using Type = float;
+};
+
+template <>
+struct ComputeType<Eigen::bfloat16> {
+    using Type = float;
+};
+
+template <typename T>
+using ConstArrayMap = Eigen::Map<const Eigen::Array<T, Eigen::Dynamic, 1>>;
+
+template <typename T>
+using ArrayMap = Eigen::Map<Eigen::Array<T, Eigen::Dynamic, 1>>;
+
+template <typename T, typename Fn>
+void UnaryBlocksImpl(const T* x, T* y, int64_t start, int64_t end, const Fn& fn, std::true_type)
+{
+    fn(ConstArrayMap<T>(x + start, end - start), ArrayMap<T>(y + start, end - start));
+}
+
+template <typename T, typename Fn>
+void UnaryBlocksImpl(const T* x, T* y, int64_t start, int64_t end, const Fn& fn, std::false_type)
+{
+    using C = typename ComputeType<T>::Type;
+    alignas(64) C xBuf[kBlockSize];
+    alignas(64) C yBuf[kBlockSize];
+    for (int64_t pos = start; pos < end; pos += kBlockSize) {
+        const int64_t num = std::min(kBlockSize, end - pos);
+        ArrayMap<C>(xBuf, num) = ConstArrayMap<T>(x + pos, num).template cast<C>();
+        fn(ConstArrayMap<C>(xBuf, num), ArrayMap<C>(yBuf, num));
+        ArrayMap<T>(y + pos, num) = ConstArrayMap<C>(yBuf, num).template cast<T>();
+    }
+}
+
+// 计算 y[start, end) = fn(x[start, end)), fn 形如 [](auto x, auto y) { y = ...; }
+template <typename T, typename Fn>
+void UnaryBlocks(const T* x, T* y, int64_t start, int64_t end, const Fn& fn)
+{
+    UnaryBlocksImpl(x, y, start, end, fn, std::is_same<T, typename ComputeType<T>::Type>());
+}
+
+template <typename T, typename Fn>
+void BinaryBlocksImpl(const T* a, const T* b, T* y, int64_t start, int64_t end, const Fn& fn, std::true_type)
+{
+    fn(ConstArrayMap<T>(a + start, end - start), ConstArrayMap<T>(b + start, end - start),
+       ArrayMap<T>(y + start, end - start));
+}
+
+template <typename T, typename Fn>
+void BinaryBlocksImpl(const T* a, const T* b, T* y, int64_t start, int64_t end, const Fn& fn, std::false_type)
+{
+    using C = typename ComputeType<T>::Type;
+    alignas(64) C aBuf[kBlockSize];
+    alignas(64) C bBuf[kBlockSize];
+    alignas(64) C yBuf[kBlockSize];
+    for (int64_t pos = start; pos < end; pos += kBlockSize) {
+        const int64_t num = std::min(kBlockSize, end - pos);
+        ArrayMap<C>(aBuf, num) = ConstArrayMap<T>(a + pos, num).template cast<C>();
+        ArrayMap<C>(bBuf, num) = ConstArrayMap<T>(b + pos, num).template cast<C>();
+        fn(ConstArrayMap<C>(aBuf, num), ConstArrayMap<C>(bBuf, num), ArrayMap<C>(yBuf, num));
+        ArrayMap<T>(y + pos, num) = ConstArrayMap<C>(yBuf, num).template cast<T>();
+    }
+}
+
+// 计算 y[start, end) = fn(a[start, end), b[start, end)), fn 形如 [](auto a, auto b, auto y) { y = ...; }
+template <typename T, typename Fn>
+void BinaryBlocks(const T* a, const T* b, T* y, int64_t start, int64_t end, const Fn& fn)
+{
+    BinaryBlocksImpl(a, b, y, start, end, fn, std::is_same<T, typename ComputeType<T>::Type>());
+}
+
+// 调用点的单元素开销(ns), 0 表示尚未测量; 以 Runner 类型区分调用点, 不同 kernel 与数据类型各自缓存
+template <typename Runner>
+std::atomic<double>& CachedElementNs()
+{
+    static std::atomic<double> elementNs(0.0);
+    return elementNs;
+}
+
+// 按单元素开销决定是否并行执行 run(start, end), 覆盖 [0, total)
+template <typename Runner>
+uint32_t ParallelRun(const CpuKernelContext& ctx, int64_t total, const Runner& run)
+{
+    // 不超过一个测量段时并行收益不足以覆盖调度开销, 直接串行且不计时
+    if (total <= kProbeSize) {
+        run(0, total);
+        return KERNEL_STATUS_OK;
+    }
+
+    std::atomic<double>& cache = CachedElementNs<Runner>();
+    double elementNs = cache.load(std::memory_order_relaxed);
+    int64_t done = 0;
+    if (elementNs <= 0.0) {
+        const auto begin = std::chrono::steady_clock::now();
+        run(0, kProbeSize);
+        const double probeNs =
+            std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - begin).count();
+        elementNs = std::max(probeNs, 1.0) / static_cast<double>(kProbeSize);
+        cache.store(elementNs, std::memory_order_relaxed);
+        done = kProbeSize;
+    }
+
+    const int64_t remain = total - done;
+    const double remainNs = elementNs * static_cast<double>(remain);
+    const int64_t cores = std::max<int64_t>(1, static_cast<int64_t>(CpuKernelUtils::GetCPUNum(ctx)));
+    const int64_t shards = std::min(cores, static_cast<int64_t>(remainNs / kMinShardNs));
+    if (remainNs < kParallelMinSerialNs || shards <= 1) {
+        run(done, total);
+        return KERNEL_STATUS_OK;
+    }
+
+    // 分片按 kBlockSize 对齐, 避免半精度路径产生零碎的尾块
+    int64_t perUnit = (remain + shards - 1) / shards;
+    perUnit = (perUnit + kBlockSize - 1) / kBlockSize * kBlockSize;
+    return CpuKernelUtils::ParallelFor(
+        ctx, remain, perUnit, [&run, done](int64_t start, int64_t end) { run(done + start, done + end); });
+}
+} // namespace elementwise
+} // namespace aicpu
+
+#endif // OPS_NN_COMMON_AICPU_ELEMENTWISE_BLOCK_H
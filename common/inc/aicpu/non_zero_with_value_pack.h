@@ -0,0 +1,148 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file non_zero_with_value_pack.h
+ * \brief NonZeroWithValueShape(V2) AICPU 算子公共的输出紧排实现
+ *
+ * NonZeroWithValue 以静态 max-size 输出 value[numel] 与坐标主序的 index[2, numel]
+ * (前 numel 个为行号, 后 numel 个为列号), 有效长度为 count. 紧排后:
+ *   out_value = value[0, count), out_index = [行号 count 个, 列号 count 个].
+ * 各段拷贝按字节切块后一次 ParallelFor 完成; 输出与输入同址的段直接跳过,
+ * count == numel 时 index 已紧排, 整体一次拷贝; 同址且区间重叠的列号段串行 memmove.
+ */
+
+#ifndef OPS_NN_COMMON_AICPU_NON_ZERO_WITH_VALUE_PACK_H
+#define OPS_NN_COMMON_AICPU_NON_ZERO_WITH_VALUE_PACK_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "cpu_kernel_utils.h"
+#include "log.h"
+#include "securec.h"
+#include "status.h"
+#include "utils/kernel_util.h"
+
+namespace aicpu {
+namespace nonzero {
+// 总拷贝量小于该字节数时串行执行
+constexpr int64_t kPackParallelBytes = 256 * 1024;
+// 并行时每个拷贝块的最小字节数
+constexpr int64_t kPackMinChunkBytes = 64 * 1024;
+
+struct CopySegment {
+    uint8_t* dst;
+    const uint8_t* src;
+    int64_t bytes;
+};
+
+inline bool IsOverlapped(const CopySegment& seg)
+{
+    return (seg.dst < seg.src + seg.bytes) && (seg.src < seg.dst + seg.bytes);
+}
+
+inline uint32_t CopySegments(const CpuKernelContext& ctx, const std::vector<CopySegment>& segments)
+{
+    std::vector<CopySegment> pending;
+    int64_t totalBytes = 0;
+    for (const auto& seg : segments) {
+        if (seg.bytes <= 0 || seg.dst == seg.src) {
+            continue;
+        }
+        if (IsOverlapped(seg)) {
+            // 同址输出中列号段前移, 区间重叠时分块并行会读到已覆盖的数据
+            (void)std::memmove(seg.dst, seg.src, static_cast<size_t>(seg.bytes));
+            continue;
+        }
+        pending.push_back(seg);
+        totalBytes += seg.bytes;
+    }
+    if (pending.empty()) {
+        return KERNEL_STATUS_OK;
+    }
+
+    const int64_t cores = std::max<int64_t>(1, static_cast<int64_t>(CpuKernelUtils::GetCPUNum(ctx)));
+    const int64_t chunkBytes =
+        (totalBytes < kPackParallelBytes || cores == 1) ?
+            totalBytes :
+            std::max(kPackMinChunkBytes, (totalBytes + cores - 1) / cores);
+    std::vector<CopySegment> chunks;
+    for (const auto& seg : pending) {
+        for (int64_t offset = 0; offset < seg.bytes; offset += chunkBytes) {
+            chunks.push_back({seg.dst + offset, seg.src + offset, std::min(chunkBytes, seg.bytes - offset)});
+        }
+    }
+
+    std::atomic<bool> copyOk(true);
+    auto copyChunks = [&](int64_t begin, int64_t end) {
+        for (int64_t i = begin; i < end; ++i) {
+            const CopySegment& chunk = chunks[i];
+            auto memRet = memcpy_s(chunk.dst, static_cast<size_t>(chunk.bytes), chunk.src,
+                                   static_cast<size_t>(chunk.bytes));
+            if (memRet != EOK) {
+                KERNEL_LOG_ERROR("Pack memory copy failed[%d], copy size is %ld.", memRet, chunk.bytes);
+                copyOk = false;
+                return;
+            }
+        }
+    };
+    const int64_t chunkNum = static_cast<int64_t>(chunks.size());
+    if (chunkNum == 1) {
+        copyChunks(0, 1);
+    } else {
+        KERNEL_HANDLE_ERROR(CpuKernelUtils::ParallelFor(ctx, chunkNum, 1, copyChunks), "Pack chunks failed.");
+    }
+    return copyOk ? KERNEL_STATUS_OK : KERNEL_STATUS_INNER_ERROR;
+}
+
+// 将 max-size 的 value/index 按 count 紧排到输出, 并设置输出 shape 为 [count] 与 [2, count]
+inline uint32_t PackNonZeroWithValue(const CpuKernelContext& ctx, const char* opName, Tensor* value, Tensor* index,
+                                     int32_t countNum, Tensor* outValue, Tensor* outIndex)
+{
+    const int64_t count = static_cast<int64_t>(countNum);
+    const int64_t valueNum = value->NumElements();
+    const int64_t indexStride = index->NumElements() / 2;
+    KERNEL_CHECK_FALSE((count >= 0 && count <= valueNum && count <= indexStride), KERNEL_STATUS_PARAM_INVALID,
+                       "[%s] count[%ld] must be in [0, %ld].", opName, count, std::min(valueNum, indexStride));
+
+    outValue->GetTensorShape()->SetDimSizes({count});
+    outIndex->GetTensorShape()->SetDimSizes({2, count});
+    if (count == 0) {
+        return KERNEL_STATUS_OK;
+    }
+
+    auto* valueData = static_cast<const uint8_t*>(value->GetData());
+    auto* indexData = static_cast<const uint8_t*>(index->GetData());
+    auto* outValueData = static_cast<uint8_t*>(outValue->GetData());
+    auto* outIndexData = static_cast<uint8_t*>(outIndex->GetData());
+    KERNEL_CHECK_NULLPTR(valueData, KERNEL_STATUS_PARAM_INVALID, "[%s] get input value failed.", opName);
+    KERNEL_CHECK_NULLPTR(indexData, KERNEL_STATUS_PARAM_INVALID, "[%s] get input index failed.", opName);
+    KERNEL_CHECK_NULLPTR(outValueData, KERNEL_STATUS_PARAM_INVALID, "[%s] get output value failed.", opName);
+    KERNEL_CHECK_NULLPTR(outIndexData, KERNEL_STATUS_PARAM_INVALID, "[%s] get output index failed.", opName);
+
+    const int64_t valueBytes = count * GetSizeByDataType(value->GetDataType());
+    const int64_t planeBytes = count * static_cast<int64_t>(sizeof(int32_t));
+    std::vector<CopySegment> segments = {{outValueData, valueData, valueBytes}};
+    if (count == indexStride) {
+        segments.push_back({outIndexData, indexData, planeBytes * 2});
+    } else {
+        segments.push_back({outIndexData, indexData, planeBytes});
+        segments.push_back(
+            {outIndexData + planeBytes, indexData + indexStride * static_cast<int64_t>(sizeof(int32_t)), planeBytes});
+    }
+    return CopySegments(ctx, segments);
+}
+} // namespace nonzero
+} // namespace aicpu
+#endif // OPS_NN_COMMON_AICPU_NON_ZERO_WITH_VALUE_PACK_H
@@ -0,0 +1,246 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file parallel_scatter.h
+ * \brief AICPU scatter 类算子公共的 owner-computes 并行执行引擎
+ *
+ * 输出按行(长度为 slice_size 的连续片段)切分给各线程, 每个线程只写自己拥有的行:
+ *   1. Build: 并行计算每个 update 单元对应的输出行号(及 updates 行号), 同时完成越界校验;
+ *   2. Apply: 按所属行分片做稳定的计数排序, 每个分片内按索引顺序回放, 无需原子操作;
+ *      行很宽时再按列切块, 以应对重复索引集中在少数行的场景.
+ * 同一输出元素上的更新始终按索引顺序执行, 结果与串行实现逐位一致;
+ * last_writer_wins 为 true 时分片内逆序回放并跳过已写过的行, 重复索引越多越省.
+ */
+
+#ifndef OPS_NN_COMMON_AICPU_PARALLEL_SCATTER_H
+#define OPS_NN_COMMON_AICPU_PARALLEL_SCATTER_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include "cpu_kernel_utils.h"
+#include "log.h"
+#include "status.h"
+
+namespace aicpu {
+namespace scatter {
+// 小于该元素数时串行执行, 避免分桶与线程调度开销
+constexpr int64_t kParallelScatterMinWork = 32 * 1024;
+// 每个核对应的行分片数, 用于缓解行分布不均
+constexpr int64_t kScatterShardsPerCore = 4;
+// 按列切块时每块的最小元素数
+constexpr int64_t kScatterMinColumnBlock = 1024;
+
+template <typename T>
+struct ScatterAssign {
+    void operator()(T& dst, const T& src) const
+    {
+        dst = src;
+    }
+};
+
+template <typename T>
+struct ScatterAdd {
+    void operator()(T& dst, const T& src) const
+    {
+        dst += src;
+    }
+};
+
+template <>
+struct ScatterAdd<bool> {
+    void operator()(bool& dst, const bool& src) const
+    {
+        dst = dst || src;
+    }
+};
+
+template <typename T>
+struct ScatterMul {
+    void operator()(T& dst, const T& src) const
+    {
+        dst *= src;
+    }
+};
+
+template <>
+struct ScatterMul<bool> {
+    void operator()(bool& dst, const bool& src) const
+    {
+        dst = dst && src;
+    }
+};
+
+template <typename T>
+struct ScatterMax {
+    void operator()(T& dst, const T& src) const
+    {
+        if (dst < src) {
+            dst = src;
+        }
+    }
+};
+
+template <typename T>
+struct ScatterMin {
+    void operator()(T& dst, const T& src) const
+    {
+        if (dst > src) {
+            dst = src;
+        }
+    }
+};
+
+class ScatterPlan {
+public:
+    // num_units: update 单元个数; num_rows: 输出行数; slice_size: 每行元素个数
+    // explicit_src 为 false 时第 i 个单元读取 updates 的第 i 行
+    ScatterPlan(int64_t num_units, int64_t num_rows, int64_t slice_size, bool explicit_src = false)
+        : num_units_(num_units), num_rows_(num_rows), slice_size_(slice_size), explicit_src_(explicit_src)
+    {}
+
+    // locate(unit, dst_row, src_row) -> uint32_t, 负责索引校验与报错; src_row 预置为 unit
+    template <typename Locate>
+    uint32_t Build(const CpuKernelContext& ctx, Locate locate)
+    {
+        dst_rows_.assign(static_cast<size_t>(num_units_), 0);
+        if (explicit_src_) {
+            src_rows_.assign(static_cast<size_t>(num_units_), 0);
+        }
+        std::atomic<uint32_t> build_ret(KERNEL_STATUS_OK);
+        auto locate_shard = [&](int64_t start, int64_t end) {
+            for (int64_t i = start; i < end; ++i) {
+                if (build_ret != KERNEL_STATUS_OK) {
+                    return;
+                }
+                int64_t dst_row = 0;
+                int64_t src_row = i;
+                uint32_t ret = locate(i, dst_row, src_row);
+                if (ret != KERNEL_STATUS_OK) {
+                    build_ret = ret;
+                    return;
+                }
+                dst_rows_[i] = dst_row;
+                if (explicit_src_) {
+                    src_rows_[i] = src_row;
+                }
+            }
+        };
+        if (num_units_ < kParallelScatterMinWork) {
+            locate_shard(0, num_units_);
+        } else {
+            KERNEL_HANDLE_ERROR(CpuKernelUtils::ParallelFor(ctx, num_units_, 1, locate_shard),
+                                "Locate scatter indices failed!");
+        }
+        return build_ret;
+    }
+
+    template <typename T, typename Reducer>
+    uint32_t Apply(const CpuKernelContext& ctx, const T* updates, T* output, Reducer reducer,
+                   bool last_writer_wins = false) const
+    {
+        if (num_units_ == 0 || slice_size_ == 0) {
+            return KERNEL_STATUS_OK;
+        }
+        KERNEL_CHECK_FALSE((num_rows_ > 0), KERNEL_STATUS_PARAM_INVALID, "Scatter output rows[%ld] must be positive.",
+                           num_rows_);
+        const int64_t core_num = std::max<int64_t>(1, static_cast<int64_t>(CpuKernelUtils::GetCPUNum(ctx)));
+        if (num_units_ * slice_size_ < kParallelScatterMinWork || core_num == 1) {
+            for (int64_t i = 0; i < num_units_; ++i) {
+                ApplyUnit(updates, output, reducer, i, 0, slice_size_);
+            }
+            return KERNEL_STATUS_OK;
+        }
+
+        const int64_t max_tasks = core_num * kScatterShardsPerCore;
+        const int64_t shard_target = std::min(num_rows_, max_tasks);
+        const int64_t rows_per_shard = (num_rows_ + shard_target - 1) / shard_target;
+        const int64_t shard_num = (num_rows_ + rows_per_shard - 1) / rows_per_shard;
+        std::vector<int64_t> shard_begin;
+        std::vector<int64_t> order;
+        BucketByShard(rows_per_shard, shard_num, shard_begin, order);
+
+        const int64_t block_num =
+            std::max<int64_t>(1, std::min(slice_size_ / kScatterMinColumnBlock, max_tasks / shard_num));
+        const int64_t block_size = (slice_size_ + block_num - 1) / block_num;
+        auto apply_task = [&](int64_t start, int64_t end) {
+            for (int64_t task = start; task < end; ++task) {
+                const int64_t shard = task / block_num;
+                const int64_t col_begin = (task % block_num) * block_size;
+                const int64_t col_end = std::min(slice_size_, col_begin + block_size);
+                if (shard_begin[shard] == shard_begin[shard + 1] || col_begin >= col_end) {
+                    continue;
+                }
+                if (!last_writer_wins) {
+                    for (int64_t k = shard_begin[shard]; k < shard_begin[shard + 1]; ++k) {
+                        ApplyUnit(updates, output, reducer, order[k], col_begin, col_end);
+                    }
+                    continue;
+                }
+                const int64_t row_base = shard * rows_per_shard;
+                std::vector<uint8_t> written(static_cast<size_t>(std::min(rows_per_shard, num_rows_ - row_base)), 0);
+                for (int64_t k = shard_begin[shard + 1] - 1; k >= shard_begin[shard]; --k) {
+                    uint8_t& flag = written[dst_rows_[order[k]] - row_base];
+                    if (flag == 0) {
+                        flag = 1;
+                        ApplyUnit(updates, output, reducer, order[k], col_begin, col_end);
+                    }
+                }
+            }
+        };
+        KERNEL_HANDLE_ERROR(CpuKernelUtils::ParallelFor(ctx, shard_num * block_num, 1, apply_task),
+                            "Apply scatter updates failed!");
+        return KERNEL_STATUS_OK;
+    }
+
+private:
+    template <typename T, typename Reducer>
+    void ApplyUnit(const T* updates, T* output, const Reducer& reducer, int64_t unit, int64_t col_begin,
+                   int64_t col_end) const
+    {
+        T* dst = output + dst_rows_[unit] * slice_size_;
+        const T* src = updates + (explicit_src_ ? src_rows_[unit] : unit) * slice_size_;
+        for (int64_t j = col_begin; j < col_end; ++j) {
+            reducer(dst[j], src[j]);
+        }
+    }
+
+    // 稳定计数排序, 保证分片内单元仍按索引顺序排列
+    void BucketByShard(int64_t rows_per_shard, int64_t shard_num, std::vector<int64_t>& shard_begin,
+                       std::vector<int64_t>& order) const
+    {
+        shard_begin.assign(static_cast<size_t>(shard_num + 1), 0);
+        for (int64_t i = 0; i < num_units_; ++i) {
+            ++shard_begin[dst_rows_[i] / rows_per_shard + 1];
+        }
+        for (int64_t s = 0; s < shard_num; ++s) {
+            shard_begin[s + 1] += shard_begin[s];
+        }
+        std::vector<int64_t> cursor(shard_begin.begin(), shard_begin.end() - 1);
+        order.assign(static_cast<size_t>(num_units_), 0);
+        for (int64_t i = 0; i < num_units_; ++i) {
+            order[cursor[dst_rows_[i] / rows_per_shard]++] = i;
+        }
+    }
+
+    int64_t num_units_;
+    int64_t num_rows_;
+    int64_t slice_size_;
+    bool explicit_src_;
+    std::vector<int64_t> dst_rows_;
+    std::vector<int64_t> src_rows_;
+};
+} // namespace scatter
+} // namespace aicpu
+
+#endif // OPS_NN_COMMON_AICPU_PARALLEL_SCATTER_H
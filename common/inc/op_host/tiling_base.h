@@ -21,6 +21,7 @@
 #include "tiling/platform/platform_ascendc.h"
 #include "platform/soc_spec.h"
 #include "log/log.h"
+#include "op_host/tiling_trace.h"
 
 #ifdef ASCENDC_OP_TEST
 #define ASCENDC_EXTERN_C extern "C"
@@ -69,36 +70,10 @@ public:
     //     3、GRAPH_PARAM_INVALID: 本类不支持，需要继续往下执行其他Tiling类的实现
     ge::graphStatus DoTiling()
     {
-        auto ret = GetShapeAttrsInfo();
-        if (ret != ge::GRAPH_SUCCESS) {
-            return ret;
-        }
-        ret = GetPlatformInfo();
-        if (ret != ge::GRAPH_SUCCESS) {
-            return ret;
-        }
-        if (!IsCapable()) {
-            return ge::GRAPH_PARAM_INVALID;
-        }
-        ret = DoOpTiling();
-        if (ret != ge::GRAPH_SUCCESS) {
-            return ret;
-        }
-        ret = DoLibApiTiling();
-        if (ret != ge::GRAPH_SUCCESS) {
-            return ret;
-        }
-        ret = GetWorkspaceSize();
-        if (ret != ge::GRAPH_SUCCESS) {
-            return ret;
-        }
-        ret = PostTiling();
-        if (ret != ge::GRAPH_SUCCESS) {
-            return ret;
-        }
-        context_->SetTilingKey(GetTilingKey());
-        DumpTilingInfo();
-        return ge::GRAPH_SUCCESS;
+        traceCapable_ = false;
+        auto ret = DoTilingPhases();
+        TilingTraceTemplateResult(traceCapable_, ret);
+        return ret;
     }
 
     // 更新 context
@@ -219,6 +194,67 @@ protected:
     uint64_t workspaceSize_{0};
     uint64_t tilingKey_{0};
     AiCoreParams aicoreParams_;
+
+private:
+    // 各阶段与原 DoTiling 流程一致, 仅在开启 tiling 决策追踪时额外记录耗时
+    ge::graphStatus DoTilingPhases()
+    {
+        ge::graphStatus ret;
+        {
+            TilingTracePhaseTimer timer(TilingTracePhase::SHAPE_ATTRS);
+            ret = GetShapeAttrsInfo();
+        }
+        if (ret != ge::GRAPH_SUCCESS) {
+            return ret;
+        }
+        {
+            TilingTracePhaseTimer timer(TilingTracePhase::PLATFORM);
+            ret = GetPlatformInfo();
+        }
+        if (ret != ge::GRAPH_SUCCESS) {
+            return ret;
+        }
+        {
+            TilingTracePhaseTimer timer(TilingTracePhase::IS_CAPABLE);
+            traceCapable_ = IsCapable();
+        }
+        if (!traceCapable_) {
+            return ge::GRAPH_PARAM_INVALID;
+        }
+        {
+            TilingTracePhaseTimer timer(TilingTracePhase::OP_TILING);
+            ret = DoOpTiling();
+        }
+        if (ret != ge::GRAPH_SUCCESS) {
+            return ret;
+        }
+        {
+            TilingTracePhaseTimer timer(TilingTracePhase::LIB_API_TILING);
+            ret = DoLibApiTiling();
+        }
+        if (ret != ge::GRAPH_SUCCESS) {
+            return ret;
+        }
+        {
+            TilingTracePhaseTimer timer(TilingTracePhase::WORKSPACE);
+            ret = GetWorkspaceSize();
+        }
+        if (ret != ge::GRAPH_SUCCESS) {
+            return ret;
+        }
+        {
+            TilingTracePhaseTimer timer(TilingTracePhase::POST_TILING);
+            ret = PostTiling();
+        }
+        if (ret != ge::GRAPH_SUCCESS) {
+            return ret;
+        }
+        context_->SetTilingKey(GetTilingKey());
+        DumpTilingInfo();
+        return ge::GRAPH_SUCCESS;
+    }
+
+    bool traceCapable_ = false;
 };
 
 } // namespace Optiling
@@ -20,6 +20,7 @@
 #include <memory>
 #include "exe_graph/runtime/tiling_context.h"
 #include "op_host/tiling_base.h"
+#include "op_host/tiling_trace.h"
 #include "op_host/static_register_symbol.h"
 #include "platform/platform_infos_def.h"
 #include "log/log.h"
@@ -92,6 +93,7 @@ public:
 
     ge::graphStatus DoTilingImpl(gert::TilingContext* context)
     {
+        TilingTraceScope traceScope(context);
         int32_t arch = (int32_t)NpuArch::DAV_RESV;
         const char* opType = context->GetNodeType();
         fe::PlatFormInfos* platformInfoPtr = context->GetPlatformInfo();
@@ -111,9 +113,11 @@ public:
         for (auto it = tilingTemplateRegistryMap.begin(); it != tilingTemplateRegistryMap.end(); ++it) {
             auto tilingTemplate = it->second(context);
             if (tilingTemplate != nullptr) {
+                traceScope.BeginTemplate(it->first);
                 ge::graphStatus status = tilingTemplate->DoTiling();
                 if (status != ge::GRAPH_PARAM_INVALID) {
                     OP_LOGD(context, "Do general op tiling success priority=%d", it->first);
+                    traceScope.End(status);
                     return status;
                 }
                 OP_LOGD(context, "Ignore general op tiling priority=%d", it->first);
@@ -125,6 +129,7 @@ public:
 
     ge::graphStatus DoTilingImpl(gert::TilingContext* context, const std::vector<int32_t>& priorities)
     {
+        TilingTraceScope traceScope(context);
         int32_t arch = static_cast<int32_t>(NpuArch::DAV_RESV);
         const char* opType = context->GetNodeType();
         if (opType == nullptr) {
@@ -152,13 +157,16 @@ public:
             if (tilingCaseIter != tilingTemplateRegistryMap.end()) {
                 auto templateFunc = tilingCaseIter->second(context);
                 if (templateFunc != nullptr) {
+                    traceScope.BeginTemplate(priorityId);
                     ge::graphStatus status = templateFunc->DoTiling();
                     if (status == ge::GRAPH_SUCCESS) {
                         OP_LOGD(context, "Do general op tiling success priority=%d", priorityId);
+                        traceScope.End(status);
                         return status;
                     }
                     if (status != ge::GRAPH_PARAM_INVALID) {
                         OP_LOGD(context, "Do op tiling failed");
+                        traceScope.End(status);
                         return status;
                     }
                     OP_LOGD(context, "Ignore general op tiling priority=%d", priorityId);
@@ -170,6 +178,7 @@ public:
 
     ge::graphStatus DoTilingImpl(gert::TilingContext* context, const std::vector<int32_t>& priorities, int32_t arch)
     {
+        TilingTraceScope traceScope(context);
         const char* opType = context->GetNodeType();
         if (opType == nullptr) {
             opType = "Unknown op";
@@ -180,13 +189,16 @@ public:
             if (tilingCaseIter != tilingTemplateRegistryMap.end()) {
                 auto templateFunc = tilingCaseIter->second(context);
                 if (templateFunc != nullptr) {
+                    traceScope.BeginTemplate(priorityId);
                     ge::graphStatus status = templateFunc->DoTiling();
                     if (status == ge::GRAPH_SUCCESS) {
                         OP_LOGD(context, "Do general op tiling success priority=%d", priorityId);
+                        traceScope.End(status);
                         return status;
                     }
                     if (status != ge::GRAPH_PARAM_INVALID) {
                         OP_LOGD(context, "Do op tiling failed");
+                        traceScope.End(status);
                         return status;
                     }
                     OP_LOGD(context, "Ignore general op tiling priority=%d", priorityId);
@@ -278,6 +290,7 @@ public:
 
     ge::graphStatus DoTilingImpl(gert::TilingContext* context)
     {
+        TilingTraceScope traceScope(context);
         int32_t soc_version = (int32_t)platform_ascendc::SocVersion::RESERVED_VERSION;
         const char* op_type = context->GetNodeType();
         fe::PlatFormInfos* platformInfoPtr = context->GetPlatformInfo();
@@ -300,9 +313,11 @@ public:
         for (auto it = tilingTemplateRegistryMap.begin(); it != tilingTemplateRegistryMap.end(); ++it) {
             auto tilingTemplate = it->second(context);
             if (tilingTemplate != nullptr) {
+                traceScope.BeginTemplate(it->first);
                 ge::graphStatus status = tilingTemplate->DoTiling();
                 if (status != ge::GRAPH_PARAM_INVALID) {
                     OP_LOGD(context, "Do general op tiling success priority=%d", it->first);
+                    traceScope.End(status);
                     return status;
                 }
                 OP_LOGD(context, "Ignore general op tiling priority=%d", it->first);
@@ -314,6 +329,7 @@ public:
 
     ge::graphStatus DoTilingImpl(gert::TilingContext* context, const std::vector<int32_t>& priorities)
     {
+        TilingTraceScope traceScope(context);
         int32_t soc_version;
         const char* op_type = context->GetNodeType();
         auto platformInfoPtr = context->GetPlatformInfo();
@@ -335,9 +351,11 @@ public:
             if (tilingCaseIter != tilingTemplateRegistryMap.end()) {
                 auto templateFunc = tilingCaseIter->second(context);
                 if (templateFunc != nullptr) {
+                    traceScope.BeginTemplate(priority_id);
                     ge::graphStatus status = templateFunc->DoTiling();
                     if (status == ge::GRAPH_SUCCESS) {
                         OP_LOGD(context, "Do general op tiling success priority=%d", priority_id);
+                        traceScope.End(status);
                         return status;
                     }
                     OP_LOGD(context, "Ignore general op tiling priority=%d", priority_id);
@@ -422,14 +440,17 @@ public:
 
     ge::graphStatus DoTilingImpl(gert::TilingContext* context)
     {
+        TilingTraceScope traceScope(context);
         const char* op_type = context->GetNodeType();
         auto tilingTemplateRegistryMap = GetTilingTemplates(op_type);
         for (auto it = tilingTemplateRegistryMap.begin(); it != tilingTemplateRegistryMap.end(); ++it) {
             auto tilingTemplate = it->second(context);
             if (tilingTemplate != nullptr) {
+                traceScope.BeginTemplate(it->first);
                 ge::graphStatus status = tilingTemplate->DoTiling();
                 if (status != ge::GRAPH_PARAM_INVALID) {
                     OP_LOGD(context, "Do general op tiling success priority=%d", it->first);
+                    traceScope.End(status);
                     return status;
                 }
                 OP_LOGD(context, "Ignore general op tiling priority=%d", it->first);
@@ -441,18 +462,22 @@ public:
 
     ge::graphStatus DoTilingImpl(gert::TilingContext* context, const std::vector<int32_t>& priorities)
     {
+        TilingTraceScope traceScope(context);
         const char* op_type = context->GetNodeType();
         auto tilingTemplateRegistryMap = GetTilingTemplates(op_type);
         for (auto priorityId : priorities) {
             auto templateFunc = tilingTemplateRegistryMap[priorityId](context);
             if (templateFunc != nullptr) {
+                traceScope.BeginTemplate(priorityId);
                 ge::graphStatus status = templateFunc->DoTiling();
                 if (status == ge::GRAPH_SUCCESS) {
                     OP_LOGD(context, "Do general op tiling success priority=%d", priorityId);
+                    traceScope.End(status);
                     return status;
                 }
                 if (status != ge::GRAPH_PARAM_INVALID) {
                     OP_LOGD(context, "Do op tiling failed");
+                    traceScope.End(status);
                     return status;
                 }
                 OP_LOGD(context, "Ignore general op tiling priority=%d", priorityId);
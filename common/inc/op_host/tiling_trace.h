@@ -0,0 +1,390 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file tiling_trace.h
+ * \brief tiling 决策结构化追踪: 记录每次 tiling 尝试过的模板、拒绝原因、最终 tiling key 与各阶段 host 耗时
+ *
+ * 默认关闭, 设置环境变量 OPS_NN_TILING_TRACE=1 开启. 记录写入环形缓冲区 (容量 OPS_NN_TILING_TRACE_CAPACITY,
+ * 默认 1024 条), 可通过 TilingTraceBuffer::DumpJsonLines 导出; 设置 OPS_NN_TILING_TRACE_FILE 时进程退出前自动导出.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+#include <exe_graph/runtime/tiling_context.h>
+#include <graph/utils/type_utils.h>
+#include "log/log.h"
+
+namespace Ops {
+namespace NN {
+namespace Optiling {
+
+enum class TilingTracePhase : size_t {
+    SHAPE_ATTRS = 0,
+    PLATFORM,
+    IS_CAPABLE,
+    OP_TILING,
+    LIB_API_TILING,
+    WORKSPACE,
+    POST_TILING,
+    PHASE_NUM
+};
+
+constexpr size_t TILING_TRACE_PHASE_NUM = static_cast<size_t>(TilingTracePhase::PHASE_NUM);
+constexpr size_t TILING_TRACE_DEFAULT_CAPACITY = 1024;
+
+struct TilingTraceTemplate {
+    int32_t priority = -1;
+    bool capable = false;
+    int32_t status = ge::GRAPH_FAILED;
+    std::string rejectReason;
+    std::array<uint64_t, TILING_TRACE_PHASE_NUM> phaseUs{};
+};
+
+struct TilingTraceRecord {
+    uint64_t seq = 0;
+    std::string opType;
+    std::string nodeName;
+    std::string inputSignature;
+    std::vector<TilingTraceTemplate> templates;
+    int32_t chosenPriority = -1;
+    int64_t tilingKey = -1;
+    uint64_t workspaceSize = 0;
+    uint64_t blockDim = 0;
+    int32_t status = ge::GRAPH_FAILED;
+    uint64_t totalUs = 0;
+
+    nlohmann::json ToJson() const
+    {
+        static const char* const phaseNames[TILING_TRACE_PHASE_NUM] = {
+            "shape_attrs", "platform", "is_capable", "op_tiling", "lib_api_tiling", "workspace", "post_tiling"};
+        nlohmann::json result = {{"seq", seq},
+                                 {"op_type", opType},
+                                 {"node", nodeName},
+                                 {"inputs", inputSignature},
+                                 {"chosen_priority", chosenPriority},
+                                 {"tiling_key", tilingKey},
+                                 {"workspace_size", workspaceSize},
+                                 {"block_dim", blockDim},
+                                 {"status", status},
+                                 {"total_us", totalUs},
+                                 {"templates", nlohmann::json::array()}};
+        for (const auto& item : templates) {
+            nlohmann::json phases = nlohmann::json::object();
+            for (size_t i = 0; i < TILING_TRACE_PHASE_NUM; i++) {
+                if (item.phaseUs[i] > 0) {
+                    phases[phaseNames[i]] = item.phaseUs[i];
+                }
+            }
+            result["templates"].push_back({{"priority", item.priority},
+                                           {"capable", item.capable},
+                                           {"status", item.status},
+                                           {"reason", item.rejectReason},
+                                           {"phase_us", phases}});
+        }
+        return result;
+    }
+};
+
+class TilingTraceBuffer {
+public:
+    static TilingTraceBuffer& GetInstance()
+    {
+        static TilingTraceBuffer buffer;
+        return buffer;
+    }
+
+    // 追踪开关可能在 tiling 执行期间被其他线程切换, 仅需保证读写原子, 不与记录本身同步
+    bool IsEnabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+    void SetEnabled(bool enabled) { enabled_.store(enabled, std::memory_order_relaxed); }
+
+    size_t GetCapacity() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return capacity_;
+    }
+
+    void SetCapacity(size_t capacity)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        capacity_ = capacity == 0 ? 1 : capacity;
+        while (records_.size() > capacity_) {
+            records_.pop_front();
+        }
+    }
+
+    void Push(TilingTraceRecord&& record)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        record.seq = nextSeq_++;
+        if (records_.size() >= capacity_) {
+            records_.pop_front();
+        }
+        records_.push_back(std::move(record));
+    }
+
+    std::vector<TilingTraceRecord> Snapshot() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return std::vector<TilingTraceRecord>(records_.begin(), records_.end());
+    }
+
+    void Clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        records_.clear();
+    }
+
+    // 每条记录一行 json, 便于离线按行流式处理
+    void DumpJsonLines(std::ostream& os) const
+    {
+        for (const auto& record : Snapshot()) {
+            os << record.ToJson().dump() << "\n";
+        }
+    }
+
+    bool DumpJsonLines(const std::string& path) const
+    {
+        std::ofstream file(path, std::ios::out | std::ios::app);
+        if (!file.is_open()) {
+            return false;
+        }
+        DumpJsonLines(file);
+        return file.good();
+    }
+
+private:
+    TilingTraceBuffer()
+    {
+        const char* enable = std::getenv("OPS_NN_TILING_TRACE");
+        SetEnabled(enable != nullptr && std::strcmp(enable, "1") == 0);
+        const char* capacity = std::getenv("OPS_NN_TILING_TRACE_CAPACITY");
+        if (capacity != nullptr) {
+            char* end = nullptr;
+            unsigned long long value = std::strtoull(capacity, &end, 10); // 10: decimal
+            if (end != capacity && *end == '\0' && value > 0) {
+                capacity_ = static_cast<size_t>(value);
+            }
+        }
+        const char* file = std::getenv("OPS_NN_TILING_TRACE_FILE");
+        if (file != nullptr) {
+            dumpPath_ = file;
+        }
+    }
+
+    ~TilingTraceBuffer()
+    {
+        if (IsEnabled() && !dumpPath_.empty()) {
+            (void)DumpJsonLines(dumpPath_);
+        }
+    }
+
+    std::atomic<bool> enabled_{false};
+    size_t capacity_ = TILING_TRACE_DEFAULT_CAPACITY;
+    uint64_t nextSeq_ = 0;
+    std::string dumpPath_;
+    std::deque<TilingTraceRecord> records_;
+    mutable std::mutex mutex_;
+};
+
+// 一次算子 tiling 调用的追踪范围, 由注册表 DoTilingImpl 创建; 未开启追踪时不做任何记录
+class TilingTraceScope {
+public:
+    explicit TilingTraceScope(gert::TilingContext* context) : context_(context)
+    {
+        if (context_ == nullptr || !TilingTraceBuffer::GetInstance().IsEnabled()) {
+            return;
+        }
+        active_ = true;
+        start_ = std::chrono::steady_clock::now();
+        const char* opType = context_->GetNodeType();
+        const char* nodeName = context_->GetNodeName();
+        record_.opType = opType == nullptr ? "" : opType;
+        record_.nodeName = nodeName == nullptr ? "" : nodeName;
+        record_.inputSignature = GetInputSignature(context_);
+        prev_ = Current();
+        Current() = this;
+    }
+
+    ~TilingTraceScope()
+    {
+        if (!active_) {
+            return;
+        }
+        Current() = prev_;
+        record_.totalUs = ElapsedUs(start_);
+        TilingTraceBuffer::GetInstance().Push(std::move(record_));
+    }
+
+    TilingTraceScope(const TilingTraceScope&) = delete;
+    TilingTraceScope& operator=(const TilingTraceScope&) = delete;
+
+    static TilingTraceScope*& Current()
+    {
+        static thread_local TilingTraceScope* current = nullptr;
+        return current;
+    }
+
+    static uint64_t ElapsedUs(const std::chrono::steady_clock::time_point& start)
+    {
+        return static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+    }
+
+    void BeginTemplate(int32_t priority)
+    {
+        if (!active_) {
+            return;
+        }
+        TilingTraceTemplate item;
+        item.priority = priority;
+        record_.templates.push_back(item);
+    }
+
+    TilingTraceTemplate* CurrentTemplate()
+    {
+        return (active_ && !record_.templates.empty()) ? &record_.templates.back() : nullptr;
+    }
+
+    void End(ge::graphStatus status)
+    {
+        if (!active_) {
+            return;
+        }
+        record_.status = status;
+        if (status != ge::GRAPH_SUCCESS) {
+            return;
+        }
+        if (!record_.templates.empty()) {
+            record_.chosenPriority = record_.templates.back().priority;
+        }
+        record_.tilingKey = static_cast<int64_t>(context_->GetTilingKey());
+        record_.blockDim = context_->GetBlockDim();
+        size_t workspaceNum = context_->GetWorkspaceNum();
+        const size_t* workspaces = workspaceNum > 0 ? context_->GetWorkspaceSizes(workspaceNum) : nullptr;
+        for (size_t i = 0; workspaces != nullptr && i < workspaceNum; i++) {
+            record_.workspaceSize += workspaces[i];
+        }
+    }
+
+private:
+    static std::string GetInputSignature(gert::TilingContext* context)
+    {
+        auto nodeInfo = context->GetComputeNodeInfo();
+        if (nodeInfo == nullptr) {
+            return "";
+        }
+        std::string signature;
+        for (size_t i = 0; i < nodeInfo->GetInputsNum(); ++i) {
+            auto shape = context->GetInputShape(i);
+            auto desc = context->GetInputDesc(i);
+            if (i > 0) {
+                signature += ";";
+            }
+            if (shape == nullptr || desc == nullptr) {
+                signature += "nil";
+                continue;
+            }
+            signature += ge::TypeUtils::DataTypeToSerialString(desc->GetDataType()) + ":" +
+                         ge::TypeUtils::FormatToSerialString(
+                             static_cast<ge::Format>(ge::GetPrimaryFormat(desc->GetStorageFormat()))) +
+                         ":[";
+            const auto& dims = shape->GetStorageShape();
+            for (size_t dim = 0; dim < dims.GetDimNum(); ++dim) {
+                signature += (dim > 0 ? "," : "") + std::to_string(dims.GetDim(dim));
+            }
+            signature += "]";
+        }
+        return signature;
+    }
+
+    gert::TilingContext* context_ = nullptr;
+    TilingTraceScope* prev_ = nullptr;
+    bool active_ = false;
+    std::chrono::steady_clock::time_point start_;
+    TilingTraceRecord record_;
+};
+
+// 记录模板某一阶段的 host 耗时, 不在追踪范围内时为空操作
+class TilingTracePhaseTimer {
+public:
+    explicit TilingTracePhaseTimer(TilingTracePhase phase) : phase_(phase)
+    {
+        auto scope = TilingTraceScope::Current();
+        item_ = scope == nullptr ? nullptr : scope->CurrentTemplate();
+        if (item_ != nullptr) {
+            start_ = std::chrono::steady_clock::now();
+        }
+    }
+
+    ~TilingTracePhaseTimer()
+    {
+        if (item_ != nullptr) {
+            item_->phaseUs[static_cast<size_t>(phase_)] += TilingTraceScope::ElapsedUs(start_);
+        }
+    }
+
+    TilingTracePhaseTimer(const TilingTracePhaseTimer&) = delete;
+    TilingTracePhaseTimer& operator=(const TilingTracePhaseTimer&) = delete;
+
+private:
+    TilingTracePhase phase_;
+    TilingTraceTemplate* item_ = nullptr;
+    std::chrono::steady_clock::time_point start_;
+};
+
+// 模板在 IsCapable 等处记录拒绝原因, 多条原因以 "; " 拼接
+inline void TilingTraceReject(const std::string& reason)
+{
+    auto scope = TilingTraceScope::Current();
+    auto item = scope == nullptr ? nullptr : scope->CurrentTemplate();
+    if (item == nullptr) {
+        return;
+    }
+    if (!item->rejectReason.empty()) {
+        item->rejectReason += "; ";
+    }
+    item->rejectReason += reason;
+}
+
+inline void TilingTraceTemplateResult(bool capable, ge::graphStatus status)
+{
+    auto scope = TilingTraceScope::Current();
+    auto item = scope == nullptr ? nullptr : scope->CurrentTemplate();
+    if (item != nullptr) {
+        item->capable = capable;
+        item->status = status;
+    }
+}
+
+} // namespace Optiling
+} // namespace NN
+} // namespace Ops
+
+// 模板拒绝: 同一条原因既写 debug 日志, 又在开启 tiling 决策追踪时记入当前模板
+#define OP_TILING_REJECT(opName, reason)                           \
+    do {                                                           \
+        const std::string tilingRejectReason_ = (reason);          \
+        OP_LOGD(opName, "%s", tilingRejectReason_.c_str());        \
+        Ops::NN::Optiling::TilingTraceReject(tilingRejectReason_); \
+    } while (0)
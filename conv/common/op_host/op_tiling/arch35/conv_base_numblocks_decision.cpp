@@ -15,6 +15,7 @@
 #include "conv_base_numblocks_decision.h"
 #include "log/log.h"
 #include <cmath>
+#include <cstdlib>
 #include <set>
 #include <algorithm>
 
@@ -386,6 +387,10 @@ NumBlocksRes ConvBaseDeci::NumBlocksDecisionMsplitMode()
     GetNumBlocksRangeMsplitMode();
     GetNumBlocksInitMsplitMode();
     CoreNumBlocksDecisionMsplitMode();
+    uint64_t searchBudgetUs = GetConvNumBlocksSearchBudget();
+    if (searchBudgetUs > 0) {
+        NumBlocksSearchMsplitMode(searchBudgetUs);
+    }
     return numBlocksRes_;
 }
 
@@ -464,6 +469,223 @@ void ConvBaseDeci::NumBlocksDecisionBackTrackMsplitMode(const vector<vector<uint
     }
 }
 
+// 以贪心结果为初值, 在(batch, m, n, do, group)全空间上剪枝穷举, 按含L1复用与尾块浪费的代价重新择优
+void ConvBaseDeci::NumBlocksSearchMsplitMode(uint64_t budgetUs)
+{
+    NumBlocksSearchState state;
+    state.start = std::chrono::steady_clock::now();
+    state.budgetUs = budgetUs;
+    state.bestRecord.resize(NUMBLOCKS_MSPLIT_DEC_NUM, 1);
+    state.bestRecord[NUMBLOCKS_MSPLIT_BATCH_IDX] = numBlocksRes_.batchDim;
+    state.bestRecord[NUMBLOCKS_MSPLIT_M_IDX] = numBlocksRes_.mDim;
+    state.bestRecord[NUMBLOCKS_MSPLIT_N_IDX] = numBlocksRes_.nDim;
+    state.bestRecord[NUMBLOCKS_MSPLIT_DO_IDX] = numBlocksRes_.doDim;
+    state.bestRecord[NUMBLOCKS_MSPLIT_GROUP_IDX] = numBlocksRes_.groupDim;
+    CalcRefinedCostMsplitMode(state.bestRecord, state.bestCost, state.bestTailWaste);
+    uint64_t greedyCost = state.bestCost;
+
+    vector<vector<uint32_t>> searchRanges;
+    GetNumBlocksSearchRangeMsplitMode(searchRanges);
+    vector<uint32_t> record;
+    NumBlocksSearchBackTrackMsplitMode(searchRanges, NUMBLOCKS_MSPLIT_BATCH_IDX, 1, record, state);
+    numBlocksSearchLeafCnt_ = state.leafCnt;
+    numBlocksSearchTimeout_ = state.timeout;
+
+    OP_LOGD(nodeInfo_.nodeName,
+            "%s AscendC: numblocks search visited %lu candidates, timeout: %d, refined cost greedy / best: %lu, %lu.",
+            nodeInfo_.nodeType.c_str(), state.leafCnt, state.timeout, greedyCost, state.bestCost);
+    // 超时时保留已搜到的最优解, 其代价不劣于贪心结果
+    const vector<uint32_t>& best = state.bestRecord;
+    SetNumBlocksMsplitMode(best, CalcTotalCostMsplitMode(best[NUMBLOCKS_MSPLIT_BATCH_IDX], best[NUMBLOCKS_MSPLIT_M_IDX],
+                                                         best[NUMBLOCKS_MSPLIT_N_IDX], best[NUMBLOCKS_MSPLIT_DO_IDX],
+                                                         best[NUMBLOCKS_MSPLIT_GROUP_IDX]));
+}
+
+void ConvBaseDeci::GetNumBlocksSearchRangeMsplitMode(vector<vector<uint32_t>>& searchRanges)
+{
+    searchRanges.assign(NUMBLOCKS_MSPLIT_DEC_NUM, vector<uint32_t>(1, 1));
+    searchRanges[NUMBLOCKS_MSPLIT_BATCH_IDX].clear();
+    ConvCalcDistinctSplit(shapeInfo_.batch, aicoreNum_, searchRanges[NUMBLOCKS_MSPLIT_BATCH_IDX]);
+    searchRanges[NUMBLOCKS_MSPLIT_M_IDX].clear();
+    ConvCalcDistinctSplit(ConvCeilDiv(shapeInfo_.ho * shapeInfo_.wo, m0_), aicoreNum_,
+                          searchRanges[NUMBLOCKS_MSPLIT_M_IDX]);
+    // C04场景N只能按因子切分, 沿用原有范围
+    if (flagInfo_.enableC04Flag) {
+        searchRanges[NUMBLOCKS_MSPLIT_N_IDX] = numBlocksRanges_.nRange;
+    } else {
+        uint64_t curCo = shapeInfo_.co;
+        if (flagInfo_.convGroupType == ConvGroupType::ORI_GROUP_CONV) {
+            curCo = oriGroupInfo_.coPerGroup;
+        } else if (flagInfo_.convGroupType == ConvGroupType::OPT_GROUP_CONV) {
+            curCo = optGroupInfo_.coutOpt;
+        }
+        searchRanges[NUMBLOCKS_MSPLIT_N_IDX].clear();
+        ConvCalcDistinctSplit(ConvCeilDiv(curCo, n0_), aicoreNum_, searchRanges[NUMBLOCKS_MSPLIT_N_IDX]);
+    }
+    if (descInfo_.fMapFormat == ge::Format::FORMAT_NCDHW || descInfo_.fMapFormat == ge::Format::FORMAT_NDHWC) {
+        searchRanges[NUMBLOCKS_MSPLIT_DO_IDX].clear();
+        ConvCalcDistinctSplit(shapeInfo_.dout, aicoreNum_, searchRanges[NUMBLOCKS_MSPLIT_DO_IDX]);
+    }
+    uint64_t curGroups = flagInfo_.convGroupType == ConvGroupType::OPT_GROUP_CONV ? optGroupInfo_.groupOpt :
+                                                                                    attrInfo_.groups;
+    searchRanges[NUMBLOCKS_MSPLIT_GROUP_IDX].clear();
+    ConvCalcDistinctSplit(curGroups, aicoreNum_, searchRanges[NUMBLOCKS_MSPLIT_GROUP_IDX]);
+    OP_LOGD(nodeInfo_.nodeName, "%s AscendC: numblocks search ranges: %s.", nodeInfo_.nodeType.c_str(),
+            VectorsToString(searchRanges, IntToString<uint32_t>).c_str());
+}
+
+void ConvBaseDeci::NumBlocksSearchBackTrackMsplitMode(const vector<vector<uint32_t>>& inputRanges, uint32_t rangeIdx,
+                                                      uint64_t usedCoreNum, vector<uint32_t>& record,
+                                                      NumBlocksSearchState& state)
+{
+    constexpr uint64_t CHECK_TIME_INTERVAL = 64;
+    if (state.timeout) {
+        return;
+    }
+    if (record.size() == inputRanges.size()) {
+        state.leafCnt++;
+        if (state.leafCnt % CHECK_TIME_INTERVAL == 0) {
+            auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() -
+                                                                                 state.start);
+            state.timeout = static_cast<uint64_t>(elapsed.count()) > state.budgetUs;
+        }
+        uint64_t curCost = 0;
+        uint64_t curTailWaste = 0;
+        CalcRefinedCostMsplitMode(record, curCost, curTailWaste);
+        if (curCost < state.bestCost || (curCost == state.bestCost && curTailWaste < state.bestTailWaste)) {
+            state.bestRecord = record;
+            state.bestCost = curCost;
+            state.bestTailWaste = curTailWaste;
+        }
+        return;
+    }
+
+    if (rangeIdx >= inputRanges.size() || CheckSearchBoundMsplitMode(record, usedCoreNum, state)) {
+        return;
+    }
+
+    // 范围升序, 核数超限后更大的切分数均不可行
+    for (uint32_t i = 0; i < inputRanges[rangeIdx].size(); i++) {
+        uint64_t curCoreNum = usedCoreNum * inputRanges[rangeIdx][i];
+        if (curCoreNum > aicoreNum_) {
+            break;
+        }
+        record.push_back(inputRanges[rangeIdx][i]);
+        NumBlocksSearchBackTrackMsplitMode(inputRanges, rangeIdx + 1, curCoreNum, record, state);
+        record.pop_back();
+    }
+}
+
+// 下界: 剩余维度最多再分到aicoreNum_ / usedCoreNum个核, 单核cube量不低于其总量均分, 下界已不优于当前最优时剪枝
+bool ConvBaseDeci::CheckSearchBoundMsplitMode(const vector<uint32_t>& record, uint64_t usedCoreNum,
+                                              const NumBlocksSearchState& state)
+{
+    if (record.empty()) {
+        return false;
+    }
+    uint64_t curCo = flagInfo_.convGroupType != ConvGroupType::NORMAL_CONV ?
+                         (flagInfo_.convGroupType == ConvGroupType::ORI_GROUP_CONV ? oriGroupInfo_.coPerGroup :
+                                                                                     optGroupInfo_.coutOpt) :
+                         shapeInfo_.co;
+    vector<uint64_t> dimSizes(NUMBLOCKS_MSPLIT_DEC_NUM, 1);
+    dimSizes[NUMBLOCKS_MSPLIT_BATCH_IDX] = shapeInfo_.batch;
+    dimSizes[NUMBLOCKS_MSPLIT_M_IDX] = ConvCeilDiv(shapeInfo_.ho * shapeInfo_.wo, m0_);
+    dimSizes[NUMBLOCKS_MSPLIT_N_IDX] = ConvCeilDiv(curCo, n0_);
+    dimSizes[NUMBLOCKS_MSPLIT_DO_IDX] = shapeInfo_.dout;
+    dimSizes[NUMBLOCKS_MSPLIT_GROUP_IDX] = flagInfo_.convGroupType == ConvGroupType::OPT_GROUP_CONV ?
+                                               optGroupInfo_.groupOpt : attrInfo_.groups;
+    uint64_t curCi = flagInfo_.convGroupType != ConvGroupType::NORMAL_CONV ?
+                         (flagInfo_.convGroupType == ConvGroupType::ORI_GROUP_CONV ? oriGroupInfo_.ciPerGroup :
+                                                                                     optGroupInfo_.cinOpt) :
+                         shapeInfo_.ci;
+    double cubeBound = static_cast<double>(shapeInfo_.kd * ConvCeilDiv(curCi, k0_) * shapeInfo_.kh * shapeInfo_.kw);
+    for (uint32_t i = 0; i < NUMBLOCKS_MSPLIT_DEC_NUM; i++) {
+        cubeBound *= i < record.size() ? static_cast<double>(ConvCeilDiv(dimSizes[i], record[i])) :
+                                         static_cast<double>(dimSizes[i]);
+    }
+    cubeBound /= static_cast<double>(aicoreNum_ / usedCoreNum);
+    return cubeBound > static_cast<double>(state.bestCost);
+}
+
+// 单核在一个batch/do/group上需搬运的fmap元素数, 按M切分后的输出行数反推输入行, 计入相邻核间kh方向的halo重复搬运
+uint64_t ConvBaseDeci::CalcFmapLoadPerCoreMsplitMode(uint32_t mDim, uint64_t ci1)
+{
+    uint64_t hiLoad = shapeInfo_.hi;
+    if (mDim > 1) {
+        uint64_t singleM = ConvCeilDiv(ConvCeilDiv(shapeInfo_.ho * shapeInfo_.wo, m0_), mDim) * m0_;
+        uint64_t hoRows = std::min(ConvCeilDiv(singleM, shapeInfo_.wo) + 1, shapeInfo_.ho);
+        hiLoad = std::min(ConvInferHiL1(hoRows, shapeInfo_.hi, shapeInfo_.kh, attrInfo_.dilationH, attrInfo_.strideH),
+                          shapeInfo_.hi);
+    }
+    return hiLoad * shapeInfo_.wi * shapeInfo_.kd * ci1 * k0_;
+}
+
+/*
+ * 在CalcTotalCostMsplitMode的基础上细化:
+ * 1. L1复用: 单核权重可驻留半个L1时跨batch/do只搬一次; 否则fmap可驻留时每个batch/do重搬权重;
+ *    两者都放不下时按较优循环顺序流式重搬.
+ * 2. fmap搬运量计入M切分引入的halo.
+ * 3. tailWaste为所有已用核上因尾块不均与m0/n0补齐而空转的cube分形数, 代价相同时取较小者.
+ */
+void ConvBaseDeci::CalcRefinedCostMsplitMode(const vector<uint32_t>& record, uint64_t& cost, uint64_t& tailWaste)
+{
+    uint64_t curCi = flagInfo_.convGroupType != ConvGroupType::NORMAL_CONV ?
+                         (flagInfo_.convGroupType == ConvGroupType::ORI_GROUP_CONV ? oriGroupInfo_.ciPerGroup :
+                                                                                     optGroupInfo_.cinOpt) :
+                         shapeInfo_.ci;
+    uint64_t ci1 = ConvCeilDiv(curCi, k0_);
+    uint64_t curCo = flagInfo_.convGroupType != ConvGroupType::NORMAL_CONV ?
+                         (flagInfo_.convGroupType == ConvGroupType::ORI_GROUP_CONV ? oriGroupInfo_.coPerGroup :
+                                                                                     optGroupInfo_.coutOpt) :
+                         shapeInfo_.co;
+    uint64_t co1 = ConvCeilDiv(curCo, n0_);
+    uint64_t curGroups = flagInfo_.convGroupType == ConvGroupType::OPT_GROUP_CONV ? optGroupInfo_.groupOpt :
+                                                                                    attrInfo_.groups;
+    uint64_t m1 = ConvCeilDiv(shapeInfo_.ho * shapeInfo_.wo, m0_);
+
+    uint64_t singleGroup = ConvCeilDiv(curGroups, record[NUMBLOCKS_MSPLIT_GROUP_IDX]);
+    uint64_t outerLoop = ConvCeilDiv(shapeInfo_.batch, record[NUMBLOCKS_MSPLIT_BATCH_IDX]) * singleGroup *
+                         ConvCeilDiv(shapeInfo_.dout, record[NUMBLOCKS_MSPLIT_DO_IDX]);
+    uint64_t singleCo1 = ConvCeilDiv(co1, record[NUMBLOCKS_MSPLIT_N_IDX]);
+    uint64_t singleM1 = ConvCeilDiv(m1, record[NUMBLOCKS_MSPLIT_M_IDX]);
+    uint64_t kFractal = shapeInfo_.kd * ci1 * shapeInfo_.kh * shapeInfo_.kw;
+
+    uint64_t fmapPerIter = CalcFmapLoadPerCoreMsplitMode(record[NUMBLOCKS_MSPLIT_M_IDX], ci1);
+    // N dim full load to UB in opt group mode.
+    uint64_t weightPerGroup = kFractal * k0_ *
+                              (flagInfo_.convGroupType == ConvGroupType::OPT_GROUP_CONV ? 1 : singleCo1 * n0_);
+    uint64_t fmapBytes = fmapPerIter * dtypeSizeTab.at(descInfo_.fMapDtype);
+    uint64_t weightBytes = weightPerGroup * dtypeSizeTab.at(descInfo_.weightDtype);
+    uint64_t halfL1Size = platformInfo_.l1Size / CONST_VALUE_2;
+
+    uint64_t loadFeatureMapCost = outerLoop * fmapPerIter;
+    uint64_t loadWeightCost = outerLoop * weightPerGroup;
+    if (halfL1Size == 0 || weightBytes <= halfL1Size) {
+        loadWeightCost = singleGroup * weightPerGroup;
+    } else if (fmapBytes > halfL1Size) {
+        uint64_t weightStreamCost = weightPerGroup * ConvCeilDiv(fmapBytes, halfL1Size) + fmapPerIter;
+        uint64_t fmapStreamCost = fmapPerIter * ConvCeilDiv(weightBytes, halfL1Size) + weightPerGroup;
+        if (weightStreamCost <= fmapStreamCost) {
+            loadWeightCost = outerLoop * (weightStreamCost - fmapPerIter);
+        } else {
+            loadFeatureMapCost = outerLoop * (fmapStreamCost - weightPerGroup);
+        }
+    }
+    uint64_t loadOutputCost = outerLoop * singleCo1 * n0_ * singleM1 * m0_;
+    uint64_t cubeCalcCost = outerLoop * singleCo1 * singleM1 * kFractal;
+
+    cost = (loadFeatureMapCost + loadWeightCost * GetWeightBandWidthCoeff() + loadOutputCost) / MIN_L2_BAND_WIDTH +
+           cubeCalcCost;
+
+    uint64_t usedCoreNum = 1;
+    for (auto dim : record) {
+        usedCoreNum *= dim;
+    }
+    uint64_t usefulCube = shapeInfo_.batch * curGroups * shapeInfo_.dout * co1 * m1 * kFractal;
+    uint64_t issuedCube = usedCoreNum * cubeCalcCost;
+    tailWaste = issuedCube > usefulCube ? issuedCube - usefulCube : 0;
+}
+
 // hw split mode
 NumBlocksRes ConvBaseDeci::NumBlocksDecisionHWsplitMode()
 {
@@ -660,6 +882,40 @@ void ConvNumBlocksFactorMix(uint32_t orgDim, std::vector<uint32_t>& inputRange,
     inputRange.assign(tmpRanges.begin(), tmpRanges.end());
 }
 
+// 只保留单核切块大小互不相同的最小切分数, 更大的切分数单核负载不变却多占核, 且保证每个核都分到数据
+void ConvCalcDistinctSplit(const uint64_t num, const uint32_t numMax, std::vector<uint32_t>& reslist)
+{
+    uint64_t upper = std::min(num, static_cast<uint64_t>(numMax));
+    uint64_t dim = 1;
+    while (dim <= upper) {
+        reslist.emplace_back(static_cast<uint32_t>(dim));
+        uint64_t single = ConvCeilDiv(num, dim);
+        if (single <= 1) {
+            break;
+        }
+        dim = ConvCeilDiv(num, single - 1);
+    }
+    if (reslist.empty()) {
+        reslist.emplace_back(1);
+    }
+}
+
+// CONV_NUMBLOCKS_SEARCH_BUDGET_US为正时开启M切分模式的剪枝穷举搜索, 取值为host侧搜索耗时上限(us)
+uint64_t GetConvNumBlocksSearchBudget()
+{
+    constexpr uint64_t MAX_SEARCH_BUDGET_US = 1000000;
+    const char* budgetEnv = std::getenv("CONV_NUMBLOCKS_SEARCH_BUDGET_US");
+    if (budgetEnv == nullptr) {
+        return 0;
+    }
+    char* end = nullptr;
+    uint64_t budgetUs = std::strtoull(budgetEnv, &end, 10);
+    if (end == budgetEnv || *end != '\0') {
+        return 0;
+    }
+    return std::min(budgetUs, MAX_SEARCH_BUDGET_US);
+}
+
 void InitNumBlocksConstParas(ConvOpsConstParams& convOpsConstParams, const ConvAscendcDescInfo& descInfo,
                              const ConvAscendcShapesInfo& shapeInfo)
 {
@@ -15,6 +15,7 @@
 #ifndef OPS_BUILT_IN_OP_TILING_RUNTIME_CONV_BASE_BLOCK_DIM_DECISION_H
 #define OPS_BUILT_IN_OP_TILING_RUNTIME_CONV_BASE_BLOCK_DIM_DECISION_H
 
+#include <chrono>
 #include <cstdarg>
 #include "securec.h"
 #include "conv_template_utils.h"
@@ -34,6 +35,8 @@ int64_t ConvComputeHo(int64_t hi, int64_t hk, int64_t padTop, int64_t padBottom,
 int64_t ConvComputeWo(int64_t wi, int64_t wk, int64_t padLeft, int64_t padRight, int64_t dilationW, int64_t strideW);
 int64_t ConvComputeDo(int64_t di, int64_t dk, int64_t padHead, int64_t padTail, int64_t dilationD, int64_t strideD);
 void ConvNumBlocksFactorMix(uint32_t orgDim, vector<uint32_t>& inputRange, const vector<uint32_t>& mixRange);
+void ConvCalcDistinctSplit(const uint64_t num, const uint32_t numMax, vector<uint32_t>& reslist);
+uint64_t GetConvNumBlocksSearchBudget();
 void InitNumBlocksConstParas(ConvOpsConstParams& convOpsConstParams, const ConvAscendcDescInfo& descInfo,
                              const ConvAscendcShapesInfo& shapeInfo);
 
@@ -89,6 +92,17 @@ inline std::string FormatString(const char* fmt, ...)
     return std::string(buf, static_cast<size_t>(ret));
 }
 
+// M切分模式下剪枝穷举搜索的状态, budgetUs为host侧耗时上限
+struct NumBlocksSearchState {
+    std::chrono::steady_clock::time_point start;
+    uint64_t budgetUs = 0;
+    uint64_t leafCnt = 0;
+    bool timeout = false;
+    vector<uint32_t> bestRecord;
+    uint64_t bestCost = 0;
+    uint64_t bestTailWaste = 0;
+};
+
 class __attribute__((visibility("default"))) ConvBaseDeci {
 public:
     ConvBaseDeci(){};
@@ -122,6 +136,15 @@ private:
                                               vector<uint32_t>& record);
     uint64_t CalcTotalCostMsplitMode(uint32_t batchDim, uint32_t mDim, uint32_t nDim, uint32_t doDim,
                                      uint32_t groupDim);
+    void NumBlocksSearchMsplitMode(uint64_t budgetUs);
+    void GetNumBlocksSearchRangeMsplitMode(vector<vector<uint32_t>>& searchRanges);
+    void NumBlocksSearchBackTrackMsplitMode(const vector<vector<uint32_t>>& inputRanges, uint32_t rangeIdx,
+                                            uint64_t usedCoreNum, vector<uint32_t>& record,
+                                            NumBlocksSearchState& state);
+    bool CheckSearchBoundMsplitMode(const vector<uint32_t>& record, uint64_t usedCoreNum,
+                                    const NumBlocksSearchState& state);
+    void CalcRefinedCostMsplitMode(const vector<uint32_t>& record, uint64_t& cost, uint64_t& tailWaste);
+    uint64_t CalcFmapLoadPerCoreMsplitMode(uint32_t mDim, uint64_t ci1);
     bool CmpCoreUtilize(const uint32_t curCoreUtilize, const uint32_t minCostCoreUtilize, const uint32_t batchDim,
                         const uint32_t doDim);
     bool CmpCoreUtilizeMsplitMode(uint32_t batchDim, uint32_t mDim, uint32_t nDim, uint32_t doDim, uint32_t groupDim);
@@ -168,6 +191,9 @@ public:
     NumBlocksRes numBlocksRes_;
     NumBlocksRange numBlocksRanges_;
     vector<uint32_t> numBlocksInit_;
+    // 最近一次M切分搜索访问的候选数及是否因超出耗时上限提前结束
+    uint64_t numBlocksSearchLeafCnt_ = 0;
+    bool numBlocksSearchTimeout_ = false;
     ConvOpsConstParams convOpsConstParams_;
 };
 } // namespace conv_ops_tiling
@@ -72,6 +72,7 @@ struct ConvInputArgs {
     int64_t output1ShapeC = 1;
     int64_t output1ShapeH = 1;
     int64_t output1ShapeW = 1;
+    uint64_t numBlocksSearchBudget = 0; // M切分模式剪枝搜索的耗时上限(us), 0表示未开启
 
     // 重载 == 运算符，用于比较
     bool operator==(const ConvInputArgs& other) const
@@ -95,7 +96,7 @@ struct ConvInputArgs {
                scaleFlag1 == other.scaleFlag1 && output1Format == other.output1Format &&
                output1Dtype == other.output1Dtype && output1ShapeN == other.output1ShapeN &&
                output1ShapeC == other.output1ShapeC && output1ShapeH == other.output1ShapeH &&
-               output1ShapeW == other.output1ShapeW;
+               output1ShapeW == other.output1ShapeW && numBlocksSearchBudget == other.numBlocksSearchBudget;
     }
 };
 
@@ -343,6 +344,7 @@ struct ConvInputArgsHash {
         HashCombine(hash_value, args.reluMode1);
         HashCombine(hash_value, args.clipMode1);
         HashCombine(hash_value, args.scaleFlag1);
+        HashCombine(hash_value, args.numBlocksSearchBudget);
         return hash_value;
     }
 };
@@ -0,0 +1,553 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "conv_bn_fold_fusion_pass.h"
+
+#include <cmath>
+#include <cstring>
+
+#include "../../common/graph_fusion/cube_utils/cube_fp16_t.h"
+#include "conv/common/op_graph/fusion_pass/conv_fusion_utils_pass.h"
+#include "ge/compliant_node_builder.h"
+#include "graph/utils/type_utils.h"
+#include "securec.h"
+
+namespace Ops {
+using namespace NN;
+using namespace Conv;
+using namespace ConvFusionUtils;
+using namespace ConvBnFoldFusion;
+using namespace ge;
+using namespace fusion;
+
+namespace {
+constexpr float FP16_MAX_VALUE = 65504.0f;
+
+int32_t GetFormatAxisPos(Format format, char axisChar)
+{
+    std::string fmtStr = TypeUtils::FormatToAscendString(format).GetString();
+    size_t found = fmtStr.find(axisChar);
+    return found == std::string::npos ? -1 : static_cast<int32_t>(found);
+}
+
+// 折叠后的值需在目标 dtype 可表示范围内, fp16 溢出时放弃折叠保持原图精度
+bool IsRepresentable(const std::vector<float>& values, DataType dtype)
+{
+    for (float value : values) {
+        if (!std::isfinite(value)) {
+            return false;
+        }
+        if (dtype == DT_FLOAT16 && std::fabs(value) > FP16_MAX_VALUE) {
+            return false;
+        }
+    }
+    return true;
+}
+} // namespace
+
+void ConvBnFoldFusionPass::InitMember()
+{
+    foldType = FoldType::NONE;
+    convType = "";
+    headNode = nullptr;
+    tailNode = nullptr;
+    tailOutputDesc = TensorDesc();
+    filterTensor = Tensor();
+    biasTensor = Tensor();
+    channelScale.clear();
+    channelShift.clear();
+    foldFilter.clear();
+    foldBias.clear();
+    biasDtype = DT_UNDEFINED;
+    coutNum = 0;
+    outChannelAxis = 0;
+    filterCoutAxis = 0;
+    hasBias = false;
+}
+
+std::set<AscendString> ConvBnFoldFusionPass::GetNodeTypes() const { return FOLD_CONV_LIST; }
+
+bool ConvBnFoldFusionPass::GetSingleConsumer(const GNode& node, GNodePtr& consumer, AscendString& consumerType) const
+{
+    auto outputs = node.GetOutDataNodesAndPortIndexs(OUTPUT_INDEX);
+    FUSION_PASS_CHECK(outputs.size() != SINGLE_REF_CNT, OP_LOGD(FUSION_NAME, "output is not single-refer."),
+                      return false);
+    consumer = outputs[0].first;
+    FUSION_PASS_CHECK(consumer == nullptr, OP_LOGD(FUSION_NAME, "output consumer is null."), return false);
+    FUSION_PASS_CHECK(consumer->GetType(consumerType) != GRAPH_SUCCESS,
+                      OP_LOGD(FUSION_NAME, "get consumer type failed."), return false);
+    return true;
+}
+
+bool ConvBnFoldFusionPass::CheckBatchNormInference(const GNode& bnNode) const
+{
+    // is_training 缺省为 true, 未显式关闭时按训练态处理
+    bool isTraining = true;
+    FUSION_PASS_CHECK(bnNode.GetAttr(ATTR_IS_TRAINING, isTraining) != GRAPH_SUCCESS,
+                      OP_LOGD(FUSION_NAME, "BatchNorm has no is_training attr."), return false);
+    FUSION_PASS_CHECK(isTraining, OP_LOGD(FUSION_NAME, "BatchNorm is training mode."), return false);
+    FUSION_PASS_CHECK(bnNode.GetInputsSize() < BN_INPUT_NUM,
+                      OP_LOGD(FUSION_NAME, "BatchNorm has no mean/variance input."), return false);
+    for (size_t i = OUTPUT_INDEX + 1; i < bnNode.GetOutputsSize(); ++i) {
+        FUSION_PASS_CHECK(!bnNode.GetOutDataNodesAndPortIndexs(static_cast<int32_t>(i)).empty(),
+                          OP_LOGD(FUSION_NAME, "BatchNorm statistic output %zu is used.", i), return false);
+    }
+    return true;
+}
+
+bool ConvBnFoldFusionPass::GetConstInput(const GNode& node, int32_t inputIdx, Tensor& value) const
+{
+    auto inPair = node.GetInDataNodesAndPortIndexs(inputIdx);
+    FUSION_PASS_CHECK(inPair.first == nullptr, OP_LOGD(FUSION_NAME, "input %d is null.", inputIdx), return false);
+    AscendString inType;
+    FUSION_PASS_CHECK(inPair.first->GetType(inType) != GRAPH_SUCCESS,
+                      OP_LOGD(FUSION_NAME, "get input %d type failed.", inputIdx), return false);
+    FUSION_PASS_CHECK(inType != CONST && inType != CONSTANT,
+                      OP_LOGD(FUSION_NAME, "input %d is not Const.", inputIdx), return false);
+    // 常量被其他节点共享时不能随子图一起删除
+    FUSION_PASS_CHECK(inPair.first->GetOutDataNodesAndPortIndexs(inPair.second).size() != SINGLE_REF_CNT,
+                      OP_LOGD(FUSION_NAME, "const input %d is multi-refer.", inputIdx), return false);
+    FUSION_PASS_CHECK(inPair.first->GetAttr(ATTR_VALUE, value) != GRAPH_SUCCESS,
+                      OP_LOGD(FUSION_NAME, "get const value of input %d failed.", inputIdx), return false);
+    FUSION_PASS_CHECK(value.GetData() == nullptr || value.GetSize() == 0,
+                      OP_LOGD(FUSION_NAME, "const value of input %d is empty.", inputIdx), return false);
+    return true;
+}
+
+bool ConvBnFoldFusionPass::GetEltwiseConstInput(const GNode& eltwiseNode, const GNode& dataNode, Tensor& value) const
+{
+    FUSION_PASS_CHECK(eltwiseNode.GetInputsSize() != ELTWISE_INPUT_NUM,
+                      OP_LOGD(FUSION_NAME, "eltwise input num is not 2."), return false);
+    AscendString dataName;
+    FUSION_PASS_CHECK(dataNode.GetName(dataName) != GRAPH_SUCCESS, OP_LOGD(FUSION_NAME, "get node name failed."),
+                      return false);
+    int32_t constIdx = -1;
+    for (int32_t i = 0; i < static_cast<int32_t>(ELTWISE_INPUT_NUM); ++i) {
+        auto inPair = eltwiseNode.GetInDataNodesAndPortIndexs(i);
+        AscendString inName;
+        if (inPair.first != nullptr && inPair.first->GetName(inName) == GRAPH_SUCCESS && inName == dataName) {
+            constIdx = static_cast<int32_t>(ELTWISE_INPUT_NUM) - 1 - i;
+            break;
+        }
+    }
+    FUSION_PASS_CHECK(constIdx < 0, OP_LOGD(FUSION_NAME, "eltwise is not fed by data node."), return false);
+    FUSION_PASS_CHECK_NOLOG(!GetConstInput(eltwiseNode, constIdx, value), return false);
+
+    TensorDesc constDesc;
+    FUSION_PASS_CHECK(eltwiseNode.GetInputDesc(constIdx, constDesc) != GRAPH_SUCCESS,
+                      OP_LOGD(FUSION_NAME, "get eltwise const desc failed."), return false);
+    FUSION_PASS_CHECK(!IsPerChannelShape(constDesc.GetShape().GetDims()),
+                      OP_LOGD(FUSION_NAME, "eltwise const is not per-channel."), return false);
+    return true;
+}
+
+bool ConvBnFoldFusionPass::CheckMatchStructure(const GNode& convNode)
+{
+    FUSION_PASS_CHECK(convNode.GetType(convType) != GRAPH_SUCCESS, OP_LOGD(FUSION_NAME, "get conv type failed."),
+                      return false);
+    AscendString headType;
+    FUSION_PASS_CHECK_NOLOG(!GetSingleConsumer(convNode, headNode, headType), return false);
+    tailNode = headNode;
+    if (headType == BN_INFER) {
+        foldType = FoldType::BN;
+        return true;
+    }
+    if (headType == BATCH_NORM) {
+        FUSION_PASS_CHECK_NOLOG(!CheckBatchNormInference(*headNode), return false);
+        foldType = FoldType::BN;
+        return true;
+    }
+    FUSION_PASS_CHECK(headType != MUL, OP_LOGD(FUSION_NAME, "conv is not followed by BN or Mul."), return false);
+    foldType = FoldType::MUL_ADD;
+
+    // Mul 后接常量 Add 时一并折叠进偏置
+    GNodePtr addNode = nullptr;
+    AscendString addType;
+    if (GetSingleConsumer(*headNode, addNode, addType) && addType == ADD) {
+        for (int32_t i = 0; i < static_cast<int32_t>(ELTWISE_INPUT_NUM); ++i) {
+            auto inPair = addNode->GetInDataNodesAndPortIndexs(i);
+            AscendString inType;
+            if (inPair.first != nullptr && inPair.first->GetType(inType) == GRAPH_SUCCESS &&
+                (inType == CONST || inType == CONSTANT)) {
+                tailNode = addNode;
+                break;
+            }
+        }
+    }
+    return true;
+}
+
+bool ConvBnFoldFusionPass::GetChannelAxis()
+{
+    Format outputFormat = convDescInfo.outputDesc.GetOriginFormat();
+    Format filterFormat = convDescInfo.filterDesc.GetOriginFormat();
+    outChannelAxis = GetFormatAxisPos(outputFormat, 'C');
+    filterCoutAxis = GetFormatAxisPos(filterFormat, 'N');
+    std::vector<int64_t> outputShape = convDescInfo.outputDesc.GetOriginShape().GetDims();
+    std::vector<int64_t> filterShape = convDescInfo.filterDesc.GetOriginShape().GetDims();
+    FUSION_PASS_CHECK(outChannelAxis < 0 || static_cast<size_t>(outChannelAxis) >= outputShape.size(),
+                      OP_LOGD(convDescInfo.nodeNameStr, "output format has no C dim."), return false);
+    FUSION_PASS_CHECK(filterCoutAxis < 0 || static_cast<size_t>(filterCoutAxis) >= filterShape.size(),
+                      OP_LOGD(convDescInfo.nodeNameStr, "filter format has no N dim."), return false);
+    FUSION_PASS_CHECK(filterShape.size() != outputShape.size(),
+                      OP_LOGD(convDescInfo.nodeNameStr, "filter rank is not equal to output rank."), return false);
+    coutNum = filterShape[filterCoutAxis];
+    FUSION_PASS_CHECK(coutNum <= 0 || outputShape[outChannelAxis] != coutNum,
+                      OP_LOGD(convDescInfo.nodeNameStr, "filter cout is not equal to output channel."), return false);
+    return true;
+}
+
+bool ConvBnFoldFusionPass::IsPerChannelShape(const std::vector<int64_t>& dims) const
+{
+    size_t outRank = convDescInfo.outputDesc.GetOriginShape().GetDims().size();
+    if (dims.size() > outRank) {
+        return false;
+    }
+    // 按广播规则右对齐, 仅通道轴允许为 cout
+    for (size_t i = 0; i < dims.size(); ++i) {
+        int32_t axis = static_cast<int32_t>(outRank - dims.size() + i);
+        if (dims[i] == 1 || (axis == outChannelAxis && dims[i] == coutNum)) {
+            continue;
+        }
+        return false;
+    }
+    return true;
+}
+
+bool ConvBnFoldFusionPass::ReadAsFloat(const Tensor& tensor, std::vector<float>& values) const
+{
+    DataType dtype = tensor.GetTensorDesc().GetDataType();
+    const uint8_t* data = tensor.GetData();
+    size_t size = tensor.GetSize();
+    values.clear();
+    if (dtype == DT_FLOAT) {
+        values.resize(size / sizeof(float));
+        FUSION_PASS_CHECK(memcpy_s(values.data(), values.size() * sizeof(float), data, size) != EOK,
+                          OP_LOGD(convDescInfo.nodeNameStr, "copy fp32 const failed."), return false);
+        return true;
+    }
+    if (dtype == DT_FLOAT16) {
+        const uint16_t* halfData = reinterpret_cast<const uint16_t*>(data);
+        values.resize(size / sizeof(uint16_t));
+        for (size_t i = 0; i < values.size(); ++i) {
+            fp16_t half(halfData[i]);
+            values[i] = static_cast<float>(half);
+        }
+        return true;
+    }
+    OP_LOGD(convDescInfo.nodeNameStr, "const dtype %s is not supported.", GeDtypeToString(dtype).c_str());
+    return false;
+}
+
+bool ConvBnFoldFusionPass::ReadPerChannel(const Tensor& tensor, std::vector<float>& values) const
+{
+    FUSION_PASS_CHECK_NOLOG(!ReadAsFloat(tensor, values), return false);
+    if (values.size() == 1) {
+        values.assign(static_cast<size_t>(coutNum), values[0]);
+    }
+    FUSION_PASS_CHECK(values.size() != static_cast<size_t>(coutNum),
+                      OP_LOGD(convDescInfo.nodeNameStr, "per-channel const size %zu is not equal to cout %lld.",
+                              values.size(), coutNum),
+                      return false);
+    return true;
+}
+
+bool ConvBnFoldFusionPass::CalcBnScaleShift()
+{
+    Tensor scaleTensor;
+    Tensor offsetTensor;
+    Tensor meanTensor;
+    Tensor varianceTensor;
+    FUSION_PASS_CHECK_NOLOG(!GetConstInput(*headNode, BN_SCALE_INPUT_IDX, scaleTensor), return false);
+    FUSION_PASS_CHECK_NOLOG(!GetConstInput(*headNode, BN_OFFSET_INPUT_IDX, offsetTensor), return false);
+    FUSION_PASS_CHECK_NOLOG(!GetConstInput(*headNode, BN_MEAN_INPUT_IDX, meanTensor), return false);
+    FUSION_PASS_CHECK_NOLOG(!GetConstInput(*headNode, BN_VARIANCE_INPUT_IDX, varianceTensor), return false);
+
+    std::vector<float> scale;
+    std::vector<float> offset;
+    std::vector<float> mean;
+    std::vector<float> variance;
+    FUSION_PASS_CHECK_NOLOG(!ReadPerChannel(scaleTensor, scale), return false);
+    FUSION_PASS_CHECK_NOLOG(!ReadPerChannel(offsetTensor, offset), return false);
+    FUSION_PASS_CHECK_NOLOG(!ReadPerChannel(meanTensor, mean), return false);
+    FUSION_PASS_CHECK_NOLOG(!ReadPerChannel(varianceTensor, variance), return false);
+
+    float epsilon = BATCH_NORM_DEFAULT_EPSILON;
+    headNode->GetAttr(ATTR_EPSILON, epsilon);
+
+    // y = (x - mean) / sqrt(var + eps) * scale + offset, 以 double 计算避免小方差时的精度损失
+    channelScale.resize(static_cast<size_t>(coutNum));
+    channelShift.resize(static_cast<size_t>(coutNum));
+    for (size_t c = 0; c < channelScale.size(); ++c) {
+        double denominator = static_cast<double>(variance[c]) + static_cast<double>(epsilon);
+        FUSION_PASS_CHECK(denominator <= 0.0,
+                          OP_LOGD(convDescInfo.nodeNameStr, "variance + epsilon of channel %zu is not positive.", c),
+                          return false);
+        double channelFactor = static_cast<double>(scale[c]) / std::sqrt(denominator);
+        channelScale[c] = static_cast<float>(channelFactor);
+        channelShift[c] =
+            static_cast<float>(static_cast<double>(offset[c]) - static_cast<double>(mean[c]) * channelFactor);
+    }
+    return true;
+}
+
+bool ConvBnFoldFusionPass::CalcMulAddScaleShift(const GNode& convNode)
+{
+    Tensor mulTensor;
+    FUSION_PASS_CHECK_NOLOG(!GetEltwiseConstInput(*headNode, convNode, mulTensor), return false);
+    FUSION_PASS_CHECK_NOLOG(!ReadPerChannel(mulTensor, channelScale), return false);
+    channelShift.assign(static_cast<size_t>(coutNum), 0.0f);
+    if (tailNode != headNode) {
+        Tensor addTensor;
+        FUSION_PASS_CHECK_NOLOG(!GetEltwiseConstInput(*tailNode, *headNode, addTensor), return false);
+        FUSION_PASS_CHECK_NOLOG(!ReadPerChannel(addTensor, channelShift), return false);
+    }
+    return true;
+}
+
+bool ConvBnFoldFusionPass::FoldWeight()
+{
+    FUSION_PASS_CHECK_NOLOG(!ReadAsFloat(filterTensor, foldFilter), return false);
+    std::vector<int64_t> filterShape = convDescInfo.filterDesc.GetOriginShape().GetDims();
+    int64_t innerSize = 1;
+    int64_t totalSize = 1;
+    for (size_t i = 0; i < filterShape.size(); ++i) {
+        totalSize *= filterShape[i];
+        if (static_cast<int32_t>(i) > filterCoutAxis) {
+            innerSize *= filterShape[i];
+        }
+    }
+    FUSION_PASS_CHECK(static_cast<int64_t>(foldFilter.size()) != totalSize,
+                      OP_LOGD(convDescInfo.nodeNameStr, "filter const size %zu is not equal to shape size %lld.",
+                              foldFilter.size(), totalSize),
+                      return false);
+    for (size_t i = 0; i < foldFilter.size(); ++i) {
+        size_t cout = (i / static_cast<size_t>(innerSize)) % static_cast<size_t>(coutNum);
+        foldFilter[i] *= channelScale[cout];
+    }
+    FUSION_PASS_CHECK(!IsRepresentable(foldFilter, convDescInfo.filterDtype),
+                      OP_LOGD(convDescInfo.nodeNameStr, "folded filter overflows."), return false);
+    return true;
+}
+
+bool ConvBnFoldFusionPass::FoldBias()
+{
+    if (hasBias) {
+        FUSION_PASS_CHECK_NOLOG(!ReadPerChannel(biasTensor, foldBias), return false);
+        biasDtype = biasTensor.GetTensorDesc().GetDataType();
+    } else {
+        foldBias.assign(static_cast<size_t>(coutNum), 0.0f);
+        biasDtype = convDescInfo.filterDtype;
+    }
+    for (size_t c = 0; c < foldBias.size(); ++c) {
+        foldBias[c] = foldBias[c] * channelScale[c] + channelShift[c];
+    }
+    FUSION_PASS_CHECK(!IsRepresentable(foldBias, biasDtype),
+                      OP_LOGD(convDescInfo.nodeNameStr, "folded bias overflows."), return false);
+    return true;
+}
+
+bool ConvBnFoldFusionPass::MeetRequirements(const GNode& convNode)
+{
+    OP_LOGD(convDescInfo.nodeNameStr, "Begin to do ConvBnFoldFusionPass.");
+    FUSION_PASS_CHECK(FOLD_DTYPE_LIST.count(convDescInfo.filterDtype) == 0 ||
+                          convDescInfo.fmapDtype != convDescInfo.filterDtype,
+                      OP_LOGD(convDescInfo.nodeNameStr, "only float16/float32 conv can be folded."), return false);
+    FUSION_PASS_CHECK(ConvFusionUtilsPass::IsUnknownShape(convDescInfo.filterDesc) ||
+                          ConvFusionUtilsPass::IsUnknownShape(convDescInfo.outputDesc),
+                      OP_LOGD(convDescInfo.nodeNameStr, "unknown shape not supported."), return false);
+    FUSION_PASS_CHECK(convNode.GetInputsSize() > static_cast<size_t>(INPUT_OFFSET_W_INDEX) &&
+                          convNode.GetInDataNodesAndPortIndexs(INPUT_OFFSET_W_INDEX).first != nullptr,
+                      OP_LOGD(convDescInfo.nodeNameStr, "conv with offset_w not supported."), return false);
+
+    FUSION_PASS_CHECK_NOLOG(!GetChannelAxis(), return false);
+    FUSION_PASS_CHECK_NOLOG(!GetConstInput(convNode, INPUT_FILTER_INDEX, filterTensor), return false);
+    hasBias = convNode.GetInputsSize() > static_cast<size_t>(INPUT_BIAS_INDEX) &&
+              convNode.GetInDataNodesAndPortIndexs(INPUT_BIAS_INDEX).first != nullptr;
+    if (hasBias) {
+        FUSION_PASS_CHECK_NOLOG(!GetConstInput(convNode, INPUT_BIAS_INDEX, biasTensor), return false);
+        FUSION_PASS_CHECK(FOLD_DTYPE_LIST.count(biasTensor.GetTensorDesc().GetDataType()) == 0,
+                          OP_LOGD(convDescInfo.nodeNameStr, "bias dtype not supported."), return false);
+    }
+
+    FUSION_PASS_CHECK(tailNode->GetOutputDesc(OUTPUT_INDEX, tailOutputDesc) != GRAPH_SUCCESS,
+                      OP_LOGD(convDescInfo.nodeNameStr, "get tail output desc failed."), return false);
+    FUSION_PASS_CHECK(tailOutputDesc.GetDataType() != convDescInfo.outputDtype ||
+                          tailOutputDesc.GetShape().GetDims() != convDescInfo.outputShape,
+                      OP_LOGD(convDescInfo.nodeNameStr, "tail output is not same as conv output."), return false);
+
+    bool calcRes = foldType == FoldType::BN ? CalcBnScaleShift() : CalcMulAddScaleShift(convNode);
+    FUSION_PASS_CHECK_NOLOG(!calcRes, return false);
+    FUSION_PASS_CHECK_NOLOG(!FoldWeight(), return false);
+    FUSION_PASS_CHECK_NOLOG(!FoldBias(), return false);
+    return true;
+}
+
+bool ConvBnFoldFusionPass::ConvFusionReplaceImpl(GraphPtr& graph, GNode& convNode, CustomPassContext& passContext)
+{
+    return DefaultConvFusionReplaceImpl(convNode, passContext);
+}
+
+std::unique_ptr<SubgraphBoundary> ConvBnFoldFusionPass::ConstructBoundary(const GNode& convNode)
+{
+    auto boundary = std::make_unique<SubgraphBoundary>();
+    FUSION_PASS_CHECK_NOLOG(
+        !ConvFusionUtilsPass::AddSubgraphInput(boundary, convNode, INPUT_FMAP_INDEX, BOUNDARY_FMAP_INPUT_IDX),
+        return nullptr);
+    FUSION_PASS_CHECK_NOLOG(
+        !ConvFusionUtilsPass::AddSubgraphOutput(boundary, *tailNode, OUTPUT_INDEX, BOUNDARY_OUTPUT_IDX),
+        return nullptr);
+    return boundary;
+}
+
+bool ConvBnFoldFusionPass::BuildConstNode(Graph* graph, const char* name, const TensorDesc& desc,
+                                          const std::vector<float>& values, GNode& constNode) const
+{
+    std::vector<uint8_t> data;
+    if (desc.GetDataType() == DT_FLOAT16) {
+        data.resize(values.size() * sizeof(uint16_t));
+        uint16_t* halfData = reinterpret_cast<uint16_t*>(data.data());
+        for (size_t i = 0; i < values.size(); ++i) {
+            fp16_t half(values[i]);
+            halfData[i] = half.val;
+        }
+    } else {
+        data.resize(values.size() * sizeof(float));
+        FUSION_PASS_CHECK(memcpy_s(data.data(), data.size(), values.data(), values.size() * sizeof(float)) != EOK,
+                          OP_LOGE(convDescInfo.nodeNameStr, "copy %s data failed.", name), return false);
+    }
+
+    constNode = es::CompliantNodeBuilder(graph)
+                    .OpType(CONST.GetString())
+                    .Name(name)
+                    .IrDefOutputs({{"y", es::CompliantNodeBuilder::kEsIrOutputRequired, ""}})
+                    .Build();
+    Tensor value(desc);
+    FUSION_PASS_CHECK(value.SetData(data.data(), data.size()) != GRAPH_SUCCESS,
+                      OP_LOGE(convDescInfo.nodeNameStr, "set %s data failed.", name), return false);
+    FUSION_PASS_CHECK(constNode.SetAttr(ATTR_VALUE, value) != GRAPH_SUCCESS,
+                      OP_LOGE(convDescInfo.nodeNameStr, "set %s value failed.", name), return false);
+    FUSION_PASS_CHECK(constNode.UpdateOutputDesc(OUTPUT_INDEX, desc) != GRAPH_SUCCESS,
+                      OP_LOGE(convDescInfo.nodeNameStr, "update %s output desc failed.", name), return false);
+    return true;
+}
+
+bool ConvBnFoldFusionPass::SetFoldConvAttrs(const GNode& convNode, GNode& foldConv) const
+{
+    ConvBaseAttrs baseAttrs;
+    FUSION_PASS_CHECK_NOLOG(!ConvFusionUtilsPass::GetConvBaseAttr(convNode, baseAttrs, convDescInfo), return false);
+    FUSION_PASS_CHECK(foldConv.SetAttr(STRIDES, baseAttrs.strides) != GRAPH_SUCCESS,
+                      OP_LOGE(convDescInfo.nodeNameStr, "set strides failed."), return false);
+    FUSION_PASS_CHECK(foldConv.SetAttr(PADS, baseAttrs.pads) != GRAPH_SUCCESS,
+                      OP_LOGE(convDescInfo.nodeNameStr, "set pads failed."), return false);
+    FUSION_PASS_CHECK(foldConv.SetAttr(DILATIONS, baseAttrs.dilations) != GRAPH_SUCCESS,
+                      OP_LOGE(convDescInfo.nodeNameStr, "set dilations failed."), return false);
+    FUSION_PASS_CHECK(foldConv.SetAttr(GROUPS, baseAttrs.groups) != GRAPH_SUCCESS,
+                      OP_LOGE(convDescInfo.nodeNameStr, "set groups failed."), return false);
+    FUSION_PASS_CHECK(foldConv.SetAttr(DATA_FORMAT, baseAttrs.dataFormat) != GRAPH_SUCCESS,
+                      OP_LOGE(convDescInfo.nodeNameStr, "set data_format failed."), return false);
+    FUSION_PASS_CHECK(foldConv.SetAttr(OFFSET_X, baseAttrs.offsetX) != GRAPH_SUCCESS,
+                      OP_LOGE(convDescInfo.nodeNameStr, "set offset_x failed."), return false);
+    if (baseAttrs.padding.GetLength() != 0) {
+        FUSION_PASS_CHECK(foldConv.SetAttr(PADDING, baseAttrs.padding) != GRAPH_SUCCESS,
+                          OP_LOGE(convDescInfo.nodeNameStr, "set padding failed."), return false);
+    }
+    AscendString autoPad = "";
+    if (convNode.GetAttr(AUTO_PAD, autoPad) == GRAPH_SUCCESS && autoPad.GetLength() != 0) {
+        FUSION_PASS_CHECK(foldConv.SetAttr(AUTO_PAD, autoPad) != GRAPH_SUCCESS,
+                          OP_LOGE(convDescInfo.nodeNameStr, "set auto_pad failed."), return false);
+    }
+    // 精度模式按原节点透传, 不使用 GetConvBaseAttr 中重置后的默认值
+    int64_t opImplModeEnum = 0;
+    if (convNode.GetAttr(OP_IMPL_MODE_ENUM, opImplModeEnum) == GRAPH_SUCCESS) {
+        FUSION_PASS_CHECK(foldConv.SetAttr(OP_IMPL_MODE_ENUM, opImplModeEnum) != GRAPH_SUCCESS,
+                          OP_LOGE(convDescInfo.nodeNameStr, "set _op_impl_mode_enum failed."), return false);
+    }
+    return true;
+}
+
+bool ConvBnFoldFusionPass::BuildFoldConvNode(es::EsGraphBuilder& graphBuilder, const GNode& convNode,
+                                             const std::vector<es::EsTensorHolder>& inputs, GNode& foldConv) const
+{
+    Graph* geGraph = graphBuilder.GetCGraphBuilder()->GetGraph();
+    FUSION_PASS_CHECK(geGraph == nullptr, OP_LOGE(convDescInfo.nodeNameStr, "get replacement graph failed."),
+                      return false);
+    std::string convName = convDescInfo.nodeNameStr + "_bn_fold";
+    foldConv = es::CompliantNodeBuilder(geGraph)
+                   .OpType(convType.GetString())
+                   .Name(convName.c_str())
+                   .IrDefInputs({
+                       {"x", es::CompliantNodeBuilder::kEsIrInputRequired, ""},
+                       {"filter", es::CompliantNodeBuilder::kEsIrInputRequired, ""},
+                       {"bias", es::CompliantNodeBuilder::kEsIrInputOptional, ""},
+                       {"offset_w", es::CompliantNodeBuilder::kEsIrInputOptional, ""},
+                   })
+                   .IrDefOutputs({{"y", es::CompliantNodeBuilder::kEsIrOutputRequired, ""}})
+                   .Build();
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        FUSION_PASS_CHECK(geGraph->AddDataEdge(*inputs[i].GetProducer(), inputs[i].GetProducerOutIndex(), foldConv,
+                                               static_cast<int32_t>(i)) != GRAPH_SUCCESS,
+                          OP_LOGE(convDescInfo.nodeNameStr, "add fold conv input %zu edge failed.", i), return false);
+    }
+    FUSION_PASS_CHECK_NOLOG(!SetFoldConvAttrs(convNode, foldConv), return false);
+
+    TensorDesc biasDesc(Shape({coutNum}), FORMAT_ND, biasDtype);
+    biasDesc.SetOriginFormat(FORMAT_ND);
+    biasDesc.SetOriginShape(Shape({coutNum}));
+    FUSION_PASS_CHECK(foldConv.UpdateInputDesc(INPUT_FMAP_INDEX, convDescInfo.fmapDesc) != GRAPH_SUCCESS ||
+                          foldConv.UpdateInputDesc(INPUT_FILTER_INDEX, convDescInfo.filterDesc) != GRAPH_SUCCESS ||
+                          foldConv.UpdateInputDesc(INPUT_BIAS_INDEX, biasDesc) != GRAPH_SUCCESS ||
+                          foldConv.UpdateOutputDesc(OUTPUT_INDEX, convDescInfo.outputDesc) != GRAPH_SUCCESS,
+                      OP_LOGE(convDescInfo.nodeNameStr, "update fold conv desc failed."), return false);
+    return true;
+}
+
+GraphUniqPtr ConvBnFoldFusionPass::Replacement(const GNode& convNode)
+{
+    auto graphBuilder = es::EsGraphBuilder("replacement");
+    auto fmap = graphBuilder.CreateInput(BOUNDARY_FMAP_INPUT_IDX);
+    Graph* geGraph = graphBuilder.GetCGraphBuilder()->GetGraph();
+    FUSION_PASS_CHECK(geGraph == nullptr, OP_LOGE(convDescInfo.nodeNameStr, "get replacement graph failed."),
+                      return nullptr);
+
+    GNode filterConst;
+    std::string filterName = convDescInfo.nodeNameStr + "_fold_filter";
+    FUSION_PASS_CHECK_NOLOG(
+        !BuildConstNode(geGraph, filterName.c_str(), convDescInfo.filterDesc, foldFilter, filterConst),
+        return nullptr);
+    TensorDesc biasDesc(Shape({coutNum}), FORMAT_ND, biasDtype);
+    biasDesc.SetOriginFormat(FORMAT_ND);
+    biasDesc.SetOriginShape(Shape({coutNum}));
+    GNode biasConst;
+    std::string biasName = convDescInfo.nodeNameStr + "_fold_bias";
+    FUSION_PASS_CHECK_NOLOG(!BuildConstNode(geGraph, biasName.c_str(), biasDesc, foldBias, biasConst),
+                            return nullptr);
+
+    auto* filterTh = graphBuilder.GetCGraphBuilder()->GetTensorHolderFromNode(filterConst, OUTPUT_INDEX);
+    auto* biasTh = graphBuilder.GetCGraphBuilder()->GetTensorHolderFromNode(biasConst, OUTPUT_INDEX);
+    FUSION_PASS_CHECK(filterTh == nullptr || biasTh == nullptr,
+                      OP_LOGE(convDescInfo.nodeNameStr, "get fold const holder failed."), return nullptr);
+    std::vector<es::EsTensorHolder> convInputs = {fmap, es::EsTensorHolder(filterTh), es::EsTensorHolder(biasTh)};
+
+    GNode foldConv;
+    FUSION_PASS_CHECK(!BuildFoldConvNode(graphBuilder, convNode, convInputs, foldConv),
+                      OP_LOGE(convDescInfo.nodeNameStr, "build fold conv failed."), return nullptr);
+    auto* yHolder = graphBuilder.GetCGraphBuilder()->GetTensorHolderFromNode(foldConv, OUTPUT_INDEX);
+    FUSION_PASS_CHECK(yHolder == nullptr, OP_LOGE(convDescInfo.nodeNameStr, "get fold conv output holder failed."),
+                      return nullptr);
+    return graphBuilder.BuildAndReset({es::EsTensorHolder(yHolder)});
+}
+
+void ConvBnFoldFusionPass::PrintGraphStructure() const
+{
+    OP_LOGI(convDescInfo.nodeNameStr, "conv_bn_fold fusion success: fold %s into %lld channels, bias %s.",
+            foldType == FoldType::BN ? "BN" : "Mul/Add", coutNum, hasBias ? "updated" : "created");
+}
+} // namespace Ops
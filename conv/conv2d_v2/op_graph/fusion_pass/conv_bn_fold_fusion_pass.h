@@ -0,0 +1,114 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CONV_BN_FOLD_FUSION_PASS_H
+#define CONV_BN_FOLD_FUSION_PASS_H
+
+#include <set>
+#include <vector>
+
+#include "../../conv/common/op_graph/fusion_pass/conv_fusion_base_pass.h"
+#include "ge/es_graph_builder.h"
+#include "ge/fusion/subgraph_boundary.h"
+#include "graph/gnode.h"
+
+namespace Ops {
+namespace NN {
+namespace Conv {
+namespace ConvBnFoldFusion {
+
+const ge::AscendString ADD = "Add";
+const ge::AscendString BATCH_NORM = "BatchNorm";
+const ge::AscendString BN_INFER = "BNInfer";
+const ge::AscendString CONSTANT = "Constant";
+const ge::AscendString MUL = "Mul";
+const ge::AscendString ATTR_EPSILON = "epsilon";
+const ge::AscendString ATTR_IS_TRAINING = "is_training";
+const ge::AscendString ATTR_VALUE = "value";
+
+const std::set<ge::AscendString> FOLD_CONV_LIST = {ConvFusionUtils::CONV2D, ConvFusionUtils::CONV2DV2,
+                                                   ConvFusionUtils::CONV3D, ConvFusionUtils::CONV3DV2};
+const std::set<ge::DataType> FOLD_DTYPE_LIST = {ge::DT_FLOAT, ge::DT_FLOAT16};
+
+const std::string FUSION_NAME = "ConvBnFoldFusionPass";
+
+constexpr int32_t BN_SCALE_INPUT_IDX = 1;
+constexpr int32_t BN_OFFSET_INPUT_IDX = 2;
+constexpr int32_t BN_MEAN_INPUT_IDX = 3;
+constexpr int32_t BN_VARIANCE_INPUT_IDX = 4;
+constexpr int32_t INPUT_OFFSET_W_INDEX = 3;
+constexpr int64_t BOUNDARY_FMAP_INPUT_IDX = 0;
+constexpr int64_t BOUNDARY_OUTPUT_IDX = 0;
+constexpr size_t BN_INPUT_NUM = 5;
+constexpr size_t ELTWISE_INPUT_NUM = 2;
+constexpr size_t SINGLE_REF_CNT = 1;
+constexpr float BATCH_NORM_DEFAULT_EPSILON = 0.0001f;
+
+// 卷积后接的逐通道仿射类型: y = conv(x) * scale + shift
+enum class FoldType {
+    NONE,
+    BN,     // BNInfer 或 is_training=false 的 BatchNorm
+    MUL_ADD // 常量 Mul, 可选后接常量 Add
+};
+} // namespace ConvBnFoldFusion
+
+// Conv(x, W, b) -> BN/Mul[-Add]  ==>  Conv(x, W * s, b * s + t), 权重与偏置在编译期折叠
+class __attribute__((visibility("default"))) ConvBnFoldFusionPass : public ConvFusionBasePass {
+protected:
+    void InitMember() override;
+    bool CheckMatchStructure(const ge::GNode& convNode) override;
+    bool MeetRequirements(const ge::GNode& convNode) override;
+    std::set<ge::AscendString> GetNodeTypes() const override;
+    void PrintGraphStructure() const override;
+    bool ConvFusionReplaceImpl(ge::GraphPtr& graph, ge::GNode& convNode, ge::CustomPassContext& passContext) override;
+    std::unique_ptr<ge::fusion::SubgraphBoundary> ConstructBoundary(const ge::GNode& convNode) override;
+    ge::fusion::GraphUniqPtr Replacement(const ge::GNode& convNode) override;
+
+private:
+    bool GetSingleConsumer(const ge::GNode& node, ge::GNodePtr& consumer, ge::AscendString& consumerType) const;
+    bool CheckBatchNormInference(const ge::GNode& bnNode) const;
+    bool GetChannelAxis();
+    bool IsPerChannelShape(const std::vector<int64_t>& dims) const;
+    bool GetConstInput(const ge::GNode& node, int32_t inputIdx, ge::Tensor& value) const;
+    bool GetEltwiseConstInput(const ge::GNode& eltwiseNode, const ge::GNode& dataNode, ge::Tensor& value) const;
+    bool ReadAsFloat(const ge::Tensor& tensor, std::vector<float>& values) const;
+    bool ReadPerChannel(const ge::Tensor& tensor, std::vector<float>& values) const;
+    bool CalcBnScaleShift();
+    bool CalcMulAddScaleShift(const ge::GNode& convNode);
+    bool FoldWeight();
+    bool FoldBias();
+    bool BuildConstNode(ge::Graph* graph, const char* name, const ge::TensorDesc& desc,
+                        const std::vector<float>& values, ge::GNode& constNode) const;
+    bool SetFoldConvAttrs(const ge::GNode& convNode, ge::GNode& foldConv) const;
+    bool BuildFoldConvNode(ge::es::EsGraphBuilder& graphBuilder, const ge::GNode& convNode,
+                           const std::vector<ge::es::EsTensorHolder>& inputs, ge::GNode& foldConv) const;
+
+    ConvBnFoldFusion::FoldType foldType = ConvBnFoldFusion::FoldType::NONE;
+    ge::AscendString convType = "";
+    ge::GNodePtr headNode = nullptr;
+    ge::GNodePtr tailNode = nullptr;
+    ge::TensorDesc tailOutputDesc = {};
+    ge::Tensor filterTensor = {};
+    ge::Tensor biasTensor = {};
+    std::vector<float> channelScale = {};
+    std::vector<float> channelShift = {};
+    std::vector<float> foldFilter = {};
+    std::vector<float> foldBias = {};
+    ge::DataType biasDtype = ge::DT_UNDEFINED;
+    int64_t coutNum = 0;
+    int32_t outChannelAxis = 0;
+    int32_t filterCoutAxis = 0;
+    bool hasBias = false;
+};
+
+} // namespace Conv
+} // namespace NN
+} // namespace Ops
+#endif // CONV_BN_FOLD_FUSION_PASS_H
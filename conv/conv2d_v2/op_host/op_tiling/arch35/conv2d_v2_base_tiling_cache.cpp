@@ -183,6 +183,7 @@ void Conv2dBaseTiling::GetCacheTilingInputArgs()
     cacheInputArgs_.padRight = attrInfo_.padRight;
     cacheInputArgs_.biasFlag = flagInfo_.hasBias;
     cacheInputArgs_.hf32Flag = (attrInfo_.hf32Mode == 1);
+    cacheInputArgs_.numBlocksSearchBudget = GetConvNumBlocksSearchBudget();
     GetCacheTilingInputArgsExtend();
 }
 
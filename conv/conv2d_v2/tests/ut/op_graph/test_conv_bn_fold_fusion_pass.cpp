@@ -0,0 +1,406 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "../../../../../common/graph_fusion/cube_utils/cube_fp16_t.h"
+#include "../../../../common/tests/ut/op_graph/test_conv_fusion_pass_framework.h"
+#include "../../../op_graph/fusion_pass/conv_bn_fold_fusion_pass.h"
+
+#include "version/ge-compiler_version.h"
+#if GE_COMPILER_VERSION_NUM >= 90000000U
+
+using namespace ge;
+using namespace es;
+using namespace fe;
+using namespace Ops;
+using namespace NN;
+using namespace Conv;
+using namespace ConvFusionUtils;
+using namespace test_conv_fusion_framework;
+
+namespace {
+constexpr int64_t BATCH = 1;
+constexpr int64_t CIN = 3;
+constexpr int64_t COUT = 4;
+constexpr int64_t IN_HW = 5;
+constexpr int64_t KERNEL = 3;
+constexpr int64_t OUT_HW = IN_HW - KERNEL + 1;
+constexpr float BN_EPSILON = 0.001f;
+
+enum class TailType { BN_INFER, BATCH_NORM, MUL_ADD, MUL_ONLY };
+
+struct FoldGraphOptions {
+    TailType tail = TailType::BN_INFER;
+    DataType dtype = DT_FLOAT;
+    bool withBias = false;
+    bool isTraining = false;
+    bool filterFromData = false;
+    std::vector<int64_t> mulShape = {1, COUT, 1, 1};
+};
+
+// 构造确定性的测试数据, 避免引入随机数导致用例不稳定
+std::vector<float> MakeValues(size_t count, float base, float step)
+{
+    std::vector<float> values(count);
+    for (size_t i = 0; i < count; ++i) {
+        values[i] = base + step * static_cast<float>(static_cast<int64_t>(i % 7) - 3);
+    }
+    return values;
+}
+
+std::vector<float> ReadTensor(const Tensor& tensor)
+{
+    std::vector<float> values;
+    if (tensor.GetTensorDesc().GetDataType() == DT_FLOAT16) {
+        const uint16_t* data = reinterpret_cast<const uint16_t*>(tensor.GetData());
+        for (size_t i = 0; i < tensor.GetSize() / sizeof(uint16_t); ++i) {
+            fp16_t half(data[i]);
+            values.push_back(static_cast<float>(half));
+        }
+        return values;
+    }
+    const float* data = reinterpret_cast<const float*>(tensor.GetData());
+    values.assign(data, data + tensor.GetSize() / sizeof(float));
+    return values;
+}
+
+// NCHW 输入, NCHW(Cout, Cin, Kh, Kw) 权重, stride 1, 无 pad 的参考卷积
+std::vector<float> RefConv2d(const std::vector<float>& x, const std::vector<float>& w, const std::vector<float>& b)
+{
+    std::vector<float> y(BATCH * COUT * OUT_HW * OUT_HW, 0.0f);
+    for (int64_t co = 0; co < COUT; ++co) {
+        for (int64_t oh = 0; oh < OUT_HW; ++oh) {
+            for (int64_t ow = 0; ow < OUT_HW; ++ow) {
+                double acc = b.empty() ? 0.0 : b[co];
+                for (int64_t ci = 0; ci < CIN; ++ci) {
+                    for (int64_t kh = 0; kh < KERNEL; ++kh) {
+                        for (int64_t kw = 0; kw < KERNEL; ++kw) {
+                            acc += static_cast<double>(x[(ci * IN_HW + oh + kh) * IN_HW + ow + kw]) *
+                                   w[((co * CIN + ci) * KERNEL + kh) * KERNEL + kw];
+                        }
+                    }
+                }
+                y[(co * OUT_HW + oh) * OUT_HW + ow] = static_cast<float>(acc);
+            }
+        }
+    }
+    return y;
+}
+} // namespace
+
+class ConvBnFoldFusionPassTest : public testing::Test {
+protected:
+    static void SetUpTestCase() { std::cout << "ConvBnFoldFusionPassTest SetUp" << std::endl; }
+
+    static void TearDownTestCase() { std::cout << "ConvBnFoldFusionPassTest TearDown" << std::endl; }
+
+    GNode CreateConst(Graph* graph, const std::string& name, DataType dtype, Format fmt,
+                      const std::vector<int64_t>& shape, const std::vector<float>& values)
+    {
+        auto node = CompliantNodeBuilder(graph)
+                        .OpType("Const")
+                        .Name(name.c_str())
+                        .IrDefOutputs({{"y", CompliantNodeBuilder::kEsIrOutputRequired, ""}})
+                        .Build();
+        std::vector<uint8_t> data;
+        if (dtype == DT_FLOAT16) {
+            data.resize(values.size() * sizeof(uint16_t));
+            uint16_t* halfData = reinterpret_cast<uint16_t*>(data.data());
+            for (size_t i = 0; i < values.size(); ++i) {
+                fp16_t half(values[i]);
+                halfData[i] = half.val;
+            }
+        } else {
+            data.resize(values.size() * sizeof(float));
+            std::copy(values.begin(), values.end(), reinterpret_cast<float*>(data.data()));
+        }
+        Tensor valueTensor(TensorDesc(Shape(shape), fmt, dtype));
+        valueTensor.SetData(data.data(), data.size());
+        node.SetAttr(AscendString("value"), valueTensor);
+        TensorDesc outDesc(Shape(shape), fmt, dtype);
+        outDesc.SetOriginFormat(fmt);
+        outDesc.SetOriginShape(Shape(shape));
+        node.UpdateOutputDesc(0, outDesc);
+        return node;
+    }
+
+    static TensorDesc MakeDesc(const std::vector<int64_t>& shape, Format fmt, DataType dtype)
+    {
+        TensorDesc desc(Shape(shape), fmt, dtype);
+        desc.SetOriginFormat(fmt);
+        desc.SetOriginShape(Shape(shape));
+        return desc;
+    }
+
+    GNode CreateNode(Graph* graph, const char* opType, const char* name, size_t inputNum, size_t outputNum = 1)
+    {
+        std::vector<CompliantNodeBuilder::IrInputDef> irInputs;
+        for (size_t i = 0; i < inputNum; ++i) {
+            irInputs.push_back({("x" + std::to_string(i)).c_str(), CompliantNodeBuilder::kEsIrInputRequired, ""});
+        }
+        std::vector<CompliantNodeBuilder::IrOutputDef> irOutputs;
+        for (size_t i = 0; i < outputNum; ++i) {
+            irOutputs.push_back({("y" + std::to_string(i)).c_str(), CompliantNodeBuilder::kEsIrOutputRequired, ""});
+        }
+        return CompliantNodeBuilder(graph)
+            .OpType(opType)
+            .Name(name)
+            .IrDefInputs(irInputs)
+            .IrDefOutputs(irOutputs)
+            .Build();
+    }
+
+    GNode CreateConv2D(Graph* graph, DataType dtype)
+    {
+        auto node = CompliantNodeBuilder(graph)
+                        .OpType("Conv2D")
+                        .Name("conv2d")
+                        .IrDefInputs({{"x", CompliantNodeBuilder::kEsIrInputRequired, ""},
+                                      {"filter", CompliantNodeBuilder::kEsIrInputRequired, ""},
+                                      {"bias", CompliantNodeBuilder::kEsIrInputOptional, ""},
+                                      {"offset_w", CompliantNodeBuilder::kEsIrInputOptional, ""}})
+                        .IrDefOutputs({{"y", CompliantNodeBuilder::kEsIrOutputRequired, ""}})
+                        .Build();
+        node.SetAttr(AscendString("strides"), std::vector<int64_t>{1, 1, 1, 1});
+        node.SetAttr(AscendString("pads"), std::vector<int64_t>{0, 0, 0, 0});
+        node.SetAttr(AscendString("dilations"), std::vector<int64_t>{1, 1, 1, 1});
+        node.SetAttr(AscendString("groups"), static_cast<int64_t>(1));
+        node.SetAttr(AscendString("data_format"), AscendString("NCHW"));
+        node.SetAttr(AscendString("offset_x"), static_cast<int64_t>(0));
+        node.UpdateInputDesc(0, MakeDesc({BATCH, CIN, IN_HW, IN_HW}, FORMAT_NCHW, dtype));
+        node.UpdateInputDesc(1, MakeDesc({COUT, CIN, KERNEL, KERNEL}, FORMAT_NCHW, dtype));
+        node.UpdateOutputDesc(0, MakeDesc({BATCH, COUT, OUT_HW, OUT_HW}, FORMAT_NCHW, dtype));
+        return node;
+    }
+
+    GNode BuildBnTail(Graph* graph, GNode& conv, const FoldGraphOptions& opt)
+    {
+        bool isBatchNorm = opt.tail == TailType::BATCH_NORM;
+        GNode bn = CreateNode(graph, isBatchNorm ? "BatchNorm" : "BNInfer", "bn", 5, isBatchNorm ? 6 : 1);
+        bn.SetAttr(AscendString("epsilon"), BN_EPSILON);
+        if (isBatchNorm) {
+            bn.SetAttr(AscendString("is_training"), opt.isTraining);
+            bn.SetAttr(AscendString("data_format"), AscendString("NCHW"));
+        }
+        graph->AddDataEdge(conv, 0, bn, 0);
+        const std::vector<const char*> names = {"bn_scale", "bn_offset", "bn_mean", "bn_variance"};
+        const std::vector<std::vector<float>*> params = {&bnScale, &bnOffset, &bnMean, &bnVariance};
+        for (size_t i = 0; i < names.size(); ++i) {
+            auto param = CreateConst(graph, names[i], DT_FLOAT, FORMAT_ND, {COUT}, *params[i]);
+            graph->AddDataEdge(param, 0, bn, static_cast<int32_t>(i + 1));
+            bn.UpdateInputDesc(static_cast<int32_t>(i + 1), MakeDesc({COUT}, FORMAT_ND, DT_FLOAT));
+        }
+        bn.UpdateInputDesc(0, MakeDesc({BATCH, COUT, OUT_HW, OUT_HW}, FORMAT_NCHW, opt.dtype));
+        bn.UpdateOutputDesc(0, MakeDesc({BATCH, COUT, OUT_HW, OUT_HW}, FORMAT_NCHW, opt.dtype));
+        return bn;
+    }
+
+    GNode BuildMulAddTail(Graph* graph, GNode& conv, const FoldGraphOptions& opt)
+    {
+        const std::vector<int64_t> outShape = {BATCH, COUT, OUT_HW, OUT_HW};
+        size_t mulCount = 1;
+        for (auto dim : opt.mulShape) {
+            mulCount *= static_cast<size_t>(dim);
+        }
+        mulValue = MakeValues(mulCount, 0.8f, 0.15f);
+        GNode mul = CreateNode(graph, "Mul", "mul", 2);
+        auto mulConst = CreateConst(graph, "mul_const", opt.dtype, FORMAT_NCHW, opt.mulShape, mulValue);
+        graph->AddDataEdge(conv, 0, mul, 0);
+        graph->AddDataEdge(mulConst, 0, mul, 1);
+        mul.UpdateInputDesc(0, MakeDesc(outShape, FORMAT_NCHW, opt.dtype));
+        mul.UpdateInputDesc(1, MakeDesc(opt.mulShape, FORMAT_NCHW, opt.dtype));
+        mul.UpdateOutputDesc(0, MakeDesc(outShape, FORMAT_NCHW, opt.dtype));
+        if (opt.tail == TailType::MUL_ONLY) {
+            return mul;
+        }
+        GNode add = CreateNode(graph, "Add", "add", 2);
+        auto addConst = CreateConst(graph, "add_const", opt.dtype, FORMAT_NCHW, {1, COUT, 1, 1}, addValue);
+        graph->AddDataEdge(addConst, 0, add, 0);
+        graph->AddDataEdge(mul, 0, add, 1);
+        add.UpdateInputDesc(0, MakeDesc({1, COUT, 1, 1}, FORMAT_NCHW, opt.dtype));
+        add.UpdateInputDesc(1, MakeDesc(outShape, FORMAT_NCHW, opt.dtype));
+        add.UpdateOutputDesc(0, MakeDesc(outShape, FORMAT_NCHW, opt.dtype));
+        return add;
+    }
+
+    GraphPtr BuildConvFoldGraph(const FoldGraphOptions& opt)
+    {
+        EsGraphBuilder graphBuilder("test_conv_bn_fold");
+        auto input = graphBuilder.CreateInput(0, "input", opt.dtype, FORMAT_NCHW, {BATCH, CIN, IN_HW, IN_HW});
+        Graph* graph = graphBuilder.GetCGraphBuilder()->GetGraph();
+
+        GNode conv = CreateConv2D(graph, opt.dtype);
+        graph->AddDataEdge(*input.GetProducer(), input.GetProducerOutIndex(), conv, 0);
+        if (opt.filterFromData) {
+            auto filterData =
+                graphBuilder.CreateInput(1, "filter", opt.dtype, FORMAT_NCHW, {COUT, CIN, KERNEL, KERNEL});
+            graph->AddDataEdge(*filterData.GetProducer(), filterData.GetProducerOutIndex(), conv, 1);
+        } else {
+            auto filter =
+                CreateConst(graph, "filter", opt.dtype, FORMAT_NCHW, {COUT, CIN, KERNEL, KERNEL}, filterValue);
+            graph->AddDataEdge(filter, 0, conv, 1);
+        }
+        if (opt.withBias) {
+            auto bias = CreateConst(graph, "bias", opt.dtype, FORMAT_ND, {COUT}, biasValue);
+            graph->AddDataEdge(bias, 0, conv, 2);
+            conv.UpdateInputDesc(2, MakeDesc({COUT}, FORMAT_ND, opt.dtype));
+        }
+
+        bool isBn = opt.tail == TailType::BN_INFER || opt.tail == TailType::BATCH_NORM;
+        GNode tail = isBn ? BuildBnTail(graph, conv, opt) : BuildMulAddTail(graph, conv, opt);
+        auto outHolder = EsTensorHolder(graphBuilder.GetCGraphBuilder()->GetTensorHolderFromNode(tail, 0));
+        return graphBuilder.BuildAndReset({outHolder});
+    }
+
+    void TestTotalPass(const std::string& passName, GraphPtr& graph, Status expectRes)
+    {
+        CustomPassContext passContext;
+        passContext.SetPassName(passName.c_str());
+        ConvBnFoldFusionPass pass;
+        auto res = pass.Run(graph, passContext);
+        EXPECT_EQ(res, expectRes);
+    }
+
+    // 未折叠图在 CPU 上的参考结果: conv 后逐通道做 BN 或 Mul/Add
+    std::vector<float> RefUnfolded(const FoldGraphOptions& opt) const
+    {
+        std::vector<float> y = RefConv2d(inputValue, filterValue, opt.withBias ? biasValue : std::vector<float>());
+        size_t plane = static_cast<size_t>(OUT_HW * OUT_HW);
+        for (size_t i = 0; i < y.size(); ++i) {
+            size_t c = i / plane;
+            if (opt.tail == TailType::BN_INFER || opt.tail == TailType::BATCH_NORM) {
+                y[i] = (y[i] - bnMean[c]) / std::sqrt(bnVariance[c] + BN_EPSILON) * bnScale[c] + bnOffset[c];
+            } else {
+                float shift = opt.tail == TailType::MUL_ADD ? addValue[c] : 0.0f;
+                y[i] = y[i] * mulValue[mulValue.size() == 1 ? 0 : c] + shift;
+            }
+        }
+        return y;
+    }
+
+    // 从折叠后的图中取出新的权重/偏置常量, 在 CPU 上重新计算卷积
+    std::vector<float> RunFolded(GraphPtr& graph) const
+    {
+        GNode foldConv;
+        EXPECT_TRUE(GraphChecker::FindFirstNodeByOpType(graph, "Conv2D", foldConv));
+        Tensor foldFilter;
+        Tensor foldBias;
+        auto filterPair = foldConv.GetInDataNodesAndPortIndexs(1);
+        auto biasPair = foldConv.GetInDataNodesAndPortIndexs(2);
+        EXPECT_NE(filterPair.first, nullptr);
+        EXPECT_NE(biasPair.first, nullptr);
+        if (filterPair.first == nullptr || biasPair.first == nullptr) {
+            return {};
+        }
+        EXPECT_EQ(filterPair.first->GetAttr(AscendString("value"), foldFilter), GRAPH_SUCCESS);
+        EXPECT_EQ(biasPair.first->GetAttr(AscendString("value"), foldBias), GRAPH_SUCCESS);
+        return RefConv2d(inputValue, ReadTensor(foldFilter), ReadTensor(foldBias));
+    }
+
+    void CheckFoldedClose(const FoldGraphOptions& opt, float tolerance)
+    {
+        auto graph = BuildConvFoldGraph(opt);
+        ASSERT_NE(graph, nullptr);
+        std::vector<float> expect = RefUnfolded(opt);
+        TestTotalPass("conv_bn_fold", graph, SUCCESS);
+        EXPECT_EQ(GraphChecker::CountNodes(graph, "Conv2D"), 1);
+        EXPECT_FALSE(GraphChecker::HasNode(graph, "BNInfer"));
+        EXPECT_FALSE(GraphChecker::HasNode(graph, "BatchNorm"));
+        EXPECT_FALSE(GraphChecker::HasNode(graph, "Mul"));
+        EXPECT_FALSE(GraphChecker::HasNode(graph, "Add"));
+        std::vector<float> actual = RunFolded(graph);
+        ASSERT_EQ(actual.size(), expect.size());
+        for (size_t i = 0; i < expect.size(); ++i) {
+            EXPECT_NEAR(actual[i], expect[i], tolerance * std::max(1.0f, std::fabs(expect[i]))) << "index " << i;
+        }
+    }
+
+    std::vector<float> inputValue = MakeValues(BATCH * CIN * IN_HW * IN_HW, 0.1f, 0.25f);
+    std::vector<float> filterValue = MakeValues(COUT * CIN * KERNEL * KERNEL, 0.05f, 0.125f);
+    std::vector<float> biasValue = MakeValues(COUT, 0.5f, 0.25f);
+    std::vector<float> bnScale = MakeValues(COUT, 1.2f, 0.1f);
+    std::vector<float> bnOffset = MakeValues(COUT, -0.3f, 0.2f);
+    std::vector<float> bnMean = MakeValues(COUT, 0.4f, 0.3f);
+    std::vector<float> bnVariance = MakeValues(COUT, 2.0f, 0.5f);
+    std::vector<float> mulValue = {};
+    std::vector<float> addValue = MakeValues(COUT, 0.25f, 0.5f);
+};
+
+TEST_F(ConvBnFoldFusionPassTest, conv2d_bninfer_fold_success)
+{
+    FoldGraphOptions opt;
+    CheckFoldedClose(opt, 1e-5f);
+}
+
+TEST_F(ConvBnFoldFusionPassTest, conv2d_bias_batchnorm_inference_fold_success)
+{
+    FoldGraphOptions opt;
+    opt.tail = TailType::BATCH_NORM;
+    opt.withBias = true;
+    CheckFoldedClose(opt, 1e-5f);
+}
+
+TEST_F(ConvBnFoldFusionPassTest, conv2d_mul_add_fold_success)
+{
+    FoldGraphOptions opt;
+    opt.tail = TailType::MUL_ADD;
+    opt.withBias = true;
+    CheckFoldedClose(opt, 1e-5f);
+}
+
+TEST_F(ConvBnFoldFusionPassTest, conv2d_scalar_mul_fold_success)
+{
+    FoldGraphOptions opt;
+    opt.tail = TailType::MUL_ONLY;
+    opt.mulShape = {1};
+    CheckFoldedClose(opt, 1e-5f);
+}
+
+TEST_F(ConvBnFoldFusionPassTest, conv2d_fp16_bninfer_fold_success)
+{
+    FoldGraphOptions opt;
+    opt.dtype = DT_FLOAT16;
+    opt.withBias = true;
+    // 误差来自权重与偏置常量的 fp16 舍入
+    CheckFoldedClose(opt, 5e-3f);
+}
+
+TEST_F(ConvBnFoldFusionPassTest, batchnorm_training_reject)
+{
+    FoldGraphOptions opt;
+    opt.tail = TailType::BATCH_NORM;
+    opt.isTraining = true;
+    auto graph = BuildConvFoldGraph(opt);
+    TestTotalPass("batchnorm_training_reject", graph, CONV_NOT_CHANGED);
+    EXPECT_TRUE(GraphChecker::HasNode(graph, "BatchNorm"));
+}
+
+TEST_F(ConvBnFoldFusionPassTest, mul_not_per_channel_reject)
+{
+    FoldGraphOptions opt;
+    opt.tail = TailType::MUL_ONLY;
+    opt.mulShape = {1, COUT, OUT_HW, OUT_HW};
+    auto graph = BuildConvFoldGraph(opt);
+    TestTotalPass("mul_not_per_channel_reject", graph, CONV_NOT_CHANGED);
+    EXPECT_TRUE(GraphChecker::HasNode(graph, "Mul"));
+}
+
+TEST_F(ConvBnFoldFusionPassTest, filter_not_const_reject)
+{
+    FoldGraphOptions opt;
+    opt.filterFromData = true;
+    auto graph = BuildConvFoldGraph(opt);
+    TestTotalPass("filter_not_const_reject", graph, CONV_NOT_CHANGED);
+    EXPECT_TRUE(GraphChecker::HasNode(graph, "BNInfer"));
+}
+
+#endif // GE_COMPILER_VERSION_NUM
@@ -95,6 +95,7 @@ void Conv3dBaseTilingV2::GetCacheTilingInputArgs()
     cacheInputArgs_.padRight = attrInfo_.padRight;
     cacheInputArgs_.biasFlag = flagInfo_.hasBias;
     cacheInputArgs_.hf32Flag = (attrInfo_.hf32Mode == 1);
+    cacheInputArgs_.numBlocksSearchBudget = GetConvNumBlocksSearchBudget();
     cacheInputArgs_.dual_output = 0;
     cacheInputArgs_.quantMode0 = 0;
     cacheInputArgs_.reluMode0 = 0;
@@ -4529,4 +4529,109 @@ TEST_F(TestConv3dV2Tiling, NetWorks_ND2NZ_limits)
 
     int64_t ret1 = testTiling.GetTiling(tilingData);
     EXPECT_EQ(ret1, -1);
-}
\ No newline at end of file
+}
+
+TEST_F(TestConv3dV2Tiling, NumBlocksSearch_distinct_split_and_budget)
+{
+    std::vector<uint32_t> splitRange;
+    optiling::conv_ops_tiling::ConvCalcDistinctSplit(10, 32, splitRange);
+    EXPECT_EQ(splitRange, std::vector<uint32_t>({1, 2, 3, 4, 5, 10}));
+    splitRange.clear();
+    optiling::conv_ops_tiling::ConvCalcDistinctSplit(100, 8, splitRange);
+    EXPECT_EQ(splitRange, std::vector<uint32_t>({1, 2, 3, 4, 5, 6, 7, 8}));
+
+    unsetenv("CONV_NUMBLOCKS_SEARCH_BUDGET_US");
+    EXPECT_EQ(optiling::conv_ops_tiling::GetConvNumBlocksSearchBudget(), 0U);
+    setenv("CONV_NUMBLOCKS_SEARCH_BUDGET_US", "abc", 1);
+    EXPECT_EQ(optiling::conv_ops_tiling::GetConvNumBlocksSearchBudget(), 0U);
+    setenv("CONV_NUMBLOCKS_SEARCH_BUDGET_US", "2000", 1);
+    EXPECT_EQ(optiling::conv_ops_tiling::GetConvNumBlocksSearchBudget(), 2000U);
+    unsetenv("CONV_NUMBLOCKS_SEARCH_BUDGET_US");
+}
+
+static optiling::conv_ops_tiling::ConvAscendcTilingInfo MakeNumBlocksSearchTilingInfo()
+{
+    optiling::conv_ops_tiling::ConvAscendcTilingInfo tilingInfo{};
+    tilingInfo.shapeInfo.batch = 3;
+    tilingInfo.shapeInfo.ci = 32;
+    tilingInfo.shapeInfo.di = 11;
+    tilingInfo.shapeInfo.hi = 7;
+    tilingInfo.shapeInfo.wi = 7;
+    tilingInfo.shapeInfo.kd = 1;
+    tilingInfo.shapeInfo.kh = 1;
+    tilingInfo.shapeInfo.kw = 1;
+    tilingInfo.shapeInfo.co = 320;
+    tilingInfo.shapeInfo.dout = 11;
+    tilingInfo.shapeInfo.ho = 7;
+    tilingInfo.shapeInfo.wo = 7;
+    tilingInfo.descInfo.weightDtype = ge::DataType::DT_FLOAT16;
+    tilingInfo.descInfo.fMapDtype = ge::DataType::DT_FLOAT16;
+    tilingInfo.descInfo.biasDtype = ge::DataType::DT_FLOAT16;
+    tilingInfo.descInfo.outDtype = ge::DataType::DT_FLOAT16;
+    tilingInfo.descInfo.out1Dtype = ge::DataType::DT_FLOAT16;
+    tilingInfo.descInfo.weightFormat = ge::FORMAT_NCDHW;
+    tilingInfo.descInfo.fMapFormat = ge::FORMAT_NCDHW;
+    tilingInfo.descInfo.outFormat = ge::FORMAT_NCDHW;
+    tilingInfo.flagInfo.convGroupType = optiling::conv_ops_tiling::ConvGroupType::NORMAL_CONV;
+    tilingInfo.attrInfo.dilationD = 1;
+    tilingInfo.attrInfo.dilationH = 1;
+    tilingInfo.attrInfo.dilationW = 1;
+    tilingInfo.attrInfo.strideD = 1;
+    tilingInfo.attrInfo.strideH = 1;
+    tilingInfo.attrInfo.strideW = 1;
+    tilingInfo.attrInfo.groups = 1;
+    tilingInfo.nodeInfo.nodeName = "conv3d_v2";
+    tilingInfo.nodeInfo.nodeType = "conv3d_v2";
+    tilingInfo.platformInfo.aicoreNum = AIC_NUM;
+    tilingInfo.platformInfo.l1Size = MEM_SIZE_512K;
+    tilingInfo.platformInfo.l0aSize = MEM_SIZE_64K;
+    tilingInfo.platformInfo.l0bSize = MEM_SIZE_64K;
+    tilingInfo.platformInfo.l0cSize = MEM_SIZE_256K;
+    tilingInfo.platformInfo.ubSize = MEM_SIZE_256K;
+    tilingInfo.platformInfo.btSize = MEM_SIZE_4K;
+    tilingInfo.platformInfo.npuArch = NpuArch::DAV_3510;
+    return tilingInfo;
+}
+
+TEST_F(TestConv3dV2Tiling, NumBlocksSearch_msplit_refines_greedy_split)
+{
+    // 贪心结果为(3, 2, 5, 1, 1), 搜索按含尾块浪费的代价改选N方向切10份
+    unsetenv("CONV_NUMBLOCKS_SEARCH_BUDGET_US");
+    optiling::conv_ops_tiling::ConvAscendcTilingInfo greedyInfo = MakeNumBlocksSearchTilingInfo();
+    optiling::conv_ops_tiling::ConvBaseDeci greedyDeci;
+    ASSERT_EQ(greedyDeci.GetNumBlocksInfo(greedyInfo), ge::GRAPH_SUCCESS);
+    EXPECT_TRUE(greedyInfo.flagInfo.mSplitModeFlag);
+    EXPECT_EQ(greedyInfo.numBlocksRes.batchDim, 3U);
+    EXPECT_EQ(greedyInfo.numBlocksRes.mDim, 2U);
+    EXPECT_EQ(greedyInfo.numBlocksRes.nDim, 5U);
+    EXPECT_EQ(greedyInfo.numBlocksRes.doDim, 1U);
+    EXPECT_EQ(greedyDeci.numBlocksSearchLeafCnt_, 0U);
+
+    setenv("CONV_NUMBLOCKS_SEARCH_BUDGET_US", "1000000", 1);
+    optiling::conv_ops_tiling::ConvAscendcTilingInfo searchInfo = MakeNumBlocksSearchTilingInfo();
+    optiling::conv_ops_tiling::ConvBaseDeci searchDeci;
+    ASSERT_EQ(searchDeci.GetNumBlocksInfo(searchInfo), ge::GRAPH_SUCCESS);
+    unsetenv("CONV_NUMBLOCKS_SEARCH_BUDGET_US");
+    EXPECT_TRUE(searchInfo.flagInfo.mSplitModeFlag);
+    EXPECT_EQ(searchInfo.numBlocksRes.batchDim, 3U);
+    EXPECT_EQ(searchInfo.numBlocksRes.mDim, 1U);
+    EXPECT_EQ(searchInfo.numBlocksRes.nDim, 10U);
+    EXPECT_EQ(searchInfo.numBlocksRes.doDim, 1U);
+    EXPECT_EQ(searchInfo.numBlocksRes.groupDim, 1U);
+    EXPECT_FALSE(searchDeci.numBlocksSearchTimeout_);
+    EXPECT_EQ(searchDeci.numBlocksSearchLeafCnt_, 153U);
+}
+
+TEST_F(TestConv3dV2Tiling, NumBlocksSearch_budget_cuts_search_short)
+{
+    // 耗时上限1us, 首次计时检查(第64个候选)即超时, 提前结束并保留不劣于贪心的合法切分
+    setenv("CONV_NUMBLOCKS_SEARCH_BUDGET_US", "1", 1);
+    optiling::conv_ops_tiling::ConvAscendcTilingInfo tilingInfo = MakeNumBlocksSearchTilingInfo();
+    optiling::conv_ops_tiling::ConvBaseDeci deci;
+    ASSERT_EQ(deci.GetNumBlocksInfo(tilingInfo), ge::GRAPH_SUCCESS);
+    unsetenv("CONV_NUMBLOCKS_SEARCH_BUDGET_US");
+    EXPECT_TRUE(deci.numBlocksSearchTimeout_);
+    EXPECT_EQ(deci.numBlocksSearchLeafCnt_, 64U);
+    const auto& res = tilingInfo.numBlocksRes;
+    EXPECT_LE(res.batchDim * res.mDim * res.nDim * res.doDim * res.groupDim, AIC_NUM);
+}
@@ -21,18 +21,23 @@ namespace ge {
  *
  * @par Inputs:
  * @li base_addr: Base address tensor, supports DT_INT64 and DT_UINT64.
- * @li x: Index tensor, supports DT_INT64 and DT_UINT64.
+ * @li x: Block index tensor, supports DT_INT64 and DT_UINT64. Shape is [2] for one (row, col) block,
+ *     or [K, 2] for a batch of K blocks.
  *
  * @par Attributes:
  * @li ori_shape: Original matrix shape.
  * @li block_size: Block matrix shape.
- * @li ori_storage_mode: Storage mode of original tensor, default "Matrix".
- * @li block_storage_mode: Storage mode of block tensor, default "Matrix".
+ * @li ori_storage_mode: Storage mode of original tensor, "Matrix" or "UT", default "Matrix".
+ *     "UT" means the square matrix is stored as packed row-major upper triangle.
+ * @li block_storage_mode: Storage mode of block tensor, "Matrix" or "UT", default "Matrix".
+ *     "UT" means only elements with col >= row are addressed.
  * @li rank_id: Rank id, default 0.
  * @li dtype: Base tensor dtype, default DT_FLOAT.
  *
  * @par Outputs:
- * @li addrs_table: Address table tensor, supports DT_INT64 and DT_UINT64.
+ * @li addrs_table: Address table tensor, supports DT_INT64 and DT_UINT64. Shape is [K * block_size[0], 4],
+ *     each item is (rank_id, src_addr, dst_addr, size). Contiguous items are merged,
+ *     unused trailing items are filled with 0.
  */
 REG_OP(IndexToAddr)
     .INPUT(base_addr, TensorType({DT_INT64, DT_UINT64}))
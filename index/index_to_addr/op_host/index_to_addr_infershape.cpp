@@ -18,9 +18,12 @@
 
 namespace ops {
 namespace {
+constexpr size_t kInputXIdx = 1U;
 constexpr size_t kAttrBlockSizeIdx = 1U;
 constexpr size_t kBlockSizeDimNum = 2U;
+constexpr size_t kBatchIndexDimNum = 2U;
 constexpr size_t kOutputColNum = 4U;
+constexpr int64_t kUnknownDim = -1;
 } // namespace
 
 static ge::graphStatus InferShapeForIndexToAddr(gert::InferShapeContext* context)
@@ -33,11 +36,15 @@ static ge::graphStatus InferShapeForIndexToAddr(gert::InferShapeContext* context
                 OP_LOGE(context->GetNodeName(), "Attr block_size size[%zu] must be 2.", blockSize->GetSize()),
                 return ge::GRAPH_FAILED);
 
+    auto xShape = context->GetInputShape(kInputXIdx);
+    OP_CHECK_NULL_WITH_CONTEXT(context, xShape);
     auto outShape = context->GetOutputShape(0);
     OP_CHECK_NULL_WITH_CONTEXT(context, outShape);
     const auto blockSizeData = static_cast<const int64_t*>(blockSize->GetData());
+    // x 为 [K, 2] 时批量输出 K 个块的地址表, 每个块至多 block_size[0] 项
+    int64_t blockNum = xShape->GetDimNum() == kBatchIndexDimNum ? xShape->GetDim(0) : 1;
     outShape->SetDimNum(kBlockSizeDimNum);
-    outShape->SetDim(0, blockSizeData[0]);
+    outShape->SetDim(0, blockNum < 0 ? kUnknownDim : blockNum * blockSizeData[0]);
     outShape->SetDim(1, kOutputColNum);
     return ge::GRAPH_SUCCESS;
 }
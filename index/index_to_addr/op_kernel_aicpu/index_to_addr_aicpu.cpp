@@ -10,6 +10,10 @@
 
 #include "index_to_addr_aicpu.h"
 
+#include <algorithm>
+#include <string>
+#include <vector>
+
 #include "cpu_kernel_utils.h"
 #include "cpu_types.h"
 #include "log.h"
@@ -19,48 +23,164 @@
 namespace {
 const char* const kIndexToAddr = "IndexToAddr";
 const char* const kMatrix = "Matrix";
+const char* const kUpperTriangular = "UT";
 const uint32_t kInputNum = 2;
 const uint32_t kOutputNum = 1;
 constexpr uint32_t kBaseAddrElementNum = 2U;
 constexpr uint32_t kIndexElementNum = 2U;
 constexpr uint32_t kAddrTableItemNum = 4U;
+constexpr int32_t kBatchIndexDimNum = 2;
+
+struct IndexToAddrParam {
+    std::vector<int64_t> ori_shape;
+    std::vector<int64_t> block_size;
+    // 原矩阵按行压缩存储上三角部分: 第 i 行只保存 [i, n) 列
+    bool ori_upper_triangular = false;
+    // 块只搬运上三角部分(列号 >= 行号的元素)
+    bool block_upper_triangular = false;
+    int64_t rank_id = 0;
+    int64_t elem_size = 0;
+};
+
+// x 支持 [2] 的单个块坐标, 以及 [K, 2] 的批量块坐标
+bool IsBatchInput(const aicpu::Tensor* x)
+{
+    return x->GetTensorShape()->GetDimSizes().size() == kBatchIndexDimNum;
+}
+
+int64_t GetBlockNum(const aicpu::Tensor* x)
+{
+    return IsBatchInput(x) ? x->GetTensorShape()->GetDimSize(0) : 1;
+}
+
+int64_t ElementOffset(const IndexToAddrParam& param, int64_t i, int64_t j)
+{
+    if (!param.ori_upper_triangular) {
+        return param.ori_shape[1] * i + j;
+    }
+    // 前 i 行共保存 i * n - i * (i - 1) / 2 个元素
+    return i * param.ori_shape[1] - i * (i - 1) / 2 + (j - i);
+}
+
+// 顺序追加 (rank_id, src, dst, size) 描述符, merge 为 true 时与上一条首尾相接则合并为一条;
+// merge 为 false 时保持块内第 r 行对应第 r 项的原有布局
+template <typename T>
+class AddrTableWriter {
+public:
+    AddrTableWriter(T* addr_table, const T* base_addr, int64_t rank_id, bool merge)
+        : addr_table_(addr_table), base_addr_(base_addr), rank_id_(rank_id), merge_(merge)
+    {}
+
+    void Append(int64_t offset, int64_t size)
+    {
+        if (merge_ && count_ > 0 && last_offset_ + last_size_ == offset) {
+            last_size_ += size;
+            addr_table_[(count_ - 1) * kAddrTableItemNum + 3] = static_cast<T>(last_size_);
+            return;
+        }
+        T* item = addr_table_ + count_ * kAddrTableItemNum;
+        item[0] = static_cast<T>(rank_id_);
+        item[1] = base_addr_[0] + static_cast<T>(offset);
+        item[2] = base_addr_[1] + static_cast<T>(offset);
+        item[3] = static_cast<T>(size);
+        last_offset_ = offset;
+        last_size_ = size;
+        ++count_;
+    }
+
+    // 块内某行无需搬运: 合并模式下不占表项, 否则占位一条 size 为 0 的表项
+    void Skip()
+    {
+        if (merge_) {
+            return;
+        }
+        T* item = addr_table_ + count_ * kAddrTableItemNum;
+        for (uint32_t k = 0; k < kAddrTableItemNum; ++k) {
+            item[k] = static_cast<T>(0);
+        }
+        ++count_;
+    }
+
+    // 合并后剩余的表项清零, size 为 0 表示无需搬运
+    void Finish(int64_t capacity) const
+    {
+        for (int64_t k = count_ * kAddrTableItemNum; k < capacity * kAddrTableItemNum; ++k) {
+            addr_table_[k] = static_cast<T>(0);
+        }
+    }
+
+    int64_t Count() const
+    {
+        return count_;
+    }
+
+private:
+    T* addr_table_;
+    const T* base_addr_;
+    int64_t rank_id_;
+    bool merge_;
+    int64_t count_ = 0;
+    int64_t last_offset_ = 0;
+    int64_t last_size_ = 0;
+};
+
+template <typename T>
+uint32_t AppendBlock(const IndexToAddrParam& param, int64_t row, int64_t col, AddrTableWriter<T>& writer)
+{
+    int64_t i = row * param.block_size[0];
+    int64_t j = col * param.block_size[1];
+    KERNEL_CHECK_FALSE((row >= 0 && i < param.ori_shape[0]), aicpu::KERNEL_STATUS_PARAM_INVALID,
+                       "Ori shape row index[%ld] must be in [0, %ld)", i, param.ori_shape[0])
+    KERNEL_CHECK_FALSE((col >= 0 && j < param.ori_shape[1]), aicpu::KERNEL_STATUS_PARAM_INVALID,
+                       "Ori shape col index[%ld] must be in [0, %ld)", j, param.ori_shape[1])
+    // 边界块按原矩阵大小截断
+    const int64_t col_end = std::min(j + param.block_size[1], param.ori_shape[1]);
+    const bool upper_triangular = param.ori_upper_triangular || param.block_upper_triangular;
+    for (int64_t r = 0; r < param.block_size[0]; ++r, ++i) {
+        const int64_t col_begin = upper_triangular ? std::max(j, i) : j;
+        if (i >= param.ori_shape[0] || col_begin >= col_end) {
+            writer.Skip();
+            continue;
+        }
+        writer.Append(ElementOffset(param, i, col_begin) * param.elem_size, (col_end - col_begin) * param.elem_size);
+    }
+    return aicpu::KERNEL_STATUS_OK;
+}
 
 template <typename T>
 uint32_t IndexToAddr(const aicpu::CpuKernelContext& ctx)
 {
     T* base_addr = static_cast<T*>(ctx.Input(0)->GetData());
-    T row = static_cast<T*>(ctx.Input(1)->GetData())[0];
-    T col = static_cast<T*>(ctx.Input(1)->GetData())[1];
+    T* blocks = static_cast<T*>(ctx.Input(1)->GetData());
     T* addr_table = static_cast<T*>(ctx.Output(0)->GetData());
-    std::vector<int64_t> ori_shape = ctx.GetAttr("ori_shape")->GetListInt();
+    IndexToAddrParam param;
+    param.ori_shape = ctx.GetAttr("ori_shape")->GetListInt();
+    param.block_size = ctx.GetAttr("block_size")->GetListInt();
     std::string ori_storage_mode = ctx.GetAttr("ori_storage_mode")->GetString();
-    std::vector<int64_t> block_size = ctx.GetAttr("block_size")->GetListInt();
     std::string block_mode = ctx.GetAttr("block_storage_mode")->GetString();
-    int64_t rank_id = ctx.GetAttr("rank_id")->GetInt();
+    param.ori_upper_triangular = ori_storage_mode == kUpperTriangular;
+    param.block_upper_triangular = block_mode == kUpperTriangular;
+    param.rank_id = ctx.GetAttr("rank_id")->GetInt();
     aicpu::DataType dtype = ctx.GetAttr("dtype")->GetDataType();
-
-    int64_t i = row * block_size[0];
-    int64_t j = col * block_size[1];
-    KERNEL_CHECK_FALSE((i < ori_shape[0]), aicpu::KERNEL_STATUS_PARAM_INVALID,
-                       "Ori shape row index[%ld] must be < Attr[ori_shape] shape[0]:%ld", i, ori_shape[0])
-    KERNEL_CHECK_FALSE((j < ori_shape[1]), aicpu::KERNEL_STATUS_PARAM_INVALID,
-                       "Ori shape col index[%ld] must be < Attr[ori_shape] shape[1]:%ld", j, ori_shape[1])
-    int64_t row_size = block_size[1];
-    KERNEL_LOG_INFO("Input row[%ld], col[%ld], ori row[%ld], ori col[%ld], "
+    param.elem_size = aicpu::GetSizeByDataType(dtype);
+    const int64_t block_num = GetBlockNum(ctx.Input(1));
+    KERNEL_LOG_INFO("Input block num[%ld], ori row[%ld], ori col[%ld], "
                     "ori mode[%s], block row[%ld], block col[%ld], block mode[%s], "
                     "rank id[%ld], dtype[%s].",
-                    static_cast<int64_t>(row), static_cast<int64_t>(col), ori_shape[0], ori_shape[1],
-                    ori_storage_mode.c_str(), block_size[0], block_size[1], block_mode.c_str(), rank_id,
+                    block_num, param.ori_shape[0], param.ori_shape[1], ori_storage_mode.c_str(),
+                    param.block_size[0], param.block_size[1], block_mode.c_str(), param.rank_id,
                     DTypeStr(dtype).c_str());
 
-    for (int64_t r = 0; r < block_size[0]; ++r, ++i) {
-        int64_t bias = ori_shape[1] * i + j;
-        int64_t bias_addr = bias * aicpu::GetSizeByDataType(dtype);
-        addr_table[r * 4] = rank_id;
-        addr_table[r * 4 + 1] = base_addr[0] + bias_addr;
-        addr_table[r * 4 + 2] = base_addr[1] + bias_addr;
-        addr_table[r * 4 + 3] = row_size * aicpu::GetSizeByDataType(dtype);
+    // 单块 [2] 输入保持每行一项的原有输出, 仅批量 [K, 2] 输入合并相邻描述符
+    AddrTableWriter<T> writer(addr_table, base_addr, param.rank_id, IsBatchInput(ctx.Input(1)));
+    for (int64_t k = 0; k < block_num; ++k) {
+        int64_t row = static_cast<int64_t>(blocks[k * kIndexElementNum]);
+        int64_t col = static_cast<int64_t>(blocks[k * kIndexElementNum + 1]);
+        KERNEL_HANDLE_ERROR(AppendBlock(param, row, col, writer), "Convert block[%ld] (%ld, %ld) failed.", k, row,
+                            col);
     }
+    writer.Finish(block_num * param.block_size[0]);
+    KERNEL_LOG_INFO("Block num[%ld] merged into [%ld] address items.", block_num, writer.Count());
     return aicpu::KERNEL_STATUS_OK;
 }
 } // namespace
@@ -81,20 +201,30 @@ uint32_t IndexToAddrCpuKernel::Check(const CpuKernelContext& ctx) const
     KERNEL_CHECK_FALSE(
         (IsVector(base_addr->GetTensorShape()->GetDimSizes()) && base_addr->NumElements() == kBaseAddrElementNum),
         KERNEL_STATUS_PARAM_INVALID, "Input[base_addr] must be a 1D with two elements")
-    KERNEL_CHECK_FALSE((IsVector(x->GetTensorShape()->GetDimSizes()) && x->NumElements() == kIndexElementNum),
-                       KERNEL_STATUS_PARAM_INVALID, "Input[x] must be a vector with shape=[2]")
+    std::vector<int64_t> x_dims = x->GetTensorShape()->GetDimSizes();
+    bool single_block = IsVector(x_dims) && x->NumElements() == kIndexElementNum;
+    bool batch_blocks = IsMatrix(x_dims) && x_dims[1] == kIndexElementNum;
+    KERNEL_CHECK_FALSE((single_block || batch_blocks), KERNEL_STATUS_PARAM_INVALID,
+                       "Input[x] must be a vector with shape=[2] or a matrix with shape=[K, 2]")
     std::vector<int64_t> ori_shape = ctx.GetAttr("ori_shape")->GetListInt();
     KERNEL_CHECK_FALSE((IsMatrix(ori_shape)), KERNEL_STATUS_PARAM_INVALID, "Attr[ori_shape] must be a matrix")
     std::string ori_storage_mode = ctx.GetAttr("ori_storage_mode")->GetString();
-    KERNEL_CHECK_FALSE((ori_storage_mode == kMatrix), KERNEL_STATUS_PARAM_INVALID,
-                       "Attr[ori_storage_mode] value[%s] must be a UT or Matrix", ori_storage_mode.c_str())
+    KERNEL_CHECK_FALSE((ori_storage_mode == kMatrix || ori_storage_mode == kUpperTriangular),
+                       KERNEL_STATUS_PARAM_INVALID, "Attr[ori_storage_mode] value[%s] must be a UT or Matrix",
+                       ori_storage_mode.c_str())
+    KERNEL_CHECK_FALSE((ori_storage_mode != kUpperTriangular || ori_shape[0] == ori_shape[1]),
+                       KERNEL_STATUS_PARAM_INVALID, "Attr[ori_shape] [%ld, %ld] must be square in UT storage mode",
+                       ori_shape[0], ori_shape[1])
     std::vector<int64_t> block_size = ctx.GetAttr("block_size")->GetListInt();
     KERNEL_CHECK_FALSE((IsMatrix(block_size)), KERNEL_STATUS_PARAM_INVALID, "Attr[block_size] must be a matrix")
-    KERNEL_CHECK_FALSE((kAddrTableItemNum * block_size[0] <= output->NumElements()), KERNEL_STATUS_PARAM_INVALID,
-                       "Attr[block_size] row[%ld] must be <= [%ld]", block_size[0],
-                       output->NumElements() / kAddrTableItemNum)
+    KERNEL_CHECK_FALSE((block_size[0] > 0 && block_size[1] > 0), KERNEL_STATUS_PARAM_INVALID,
+                       "Attr[block_size] [%ld, %ld] must be positive", block_size[0], block_size[1])
+    int64_t block_num = GetBlockNum(x);
+    KERNEL_CHECK_FALSE((kAddrTableItemNum * block_size[0] * block_num <= output->NumElements()),
+                       KERNEL_STATUS_PARAM_INVALID, "Attr[block_size] row[%ld] * block num[%ld] must be <= [%ld]",
+                       block_size[0], block_num, output->NumElements() / kAddrTableItemNum)
     std::string block_mode = ctx.GetAttr("block_storage_mode")->GetString();
-    KERNEL_CHECK_FALSE((block_mode == kMatrix), KERNEL_STATUS_PARAM_INVALID,
+    KERNEL_CHECK_FALSE((block_mode == kMatrix || block_mode == kUpperTriangular), KERNEL_STATUS_PARAM_INVALID,
                        "Attr[block_storage_mode] value[%s] must be a UT or Matrix", block_mode.c_str())
 
     return KERNEL_STATUS_OK;
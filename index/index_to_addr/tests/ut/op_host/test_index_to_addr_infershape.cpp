@@ -0,0 +1,84 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file test_index_to_addr_infershape.cpp
+ * \brief
+ */
+
+#include <iostream>
+#include <gtest/gtest.h>
+#include "infershape_case_executor.h"
+
+class IndexToAddrInfershape : public testing::Test {
+protected:
+    static void SetUpTestCase() { std::cout << "IndexToAddrInfershape SetUp" << std::endl; }
+
+    static void TearDownTestCase() { std::cout << "IndexToAddrInfershape TearDown" << std::endl; }
+};
+
+static gert::InfershapeContextPara MakeIndexToAddrPara(const std::vector<int64_t>& xDims,
+                                                       const std::vector<int64_t>& blockSize)
+{
+    gert::Shape xShape;
+    for (auto dim : xDims) {
+        xShape.AppendDim(dim);
+    }
+    return gert::InfershapeContextPara(
+        "IndexToAddr",
+        {
+            {{{2}, {2}}, ge::DT_INT64, ge::FORMAT_ND},
+            {{xShape, xShape}, ge::DT_INT64, ge::FORMAT_ND},
+        },
+        {
+            {{{}, {}}, ge::DT_INT64, ge::FORMAT_ND},
+        },
+        {
+            {"ori_shape", Ops::NN::AnyValue::CreateFrom<std::vector<int64_t>>({16, 16})},
+            {"block_size", Ops::NN::AnyValue::CreateFrom<std::vector<int64_t>>(blockSize)},
+            {"ori_storage_mode", Ops::NN::AnyValue::CreateFrom<std::string>("Matrix")},
+            {"block_storage_mode", Ops::NN::AnyValue::CreateFrom<std::string>("Matrix")},
+            {"rank_id", Ops::NN::AnyValue::CreateFrom<int64_t>(0)},
+        });
+}
+
+TEST_F(IndexToAddrInfershape, index_to_addr_infershape_single_block)
+{
+    auto infershapeContextPara = MakeIndexToAddrPara({2}, {4, 4});
+    std::vector<std::vector<int64_t>> expectOutputShape = {
+        {4, 4},
+    };
+    ExecuteTestCase(infershapeContextPara, ge::GRAPH_SUCCESS, expectOutputShape);
+}
+
+TEST_F(IndexToAddrInfershape, index_to_addr_infershape_batch_blocks)
+{
+    // x 为 [K, 2] 时输出 K * block_size[0] 项
+    auto infershapeContextPara = MakeIndexToAddrPara({3, 2}, {8, 4});
+    std::vector<std::vector<int64_t>> expectOutputShape = {
+        {24, 4},
+    };
+    ExecuteTestCase(infershapeContextPara, ge::GRAPH_SUCCESS, expectOutputShape);
+}
+
+TEST_F(IndexToAddrInfershape, index_to_addr_infershape_unknown_block_num)
+{
+    auto infershapeContextPara = MakeIndexToAddrPara({-1, 2}, {4, 4});
+    std::vector<std::vector<int64_t>> expectOutputShape = {
+        {-1, 4},
+    };
+    ExecuteTestCase(infershapeContextPara, ge::GRAPH_SUCCESS, expectOutputShape);
+}
+
+TEST_F(IndexToAddrInfershape, index_to_addr_infershape_invalid_block_size)
+{
+    auto infershapeContextPara = MakeIndexToAddrPara({2}, {4, 4, 4});
+    ExecuteTestCase(infershapeContextPara, ge::GRAPH_FAILED);
+}
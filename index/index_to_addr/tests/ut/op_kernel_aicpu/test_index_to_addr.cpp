@@ -26,19 +26,21 @@ constexpr int64_t kExpectedOutputElementCount = 16;
 }
 class TEST_INDEX_TO_ADDR_UT : public testing::Test {};
 
-#define CREATE_NODEDEF(shapes, dataTypes, datas)                          \
-    auto nodeDef = CpuKernelUtils::CpuKernelUtils::CreateNodeDef();       \
-    NodeDefBuilder(nodeDef.get(), "IndexToAddr", "IndexToAddr")           \
-        .Input({"base_addr", (dataTypes)[0], (shapes)[0], (datas)[0]})    \
-        .Input({"x", (dataTypes)[1], (shapes)[1], (datas)[1]})            \
-        .Output({"addrs_table", (dataTypes)[2], (shapes)[2], (datas)[2]}) \
-        .Attr("ori_shape", oriShape)                                      \
-        .Attr("ori_storage_mode", std::string("Matrix"))                  \
-        .Attr("block_size", blockSize)                                    \
-        .Attr("block_storage_mode", std::string("Matrix"))                \
-        .Attr("rank_id", 0)                                               \
+#define CREATE_NODEDEF_WITH_MODE(shapes, dataTypes, datas, oriMode, blockMode) \
+    auto nodeDef = CpuKernelUtils::CpuKernelUtils::CreateNodeDef();             \
+    NodeDefBuilder(nodeDef.get(), "IndexToAddr", "IndexToAddr")                 \
+        .Input({"base_addr", (dataTypes)[0], (shapes)[0], (datas)[0]})          \
+        .Input({"x", (dataTypes)[1], (shapes)[1], (datas)[1]})                  \
+        .Output({"addrs_table", (dataTypes)[2], (shapes)[2], (datas)[2]})       \
+        .Attr("ori_shape", oriShape)                                            \
+        .Attr("ori_storage_mode", std::string(oriMode))                         \
+        .Attr("block_size", blockSize)                                          \
+        .Attr("block_storage_mode", std::string(blockMode))                     \
+        .Attr("rank_id", 0)                                                     \
         .Attr("dtype", DT_FLOAT)
 
+#define CREATE_NODEDEF(shapes, dataTypes, datas) CREATE_NODEDEF_WITH_MODE(shapes, dataTypes, datas, "Matrix", "Matrix")
+
 TEST_F(TEST_INDEX_TO_ADDR_UT, Row0Col3Success)
 {
     vector<DataType> dataTypes = {DT_INT64, DT_INT64, DT_INT64};
@@ -112,3 +114,149 @@ TEST_F(TEST_INDEX_TO_ADDR_UT, UnsupportedDtypeFail)
     CREATE_NODEDEF(shapes, dataTypes, datas);
     RUN_KERNEL(nodeDef, HOST, KERNEL_STATUS_PARAM_INVALID);
 }
+
+TEST_F(TEST_INDEX_TO_ADDR_UT, BatchBlocksSuccess)
+{
+    vector<DataType> dataTypes = {DT_INT64, DT_INT64, DT_INT64};
+    vector<vector<int64_t>> shapes = {{2}, {2, 2}, {8, 4}};
+    int64_t input0[2] = {20, 40};
+    int64_t input1[4] = {0, 3, 1, 1};
+    int64_t output[32] = {0};
+    vector<void*> datas = {static_cast<void*>(input0), static_cast<void*>(input1), static_cast<void*>(output)};
+    vector<int64_t> oriShape = {16, 16};
+    vector<int64_t> blockSize = {4, 4};
+    CREATE_NODEDEF(shapes, dataTypes, datas);
+    RUN_KERNEL(nodeDef, HOST, KERNEL_STATUS_OK);
+    int64_t outputExp[32] = {0, 68,  88,  16, 0, 132, 152, 16, 0, 196, 216, 16, 0, 260, 280, 16,
+                             0, 292, 312, 16, 0, 356, 376, 16, 0, 420, 440, 16, 0, 484, 504, 16};
+    EXPECT_EQ(CompareResult(output, outputExp, 32), true);
+}
+
+TEST_F(TEST_INDEX_TO_ADDR_UT, FullRowBlocksMergedSuccess)
+{
+    // 块宽等于矩阵列数时整块连续, 相邻块也首尾相接, 合并为一项
+    vector<DataType> dataTypes = {DT_INT64, DT_INT64, DT_INT64};
+    vector<vector<int64_t>> shapes = {{2}, {2, 2}, {8, 4}};
+    int64_t input0[2] = {20, 40};
+    int64_t input1[4] = {0, 0, 1, 0};
+    int64_t output[32] = {0};
+    vector<void*> datas = {static_cast<void*>(input0), static_cast<void*>(input1), static_cast<void*>(output)};
+    vector<int64_t> oriShape = {8, 4};
+    vector<int64_t> blockSize = {4, 4};
+    CREATE_NODEDEF(shapes, dataTypes, datas);
+    RUN_KERNEL(nodeDef, HOST, KERNEL_STATUS_OK);
+    int64_t outputExp[32] = {0, 20, 40, 128};
+    EXPECT_EQ(CompareResult(output, outputExp, 32), true);
+}
+
+TEST_F(TEST_INDEX_TO_ADDR_UT, SingleBlockKeepRowLayoutSuccess)
+{
+    // 单块 [2] 输入即使整块连续也保持每行一项
+    vector<DataType> dataTypes = {DT_INT64, DT_INT64, DT_INT64};
+    vector<vector<int64_t>> shapes = {{2}, {2}, {4, 4}};
+    int64_t input0[2] = {20, 40};
+    int64_t input1[2] = {0, 0};
+    int64_t output[16] = {0};
+    vector<void*> datas = {static_cast<void*>(input0), static_cast<void*>(input1), static_cast<void*>(output)};
+    vector<int64_t> oriShape = {8, 4};
+    vector<int64_t> blockSize = {4, 4};
+    CREATE_NODEDEF(shapes, dataTypes, datas);
+    RUN_KERNEL(nodeDef, HOST, KERNEL_STATUS_OK);
+    int64_t outputExp[16] = {0, 20, 40, 16, 0, 36, 56, 16, 0, 52, 72, 16, 0, 68, 88, 16};
+    EXPECT_EQ(CompareResult(output, outputExp, kExpectedOutputElementCount), true);
+}
+
+TEST_F(TEST_INDEX_TO_ADDR_UT, SingleBlockEdgeRowsZeroSuccess)
+{
+    // 边界块超出原矩阵的行占位填0, 其余行仍在原位置
+    vector<DataType> dataTypes = {DT_INT64, DT_INT64, DT_INT64};
+    vector<vector<int64_t>> shapes = {{2}, {2}, {4, 4}};
+    int64_t input0[2] = {20, 40};
+    int64_t input1[2] = {1, 0};
+    int64_t output[16] = {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1};
+    vector<void*> datas = {static_cast<void*>(input0), static_cast<void*>(input1), static_cast<void*>(output)};
+    vector<int64_t> oriShape = {6, 4};
+    vector<int64_t> blockSize = {4, 4};
+    CREATE_NODEDEF(shapes, dataTypes, datas);
+    RUN_KERNEL(nodeDef, HOST, KERNEL_STATUS_OK);
+    int64_t outputExp[16] = {0, 84, 104, 16, 0, 100, 120, 16};
+    EXPECT_EQ(CompareResult(output, outputExp, kExpectedOutputElementCount), true);
+}
+
+TEST_F(TEST_INDEX_TO_ADDR_UT, UpperTriangularOriSuccess)
+{
+    // 8x8 上三角压缩存储, 对角块 (1, 1) 每行从对角线开始
+    vector<DataType> dataTypes = {DT_UINT64, DT_UINT64, DT_UINT64};
+    vector<vector<int64_t>> shapes = {{2}, {2}, {4, 4}};
+    uint64_t input0[2] = {20, 40};
+    uint64_t input1[2] = {1, 1};
+    uint64_t output[16] = {0};
+    vector<void*> datas = {static_cast<void*>(input0), static_cast<void*>(input1), static_cast<void*>(output)};
+    vector<int64_t> oriShape = {8, 8};
+    vector<int64_t> blockSize = {4, 4};
+    CREATE_NODEDEF_WITH_MODE(shapes, dataTypes, datas, "UT", "Matrix");
+    RUN_KERNEL(nodeDef, HOST, KERNEL_STATUS_OK);
+    uint64_t outputExp[16] = {0, 124, 144, 16, 0, 140, 160, 12, 0, 152, 172, 8, 0, 160, 180, 4};
+    EXPECT_EQ(CompareResult(output, outputExp, kExpectedOutputElementCount), true);
+}
+
+TEST_F(TEST_INDEX_TO_ADDR_UT, UpperTriangularOriBatchMergedSuccess)
+{
+    // [1, 2] 批量输入时对角块 (1, 1) 的四行在压缩存储中连续, 合并为一项
+    vector<DataType> dataTypes = {DT_UINT64, DT_UINT64, DT_UINT64};
+    vector<vector<int64_t>> shapes = {{2}, {1, 2}, {4, 4}};
+    uint64_t input0[2] = {20, 40};
+    uint64_t input1[2] = {1, 1};
+    uint64_t output[16] = {0};
+    vector<void*> datas = {static_cast<void*>(input0), static_cast<void*>(input1), static_cast<void*>(output)};
+    vector<int64_t> oriShape = {8, 8};
+    vector<int64_t> blockSize = {4, 4};
+    CREATE_NODEDEF_WITH_MODE(shapes, dataTypes, datas, "UT", "Matrix");
+    RUN_KERNEL(nodeDef, HOST, KERNEL_STATUS_OK);
+    uint64_t outputExp[16] = {0, 124, 144, 40};
+    EXPECT_EQ(CompareResult(output, outputExp, kExpectedOutputElementCount), true);
+}
+
+TEST_F(TEST_INDEX_TO_ADDR_UT, UpperTriangularBlockSuccess)
+{
+    vector<DataType> dataTypes = {DT_INT64, DT_INT64, DT_INT64};
+    vector<vector<int64_t>> shapes = {{2}, {2}, {4, 4}};
+    int64_t input0[2] = {20, 40};
+    int64_t input1[2] = {0, 0};
+    int64_t output[16] = {0};
+    vector<void*> datas = {static_cast<void*>(input0), static_cast<void*>(input1), static_cast<void*>(output)};
+    vector<int64_t> oriShape = {8, 8};
+    vector<int64_t> blockSize = {4, 4};
+    CREATE_NODEDEF_WITH_MODE(shapes, dataTypes, datas, "Matrix", "UT");
+    RUN_KERNEL(nodeDef, HOST, KERNEL_STATUS_OK);
+    int64_t outputExp[16] = {0, 20, 40, 16, 0, 56, 76, 12, 0, 92, 112, 8, 0, 128, 148, 4};
+    EXPECT_EQ(CompareResult(output, outputExp, kExpectedOutputElementCount), true);
+}
+
+TEST_F(TEST_INDEX_TO_ADDR_UT, UpperTriangularNonSquareFail)
+{
+    vector<DataType> dataTypes = {DT_INT64, DT_INT64, DT_INT64};
+    vector<vector<int64_t>> shapes = {{2}, {2}, {4, 4}};
+    int64_t input0[2] = {20, 40};
+    int64_t input1[2] = {0, 0};
+    int64_t output[16] = {0};
+    vector<void*> datas = {static_cast<void*>(input0), static_cast<void*>(input1), static_cast<void*>(output)};
+    vector<int64_t> oriShape = {8, 16};
+    vector<int64_t> blockSize = {4, 4};
+    CREATE_NODEDEF_WITH_MODE(shapes, dataTypes, datas, "UT", "Matrix");
+    RUN_KERNEL(nodeDef, HOST, KERNEL_STATUS_PARAM_INVALID);
+}
+
+TEST_F(TEST_INDEX_TO_ADDR_UT, BatchOutputTooSmallFail)
+{
+    vector<DataType> dataTypes = {DT_INT64, DT_INT64, DT_INT64};
+    vector<vector<int64_t>> shapes = {{2}, {2, 2}, {4, 4}};
+    int64_t input0[2] = {20, 40};
+    int64_t input1[4] = {0, 0, 1, 1};
+    int64_t output[16] = {0};
+    vector<void*> datas = {static_cast<void*>(input0), static_cast<void*>(input1), static_cast<void*>(output)};
+    vector<int64_t> oriShape = {16, 16};
+    vector<int64_t> blockSize = {4, 4};
+    CREATE_NODEDEF(shapes, dataTypes, datas);
+    RUN_KERNEL(nodeDef, HOST, KERNEL_STATUS_PARAM_INVALID);
+}
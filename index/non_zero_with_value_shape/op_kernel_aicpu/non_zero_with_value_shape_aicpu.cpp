@@ -14,6 +14,7 @@
 #include "cpu_tensor.h"
 #include "cpu_tensor_shape.h"
 #include "cpu_types.h"
+#include "aicpu/non_zero_with_value_pack.h"
 #include "utils/kernel_util.h"
 
 namespace {
@@ -21,10 +22,11 @@ const char* const kNonZeroWithValueShape = "NonZeroWithValueShape";
 const uint32_t INPUTS_NUM = 3;
 const uint32_t OUTPUTS_NUM = 2;
 
+const uint32_t IDX_INPUT_TENSOR_VALUE = 0;
+const uint32_t IDX_INPUT_TENSOR_INDEX = 1;
 const uint32_t IDX_INPUT_TENSOR_COUNT = 2;
 const uint32_t IDX_OUTPUT_VALUE = 0;
 const uint32_t IDX_OUTPUT_INDEX = 1;
-const uint32_t IDX_OUTPUT_INDEX_SHAPE = 2;
 } // namespace
 namespace aicpu {
 uint32_t NonZeroWithValueShapeCpuKernel::Compute(CpuKernelContext& ctx)
@@ -35,18 +37,11 @@ uint32_t NonZeroWithValueShapeCpuKernel::Compute(CpuKernelContext& ctx)
     KERNEL_CHECK_FALSE((count->NumElements() >= 1), KERNEL_STATUS_PARAM_INVALID,
                        "[%s] input count must contain at least one element.", kNonZeroWithValueShape);
 
-    Tensor* out_value = ctx.Output(IDX_OUTPUT_VALUE);
-    auto out_value_shape = out_value->GetTensorShape();
-    int32_t count_num = static_cast<int32_t*>(count->GetData())[IDX_OUTPUT_VALUE];
-    std::vector<int64_t> out_value_shape_values = {count_num};
-    out_value_shape->SetDimSizes(out_value_shape_values);
+    int32_t count_num = static_cast<int32_t*>(count->GetData())[0];
 
-    Tensor* out_index = ctx.Output(IDX_OUTPUT_INDEX);
-    auto out_index_shape = out_index->GetTensorShape();
-    std::vector<int64_t> out_index_shape_values = {IDX_OUTPUT_INDEX_SHAPE, count_num};
-    out_index_shape->SetDimSizes(out_index_shape_values);
-
-    return KERNEL_STATUS_OK;
+    return nonzero::PackNonZeroWithValue(ctx, kNonZeroWithValueShape, ctx.Input(IDX_INPUT_TENSOR_VALUE),
+                                         ctx.Input(IDX_INPUT_TENSOR_INDEX), count_num, ctx.Output(IDX_OUTPUT_VALUE),
+                                         ctx.Output(IDX_OUTPUT_INDEX));
 }
 
 REGISTER_CPU_KERNEL(kNonZeroWithValueShape, NonZeroWithValueShapeCpuKernel);
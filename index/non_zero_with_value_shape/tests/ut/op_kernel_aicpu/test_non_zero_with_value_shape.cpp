@@ -79,3 +79,70 @@ TEST_F(TEST_NON_ZERO_WITH_VALUE_SHAPE_UT, CountEmptyInvalid)
     CREATE_NODEDEF(shapes, dataTypes, datas);
     RUN_KERNEL(nodeDef, HOST, KERNEL_STATUS_PARAM_INVALID);
 }
+
+TEST_F(TEST_NON_ZERO_WITH_VALUE_SHAPE_UT, PackIndexColumns)
+{
+    vector<DataType> dataTypes = {DT_FLOAT, DT_INT32, DT_INT32, DT_FLOAT, DT_INT32};
+    vector<vector<int64_t>> shapes = {{4}, {8}, {1}, {}, {}};
+
+    float input0[4] = {1.5f, -2.0f, 0.0f, 0.0f};
+    int32_t input1[8] = {0, 1, 0, 0, 3, 2, 0, 0};
+    int32_t input2[1] = {2};
+    float output0[4] = {0.0f};
+    int32_t output1[8] = {0};
+    vector<void*> datas = {static_cast<void*>(input0), static_cast<void*>(input1), static_cast<void*>(input2),
+                           static_cast<void*>(output0), static_cast<void*>(output1)};
+    CREATE_NODEDEF(shapes, dataTypes, datas);
+    RUN_KERNEL(nodeDef, HOST, KERNEL_STATUS_OK);
+    std::vector<int64_t> dims0;
+    std::vector<int64_t> dims1;
+    CalcExpectFunc(*nodeDef.get(), dims0, dims1);
+    EXPECT_EQ(dims0, std::vector<int64_t>({2}));
+    EXPECT_EQ(dims1, std::vector<int64_t>({2, 2}));
+    float expectValue[2] = {1.5f, -2.0f};
+    int32_t expectIndex[4] = {0, 1, 3, 2};
+    EXPECT_EQ(CompareResult<float>(output0, expectValue, 2), true);
+    EXPECT_EQ(CompareResult<int32_t>(output1, expectIndex, 4), true);
+}
+
+TEST_F(TEST_NON_ZERO_WITH_VALUE_SHAPE_UT, PackLargeParallel)
+{
+    const int64_t numel = 256 * 1024;
+    const int32_t countNum = 200000;
+    vector<DataType> dataTypes = {DT_INT64, DT_INT32, DT_INT32, DT_INT64, DT_INT32};
+    vector<vector<int64_t>> shapes = {{numel}, {2 * numel}, {1}, {}, {}};
+
+    vector<int64_t> input0(numel);
+    vector<int32_t> input1(2 * numel);
+    for (int64_t i = 0; i < numel; ++i) {
+        input0[i] = i * 3;
+        input1[i] = static_cast<int32_t>(i / 512);
+        input1[numel + i] = static_cast<int32_t>(i % 512);
+    }
+    int32_t input2[1] = {countNum};
+    vector<int64_t> output0(numel, 0);
+    vector<int32_t> output1(2 * numel, 0);
+    vector<void*> datas = {input0.data(), input1.data(), input2, output0.data(), output1.data()};
+    CREATE_NODEDEF(shapes, dataTypes, datas);
+    RUN_KERNEL(nodeDef, HOST, KERNEL_STATUS_OK);
+    vector<int32_t> expectIndex(input1.begin(), input1.begin() + countNum);
+    expectIndex.insert(expectIndex.end(), input1.begin() + numel, input1.begin() + numel + countNum);
+    EXPECT_EQ(CompareResult<int64_t>(output0.data(), input0.data(), countNum), true);
+    EXPECT_EQ(CompareResult<int32_t>(output1.data(), expectIndex.data(), 2 * countNum), true);
+}
+
+TEST_F(TEST_NON_ZERO_WITH_VALUE_SHAPE_UT, CountOutOfRangeInvalid)
+{
+    vector<DataType> dataTypes = {DT_INT32, DT_INT32, DT_INT32, DT_INT32, DT_INT32};
+    vector<vector<int64_t>> shapes = {{2}, {4}, {1}, {}, {}};
+
+    int32_t input0[2] = {1, 2};
+    int32_t input1[4] = {1, 2, 3, 4};
+    int32_t input2[1] = {3};
+    int32_t output0[2] = {1, 2};
+    int32_t output1[4] = {1, 2, 3, 4};
+    vector<void*> datas = {static_cast<void*>(input0), static_cast<void*>(input1), static_cast<void*>(input2),
+                           static_cast<void*>(output0), static_cast<void*>(output1)};
+    CREATE_NODEDEF(shapes, dataTypes, datas);
+    RUN_KERNEL(nodeDef, HOST, KERNEL_STATUS_PARAM_INVALID);
+}
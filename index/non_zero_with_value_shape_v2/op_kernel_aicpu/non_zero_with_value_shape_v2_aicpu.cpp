@@ -14,12 +14,12 @@
 #include "cpu_tensor.h"
 #include "cpu_tensor_shape.h"
 #include "cpu_types.h"
+#include "aicpu/non_zero_with_value_pack.h"
 #include "utils/kernel_util.h"
 
 namespace {
 const char* const kNonZeroWithValueShapeV2 = "NonZeroWithValueShapeV2";
 const uint32_t kOutputNum = 2;
-const uint32_t kIndexFirstDim = 2;
 } // namespace
 
 namespace aicpu {
@@ -46,17 +46,9 @@ uint32_t NonZeroWithValueShapeV2CpuKernel::Compute(CpuKernelContext& ctx)
                        "[%s] input count must contain at least one element.", kNonZeroWithValueShapeV2);
     int32_t count_num = static_cast<int32_t*>(count->GetData())[0];
 
-    Tensor* out_value = ctx.Output(kFirstOutputIndex);
-    auto out_value_shape = out_value->GetTensorShape();
-    std::vector<int64_t> out_value_shape_values = {count_num};
-    out_value_shape->SetDimSizes(out_value_shape_values);
-
-    Tensor* out_index = ctx.Output(kSecondOutputIndex);
-    auto out_index_shape = out_index->GetTensorShape();
-    std::vector<int64_t> out_index_shape_values = {kIndexFirstDim, count_num};
-    out_index_shape->SetDimSizes(out_index_shape_values);
-
-    return KERNEL_STATUS_OK;
+    return nonzero::PackNonZeroWithValue(ctx, kNonZeroWithValueShapeV2, ctx.Input(kFirstInputIndex),
+                                         ctx.Input(kSecondInputIndex), count_num, ctx.Output(kFirstOutputIndex),
+                                         ctx.Output(kSecondOutputIndex));
 }
 
 REGISTER_CPU_KERNEL(kNonZeroWithValueShapeV2, NonZeroWithValueShapeV2CpuKernel);
@@ -31,7 +31,9 @@ qint32, qint8, quint8, uint16, uint32, uint64, uint8, bfloat16, complex32.
 * @par Attributes:
 * @li axis: An optional int. Defaults to 0.
 * @li reduction: An optional string. Defaults to string "none" and can be
-* "add" or "mul". \n
+* "add", "mul", "max"("amax"), "min"("amin") or "mean". If either operand of max/min is NaN, the result is NaN.
+* Integer mean rounds toward negative infinity. \n
+* @li include_self: An optional bool. Defaults to true. It controls whether data participates in reduction. \n
 
 * @par Outputs:
 * y: A Tensor. Has the same type and format as input "data" . \n
@@ -52,6 +54,7 @@ REG_OP(ScatterElements)
     .OUTPUT(y, TensorType::NumberType())
     .ATTR(axis, Int, 0)
     .ATTR(reduction, String, "none")
+    .ATTR(include_self, Bool, true)
     .OP_END_FACTORY_REG(ScatterElements)
 
 } // namespace ge
@@ -13,8 +13,10 @@
 #include <atomic>
 #include <complex>
 #include <string>
+#include <type_traits>
 #include <vector>
 
+#include "aicpu/parallel_scatter.h"
 #include "utils/eigen_tensor.h"
 #include "utils/kernel_util.h"
 
@@ -30,11 +32,16 @@ const uint32_t kUpdatesInputIndex = 2;
 const uint8_t kReductionNone = 0;
 const uint8_t kReductionAdd = 1;
 const uint8_t kReductionMul = 2;
+const uint8_t kReductionMax = 3;
+const uint8_t kReductionMin = 4;
+const uint8_t kReductionMean = 5;
+const uint8_t kReductionInvalid = 0xFF;
 
 struct ScatterElementsComputeInfo {
     int64_t total_value_num = 0;
     int64_t axis_value = 0;
     uint8_t reduction_flag = kReductionNone;
+    bool include_self = true;
     int64_t value_dim_num_x1 = 0;
     int64_t value_dim_num_x2 = 0;
     int64_t value_dim_num_x3 = 0;
@@ -62,38 +69,97 @@ std::vector<int64_t> GetTensorDims(const std::shared_ptr<TensorShape>& shape, in
 
 uint8_t GetReductionFlag(const std::string& rdt_value)
 {
+    if (rdt_value == "none") {
+        return kReductionNone;
+    }
     if (rdt_value == "add") {
         return kReductionAdd;
     }
     if (rdt_value == "mul") {
         return kReductionMul;
     }
+    if (rdt_value == "max" || rdt_value == "amax") {
+        return kReductionMax;
+    }
+    if (rdt_value == "min" || rdt_value == "amin") {
+        return kReductionMin;
+    }
+    if (rdt_value == "mean") {
+        return kReductionMean;
+    }
 
-    return kReductionNone;
+    return kReductionInvalid;
 }
 
 template <typename T>
-inline void ApplyReduction(const T* updates, T* output, int64_t index_value, int64_t update_index, uint8_t flag)
+struct IsComplexType : std::false_type {};
+
+template <typename T>
+struct IsComplexType<std::complex<T>> : std::true_type {};
+
+// amax/amin 与 torch.scatter_reduce 一致: 任一操作数为 NaN 时结果为 NaN
+template <typename T>
+struct ReduceMax {
+    void operator()(T& dst, const T& src) const
+    {
+        if (!Eigen::numext::isnan(dst) && (Eigen::numext::isnan(src) || dst < src)) {
+            dst = src;
+        }
+    }
+};
+
+template <typename T>
+struct ReduceMin {
+    void operator()(T& dst, const T& src) const
+    {
+        if (!Eigen::numext::isnan(dst) && (Eigen::numext::isnan(src) || src < dst)) {
+            dst = src;
+        }
+    }
+};
+
+// include_self 为 false 或 mean 时需要统计每个输出位置的命中次数;
+// owner-computes 保证同一位置只由一个线程访问, 计数无需原子操作
+template <typename T, typename Reducer>
+struct CountedReducer {
+    T* output;
+    int64_t* hit_counts;
+    bool include_self;
+    Reducer reducer;
+
+    void operator()(T& dst, const T& src) const
+    {
+        int64_t& hit_count = hit_counts[&dst - output];
+        if (hit_count == 0 && !include_self) {
+            dst = src;
+        } else {
+            reducer(dst, src);
+        }
+        ++hit_count;
+    }
+};
+
+// 整数 mean 与 AI Core 实现一致, 采用向下取整除法
+template <typename T, typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value, int>::type = 0>
+inline T MeanDivide(T value, int64_t divisor)
 {
-    if (flag == kReductionNone) {
-        output[index_value] = updates[update_index];
-    } else if (flag == kReductionAdd) {
-        output[index_value] += updates[update_index];
-    } else {
-        output[index_value] *= updates[update_index];
+    int64_t quotient = static_cast<int64_t>(value) / divisor;
+    if (static_cast<int64_t>(value) % divisor != 0 && value < 0) {
+        --quotient;
     }
+    return static_cast<T>(quotient);
 }
 
-template <>
-inline void ApplyReduction(const bool* updates, bool* output, int64_t index_value, int64_t update_index, uint8_t flag)
+template <typename T, typename std::enable_if<std::is_integral<T>::value && !std::is_signed<T>::value, int>::type = 0>
+inline T MeanDivide(T value, int64_t divisor)
 {
-    if (flag == kReductionAdd) {
-        output[index_value] = output[index_value] || updates[update_index];
-    } else if (flag == kReductionMul) {
-        output[index_value] = output[index_value] && updates[update_index];
-    } else {
-        output[index_value] = updates[update_index];
-    }
+    return static_cast<T>(static_cast<uint64_t>(value) / static_cast<uint64_t>(divisor));
+}
+
+template <typename T, typename std::enable_if<!std::is_integral<T>::value, int>::type = 0>
+inline T MeanDivide(T value, int64_t divisor)
+{
+    return value / static_cast<T>(divisor);
 }
 
 uint32_t InitScatterElementsInfo(const CpuKernelContext& ctx, ScatterElementsComputeInfo& info)
@@ -105,7 +171,12 @@ uint32_t InitScatterElementsInfo(const CpuKernelContext& ctx, ScatterElementsCom
     auto* reduction = ctx.GetAttr("reduction");
     info.total_value_num = data_tensor->NumElements();
     info.axis_value = axis == nullptr ? 0 : axis->GetInt();
-    info.reduction_flag = GetReductionFlag(reduction == nullptr ? "none" : reduction->GetString());
+    auto* include_self = ctx.GetAttr("include_self");
+    std::string reduction_value = reduction == nullptr ? "none" : reduction->GetString();
+    info.reduction_flag = GetReductionFlag(reduction_value);
+    KERNEL_CHECK_FALSE(info.reduction_flag != kReductionInvalid, KERNEL_STATUS_PARAM_INVALID,
+                       "Reduction[%s] is unsupported, it should be none|add|mul|max|min|mean", reduction_value.c_str());
+    info.include_self = include_self == nullptr ? true : include_self->GetBool();
     info.value_dim_num_x1 = data_tensor->GetTensorShape()->GetDims();
     info.value_dim_num_x2 = indices_tensor->GetTensorShape()->GetDims();
     info.value_dim_num_x3 = updates_tensor->GetTensorShape()->GetDims();
@@ -180,41 +251,103 @@ uint32_t CalcScatterIndices(const ScatterElementsComputeInfo& info, int64_t flat
     return KERNEL_STATUS_OK;
 }
 
-template <typename T, typename TI>
-uint32_t ScatterSameNum(const ScatterElementsComputeInfo& info, const TI* indices_data, const T* updates, T* output)
+template <typename T, typename Reducer>
+uint32_t ApplyReduction(const CpuKernelContext& ctx, const ScatterElementsComputeInfo& info,
+                        const scatter::ScatterPlan& plan, const T* updates, T* output, Reducer reducer,
+                        std::vector<int64_t>* hit_counts = nullptr)
 {
-    for (int64_t i = 0; i < info.update_value_num; ++i) {
-        int64_t indices_value = 0;
-        int64_t index_value = 0;
-        int64_t src_index = 0;
-        auto ret = NormalizeIndicesValue(info, indices_data[i], indices_value);
-        KERNEL_CHECK_FALSE(ret == KERNEL_STATUS_OK, ret, "NormalizeIndicesValue failed");
-        CalcScatterIndices(info, i, indices_value, index_value, src_index);
-        KERNEL_CHECK_FALSE(index_value < info.total_value_num, KERNEL_STATUS_PARAM_INVALID,
-                           "Update index %ld greater than %ld which is overflow", index_value, info.total_value_num);
-        ApplyReduction(updates, output, index_value, i, info.reduction_flag);
+    if (hit_counts == nullptr && info.include_self) {
+        return plan.Apply(ctx, updates, output, reducer);
+    }
+    std::vector<int64_t> local_counts;
+    if (hit_counts == nullptr) {
+        hit_counts = &local_counts;
+    }
+    hit_counts->assign(static_cast<size_t>(info.total_value_num), 0);
+    CountedReducer<T, Reducer> counted = {output, hit_counts->data(), info.include_self, reducer};
+    return plan.Apply(ctx, updates, output, counted);
+}
+
+template <typename T, typename Reducer, typename std::enable_if<!IsComplexType<T>::value, int>::type = 0>
+uint32_t ApplyExtremum(const CpuKernelContext& ctx, const ScatterElementsComputeInfo& info,
+                       const scatter::ScatterPlan& plan, const T* updates, T* output)
+{
+    return ApplyReduction(ctx, info, plan, updates, output, Reducer());
+}
+
+template <typename T, typename Reducer, typename std::enable_if<IsComplexType<T>::value, int>::type = 0>
+uint32_t ApplyExtremum(const CpuKernelContext&, const ScatterElementsComputeInfo&, const scatter::ScatterPlan&,
+                       const T*, T*)
+{
+    KERNEL_LOG_ERROR("Reduction max|min does not support complex data type");
+    return KERNEL_STATUS_PARAM_INVALID;
+}
+
+template <typename T>
+uint32_t ApplyMean(const CpuKernelContext& ctx, const ScatterElementsComputeInfo& info,
+                   const scatter::ScatterPlan& plan, const T* updates, T* output)
+{
+    KERNEL_CHECK_FALSE((!std::is_same<T, bool>::value), KERNEL_STATUS_PARAM_INVALID,
+                       "Reduction mean does not support bool data type");
+    std::vector<int64_t> hit_counts;
+    auto ret = ApplyReduction(ctx, info, plan, updates, output, scatter::ScatterAdd<T>(), &hit_counts);
+    KERNEL_CHECK_FALSE(ret == KERNEL_STATUS_OK, ret, "Apply mean reduction failed");
+    const int64_t self_count = info.include_self ? 1 : 0;
+    auto shard_divide = [&](int64_t start, int64_t end) {
+        for (int64_t i = start; i < end; ++i) {
+            if (hit_counts[i] != 0) {
+                output[i] = MeanDivide(output[i], hit_counts[i] + self_count);
+            }
+        }
+    };
+    if (info.total_value_num < kSplitSize) {
+        shard_divide(0, info.total_value_num);
+        return KERNEL_STATUS_OK;
     }
+    KERNEL_HANDLE_ERROR(CpuKernelUtils::ParallelFor(ctx, info.total_value_num, kSplitSize, shard_divide),
+                        "Calculate mean value failed!");
     return KERNEL_STATUS_OK;
 }
 
 template <typename T, typename TI>
-uint32_t ScatterDiffNum(const ScatterElementsComputeInfo& info, const TI* indices_data, const T* updates, T* output)
+uint32_t ScatterByPlan(const CpuKernelContext& ctx, const ScatterElementsComputeInfo& info, const TI* indices_data,
+                       const T* updates, T* output)
 {
-    for (int64_t i = 0; i < info.update_value_num; ++i) {
+    // updates 与 indices 元素个数不同时需按 updates 的 shape 单独计算读取位置
+    const bool diff_num = info.update_value_num != info.update_src_num;
+    scatter::ScatterPlan plan(info.update_value_num, info.total_value_num, 1, diff_num);
+    auto locate = [&](int64_t i, int64_t& index_value, int64_t& src_row) -> uint32_t {
         int64_t indices_value = 0;
-        int64_t index_value = 0;
         int64_t src_index = 0;
         auto ret = NormalizeIndicesValue(info, indices_data[i], indices_value);
         KERNEL_CHECK_FALSE(ret == KERNEL_STATUS_OK, ret, "NormalizeIndicesValue failed");
         CalcScatterIndices(info, i, indices_value, index_value, src_index);
         KERNEL_CHECK_FALSE(index_value < info.total_value_num, KERNEL_STATUS_PARAM_INVALID,
                            "Update index %ld greater than %ld which is overflow", index_value, info.total_value_num);
-        KERNEL_CHECK_FALSE(src_index < info.update_src_num, KERNEL_STATUS_PARAM_INVALID,
-                           "src index %ld greater than src total numbers %ld which is overflow", src_index,
-                           info.update_src_num);
-        ApplyReduction(updates, output, index_value, src_index, info.reduction_flag);
+        if (diff_num) {
+            KERNEL_CHECK_FALSE(src_index < info.update_src_num, KERNEL_STATUS_PARAM_INVALID,
+                               "src index %ld greater than src total numbers %ld which is overflow", src_index,
+                               info.update_src_num);
+            src_row = src_index;
+        }
+        return KERNEL_STATUS_OK;
+    };
+    auto ret = plan.Build(ctx, locate);
+    KERNEL_CHECK_FALSE(ret == KERNEL_STATUS_OK, ret, "Locate scatter indices failed");
+    switch (info.reduction_flag) {
+        case kReductionAdd:
+            return ApplyReduction(ctx, info, plan, updates, output, scatter::ScatterAdd<T>());
+        case kReductionMul:
+            return ApplyReduction(ctx, info, plan, updates, output, scatter::ScatterMul<T>());
+        case kReductionMax:
+            return ApplyExtremum<T, ReduceMax<T>>(ctx, info, plan, updates, output);
+        case kReductionMin:
+            return ApplyExtremum<T, ReduceMin<T>>(ctx, info, plan, updates, output);
+        case kReductionMean:
+            return ApplyMean(ctx, info, plan, updates, output);
+        default:
+            return plan.Apply(ctx, updates, output, scatter::ScatterAssign<T>(), true);
     }
-    return KERNEL_STATUS_OK;
 }
 
 } // namespace
@@ -329,8 +462,7 @@ uint32_t ScatterElementsCpuKernel::DoCompute(const CpuKernelContext& ctx)
     auto* indices_data = reinterpret_cast<TI*>(ctx.Input(1)->GetData());
     auto* updates = reinterpret_cast<T*>(ctx.Input(kUpdatesInputIndex)->GetData());
     auto* output = reinterpret_cast<T*>(ctx.Output(0)->GetData());
-    return info.update_value_num == info.update_src_num ? ScatterSameNum(info, indices_data, updates, output) :
-                                                          ScatterDiffNum(info, indices_data, updates, output);
+    return ScatterByPlan(ctx, info, indices_data, updates, output);
 }
 
 REGISTER_CPU_KERNEL(kScatterElements, ScatterElementsCpuKernel);
@@ -8,6 +8,7 @@
  * See LICENSE in the root of the software repository for the full text of the License.
  */
 
+#include <cmath>
 #include <complex>
 #include <memory>
 #include <numeric>
@@ -30,20 +31,21 @@ using namespace aicpu;
 
 class TEST_SCATTER_ELEMENTS_UT : public testing::Test {};
 
-#define CREATE_NODEDEF(shapes, data_types, datas, axis, reduction)       \
-    auto node_def = CpuKernelUtils::CreateNodeDef();                     \
-    NodeDefBuilder(node_def.get(), "ScatterElements", "ScatterElements") \
-        .Input({"data", data_types[0], shapes[0], datas[0]})             \
-        .Input({"indices", data_types[1], shapes[1], datas[1]})          \
-        .Input({"updates", data_types[2], shapes[2], datas[2]})          \
-        .Attr("axis", axis)                                              \
-        .Attr("reduction", reduction)                                    \
+#define CREATE_NODEDEF(shapes, data_types, datas, axis, reduction, include_self) \
+    auto node_def = CpuKernelUtils::CreateNodeDef();                               \
+    NodeDefBuilder(node_def.get(), "ScatterElements", "ScatterElements")           \
+        .Input({"data", data_types[0], shapes[0], datas[0]})                       \
+        .Input({"indices", data_types[1], shapes[1], datas[1]})                    \
+        .Input({"updates", data_types[2], shapes[2], datas[2]})                    \
+        .Attr("axis", axis)                                                        \
+        .Attr("reduction", reduction)                                              \
+        .Attr("include_self", include_self)                                        \
         .Output({"y", data_types[3], shapes[3], datas[3]})
 
 template <typename T, typename Index>
 void RunScatterElementsKernel(const vector<vector<int64_t>>& shapes, const vector<DataType>& data_types,
                               const T* input_data, const Index* input_indices, const T* input_updates, T* expect_output,
-                              int64_t axis, const string& reduction = "none")
+                              int64_t axis, const string& reduction = "none", bool include_self = true)
 {
     auto calc_size = [](const vector<int64_t>& shape) -> uint64_t {
         return shape.empty() ? 0 : accumulate(shape.begin(), shape.end(), 1LL, multiplies<int64_t>());
@@ -73,7 +75,7 @@ void RunScatterElementsKernel(const vector<vector<int64_t>>& shapes, const vecto
 
     vector<void*> datas = {static_cast<void*>(data.get()), static_cast<void*>(indices.get()),
                            static_cast<void*>(updates.get()), static_cast<void*>(output.get())};
-    CREATE_NODEDEF(shapes, data_types, datas, axis, reduction);
+    CREATE_NODEDEF(shapes, data_types, datas, axis, reduction, include_self);
     RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
     EXPECT_TRUE(CompareResult(output.get(), expect_output, output_size));
 }
@@ -121,6 +123,122 @@ TEST_F(TEST_SCATTER_ELEMENTS_UT, FAILED_OUT_OF_BOUND_INDEX)
     double output[5] = {0};
     vector<void*> datas = {static_cast<void*>(input_data), static_cast<void*>(input_indices),
                            static_cast<void*>(input_updates), static_cast<void*>(output)};
-    CREATE_NODEDEF(shapes, data_types, datas, 1, "none");
+    CREATE_NODEDEF(shapes, data_types, datas, 1, "none", true);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_PARAM_INVALID);
+}
+
+TEST_F(TEST_SCATTER_ELEMENTS_UT, DUPLICATE_INDICES_PARALLEL_ADD_SUCC)
+{
+    constexpr int64_t kDataNum = 8;
+    constexpr int64_t kUpdateNum = 40000;
+    vector<DataType> data_types = {DT_INT32, DT_INT32, DT_INT32, DT_INT32};
+    vector<vector<int64_t>> shapes = {{1, kDataNum}, {1, kUpdateNum}, {1, kUpdateNum}, {1, kDataNum}};
+    vector<int32_t> input_data(kDataNum, 1);
+    vector<int32_t> input_indices(kUpdateNum);
+    vector<int32_t> input_updates(kUpdateNum, 1);
+    vector<int32_t> expect_output(input_data);
+    for (int64_t i = 0; i < kUpdateNum; ++i) {
+        input_indices[i] = static_cast<int32_t>(i % kDataNum);
+        expect_output[input_indices[i]] += input_updates[i];
+    }
+    RunScatterElementsKernel(shapes, data_types, input_data.data(), input_indices.data(), input_updates.data(),
+                             expect_output.data(), 1, "add");
+}
+
+TEST_F(TEST_SCATTER_ELEMENTS_UT, DATA_TYPE_DT_FLOAT_AMAX_NAN_SUCC)
+{
+    vector<DataType> data_types = {DT_FLOAT, DT_INT32, DT_FLOAT, DT_FLOAT};
+    vector<vector<int64_t>> shapes = {{1, 4}, {1, 4}, {1, 4}, {1, 4}};
+    float input_data[4] = {1, NAN, 3, 4};
+    int32_t input_indices[4] = {0, 1, 2, 2};
+    float input_updates[4] = {5, 6, NAN, 7};
+    float output[4] = {0};
+    vector<void*> datas = {static_cast<void*>(input_data), static_cast<void*>(input_indices),
+                           static_cast<void*>(input_updates), static_cast<void*>(output)};
+    CREATE_NODEDEF(shapes, data_types, datas, 1, "amax", true);
+    RUN_KERNEL(node_def, HOST, KERNEL_STATUS_OK);
+    EXPECT_FLOAT_EQ(output[0], 5);
+    EXPECT_TRUE(std::isnan(output[1]));
+    EXPECT_TRUE(std::isnan(output[2]));
+    EXPECT_FLOAT_EQ(output[3], 4);
+}
+
+TEST_F(TEST_SCATTER_ELEMENTS_UT, DATA_TYPE_DT_INT32_AMIN_EXCLUDE_SELF_SUCC)
+{
+    vector<DataType> data_types = {DT_INT32, DT_INT64, DT_INT32, DT_INT32};
+    vector<vector<int64_t>> shapes = {{2, 3}, {2, 2}, {2, 2}, {2, 3}};
+    int32_t input_data[6] = {-10, 2, 3, 4, 5, 6};
+    int64_t input_indices[4] = {0, 0, 2, 2};
+    int32_t input_updates[4] = {7, 8, 9, -1};
+    int32_t expect_output[6] = {7, 2, 3, 4, 5, -1};
+    RunScatterElementsKernel(shapes, data_types, input_data, input_indices, input_updates, expect_output, 1, "amin",
+                             false);
+}
+
+TEST_F(TEST_SCATTER_ELEMENTS_UT, DATA_TYPE_DT_FLOAT_MEAN_SUCC)
+{
+    vector<DataType> data_types = {DT_FLOAT, DT_INT32, DT_FLOAT, DT_FLOAT};
+    vector<vector<int64_t>> shapes = {{1, 4}, {1, 3}, {1, 3}, {1, 4}};
+    float input_data[4] = {1, 2, 3, 4};
+    int32_t input_indices[3] = {1, 1, 3};
+    float input_updates[3] = {4, 6, 8};
+    float expect_include_self[4] = {1, 4, 3, 6};
+    RunScatterElementsKernel(shapes, data_types, input_data, input_indices, input_updates, expect_include_self, 1,
+                             "mean");
+    float expect_exclude_self[4] = {1, 5, 3, 8};
+    RunScatterElementsKernel(shapes, data_types, input_data, input_indices, input_updates, expect_exclude_self, 1,
+                             "mean", false);
+}
+
+TEST_F(TEST_SCATTER_ELEMENTS_UT, DATA_TYPE_DT_INT32_MEAN_FLOOR_SUCC)
+{
+    vector<DataType> data_types = {DT_INT32, DT_INT32, DT_INT32, DT_INT32};
+    vector<vector<int64_t>> shapes = {{1, 3}, {1, 4}, {1, 4}, {1, 3}};
+    int32_t input_data[3] = {1, 0, 5};
+    int32_t input_indices[4] = {0, 0, 1, 1};
+    int32_t input_updates[4] = {2, 2, -3, -4};
+    int32_t expect_output[3] = {1, -3, 5};
+    RunScatterElementsKernel(shapes, data_types, input_data, input_indices, input_updates, expect_output, 1, "mean");
+}
+
+TEST_F(TEST_SCATTER_ELEMENTS_UT, DUPLICATE_INDICES_PARALLEL_MEAN_EXCLUDE_SELF_SUCC)
+{
+    constexpr int64_t kDataNum = 16;
+    constexpr int64_t kUpdateNum = 40000;
+    vector<DataType> data_types = {DT_DOUBLE, DT_INT64, DT_DOUBLE, DT_DOUBLE};
+    vector<vector<int64_t>> shapes = {{1, kDataNum}, {1, kUpdateNum}, {1, kUpdateNum}, {1, kDataNum}};
+    vector<double> input_data(kDataNum, -1);
+    vector<int64_t> input_indices(kUpdateNum);
+    vector<double> input_updates(kUpdateNum);
+    vector<double> sums(kDataNum, 0);
+    vector<int64_t> counts(kDataNum, 0);
+    for (int64_t i = 0; i < kUpdateNum; ++i) {
+        // 最后一个位置不被命中, 应保持原值
+        input_indices[i] = i % (kDataNum - 1);
+        input_updates[i] = static_cast<double>(i % 7);
+        sums[input_indices[i]] += input_updates[i];
+        ++counts[input_indices[i]];
+    }
+    vector<double> expect_output(input_data);
+    for (int64_t i = 0; i < kDataNum; ++i) {
+        if (counts[i] != 0) {
+            expect_output[i] = sums[i] / counts[i];
+        }
+    }
+    RunScatterElementsKernel(shapes, data_types, input_data.data(), input_indices.data(), input_updates.data(),
+                             expect_output.data(), 1, "mean", false);
+}
+
+TEST_F(TEST_SCATTER_ELEMENTS_UT, FAILED_UNSUPPORTED_REDUCTION)
+{
+    vector<DataType> data_types = {DT_FLOAT, DT_INT32, DT_FLOAT, DT_FLOAT};
+    vector<vector<int64_t>> shapes = {{1, 4}, {1, 2}, {1, 2}, {1, 4}};
+    float input_data[4] = {1, 2, 3, 4};
+    int32_t input_indices[2] = {0, 1};
+    float input_updates[2] = {5, 6};
+    float output[4] = {0};
+    vector<void*> datas = {static_cast<void*>(input_data), static_cast<void*>(input_indices),
+                           static_cast<void*>(input_updates), static_cast<void*>(output)};
+    CREATE_NODEDEF(shapes, data_types, datas, 1, "sum", true);
     RUN_KERNEL(node_def, HOST, KERNEL_STATUS_PARAM_INVALID);
 }
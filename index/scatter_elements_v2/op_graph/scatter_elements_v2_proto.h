@@ -35,8 +35,8 @@ namespace ge {
 * @par Attributes:
 * @li axis: An optional int. Defaults to 0.
 * @li reduction: An optional string. Defaults to string "none" and can be
-* "add" or "mul". \n
-* @li include_self: An optional bool. Defaults to true. It controls whether var participates in mean reduction. \n
+* "add", "mul", "max", "min" or "mean". If either operand of max/min is NaN, the result is NaN. \n
+* @li include_self: An optional bool. Defaults to true. It controls whether var participates in reduction. \n
 
 * @attention Constraints:
 * @li In non-last axis scenarios, you are advised to convert x, indices, and updates to the last axes,
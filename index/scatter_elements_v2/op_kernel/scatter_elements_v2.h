@@ -426,10 +426,10 @@ private:
             return static_cast<DataType>(inputValue * updateValue);
         }
         if (mode == ScatterElementsV2NS::SCATTER_MODE_MIN) {
-            return inputValue < updateValue ? inputValue : updateValue;
+            return ScatterElementsV2NS::ReduceMinValue<DataType>(inputValue, updateValue);
         }
         if (mode == ScatterElementsV2NS::SCATTER_MODE_MAX) {
-            return inputValue > updateValue ? inputValue : updateValue;
+            return ScatterElementsV2NS::ReduceMaxValue<DataType>(inputValue, updateValue);
         }
         return updateValue;
     }
@@ -63,6 +63,31 @@ __aicore__ inline int64_t FloorDivInt64(int64_t value, int32_t divisor)
     return quotient;
 }
 
+// min/max 与 torch.scatter_reduce 的 amin/amax 保持一致: 任一操作数为 NaN 时结果为 NaN
+template <typename T>
+__aicore__ inline T ReduceMinValue(T inputValue, T updateValue)
+{
+    if (inputValue != inputValue) {
+        return inputValue;
+    }
+    if (updateValue != updateValue) {
+        return updateValue;
+    }
+    return inputValue < updateValue ? inputValue : updateValue;
+}
+
+template <typename T>
+__aicore__ inline T ReduceMaxValue(T inputValue, T updateValue)
+{
+    if (inputValue != inputValue) {
+        return inputValue;
+    }
+    if (updateValue != updateValue) {
+        return updateValue;
+    }
+    return inputValue > updateValue ? inputValue : updateValue;
+}
+
 template <typename T>
 __aicore__ inline T MeanDivideValue(T value, int32_t divisor)
 {
@@ -442,9 +442,9 @@ private:
                 } else if (this->mode == SCATTER_MODE_MUL) {
                     *(xUbAddress + indexValue) = static_cast<V>(inputValue * value);
                 } else if (this->mode == SCATTER_MODE_MIN) {
-                    *(xUbAddress + indexValue) = inputValue < value ? inputValue : value;
+                    *(xUbAddress + indexValue) = ReduceMinValue<V>(inputValue, value);
                 } else if (this->mode == SCATTER_MODE_MAX) {
-                    *(xUbAddress + indexValue) = inputValue > value ? inputValue : value;
+                    *(xUbAddress + indexValue) = ReduceMaxValue<V>(inputValue, value);
                 }
             }
         }
@@ -14,6 +14,7 @@
 #include <iostream>
 
 #include "Eigen/Dense"
+#include "aicpu/parallel_scatter.h"
 #include "cpu_kernel.h"
 #include "cpu_kernel_utils.h"
 #include "kernel_util.h"
@@ -184,22 +185,29 @@ uint32_t ScatterNdMaxCpuKernel::DoScatterNdMaxCompute(CpuKernelContext& ctx)
         dims_to_count[i] = count / value_dim_ref[i];
         count = dims_to_count[i];
     }
+    KERNEL_CHECK_FALSE((unit_size == count), KERNEL_STATUS_PARAM_INVALID,
+                       "The slice size of updates[%ld] must be equal to that of var[%ld].", unit_size, count);
 
-    for (int64_t i = 0; i < num_units; ++i) {
-        int64_t offset = 0;
-        for (int64_t j = 0; j < indices_unit_rank; ++j) {
-            int64_t index = input_indices[i * indices_unit_rank + j];
-            if (index < 0 || index >= value_dim_ref[j]) {
-                KERNEL_LOG_ERROR("The indices[%ld] is so big or small", index);
-                return KERNEL_STATUS_PARAM_INVALID;
-            }
-            offset += index * dims_to_count[j];
-        }
-        for (int64_t j = 0; j < unit_size; j++) {
-            if (input_ref[offset + j] < input_updates[i * unit_size + j]) {
-                input_ref[offset + j] = input_updates[i * unit_size + j];
+    if (num_units > 0 && unit_size > 0) {
+        scatter::ScatterPlan plan(num_units, total_value_num / unit_size, unit_size);
+        auto locate = [&](int64_t i, int64_t& row, int64_t& src_row) -> uint32_t {
+            (void)src_row;
+            int64_t offset = 0;
+            for (int64_t j = 0; j < indices_unit_rank; ++j) {
+                int64_t index = input_indices[i * indices_unit_rank + j];
+                if (index < 0 || index >= value_dim_ref[j]) {
+                    KERNEL_LOG_ERROR("The indices[%ld] is so big or small", index);
+                    return KERNEL_STATUS_PARAM_INVALID;
+                }
+                offset += index * dims_to_count[j];
             }
-        }
+            row = offset / unit_size;
+            return KERNEL_STATUS_OK;
+        };
+        KERNEL_CHECK_FALSE((plan.Build(ctx, locate) == KERNEL_STATUS_OK), KERNEL_STATUS_PARAM_INVALID,
+                           "Locate indices failed.");
+        KERNEL_CHECK_FALSE((plan.Apply(ctx, input_updates, input_ref, scatter::ScatterMax<T>()) == KERNEL_STATUS_OK),
+                           KERNEL_STATUS_INNER_ERROR, "Apply updates failed.");
     }
     KERNEL_CHECK_FALSE((InitScatterNdMaxOutput<T>(ctx) == KERNEL_STATUS_OK), KERNEL_STATUS_PARAM_INVALID, "InitOutput failed.");
     return KERNEL_STATUS_OK;
@@ -110,6 +110,31 @@ TEST_F(TEST_SCATTER_ND_MAX_UT, DATA_TYPE_DT_INT32_INT64_SUCC)
     RunScatterNdMaxKernel(shapes, data_types, input_x, input_indices, input_updates, expect_output);
 }
 
+TEST_F(TEST_SCATTER_ND_MAX_UT, DUPLICATE_INDICES_PARALLEL_SUCC)
+{
+    constexpr int64_t kRows = 64;
+    constexpr int64_t kCols = 1024;
+    constexpr int64_t kUnits = 256;
+    constexpr int64_t kHotRows = 4;
+    vector<DataType> data_types = {DT_FLOAT, DT_INT64, DT_FLOAT, DT_FLOAT};
+    vector<vector<int64_t>> shapes = {{kRows, kCols}, {kUnits, 1}, {kUnits, kCols}, {kRows, kCols}};
+    vector<float> input_x(kRows * kCols, -1.0F);
+    vector<int64_t> input_indices(kUnits);
+    vector<float> input_updates(kUnits * kCols);
+    vector<float> expect_output(input_x);
+    for (int64_t i = 0; i < kUnits; ++i) {
+        input_indices[i] = i % kHotRows;
+        for (int64_t j = 0; j < kCols; ++j) {
+            float value = static_cast<float>((i * 7 + j) % kUnits);
+            input_updates[i * kCols + j] = value;
+            float& expect = expect_output[input_indices[i] * kCols + j];
+            expect = value > expect ? value : expect;
+        }
+    }
+    RunScatterNdMaxKernel(shapes, data_types, input_x.data(), input_indices.data(), input_updates.data(),
+                          expect_output.data());
+}
+
 TEST_F(TEST_SCATTER_ND_MAX_UT, FAILED_INDICES_TYPE)
 {
     vector<DataType> data_types = {DT_FLOAT, DT_DOUBLE, DT_FLOAT, DT_FLOAT};
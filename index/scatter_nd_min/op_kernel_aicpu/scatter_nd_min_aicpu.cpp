@@ -14,6 +14,7 @@
 #include <iostream>
 
 #include "Eigen/Dense"
+#include "aicpu/parallel_scatter.h"
 #include "cpu_kernel.h"
 #include "cpu_kernel_utils.h"
 #include "kernel_util.h"
@@ -182,22 +183,30 @@ uint32_t ScatterNdMinCpuKernel::DoScatterNdMinCompute(CpuKernelContext& ctx)
         ref_strides[depth_idx] = stride_count / ref_dims[depth_idx];
         stride_count = ref_strides[depth_idx];
     }
+    KERNEL_CHECK_FALSE((update_unit_size == stride_count), KERNEL_STATUS_PARAM_INVALID,
+                       "The slice size of updates[%ld] must be equal to that of var[%ld].", update_unit_size,
+                       stride_count);
 
-    for (int64_t unit_idx = 0; unit_idx < unit_num; ++unit_idx) {
-        int64_t ref_offset = 0;
-        for (int64_t depth_idx = 0; depth_idx < index_depth; ++depth_idx) {
-            int64_t index_value = indices_ptr[unit_idx * index_depth + depth_idx];
-            if (index_value < 0 || index_value >= ref_dims[depth_idx]) {
-                KERNEL_LOG_ERROR("The indices[%ld] is so big or small", index_value);
-                return KERNEL_STATUS_PARAM_INVALID;
-            }
-            ref_offset += index_value * ref_strides[depth_idx];
-        }
-        for (int64_t update_idx = 0; update_idx < update_unit_size; update_idx++) {
-            if (ref_data[ref_offset + update_idx] > updates_ptr[unit_idx * update_unit_size + update_idx]) {
-                ref_data[ref_offset + update_idx] = updates_ptr[unit_idx * update_unit_size + update_idx];
+    if (unit_num > 0 && update_unit_size > 0) {
+        scatter::ScatterPlan plan(unit_num, ref_element_num / update_unit_size, update_unit_size);
+        auto locate = [&](int64_t unit_idx, int64_t& ref_row, int64_t& src_row) -> uint32_t {
+            (void)src_row;
+            int64_t ref_offset = 0;
+            for (int64_t depth_idx = 0; depth_idx < index_depth; ++depth_idx) {
+                int64_t index_value = indices_ptr[unit_idx * index_depth + depth_idx];
+                if (index_value < 0 || index_value >= ref_dims[depth_idx]) {
+                    KERNEL_LOG_ERROR("The indices[%ld] is so big or small", index_value);
+                    return KERNEL_STATUS_PARAM_INVALID;
+                }
+                ref_offset += index_value * ref_strides[depth_idx];
             }
-        }
+            ref_row = ref_offset / update_unit_size;
+            return KERNEL_STATUS_OK;
+        };
+        KERNEL_CHECK_FALSE((plan.Build(ctx, locate) == KERNEL_STATUS_OK), KERNEL_STATUS_PARAM_INVALID,
+                           "Locate indices failed.");
+        KERNEL_CHECK_FALSE((plan.Apply(ctx, updates_ptr, ref_data, scatter::ScatterMin<T>()) == KERNEL_STATUS_OK),
+                           KERNEL_STATUS_INNER_ERROR, "Apply updates failed.");
     }
     KERNEL_CHECK_FALSE((InitScatterNdMinOutput<T>(ctx) == KERNEL_STATUS_OK), KERNEL_STATUS_PARAM_INVALID, "InitOutput failed.");
     return KERNEL_STATUS_OK;
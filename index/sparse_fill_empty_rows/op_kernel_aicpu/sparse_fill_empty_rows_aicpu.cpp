@@ -15,6 +15,7 @@
 #include <algorithm>
 #include <complex>
 #include <cstdint>
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -38,52 +39,106 @@ constexpr int32_t kYValuesOutput = 1;
 constexpr int32_t kEmptyRowIndicatorOutput = 2;
 constexpr int32_t kReverseIndexMapOutput = 3;
 
+constexpr int64_t kParallelDataNum = 16 * 1024;
+
 #define SPARSE_FILL_EMPTY_ROWS_DATA_TYPE_CASE(DTYPE, TYPE)                                      \
     case (DTYPE): {                                                                             \
         ret = ComputeSparseFillEmptyRows<TYPE>(ctx, indices, values, denseShape, defaultValue); \
         break;                                                                                  \
     }
-} // namespace
 
-namespace aicpu {
-template <typename T>
-void SparseFillEmptyRowsCpuKernel::FillValue(const TTypes<int64_t>::Matrix& indicesMatrix,
-                                             std::vector<int64_t>& csrOffset,
-                                             TTypes<int64_t>::Matrix& outputIndicesMatrix, const T* valuesData,
-                                             T* outputValuesData, int64_t* reverseIndexMapData, const T defaultValue)
+// 按行统计时各分片的汇总信息, 用于判定输入是否已按行有序且无空行
+struct ShardSummary {
+    int64_t firstRow = 0;
+    int64_t lastRow = 0;
+    bool ordered = true;
+    // 相邻索引的行号至多相差 1, 有序时即分片内没有跳过的行
+    bool dense = true;
+    int64_t invalidIndex = -1;
+};
+
+// 总量较小或单核时串行执行, 否则按核数切分后调用 ParallelFor
+uint32_t RunSharded(const CpuKernelContext& ctx, int64_t total, const std::function<void(int64_t, int64_t)>& shard)
 {
-    const int64_t n = indicesMatrix.dimension(0);
-    const int64_t rank = indicesMatrix.dimension(1);
-    const int64_t denseRows = static_cast<int64_t>(csrOffset.size());
-    std::vector<int64_t> filledCount(denseRows, 0);
-
-    for (int64_t i = 0; i < n; ++i) {
-        const int64_t row = indicesMatrix(i, 0);
-        int64_t& offset = filledCount[row];
-        const int64_t outputI = ((row == 0) ? 0 : csrOffset[row - 1]) + offset;
-        ++offset;
-        (void)std::copy_n(&indicesMatrix(i, 0), rank, &outputIndicesMatrix(outputI, 0));
-        outputValuesData[outputI] = valuesData[i];
-        reverseIndexMapData[i] = outputI;
+    if (total <= 0) {
+        return KERNEL_STATUS_OK;
+    }
+    const int64_t cores = std::max<int64_t>(1, static_cast<int64_t>(CpuKernelUtils::GetCPUNum(ctx)));
+    if (total < kParallelDataNum || cores == 1) {
+        shard(0, total);
+        return KERNEL_STATUS_OK;
     }
+    return CpuKernelUtils::ParallelFor(ctx, total, (total + cores - 1) / cores, shard);
+}
 
-    for (int64_t row = 0; row < denseRows; ++row) {
-        if (filledCount[row] != 0) {
-            continue;
+// 分块并行的原地 exclusive scan: 块内求和, 串行扫描块和, 再块内回写
+uint32_t ExclusiveScan(const CpuKernelContext& ctx, int64_t* data, int64_t num, int64_t blockNum, int64_t& total)
+{
+    blockNum = (num < kParallelDataNum) ? 1 : std::max<int64_t>(1, std::min(blockNum, num));
+    const int64_t blockSize = (num + blockNum - 1) / blockNum;
+    std::vector<int64_t> blockSum(static_cast<size_t>(blockNum), 0);
+    auto sumBlocks = [&](int64_t begin, int64_t end) {
+        for (int64_t blk = begin; blk < end; ++blk) {
+            const int64_t rowEnd = std::min(num, (blk + 1) * blockSize);
+            for (int64_t row = blk * blockSize; row < rowEnd; ++row) {
+                blockSum[blk] += data[row];
+            }
         }
-        const int64_t startingIndex = (row == 0) ? 0 : csrOffset[row - 1];
-        outputIndicesMatrix(startingIndex, 0) = row;
-        for (int64_t col = 1; col < rank; ++col) {
-            outputIndicesMatrix(startingIndex, col) = 0;
+    };
+    auto scanBlocks = [&](int64_t begin, int64_t end) {
+        for (int64_t blk = begin; blk < end; ++blk) {
+            int64_t running = blockSum[blk];
+            const int64_t rowEnd = std::min(num, (blk + 1) * blockSize);
+            for (int64_t row = blk * blockSize; row < rowEnd; ++row) {
+                const int64_t size = data[row];
+                data[row] = running;
+                running += size;
+            }
         }
-        outputValuesData[startingIndex] = defaultValue;
+    };
+    if (blockNum == 1) {
+        sumBlocks(0, 1);
+        total = blockSum[0];
+        blockSum[0] = 0;
+        scanBlocks(0, 1);
+        return KERNEL_STATUS_OK;
     }
+    KERNEL_HANDLE_ERROR(CpuKernelUtils::ParallelFor(ctx, blockNum, 1, sumBlocks), "Sum row blocks failed.");
+    total = 0;
+    for (int64_t blk = 0; blk < blockNum; ++blk) {
+        const int64_t size = blockSum[blk];
+        blockSum[blk] = total;
+        total += size;
+    }
+    KERNEL_HANDLE_ERROR(CpuKernelUtils::ParallelFor(ctx, blockNum, 1, scanBlocks), "Scan row blocks failed.");
+    return KERNEL_STATUS_OK;
 }
 
+bool IsRowSortedAndFull(const std::vector<ShardSummary>& summaries, int64_t denseRows)
+{
+    if (summaries.front().firstRow != 0 || summaries.back().lastRow != denseRows - 1) {
+        return false;
+    }
+    for (size_t s = 0; s < summaries.size(); ++s) {
+        if (!summaries[s].ordered || !summaries[s].dense) {
+            return false;
+        }
+        if (s > 0) {
+            const int64_t step = summaries[s].firstRow - summaries[s - 1].lastRow;
+            if (step < 0 || step > 1) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+} // namespace
+
+namespace aicpu {
 template <typename T>
-KernelStatus SparseFillEmptyRowsCpuKernel::ComputeSparseFillEmptyRows(const CpuKernelContext& ctx, Tensor* indices,
-                                                                      const Tensor* values, const Tensor* denseShape,
-                                                                      const Tensor* defaultValueTensor)
+uint32_t SparseFillEmptyRowsCpuKernel::ComputeSparseFillEmptyRows(const CpuKernelContext& ctx, Tensor* indices,
+                                                                  const Tensor* values, const Tensor* denseShape,
+                                                                  const Tensor* defaultValueTensor)
 {
     Tensor* outputIndices = ctx.Output(kYIndicesOutput);
     Tensor* outputValues = ctx.Output(kYValuesOutput);
@@ -103,54 +158,129 @@ KernelStatus SparseFillEmptyRowsCpuKernel::ComputeSparseFillEmptyRows(const CpuK
         outputValues->GetTensorShape()->SetDimSizes({0});
         return KERNEL_STATUS_OK;
     }
+    KERNEL_CHECK_FALSE((denseRows > 0), KERNEL_STATUS_PARAM_INVALID, "dense_shape[0] = %ld must be > 0.", denseRows);
 
-    bool rowsAreOrdered = true;
-    int64_t lastIndicesRow = 0;
-    std::vector<int64_t> csrOffset(denseRows, 0);
-
-    EigenTensor indicesEigen(indices, indices->GetData());
-    const auto indicesMatrix = indicesEigen.matrix<int64_t>();
-    auto* valuesData = reinterpret_cast<T*>(values->GetData());
+    const auto* indicesData = reinterpret_cast<const int64_t*>(indices->GetData());
+    const auto* valuesData = reinterpret_cast<const T*>(values->GetData());
     auto* emptyRowIndicatorData = reinterpret_cast<bool*>(emptyRowIndicator->GetData());
     auto* reverseIndexMapData = reinterpret_cast<int64_t*>(reverseIndexMap->GetData());
-
-    EigenTensor outputIndicesEigen(outputIndices, outputIndices->GetData());
-    auto outputIndicesMatrix = outputIndicesEigen.matrix<int64_t>();
+    auto* outputIndicesData = reinterpret_cast<int64_t*>(outputIndices->GetData());
     auto* outputValuesData = reinterpret_cast<T*>(outputValues->GetData());
-    for (int64_t i = 0; i < n; ++i) {
-        const int64_t row = indicesMatrix(i, 0);
-        if (row < 0 || row >= denseRows) {
-            KERNEL_LOG_ERROR("indices(%ld, 0) value is %ld which is invalid.", i, row);
+
+    // 1. 各分片统计行直方图, 同时完成行号校验与有序/无空行判定;
+    //    每个分片各持有 denseRows 大小的直方图, 分片数受 n / denseRows 限制以控制额外开销
+    const int64_t cores = std::max<int64_t>(1, static_cast<int64_t>(CpuKernelUtils::GetCPUNum(ctx)));
+    const int64_t shardTarget = (n < kParallelDataNum) ? 1 : std::min(cores, 1 + n / denseRows);
+    const int64_t shardSize = std::max<int64_t>(1, (n + shardTarget - 1) / shardTarget);
+    const int64_t shardNum = std::max<int64_t>(1, (n + shardSize - 1) / shardSize);
+    std::vector<ShardSummary> summaries(static_cast<size_t>(shardNum));
+    std::vector<int64_t> shardRowCount(static_cast<size_t>(shardNum * denseRows), 0);
+    auto countRows = [&](int64_t begin, int64_t end) {
+        for (int64_t s = begin; s < end; ++s) {
+            ShardSummary& summary = summaries[s];
+            int64_t* count = shardRowCount.data() + s * denseRows;
+            const int64_t indexEnd = std::min(n, (s + 1) * shardSize);
+            int64_t lastRow = -1;
+            for (int64_t i = s * shardSize; i < indexEnd; ++i) {
+                const int64_t row = indicesData[i * rank];
+                if (row < 0 || row >= denseRows) {
+                    summary.invalidIndex = i;
+                    break;
+                }
+                ++count[row];
+                if (lastRow >= 0) {
+                    summary.ordered = summary.ordered && (row >= lastRow);
+                    summary.dense = summary.dense && (row - lastRow <= 1);
+                } else {
+                    summary.firstRow = row;
+                }
+                lastRow = row;
+            }
+            summary.lastRow = lastRow;
+        }
+    };
+    if (shardNum > 1) {
+        KERNEL_HANDLE_ERROR(CpuKernelUtils::ParallelFor(ctx, shardNum, 1, countRows), "Count rows failed.");
+    } else {
+        countRows(0, 1);
+    }
+    for (int64_t s = 0; s < shardNum; ++s) {
+        if (summaries[s].invalidIndex >= 0) {
+            const int64_t i = summaries[s].invalidIndex;
+            KERNEL_LOG_ERROR("indices(%ld, 0) value is %ld which is invalid.", i, indicesData[i * rank]);
             return KERNEL_STATUS_PARAM_INVALID;
         }
-        ++csrOffset[row];
-        rowsAreOrdered = rowsAreOrdered && (row >= lastIndicesRow);
-        lastIndicesRow = row;
     }
 
-    bool allRowsFull = true;
-    for (int64_t row = 0; row < denseRows; ++row) {
-        const bool rowEmpty = (csrOffset[row] == 0);
-        emptyRowIndicatorData[row] = rowEmpty;
-        allRowsFull = allRowsFull && !rowEmpty;
-        csrOffset[row] = std::max(csrOffset[row], static_cast<int64_t>(1));
-        if (row > 0) {
-            csrOffset[row] += csrOffset[row - 1];
-        }
+    // 2. 输入已按行有序且每行非空时, 输出即输入的拷贝
+    if (n > 0 && IsRowSortedAndFull(summaries, denseRows)) {
+        auto copyShard = [&](int64_t begin, int64_t end) {
+            (void)std::copy(indicesData + begin * rank, indicesData + end * rank, outputIndicesData + begin * rank);
+            (void)std::copy(valuesData + begin, valuesData + end, outputValuesData + begin);
+            for (int64_t i = begin; i < end; ++i) {
+                reverseIndexMapData[i] = i;
+            }
+        };
+        KERNEL_HANDLE_ERROR(RunSharded(ctx, n, copyShard), "Copy sorted indices failed.");
+        (void)std::fill(emptyRowIndicatorData, emptyRowIndicatorData + denseRows, false);
+        outputIndices->GetTensorShape()->SetDimSizes({n, rank});
+        outputValues->GetTensorShape()->SetDimSizes({n});
+        return KERNEL_STATUS_OK;
     }
 
-    if (allRowsFull && rowsAreOrdered) {
-        (void)std::copy_n(&indicesMatrix(0, 0), n * rank, &outputIndicesMatrix(0, 0));
-        (void)std::copy_n(valuesData, n, outputValuesData);
-        for (int64_t i = 0; i < n; ++i) {
-            reverseIndexMapData[i] = i;
+    // 3. 按行汇总各分片计数, 分片计数原地改写为该分片在行内的写入起点; 空行占一个位置
+    std::vector<int64_t> rowStart(static_cast<size_t>(denseRows), 0);
+    auto mergeRows = [&](int64_t begin, int64_t end) {
+        for (int64_t row = begin; row < end; ++row) {
+            int64_t running = 0;
+            for (int64_t s = 0; s < shardNum; ++s) {
+                int64_t& count = shardRowCount[s * denseRows + row];
+                const int64_t shardCount = count;
+                count = running;
+                running += shardCount;
+            }
+            emptyRowIndicatorData[row] = (running == 0);
+            rowStart[row] = std::max(running, static_cast<int64_t>(1));
+        }
+    };
+    KERNEL_HANDLE_ERROR(RunSharded(ctx, denseRows, mergeRows), "Merge row counts failed.");
+    int64_t outputNum = 0;
+    KERNEL_HANDLE_ERROR(ExclusiveScan(ctx, rowStart.data(), denseRows, cores, outputNum),
+                        "Compute row offsets failed.");
+
+    // 4. 各分片按索引顺序写入自己的行内区间, 行内顺序与输入一致
+    auto fillShard = [&](int64_t begin, int64_t end) {
+        for (int64_t s = begin; s < end; ++s) {
+            int64_t* cursor = shardRowCount.data() + s * denseRows;
+            const int64_t indexEnd = std::min(n, (s + 1) * shardSize);
+            for (int64_t i = s * shardSize; i < indexEnd; ++i) {
+                const int64_t row = indicesData[i * rank];
+                const int64_t outputI = rowStart[row] + cursor[row]++;
+                (void)std::copy_n(indicesData + i * rank, rank, outputIndicesData + outputI * rank);
+                outputValuesData[outputI] = valuesData[i];
+                reverseIndexMapData[i] = outputI;
+            }
         }
+    };
+    if (shardNum > 1) {
+        KERNEL_HANDLE_ERROR(CpuKernelUtils::ParallelFor(ctx, shardNum, 1, fillShard), "Fill indices failed.");
     } else {
-        FillValue(indicesMatrix, csrOffset, outputIndicesMatrix, valuesData, outputValuesData, reverseIndexMapData,
-                  defaultValue);
+        fillShard(0, 1);
     }
-    outputIndices->GetTensorShape()->SetDimSizes({csrOffset[denseRows - 1], rank});
-    outputValues->GetTensorShape()->SetDimSizes({csrOffset[denseRows - 1]});
+    auto fillEmptyRows = [&](int64_t begin, int64_t end) {
+        for (int64_t row = begin; row < end; ++row) {
+            if (!emptyRowIndicatorData[row]) {
+                continue;
+            }
+            int64_t* outputRow = outputIndicesData + rowStart[row] * rank;
+            outputRow[0] = row;
+            (void)std::fill(outputRow + 1, outputRow + rank, 0);
+            outputValuesData[rowStart[row]] = defaultValue;
+        }
+    };
+    KERNEL_HANDLE_ERROR(RunSharded(ctx, denseRows, fillEmptyRows), "Fill empty rows failed.");
+    outputIndices->GetTensorShape()->SetDimSizes({outputNum, rank});
+    outputValues->GetTensorShape()->SetDimSizes({outputNum});
     return KERNEL_STATUS_OK;
 }
 
@@ -164,7 +294,7 @@ uint32_t SparseFillEmptyRowsCpuKernel::Compute(CpuKernelContext& ctx)
     Tensor* denseShape = ctx.Input(kDenseShapeInput);
     Tensor* defaultValue = ctx.Input(kDefaultValueInput);
 
-    KernelStatus ret = KERNEL_STATUS_OK;
+    uint32_t ret = KERNEL_STATUS_OK;
     switch (values->GetDataType()) {
         SPARSE_FILL_EMPTY_ROWS_DATA_TYPE_CASE(DT_BOOL, bool)
         SPARSE_FILL_EMPTY_ROWS_DATA_TYPE_CASE(DT_COMPLEX128, std::complex<double>)
@@ -188,7 +318,7 @@ uint32_t SparseFillEmptyRowsCpuKernel::Compute(CpuKernelContext& ctx)
     if (ret != KERNEL_STATUS_OK) {
         KERNEL_LOG_ERROR("SparseFillEmptyRows compute failed.");
     }
-    return static_cast<uint32_t>(ret);
+    return ret;
 }
 
 REGISTER_CPU_KERNEL(kSparseFillEmptyRows, SparseFillEmptyRowsCpuKernel);
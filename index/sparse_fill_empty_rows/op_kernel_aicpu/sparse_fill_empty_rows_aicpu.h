@@ -29,13 +29,8 @@ public:
 
 private:
     template <typename T>
-    KernelStatus ComputeSparseFillEmptyRows(const CpuKernelContext& ctx, Tensor* indices, const Tensor* values,
-                                            const Tensor* denseShape, const Tensor* defaultValueTensor);
-
-    template <typename T>
-    void FillValue(const TTypes<int64_t>::Matrix& indicesMatrix, std::vector<int64_t>& csrOffset,
-                   TTypes<int64_t>::Matrix& outputIndicesMatrix, const T* valuesData, T* outputValuesData,
-                   int64_t* reverseIndexMapData, const T defaultValue);
+    uint32_t ComputeSparseFillEmptyRows(const CpuKernelContext& ctx, Tensor* indices, const Tensor* values,
+                                        const Tensor* denseShape, const Tensor* defaultValueTensor);
 };
 } // namespace aicpu
 
@@ -23,6 +23,7 @@
 
 #include <complex>
 #include <cstdint>
+#include <memory>
 #include <vector>
 
 #include "unsupported/Eigen/CXX11/Tensor"
@@ -214,6 +215,92 @@ TEST_F(TEST_SPARSE_FILL_EMPTY_ROWS_UT, row_index_out_of_range_fail)
     RUN_KERNEL(nodeDef, HOST, KERNEL_STATUS_PARAM_INVALID);
 }
 
+// 串行参考实现: 按行分桶, 行内保持输入顺序, 空行补默认值
+static void SparseFillEmptyRowsReference(const vector<int64_t>& indices, const vector<int32_t>& values,
+                                         int64_t rank, int64_t denseRows, int32_t defaultValue,
+                                         vector<int64_t>& yIndices, vector<int32_t>& yValues,
+                                         vector<bool>& emptyRows, vector<int64_t>& reverseIndexMap)
+{
+    const int64_t n = static_cast<int64_t>(values.size());
+    vector<vector<int64_t>> rowItems(denseRows);
+    for (int64_t i = 0; i < n; ++i) {
+        rowItems[indices[i * rank]].push_back(i);
+    }
+    reverseIndexMap.assign(n, 0);
+    for (int64_t row = 0; row < denseRows; ++row) {
+        emptyRows.push_back(rowItems[row].empty());
+        if (rowItems[row].empty()) {
+            yIndices.push_back(row);
+            yIndices.insert(yIndices.end(), rank - 1, 0);
+            yValues.push_back(defaultValue);
+        }
+        for (int64_t i : rowItems[row]) {
+            reverseIndexMap[i] = static_cast<int64_t>(yValues.size());
+            yIndices.insert(yIndices.end(), indices.begin() + i * rank, indices.begin() + (i + 1) * rank);
+            yValues.push_back(values[i]);
+        }
+    }
+}
+
+// rowStep > 0 时生成按行有序的索引(第 i 个索引位于第 i / rowStep * rowStep 行), 否则随机乱序
+static void RunLargeSparseFillEmptyRowsCase(int64_t n, int64_t denseRows, int64_t rowStep)
+{
+    const int64_t rank = 2;
+    vector<int64_t> inputIndices(n * rank);
+    vector<int32_t> inputValues(n);
+    for (int64_t i = 0; i < n; ++i) {
+        const int64_t row = (rowStep > 0) ? (i * denseRows / n) / rowStep * rowStep : (i * 7919 + 13) % denseRows;
+        inputIndices[i * rank] = row;
+        inputIndices[i * rank + 1] = i % 97;
+        inputValues[i] = static_cast<int32_t>(i);
+    }
+    int64_t denseShape[2] = {denseRows, 97};
+    int32_t defaultValue[1] = {-1};
+    vector<int64_t> expectIndices;
+    vector<int32_t> expectValues;
+    vector<bool> expectEmptyRows;
+    vector<int64_t> expectReverseIndexMap;
+    SparseFillEmptyRowsReference(inputIndices, inputValues, rank, denseRows, defaultValue[0], expectIndices,
+                                 expectValues, expectEmptyRows, expectReverseIndexMap);
+
+    const int64_t outputNum = n + denseRows;
+    vector<int64_t> yIndices(outputNum * rank, 0);
+    vector<int32_t> yValues(outputNum, 0);
+    unique_ptr<bool[]> emptyRowIndicator(new bool[denseRows]());
+    vector<int64_t> reverseIndexMap(n, 0);
+    vector<DataType> dataTypes = {DT_INT64, DT_INT32, DT_INT64, DT_INT32, DT_INT64, DT_INT32, DT_BOOL, DT_INT64};
+    vector<vector<int64_t>> shapes = {{n, rank}, {n},         {2},       {},
+                                      {outputNum, rank}, {outputNum}, {denseRows}, {n}};
+    vector<void*> datas = {inputIndices.data(), inputValues.data(), denseShape,
+                           defaultValue,        yIndices.data(),    yValues.data(),
+                           emptyRowIndicator.get(), reverseIndexMap.data()};
+    CREATE_NODEDEF(shapes, dataTypes, datas);
+    RUN_KERNEL(nodeDef, HOST, KERNEL_STATUS_OK);
+
+    const int64_t expectNum = static_cast<int64_t>(expectValues.size());
+    EXPECT_EQ(CompareResult<int64_t>(yIndices.data(), expectIndices.data(), expectNum * rank), true);
+    EXPECT_EQ(CompareResult<int32_t>(yValues.data(), expectValues.data(), expectNum), true);
+    EXPECT_EQ(CompareResult<int64_t>(reverseIndexMap.data(), expectReverseIndexMap.data(), n), true);
+    for (int64_t row = 0; row < denseRows; ++row) {
+        EXPECT_EQ(emptyRowIndicator[row], expectEmptyRows[row]);
+    }
+}
+
+TEST_F(TEST_SPARSE_FILL_EMPTY_ROWS_UT, large_unordered_parallel_success)
+{
+    RunLargeSparseFillEmptyRowsCase(40000, 3000, 0);
+}
+
+TEST_F(TEST_SPARSE_FILL_EMPTY_ROWS_UT, large_ordered_all_rows_full_success)
+{
+    RunLargeSparseFillEmptyRowsCase(40000, 3000, 1);
+}
+
+TEST_F(TEST_SPARSE_FILL_EMPTY_ROWS_UT, large_ordered_with_empty_rows_success)
+{
+    RunLargeSparseFillEmptyRowsCase(40000, 3000, 2);
+}
+
 TEST_F(TEST_SPARSE_FILL_EMPTY_ROWS_UT, unsupported_dtype_fail)
 {
     vector<DataType> dataTypes = {DT_INT64, DT_UNDEFINED, DT_INT64, DT_INT64, DT_INT64, DT_INT64, DT_BOOL, DT_INT64};
@@ -14,7 +14,9 @@
 #include <complex>
 #include <functional>
 #include <map>
+#include <vector>
 
+#include "aicpu/parallel_scatter.h"
 #include "cpu_types.h"
 #include "log.h"
 #include "securec.h"
@@ -69,40 +71,6 @@ inline void GetBatchStrides(uint64_t* outer_shape, uint64_t index_depth, uint64_
     }
 }
 
-template <typename T, typename Index>
-struct UpdateOutputArgs {
-    const Index* indices_data;
-    const uint64_t* batch_strides;
-    T* output_data;
-    const T* updates_data;
-    uint64_t inner_shape_nums;
-};
-
-template <typename T, typename Index>
-uint32_t UpdateOneOutput(const CpuKernelContextInfo& info, const UpdateOutputArgs<T, Index>& args, uint64_t update_idx)
-{
-    uint64_t row_pos = 0;
-    for (uint64_t j = 0; j < info.index_depth; ++j) {
-        const Index index_d = static_cast<Index>(update_idx * info.index_depth + j);
-        const bool out_of_bounds = !(args.indices_data[index_d] >= 0 &&
-                                     args.indices_data[index_d] < info.x_shape->GetDimSize(j));
-        if (out_of_bounds) {
-            KERNEL_LOG_ERROR("the index is out of bounds.");
-            return KERNEL_STATUS_PARAM_INVALID;
-        }
-        row_pos += static_cast<uint64_t>(args.indices_data[index_d]) * args.batch_strides[j];
-    }
-
-    const auto cpret = memcpy_s(args.output_data + row_pos * args.inner_shape_nums, args.inner_shape_nums * sizeof(T),
-                                args.updates_data + update_idx * args.inner_shape_nums,
-                                args.inner_shape_nums * sizeof(T));
-    if (cpret != EOK) {
-        KERNEL_LOG_ERROR("from updates memcpy_s to output failed.");
-        return KERNEL_STATUS_INNER_ERROR;
-    }
-    return KERNEL_STATUS_OK;
-}
-
 uint32_t DataTypeCheck(const CpuKernelContext& ctx)
 {
     KERNEL_CHECK_FALSE((ctx.Input(kXIndex)->GetDataType() == ctx.Input(kUpdatesIndex)->GetDataType()),
@@ -175,47 +143,39 @@ uint32_t UpdateOutput(const CpuKernelContextInfo& info)
     KERNEL_CHECK_NULLPTR(output_data, KERNEL_STATUS_PARAM_INVALID, "Get output failed.");
 
     const uint64_t inner_shape_nums = GetInnerShapeNums(info);
-    auto* outer_shape = new (std::nothrow) uint64_t[info.index_depth];
-    if (outer_shape == nullptr) {
-        KERNEL_LOG_ERROR("New memory fail.");
-        return KERNEL_STATUS_PARAM_INVALID;
+    if (inner_shape_nums == 0) {
+        return KERNEL_STATUS_OK;
     }
-    GetOuterShape(info, outer_shape);
-
-    auto* batch_strides = new (std::nothrow) uint64_t[info.index_depth];
-    if (batch_strides == nullptr) {
-        KERNEL_LOG_ERROR("New memory fail.");
-        delete[] outer_shape;
-        return KERNEL_STATUS_PARAM_INVALID;
+    std::vector<uint64_t> outer_shape(info.index_depth, 0);
+    std::vector<uint64_t> batch_strides(info.index_depth, 0);
+    if (info.index_depth > 0) {
+        GetOuterShape(info, outer_shape.data());
+        GetBatchStrides(outer_shape.data(), info.index_depth, batch_strides.data());
     }
-    GetBatchStrides(outer_shape, info.index_depth, batch_strides);
 
-    const UpdateOutputArgs<T, Index> args = {indices_data, batch_strides, output_data, updates_data, inner_shape_nums};
-    uint32_t ret = KERNEL_STATUS_OK;
-    auto shard_copy = [&](uint64_t start, uint64_t end) {
-        if (ret != KERNEL_STATUS_OK) {
-            return;
-        }
-        for (uint64_t i = start; i < end; ++i) {
-            ret = UpdateOneOutput(info, args, i);
-            if (ret != KERNEL_STATUS_OK) {
-                return;
+    // 重复索引按索引顺序最后一次写入生效, 与串行语义一致
+    scatter::ScatterPlan plan(static_cast<int64_t>(info.num_updates),
+                              static_cast<int64_t>(info.x_nums / inner_shape_nums),
+                              static_cast<int64_t>(inner_shape_nums));
+    auto locate = [&](int64_t update_idx, int64_t& row, int64_t& src_row) -> uint32_t {
+        (void)src_row;
+        uint64_t row_pos = 0;
+        for (uint64_t j = 0; j < info.index_depth; ++j) {
+            const Index index_value = indices_data[static_cast<uint64_t>(update_idx) * info.index_depth + j];
+            if (!(index_value >= 0 && index_value < info.x_shape->GetDimSize(j))) {
+                KERNEL_LOG_ERROR("the index is out of bounds.");
+                return KERNEL_STATUS_PARAM_INVALID;
             }
+            row_pos += static_cast<uint64_t>(index_value) * batch_strides[j];
         }
+        row = static_cast<int64_t>(row_pos);
+        return KERNEL_STATUS_OK;
     };
-
-    if (info.updates_nums > kSplitSize) {
-        ret = CpuKernelUtils::ParallelFor(*info.ctx, info.num_updates, 1, shard_copy);
-        if (ret != KERNEL_STATUS_OK) {
-            KERNEL_LOG_ERROR("Update output data failed!");
-        }
-    } else {
-        shard_copy(0, info.num_updates);
-    }
-
-    delete[] outer_shape;
-    delete[] batch_strides;
-    return ret;
+    uint32_t ret = plan.Build(*info.ctx, locate);
+    KERNEL_CHECK_FALSE((ret == KERNEL_STATUS_OK), ret, "Locate indices failed.");
+    ret = plan.Apply(*info.ctx, updates_data, output_data, scatter::ScatterAssign<T>(), true);
+    KERNEL_CHECK_FALSE((ret == KERNEL_STATUS_OK), ret, "Update output data failed!");
+    return KERNEL_STATUS_OK;
 }
 
 template <typename T, typename Index>
@@ -232,3 +232,25 @@ TEST_F(TEST_TENSOR_SCATTER_UPDATE_UT, FAILED_OUT_OF_BOUNDS_INDEX)
     auto node_def = CreateTensorScatterUpdateNodeDef(shapes, data_types, datas);
     RUN_KERNEL(node_def, HOST, KERNEL_STATUS_PARAM_INVALID);
 }
+
+TEST_F(TEST_TENSOR_SCATTER_UPDATE_UT, DUPLICATE_INDICES_LAST_WRITER_WINS_SUCC)
+{
+    constexpr int64_t kRows = 1024;
+    constexpr int64_t kCols = 64;
+    constexpr int64_t kHotRows = 16;
+    vector<DataType> data_types = {DT_FLOAT, DT_INT64, DT_FLOAT, DT_FLOAT};
+    vector<vector<int64_t>> shapes = {{kRows, kCols}, {kRows, 1}, {kRows, kCols}, {kRows, kCols}};
+    vector<float> input_x(kRows * kCols, -1.0F);
+    vector<int64_t> input_indices(kRows);
+    vector<float> input_updates(kRows * kCols);
+    vector<float> expect_output(input_x);
+    for (int64_t i = 0; i < kRows; ++i) {
+        input_indices[i] = i % kHotRows;
+        for (int64_t j = 0; j < kCols; ++j) {
+            input_updates[i * kCols + j] = static_cast<float>(i);
+            expect_output[input_indices[i] * kCols + j] = static_cast<float>(i);
+        }
+    }
+    RunTensorScatterUpdateKernel(shapes, data_types, input_x.data(), input_indices.data(), input_updates.data(),
+                                 expect_output.data());
+}
@@ -13,6 +13,8 @@
  * \brief unsorted_segment_sum_simd_non_sort_tiling
  */
 
+#include <cstdlib>
+#include <cstring>
 #include "unsorted_segment_sum_simd_dyn_sort_tiling.h"
 #include "util/platform_util.h"
 #include "util/math_util.h"
@@ -31,14 +33,30 @@ static constexpr uint64_t DOUBLE = 2;
 static constexpr uint32_t SORT_STAT_PADDING = 64;
 static constexpr uint32_t OUTPUT_THRESHOLD = 12000;
 static constexpr uint32_t RATIO_THRESHOLD = 256;
+static constexpr uint64_t INDEX_SAMPLE_NUM = 1024;
+static constexpr uint64_t DUP_THRESHOLD_PERCENT = 25;
+static constexpr const char* INDEX_AWARE_ENV = "UNSORTED_SEGMENT_SUM_INDEX_AWARE";
 
 static const std::set<ge::DataType> setAtomicNotSupport = {ge::DT_UINT32, ge::DT_INT64, ge::DT_UINT64};
 
+bool UnsortedSegmentSumSimdDynSortTiling::IsIndexAwareEnabled() const
+{
+    const char* indexAwarePtr = std::getenv(INDEX_AWARE_ENV);
+    return indexAwarePtr != nullptr && strcmp(indexAwarePtr, "1") == 0;
+}
+
 bool UnsortedSegmentSumSimdDynSortTiling::IsCapable()
 {
-    if (ratio_ >= RATIO_THRESHOLD && innerDim_ * outputOuterDim_ < OUTPUT_THRESHOLD &&
-        innerDim_ * valueTypeBytes_ >= LAST_DIM_SIMD_COND &&
-        setAtomicNotSupport.find(dataType_) == setAtomicNotSupport.end()) {
+    if (innerDim_ * valueTypeBytes_ < LAST_DIM_SIMD_COND ||
+        setAtomicNotSupport.find(dataType_) != setAtomicNotSupport.end()) {
+        return false;
+    }
+    // index-aware模式下由kernel采样segment_ids的重复度决定是否排序，不再依赖ratio和输出规模的静态判断
+    indexAware_ = IsIndexAwareEnabled();
+    if (indexAware_) {
+        return true;
+    }
+    if (ratio_ >= RATIO_THRESHOLD && innerDim_ * outputOuterDim_ < OUTPUT_THRESHOLD) {
         return true;
     }
     return false;
@@ -66,6 +84,10 @@ void UnsortedSegmentSumSimdDynSortTiling::SetTilingData()
     tilingData_.set_sortBaseA(sortBaseA_);
     tilingData_.set_sortSharedBufSize(static_cast<uint64_t>(sortSharedBufSize_));
     tilingData_.set_indicesCastMode(static_cast<uint64_t>(indicesCastMode_));
+    tilingData_.set_indexAware(indexAware_ ? 1UL : 0UL);
+    tilingData_.set_sampleNum(sampleNum_);
+    tilingData_.set_dupThreshold(DUP_THRESHOLD_PERCENT);
+    tilingData_.set_statBufSize(statBufSize_);
 }
 
 void UnsortedSegmentSumSimdDynSortTiling::DoBlockTiling()
@@ -149,6 +171,12 @@ ge::graphStatus UnsortedSegmentSumSimdDynSortTiling::DoOpTiling()
     }
     sortBaseA_ = baseA_;
     ubSize_ -= SIMD_RESERVED_SIZE;
+    if (indexAware_) {
+        // 每核一个block记录采样统计，kernel侧需要将所有核的统计一次搬入UB
+        statBufSize_ = usedCoreNum_ * ubBlockSize_;
+        ubSize_ -= statBufSize_;
+        usrWorkspaceSize_ = usedCoreNum_ * ubBlockSize_;
+    }
     uint64_t coreMaxS = std::max(normBlockS_, tailBlockS_);
 
     // ub split for non sort case
@@ -187,6 +215,9 @@ ge::graphStatus UnsortedSegmentSumSimdDynSortTiling::DoOpTiling()
         sortBaseA_ = Ops::Base::FloorAlign(sortBaseA_, ubBlockSize_ / valueTypeBytes_);
     }
     sortSharedBufSize_ = GetSortTmpSize(indicesCastDtype_, sortBaseS_, false);
+    if (indexAware_) {
+        sampleNum_ = std::min(sortBaseS_, INDEX_SAMPLE_NUM);
+    }
     SetTilingData();
     return ge::GRAPH_SUCCESS;
 }
@@ -223,6 +254,10 @@ void UnsortedSegmentSumSimdDynSortTiling::DumpTilingInfo()
     info << ", sortBaseA: " << tilingData_.get_sortBaseA();
     info << ", sortSharedBufSize: " << tilingData_.get_sortSharedBufSize();
     info << ", indicesCastMode: " << tilingData_.get_indicesCastMode();
+    info << ", indexAware: " << tilingData_.get_indexAware();
+    info << ", sampleNum: " << tilingData_.get_sampleNum();
+    info << ", dupThreshold: " << tilingData_.get_dupThreshold();
+    info << ", statBufSize: " << tilingData_.get_statBufSize();
     OP_LOGI(context_->GetNodeName(), "%s", info.str().c_str());
 }
 
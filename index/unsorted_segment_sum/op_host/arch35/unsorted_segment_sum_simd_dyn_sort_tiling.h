@@ -35,6 +35,10 @@ TILING_DATA_FIELD_DEF(uint64_t, sortBaseS);
 TILING_DATA_FIELD_DEF(uint64_t, sortBaseA);
 TILING_DATA_FIELD_DEF(uint64_t, sortSharedBufSize);
 TILING_DATA_FIELD_DEF(uint64_t, indicesCastMode);
+TILING_DATA_FIELD_DEF(uint64_t, indexAware);     // 1: 运行时采样segment_ids，在排序/非排序路径间选择
+TILING_DATA_FIELD_DEF(uint64_t, sampleNum);      // 每核采样的索引个数
+TILING_DATA_FIELD_DEF(uint64_t, dupThreshold);   // 采样重复率(百分比)达到该阈值时走排序路径
+TILING_DATA_FIELD_DEF(uint64_t, statBufSize);    // 各核采样统计结果的UB大小
 END_TILING_DATA_DEF;
 
 REGISTER_TILING_DATA_CLASS(UnsortedSegmentSum_7000, UnsortedSegmentSumSimdDynSortTilingData);
@@ -54,6 +58,7 @@ private:
     void SetTilingData();
     void DoBlockTiling();
     uint64_t CalBestBaseSize(uint64_t baseXoStart, uint64_t baseXoEnd);
+    bool IsIndexAwareEnabled() const;
 
     uint64_t sTileNum_ = 0;
     uint64_t aTileNum_ = 0;
@@ -66,6 +71,9 @@ private:
     uint64_t sortBaseS_ = 1;
     uint64_t sortBaseA_ = 1;
     uint32_t sortSharedBufSize_ = 0;
+    bool indexAware_ = false;
+    uint64_t sampleNum_ = 0;
+    uint64_t statBufSize_ = 0;
     UnsortedSegmentSumSimdDynSortTilingData tilingData_;
 };
 } // namespace optiling
@@ -33,6 +33,12 @@ using namespace AscendC;
 constexpr uint32_t DYN_SORT_DB_BUF = 1;
 constexpr uint32_t SORT_PADDING = 64;
 constexpr uint32_t HELP_FRE = 2;
+// index-aware模式下每核采样统计结果在workspace/UB中的布局，每核占一个block
+constexpr uint32_t STAT_SAMPLE_IDX = 0;
+constexpr uint32_t STAT_UNIQUE_IDX = 1;
+constexpr uint32_t STAT_IN_ORDER_IDX = 2;
+constexpr uint32_t STAT_SLOT_NUM = ONE_BLOCK_SIZE / sizeof(int32_t);
+constexpr uint64_t PERCENT = 100;
 
 constexpr AscendC::MicroAPI::CastTrait castTraitU32U16 = {
     AscendC::MicroAPI::RegLayout::ZERO, AscendC::MicroAPI::SatMode::NO_SAT, AscendC::MicroAPI::MaskMergeMode::ZEROING};
@@ -42,7 +48,10 @@ class USSKernelSimdDynSort {
 public:
     __aicore__ inline USSKernelSimdDynSort(const UnsortedSegmentSumSimdDynSortTilingData* tiling, TPipe* pipe)
         : td_(tiling), pipe_(pipe){};
-    __aicore__ inline void Init(GM_ADDR x, GM_ADDR segmentIds, GM_ADDR output);
+    __aicore__ inline void Init(GM_ADDR x, GM_ADDR segmentIds, GM_ADDR output, GM_ADDR workspace);
+    __aicore__ inline void SampleIndices();
+    __aicore__ inline void SelectPath();
+    __aicore__ inline void ComputeNonSort();
     __aicore__ inline void ProcessIndices(uint64_t blockOffsetIdx, uint64_t sLoop, uint32_t rows, int64_t& arNum);
     template <typename VGatherIndexDType>
     __aicore__ inline void ComputeXSum(uint32_t cols, uint32_t colsAlign, int64_t arNum);
@@ -60,6 +69,7 @@ private:
     AscendC::GlobalTensor<X_T> xGm_;
     AscendC::GlobalTensor<X_T> yGm_;
     AscendC::GlobalTensor<IDS_T> idsGm_;
+    AscendC::GlobalTensor<int32_t> statGm_;
     TQue<QuePosition::VECIN, DYN_SORT_DB_BUF> xQue_;
     TQue<QuePosition::VECIN, DYN_SORT_DB_BUF> idsQue_;
     TQue<QuePosition::VECOUT, 1> outQueueRes_;
@@ -68,7 +78,9 @@ private:
     TBuf<QuePosition::VECCALC> castKeyIdxBuf_;
     TBuf<QuePosition::VECCALC> sortedKeyBuf_;
     TBuf<QuePosition::VECCALC> sharedTmpBuf_;
+    TBuf<QuePosition::VECCALC> statBuf_;
     TPipe* pipe_ = nullptr;
+    bool useSort_ = true;
     const UnsortedSegmentSumSimdDynSortTilingData* td_;
     static constexpr uint32_t vfLengthX_ = VF_SIZE / sizeof(X_T);
     static constexpr uint32_t shiftOffset_ = ONE_BLOCK_SIZE / sizeof(CAST_T);
@@ -77,10 +89,8 @@ private:
 
 template <typename X_T, typename IDS_T, typename CAST_T, uint32_t castType>
 __aicore__ inline void USSKernelSimdDynSort<X_T, IDS_T, CAST_T, castType>::Init(GM_ADDR x, GM_ADDR segmentIds,
-                                                                                GM_ADDR output)
+                                                                                GM_ADDR output, GM_ADDR workspace)
 {
-    InitGm<X_T>(output, td_->outputOuterDim * td_->innerDim);
-
     xGm_.SetGlobalBuffer((__gm__ X_T*)(x));
     idsGm_.SetGlobalBuffer((__gm__ IDS_T*)(segmentIds));
     yGm_.SetGlobalBuffer((__gm__ X_T*)(output));
@@ -105,6 +115,72 @@ __aicore__ inline void USSKernelSimdDynSort<X_T, IDS_T, CAST_T, castType>::Init(
         pipe_->InitBuffer(sortedKeyBuf_, idsAlignCast + SORT_PADDING);
         pipe_->InitBuffer(castKeyIdxBuf_, idsAlignCast);
     }
+
+    if (td_->indexAware == 0) {
+        InitGm<X_T>(output, td_->outputOuterDim * td_->innerDim);
+        return;
+    }
+    // 采样结果写入workspace后复用InitGm中的SyncAll作为核间同步，再由每个核独立汇总并选择路径
+    statGm_.SetGlobalBuffer((__gm__ int32_t*)(workspace));
+    pipe_->InitBuffer(statBuf_, td_->statBufSize);
+    SampleIndices();
+    InitGm<X_T>(output, td_->outputOuterDim * td_->innerDim);
+    SelectPath();
+}
+
+template <typename X_T, typename IDS_T, typename CAST_T, uint32_t castType>
+__aicore__ inline void USSKernelSimdDynSort<X_T, IDS_T, CAST_T, castType>::SampleIndices()
+{
+    uint64_t sIdx = GetBlockIdx() / td_->aTileNum;
+    uint64_t curCoreRows = sIdx != (td_->sTileNum - 1) ? td_->normBlockS : td_->tailBlockS;
+    uint32_t rows = static_cast<uint32_t>(curCoreRows < td_->sampleNum ? curCoreRows : td_->sampleNum);
+
+    // 采样本核首段索引，排序去重得到段内不重复索引数，与排序路径单次处理的索引范围一致
+    int64_t arNum = 0;
+    ProcessIndices(sIdx * td_->normBlockS, 0, rows, arNum);
+
+    // 稳定排序后位置未变化的索引个数，全部未变化说明采样段本身有序
+    LocalTensor<uint32_t> sortedIdxLocal = sortedIdxBuf_.Get<uint32_t>();
+    int32_t inOrderNum = 0;
+    for (uint32_t i = 0; i < rows; i++) {
+        if (sortedIdxLocal.GetValue(i) == i) {
+            inOrderNum++;
+        }
+    }
+
+    LocalTensor<int32_t> statLocal = statBuf_.Get<int32_t>();
+    statLocal.SetValue(STAT_SAMPLE_IDX, static_cast<int32_t>(rows));
+    statLocal.SetValue(STAT_UNIQUE_IDX, static_cast<int32_t>(arNum));
+    statLocal.SetValue(STAT_IN_ORDER_IDX, inOrderNum);
+    event_t eventIDSToMTE3 = static_cast<event_t>(GetTPipePtr()->FetchEventID(HardEvent::S_MTE3));
+    SetFlag<HardEvent::S_MTE3>(eventIDSToMTE3);
+    WaitFlag<HardEvent::S_MTE3>(eventIDSToMTE3);
+    CopyOut(statGm_, statLocal, GetBlockIdx() * STAT_SLOT_NUM, 1, STAT_SLOT_NUM);
+    PipeBarrier<PIPE_ALL>();
+}
+
+template <typename X_T, typename IDS_T, typename CAST_T, uint32_t castType>
+__aicore__ inline void USSKernelSimdDynSort<X_T, IDS_T, CAST_T, castType>::SelectPath()
+{
+    LocalTensor<int32_t> statLocal = statBuf_.Get<int32_t>();
+    CopyIn(statLocal, statGm_, 0, 1, GetBlockNum() * STAT_SLOT_NUM);
+    event_t eventIDMTE2ToS = static_cast<event_t>(GetTPipePtr()->FetchEventID(HardEvent::MTE2_S));
+    SetFlag<HardEvent::MTE2_S>(eventIDMTE2ToS);
+    WaitFlag<HardEvent::MTE2_S>(eventIDMTE2ToS);
+
+    uint64_t sampleTotal = 0;
+    uint64_t uniqueTotal = 0;
+    bool allInOrder = true;
+    for (uint32_t i = 0; i < GetBlockNum(); i++) {
+        int32_t sampled = statLocal.GetValue(i * STAT_SLOT_NUM + STAT_SAMPLE_IDX);
+        sampleTotal += static_cast<uint64_t>(sampled);
+        uniqueTotal += static_cast<uint64_t>(statLocal.GetValue(i * STAT_SLOT_NUM + STAT_UNIQUE_IDX));
+        allInOrder = allInOrder && (statLocal.GetValue(i * STAT_SLOT_NUM + STAT_IN_ORDER_IDX) == sampled);
+    }
+
+    // 有序索引的重复值相邻，非排序路径会对同一目标行连续做atomic累加，阈值减半
+    uint64_t threshold = allInOrder ? td_->dupThreshold / TWO : td_->dupThreshold;
+    useSort_ = (sampleTotal - uniqueTotal) * PERCENT >= sampleTotal * threshold;
 }
 
 template <typename X_T, typename IDS_T, typename CAST_T, uint32_t castType>
@@ -312,6 +388,62 @@ __aicore__ inline void USSKernelSimdDynSort<X_T, IDS_T, CAST_T, castType>::Compu
     }
 }
 
+template <typename X_T, typename IDS_T, typename CAST_T, uint32_t castType>
+__aicore__ inline void USSKernelSimdDynSort<X_T, IDS_T, CAST_T, castType>::ComputeNonSort()
+{
+    uint64_t sIdx = GetBlockIdx() / td_->aTileNum;
+    uint64_t aIdx = GetBlockIdx() % td_->aTileNum;
+    uint64_t curCoreRows = sIdx != (td_->sTileNum - 1) ? td_->normBlockS : td_->tailBlockS;
+    uint64_t curCoreCols = aIdx != (td_->aTileNum - 1) ? td_->normBlockA : td_->tailBlockA;
+
+    uint64_t blockOffsetIdx = sIdx * td_->normBlockS;
+    uint64_t blockOffsetX = sIdx * td_->normBlockS * td_->innerDim + aIdx * td_->normBlockA;
+
+    uint64_t aLoopNum = Ops::Base::CeilDiv(curCoreCols, td_->sortBaseA);
+    uint64_t sLoopNum = Ops::Base::CeilDiv(curCoreRows, td_->sortBaseS);
+
+    for (uint64_t sLoop = 0; sLoop < sLoopNum; sLoop++) {
+        uint32_t rows = (sLoop == sLoopNum - 1) ? (curCoreRows - sLoop * td_->sortBaseS) : td_->sortBaseS;
+
+        LocalTensor<IDS_T> idsLocal = idsQue_.AllocTensor<IDS_T>();
+        CopyIn(idsLocal, idsGm_, blockOffsetIdx + sLoop * td_->sortBaseS, 1, rows);
+        idsQue_.EnQue<IDS_T>(idsLocal);
+
+        idsLocal = idsQue_.DeQue<IDS_T>();
+        for (uint64_t aLoop = 0; aLoop < aLoopNum; aLoop++) {
+            uint32_t cols = (aLoop == aLoopNum - 1) ? (curCoreCols - aLoop * td_->sortBaseA) : td_->sortBaseA;
+            uint32_t colsAlign = Ops::Base::CeilAlign(static_cast<uint64_t>(cols * sizeof(X_T)), ONE_BLOCK_SIZE) /
+                                 sizeof(X_T);
+
+            LocalTensor<X_T> xLocal = xQue_.AllocTensor<X_T>();
+            uint64_t offset = blockOffsetX + sLoop * td_->sortBaseS * td_->innerDim + aLoop * td_->sortBaseA;
+            CopyIn(xLocal, xGm_, offset, rows, cols, td_->innerDim - cols);
+            xQue_.EnQue<X_T>(xLocal);
+
+            xLocal = xQue_.DeQue<X_T>();
+            event_t eventIDMTE2ToS = static_cast<event_t>(GetTPipePtr()->FetchEventID(HardEvent::MTE2_S));
+            SetFlag<HardEvent::MTE2_S>(eventIDMTE2ToS);
+            WaitFlag<HardEvent::MTE2_S>(eventIDMTE2ToS);
+            SetAtomicAdd<X_T>();
+            for (uint32_t i = 0; i < rows; i++) {
+                uint64_t dstIdx = idsLocal.GetValue(i);
+                if (dstIdx >= td_->outputOuterDim) {
+                    continue;
+                }
+                uint64_t dstOffset = dstIdx * td_->innerDim + aIdx * td_->normBlockA + aLoop * td_->sortBaseA;
+                CopyOut(yGm_, xLocal[i * colsAlign], dstOffset, 1, cols);
+            }
+            SetAtomicNone();
+            // xQue_为单buffer，下一次搬入前需等待本次搬出完成
+            event_t eventIDMTE3ToMTE2 = static_cast<event_t>(GetTPipePtr()->FetchEventID(HardEvent::MTE3_MTE2));
+            SetFlag<HardEvent::MTE3_MTE2>(eventIDMTE3ToMTE2);
+            WaitFlag<HardEvent::MTE3_MTE2>(eventIDMTE3ToMTE2);
+            xQue_.FreeTensor(xLocal);
+        }
+        idsQue_.FreeTensor(idsLocal);
+    }
+}
+
 template <typename X_T, typename IDS_T, typename CAST_T, uint32_t castType>
 __aicore__ inline void USSKernelSimdDynSort<X_T, IDS_T, CAST_T, castType>::Process()
 {
@@ -319,6 +451,11 @@ __aicore__ inline void USSKernelSimdDynSort<X_T, IDS_T, CAST_T, castType>::Proce
         return;
     }
 
+    if (!useSort_) {
+        ComputeNonSort();
+        return;
+    }
+
     if constexpr (IsSameType<X_T, half>::value || IsSameType<X_T, bfloat16_t>::value) {
         Compute<uint16_t>();
     } else if constexpr (IsSameType<X_T, float>::value || IsSameType<X_T, uint32_t>::value ||
@@ -77,35 +77,36 @@ extern "C" __global__ __aicore__ void unsorted_segment_sum(GM_ADDR x, GM_ADDR se
             return;
         } else {
             GET_TILING_DATA_WITH_STRUCT(UnsortedSegmentSumSimdDynSortTilingData, tilingData, tiling);
+            GM_ADDR userWS = GetUserWorkspace(workspace);
             if (tilingData.indicesCastMode == CAST_NO) {
                 UnsortedSegmentSum::USSKernelSimdDynSort<DTYPE_X, DTYPE_SEGMENT_IDS, DTYPE_SEGMENT_IDS, CAST_NO> op(
                     &tilingData, &pipe);
-                op.Init(x, segment_ids, output);
+                op.Init(x, segment_ids, output, userWS);
                 op.Process();
             } else if (tilingData.indicesCastMode == CAST_INT32_2_INT16) {
                 UnsortedSegmentSum::USSKernelSimdDynSort<DTYPE_X, DTYPE_SEGMENT_IDS, int16_t, CAST_INT32_2_INT16> op(
                     &tilingData, &pipe);
-                op.Init(x, segment_ids, output);
+                op.Init(x, segment_ids, output, userWS);
                 op.Process();
             } else if (tilingData.indicesCastMode == CAST_INT64_2_INT32) {
                 UnsortedSegmentSum::USSKernelSimdDynSort<DTYPE_X, DTYPE_SEGMENT_IDS, int32_t, CAST_INT64_2_INT32> op(
                     &tilingData, &pipe);
-                op.Init(x, segment_ids, output);
+                op.Init(x, segment_ids, output, userWS);
                 op.Process();
             } else if (tilingData.indicesCastMode == CAST_INT64_2_INT16) {
                 UnsortedSegmentSum::USSKernelSimdDynSort<DTYPE_X, DTYPE_SEGMENT_IDS, int16_t, CAST_INT64_2_INT16> op(
                     &tilingData, &pipe);
-                op.Init(x, segment_ids, output);
+                op.Init(x, segment_ids, output, userWS);
                 op.Process();
             } else if (tilingData.indicesCastMode == CAST_INT32_2_UINT8) {
                 UnsortedSegmentSum::USSKernelSimdDynSort<DTYPE_X, DTYPE_SEGMENT_IDS, uint8_t, CAST_INT32_2_UINT8> op(
                     &tilingData, &pipe);
-                op.Init(x, segment_ids, output);
+                op.Init(x, segment_ids, output, userWS);
                 op.Process();
             } else if (tilingData.indicesCastMode == CAST_INT64_2_UINT8) {
                 UnsortedSegmentSum::USSKernelSimdDynSort<DTYPE_X, DTYPE_SEGMENT_IDS, uint8_t, CAST_INT64_2_UINT8> op(
                     &tilingData, &pipe);
-                op.Init(x, segment_ids, output);
+                op.Init(x, segment_ids, output, userWS);
                 op.Process();
             }
         }
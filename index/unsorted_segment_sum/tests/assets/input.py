@@ -34,8 +34,20 @@ def unsorted_segment_sum_input(
     inputx = inputx.astype(x.dtype)
     lower_limit = 0
     upper_limit = int(num_segments)
-    segments = np.random.uniform(lower_limit, upper_limit, segment_ids.shape).astype(
-        segment_ids.dtype
-    )
+    testcase_name = kwargs.get("testcase_name", "")
+    if "index_aware_dup" in testcase_name:
+        # 少量segment反复出现，采样重复率高，index-aware模式下走排序路径
+        segments = np.random.randint(0, min(upper_limit, 16), segment_ids.shape).astype(
+            segment_ids.dtype
+        )
+    elif "index_aware_unique" in testcase_name:
+        # segment_ids互不重复，采样重复率为0，index-aware模式下走非排序路径
+        segments = np.random.permutation(upper_limit)[: segment_ids.size].reshape(
+            segment_ids.shape
+        ).astype(segment_ids.dtype)
+    else:
+        segments = np.random.uniform(lower_limit, upper_limit, segment_ids.shape).astype(
+            segment_ids.dtype
+        )
     segment_num = np.array([upper_limit], dtype=kwargs["input_dtypes"][2])
     return [inputx, segments, segment_num]
@@ -0,0 +1,197 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License")
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include <gtest/gtest.h>
+#include "log/log.h"
+#include "kernel_run_context_facker.h"
+#include "exe_graph/runtime/storage_format.h"
+#include "exe_graph/runtime/storage_shape.h"
+#include "test_cube_util.h"
+#include "register/op_impl_registry.h"
+#include "ut_op_util.h"
+#include "ut_op_common.h"
+#include "platform/platform_infos_def.h"
+#include "../../../../op_host/arch35/unsorted_segment_sum_tiling_arch35.h"
+
+using namespace ut_util;
+using namespace std;
+using namespace ge;
+
+static constexpr uint64_t TEMPLATE_SIMD_NON_SORT = 6000;
+static constexpr uint64_t TEMPLATE_SIMD_DYN_SORT = 7000;
+// UnsortedSegmentSumSimdDynSortTilingData中index-aware相关字段的下标(uint64_t)
+static constexpr size_t DYN_SORT_INDEX_AWARE_IDX = 14;
+static constexpr size_t DYN_SORT_SAMPLE_NUM_IDX = 15;
+static constexpr size_t DYN_SORT_DUP_THRESHOLD_IDX = 16;
+static constexpr size_t DYN_SORT_STAT_BUF_SIZE_IDX = 17;
+
+class UnsortedSegmentSumTiling : public testing::Test {
+protected:
+    static void SetUpTestCase() { std::cout << "UnsortedSegmentSumTiling SetUp" << std::endl; }
+
+    static void TearDownTestCase() { std::cout << "UnsortedSegmentSumTiling TearDown" << std::endl; }
+
+    void TearDown() override { unsetenv("UNSORTED_SEGMENT_SUM_INDEX_AWARE"); }
+};
+
+static void ExecuteTestCase(gert::StorageShape& dataStorageShape, gert::StorageShape& segmentIdsStorageShape,
+                            gert::StorageShape& outputStorageShape, ge::DataType dtype, ge::DataType segmentIdsDtype,
+                            uint64_t exceptTilingKey, std::vector<uint64_t>& tilingDataOut)
+{
+    dlog_setlevel(0, 0, 0);
+
+    gert::Shape dataShape = dataStorageShape.GetStorageShape();
+    gert::Shape segmentIdsShape = segmentIdsStorageShape.GetStorageShape();
+    gert::Shape numSegmentsShape = {1};
+    gert::Shape outputShape = outputStorageShape.GetStorageShape();
+    string compile_info_string = R"({
+        "hardware_info": {"BT_SIZE": 0, "load3d_constraints": "1",
+                          "Intrinsic_fix_pipe_l0c2out": false,
+                          "Intrinsic_data_move_l12ub": true,
+                          "Intrinsic_data_move_l0c2ub": true,
+                          "Intrinsic_data_move_out2l1_nd2nz": false,
+                          "UB_SIZE": 253952, "L2_SIZE": 33554432, "L1_SIZE": 524288,
+                          "L0A_SIZE": 65536, "L0B_SIZE": 65536, "L0C_SIZE": 131072,
+                          "CORE_NUM": 64}
+                          })";
+    map<string, string> soc_infos;
+    map<string, string> aicore_spec;
+    map<string, string> intrinsics;
+    GetPlatFormInfos(compile_info_string.c_str(), soc_infos, aicore_spec, intrinsics);
+    std::map<std::string, std::string> soc_version_infos = {{"Short_SoC_version", "Ascend950"}};
+
+    // platform info
+    fe::PlatFormInfos platform_info;
+    platform_info.Init();
+    // compile info
+    optiling::TilingPrepareForUnsortedSegmentSumCompileInfo compile_info;
+
+    std::string op_type("UnsortedSegmentSum");
+    ASSERT_NE(gert::OpImplRegistry::GetInstance().GetOpImpl(op_type.c_str()), nullptr);
+    auto tiling_func = gert::OpImplRegistry::GetInstance().GetOpImpl(op_type.c_str())->tiling;
+    auto tiling_parse_func = gert::OpImplRegistry::GetInstance().GetOpImpl(op_type.c_str())->tiling_parse;
+
+    // tilingParseFunc simulate
+    auto kernel_holder = gert::KernelRunContextFaker()
+                             .KernelIONum(2, 1)
+                             .Inputs({const_cast<char*>(compile_info_string.c_str()),
+                                      reinterpret_cast<void*>(&platform_info)})
+                             .Outputs({&compile_info})
+                             .Build();
+
+    ASSERT_TRUE(kernel_holder.GetContext<gert::TilingParseContext>()->GetPlatformInfo()->Init());
+    kernel_holder.GetContext<gert::TilingParseContext>()->GetPlatformInfo()->SetPlatformRes("SoCInfo", soc_infos);
+    kernel_holder.GetContext<gert::TilingParseContext>()->GetPlatformInfo()->SetPlatformRes("AICoreSpec", aicore_spec);
+    kernel_holder.GetContext<gert::TilingParseContext>()->GetPlatformInfo()->SetCoreNumByCoreType("AICore");
+    kernel_holder.GetContext<gert::TilingParseContext>()->GetPlatformInfo()->SetPlatformRes("AICoreintrinsicDtypeMap",
+                                                                                            intrinsics);
+    kernel_holder.GetContext<gert::TilingParseContext>()->GetPlatformInfo()->SetPlatformRes("version",
+                                                                                            soc_version_infos);
+
+    ASSERT_EQ(tiling_parse_func(kernel_holder.GetContext<gert::KernelContext>()), ge::GRAPH_SUCCESS);
+
+    // tilingFunc simulate
+    auto param = gert::TilingData::CreateCap(4096);
+    auto workspace_size_holer = gert::ContinuousVector::Create<size_t>(4096);
+    auto ws_size = reinterpret_cast<gert::ContinuousVector*>(workspace_size_holer.get());
+    ASSERT_NE(param, nullptr);
+
+    std::vector<gert::Shape*> input_shape_ptrs = {&dataShape, &segmentIdsShape, &numSegmentsShape};
+    std::vector<gert::Shape*> output_shape_ptrs = {&outputShape};
+    auto holder = gert::TilingContextFaker()
+                      .SetOpType(op_type)
+                      .NodeIoNum(3, 1)
+                      .IrInstanceNum({1, 1, 1})
+                      .InputShapes(input_shape_ptrs)
+                      .OutputShapes(output_shape_ptrs)
+                      .CompileInfo(&compile_info)
+                      .PlatformInfo(reinterpret_cast<char*>(&platform_info))
+                      .NodeInputTd(0, dtype, ge::FORMAT_ND, ge::FORMAT_ND)
+                      .NodeInputTd(1, segmentIdsDtype, ge::FORMAT_ND, ge::FORMAT_ND)
+                      .NodeInputTd(2, ge::DT_INT32, ge::FORMAT_ND, ge::FORMAT_ND)
+                      .NodeOutputTd(0, dtype, ge::FORMAT_ND, ge::FORMAT_ND)
+                      .TilingData(param.get())
+                      .Workspace(ws_size)
+                      .Build();
+
+    gert::TilingContext* tiling_context = holder.GetContext<gert::TilingContext>();
+    ASSERT_NE(tiling_context->GetPlatformInfo(), nullptr);
+    holder.GetContext<gert::TilingContext>()->GetPlatformInfo()->SetPlatformRes("SoCInfo", soc_infos);
+    holder.GetContext<gert::TilingContext>()->GetPlatformInfo()->SetPlatformRes("AICoreSpec", aicore_spec);
+    holder.GetContext<gert::TilingContext>()->GetPlatformInfo()->SetCoreNumByCoreType("AICore");
+    holder.GetContext<gert::TilingContext>()->GetPlatformInfo()->SetPlatformRes("AICoreintrinsicDtypeMap", intrinsics);
+
+    EXPECT_EQ(tiling_func(tiling_context), ge::GRAPH_SUCCESS);
+    auto tiling_key = tiling_context->GetTilingKey();
+    ASSERT_EQ(tiling_key, exceptTilingKey);
+    auto tilingData = tiling_context->GetRawTilingData();
+    ASSERT_NE(tilingData, nullptr);
+    dlog_setlevel(0, 3, 0);
+    const uint64_t* data = reinterpret_cast<const uint64_t*>(tilingData->GetData());
+    tilingDataOut.assign(data, data + tilingData->GetDataSize() / sizeof(uint64_t));
+}
+
+TEST_F(UnsortedSegmentSumTiling, dyn_sort_static_heuristic)
+{
+    // ratio >= 256且输出规模较小，静态判断命中排序模板，index-aware关闭
+    gert::StorageShape data_shape = {{65536, 64}, {65536, 64}};
+    gert::StorageShape segment_ids_shape = {{65536}, {65536}};
+    gert::StorageShape output_shape = {{128, 64}, {128, 64}};
+    std::vector<uint64_t> tilingData;
+    ExecuteTestCase(data_shape, segment_ids_shape, output_shape, ge::DT_FLOAT, ge::DT_INT32, TEMPLATE_SIMD_DYN_SORT,
+                    tilingData);
+    ASSERT_GT(tilingData.size(), DYN_SORT_STAT_BUF_SIZE_IDX);
+    EXPECT_EQ(tilingData[DYN_SORT_INDEX_AWARE_IDX], 0UL);
+    EXPECT_EQ(tilingData[DYN_SORT_SAMPLE_NUM_IDX], 0UL);
+    EXPECT_EQ(tilingData[DYN_SORT_STAT_BUF_SIZE_IDX], 0UL);
+}
+
+TEST_F(UnsortedSegmentSumTiling, low_ratio_without_index_aware_non_sort)
+{
+    // ratio较小，静态判断不走排序模板，落到非排序模板
+    gert::StorageShape data_shape = {{4096, 64}, {4096, 64}};
+    gert::StorageShape segment_ids_shape = {{4096}, {4096}};
+    gert::StorageShape output_shape = {{2048, 64}, {2048, 64}};
+    std::vector<uint64_t> tilingData;
+    ExecuteTestCase(data_shape, segment_ids_shape, output_shape, ge::DT_FLOAT, ge::DT_INT32, TEMPLATE_SIMD_NON_SORT,
+                    tilingData);
+}
+
+TEST_F(UnsortedSegmentSumTiling, low_ratio_with_index_aware_dyn_sort)
+{
+    // 打开index-aware后同一shape进入排序模板，由kernel采样决定排序/非排序路径
+    setenv("UNSORTED_SEGMENT_SUM_INDEX_AWARE", "1", 1);
+    gert::StorageShape data_shape = {{4096, 64}, {4096, 64}};
+    gert::StorageShape segment_ids_shape = {{4096}, {4096}};
+    gert::StorageShape output_shape = {{2048, 64}, {2048, 64}};
+    std::vector<uint64_t> tilingData;
+    ExecuteTestCase(data_shape, segment_ids_shape, output_shape, ge::DT_FLOAT, ge::DT_INT32, TEMPLATE_SIMD_DYN_SORT,
+                    tilingData);
+    ASSERT_GT(tilingData.size(), DYN_SORT_STAT_BUF_SIZE_IDX);
+    EXPECT_EQ(tilingData[DYN_SORT_INDEX_AWARE_IDX], 1UL);
+    EXPECT_GT(tilingData[DYN_SORT_SAMPLE_NUM_IDX], 0UL);
+    EXPECT_LE(tilingData[DYN_SORT_SAMPLE_NUM_IDX], 1024UL);
+    EXPECT_EQ(tilingData[DYN_SORT_DUP_THRESHOLD_IDX], 25UL);
+    EXPECT_GT(tilingData[DYN_SORT_STAT_BUF_SIZE_IDX], 0UL);
+}
+
+TEST_F(UnsortedSegmentSumTiling, index_aware_other_value_disabled)
+{
+    // 仅"1"打开index-aware
+    setenv("UNSORTED_SEGMENT_SUM_INDEX_AWARE", "0", 1);
+    gert::StorageShape data_shape = {{4096, 64}, {4096, 64}};
+    gert::StorageShape segment_ids_shape = {{4096}, {4096}};
+    gert::StorageShape output_shape = {{2048, 64}, {2048, 64}};
+    std::vector<uint64_t> tilingData;
+    ExecuteTestCase(data_shape, segment_ids_shape, output_shape, ge::DT_FLOAT, ge::DT_INT32, TEMPLATE_SIMD_NON_SORT,
+                    tilingData);
+}
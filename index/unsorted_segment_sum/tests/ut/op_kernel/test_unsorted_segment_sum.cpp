@@ -0,0 +1,138 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file test_unsorted_segment_sum.cpp
+ * \brief
+ */
+
+#include <array>
+#include <vector>
+#include <iostream>
+#include <string>
+#include <cstdint>
+#include "gtest/gtest.h"
+#include "tikicpulib.h"
+#include "unsorted_segment_sum_tiling_def.h"
+#include "data_utils.h"
+
+using namespace std;
+
+extern "C" __global__ __aicore__ void unsorted_segment_sum(GM_ADDR x, GM_ADDR segment_ids, GM_ADDR num_segments,
+                                                           GM_ADDR output, GM_ADDR workspace, GM_ADDR tiling);
+
+class unsorted_segment_sum_test : public testing::Test {
+protected:
+    static void SetUpTestCase() { cout << "unsorted_segment_sum_test SetUp\n" << endl; }
+    static void TearDownTestCase() { cout << "unsorted_segment_sum_test TearDown\n" << endl; }
+};
+
+static constexpr uint64_t TEMPLATE_SIMD_DYN_SORT = 7000;
+
+static void FillDynSortTilingData(UnsortedSegmentSumSimdDynSortTilingData* td, uint64_t rows, uint64_t cols,
+                                  uint64_t segments)
+{
+    td->outputOuterDim = segments;
+    td->innerDim = cols;
+    td->sTileNum = 1;
+    td->aTileNum = 1;
+    td->normBlockS = rows;
+    td->tailBlockS = rows;
+    td->normBlockA = cols;
+    td->tailBlockA = cols;
+    td->baseS = rows;
+    td->baseA = cols;
+    td->sortBaseS = rows;
+    td->sortBaseA = cols;
+    td->sortSharedBufSize = 32768;
+    td->indicesCastMode = 0;
+    td->indexAware = 1;
+    td->sampleNum = rows;
+    td->dupThreshold = 25;
+    td->statBufSize = 32;
+}
+
+// 单核index-aware用例：按segment_ids采样结果选择排序/非排序路径，两条路径结果均与CPU累加一致
+static void RunIndexAwareCase(const vector<int32_t>& ids, uint64_t cols, uint64_t segments)
+{
+    uint64_t rows = ids.size();
+    size_t x_size = rows * cols * sizeof(float);
+    size_t ids_size = rows * sizeof(int32_t);
+    size_t output_size = segments * cols * sizeof(float);
+    size_t tiling_data_size = sizeof(UnsortedSegmentSumSimdDynSortTilingData);
+
+    uint8_t* x = (uint8_t*)AscendC::GmAlloc(x_size);
+    uint8_t* segmentIds = (uint8_t*)AscendC::GmAlloc(ids_size);
+    uint8_t* numSegments = (uint8_t*)AscendC::GmAlloc(sizeof(int32_t));
+    uint8_t* output = (uint8_t*)AscendC::GmAlloc(output_size);
+    uint8_t* workspace = (uint8_t*)AscendC::GmAlloc(16 * 1024 * 1024 + 1024);
+    uint8_t* tiling = (uint8_t*)AscendC::GmAlloc(tiling_data_size);
+    uint32_t blockDim = 1;
+
+    float* xData = reinterpret_cast<float*>(x);
+    for (uint64_t i = 0; i < rows * cols; i++) {
+        xData[i] = static_cast<float>(i % 7);
+    }
+    memcpy(segmentIds, ids.data(), ids_size);
+    *reinterpret_cast<int32_t*>(numSegments) = static_cast<int32_t>(segments);
+    memset(output, 0, output_size);
+
+    UnsortedSegmentSumSimdDynSortTilingData* td = reinterpret_cast<UnsortedSegmentSumSimdDynSortTilingData*>(tiling);
+    memset(td, 0, tiling_data_size);
+    FillDynSortTilingData(td, rows, cols, segments);
+
+    ICPU_SET_TILING_KEY(TEMPLATE_SIMD_DYN_SORT);
+    AscendC::SetKernelMode(KernelMode::AIV_MODE);
+    ICPU_RUN_KF(unsorted_segment_sum, blockDim, x, segmentIds, numSegments, output, workspace, tiling);
+
+    vector<float> expect(segments * cols, 0.0f);
+    for (uint64_t i = 0; i < rows; i++) {
+        if (ids[i] < 0 || static_cast<uint64_t>(ids[i]) >= segments) {
+            continue;
+        }
+        for (uint64_t j = 0; j < cols; j++) {
+            expect[ids[i] * cols + j] += xData[i * cols + j];
+        }
+    }
+    float* outData = reinterpret_cast<float*>(output);
+    for (uint64_t i = 0; i < segments * cols; i++) {
+        EXPECT_FLOAT_EQ(outData[i], expect[i]) << "mismatch at " << i;
+    }
+
+    AscendC::GmFree(x);
+    AscendC::GmFree(segmentIds);
+    AscendC::GmFree(numSegments);
+    AscendC::GmFree(output);
+    AscendC::GmFree(workspace);
+    AscendC::GmFree(tiling);
+}
+
+TEST_F(unsorted_segment_sum_test, test_index_aware_dup_heavy_sort_path)
+{
+    // 64行只落到4个segment，重复率约94%，超过阈值走排序路径
+    uint64_t rows = 64;
+    vector<int32_t> ids(rows);
+    for (uint64_t i = 0; i < rows; i++) {
+        ids[i] = static_cast<int32_t>(i % 4);
+    }
+    RunIndexAwareCase(ids, 64, 8);
+}
+
+TEST_F(unsorted_segment_sum_test, test_index_aware_unique_non_sort_path)
+{
+    // 逆序且不重复的segment_ids，重复率为0走非排序路径；首行越界索引被跳过
+    uint64_t rows = 64;
+    vector<int32_t> ids(rows);
+    for (uint64_t i = 0; i < rows; i++) {
+        ids[i] = static_cast<int32_t>(rows - 1 - i);
+    }
+    ids[0] = -1;
+    RunIndexAwareCase(ids, 64, rows);
+}
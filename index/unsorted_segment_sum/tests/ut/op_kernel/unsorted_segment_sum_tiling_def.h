@@ -0,0 +1,138 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file unsorted_segment_sum_tiling_def.h
+ * \brief
+ */
+#ifndef UNSORTED_SEGMENT_SUM_TILING_DEF_H
+#define UNSORTED_SEGMENT_SUM_TILING_DEF_H
+
+#include <cstring>
+#include "kernel_tiling/kernel_tiling.h"
+
+struct UnsortedSegmentSumSimtTilingData {
+    uint64_t inputOuterDim = 0;
+    uint64_t outputOuterDim = 0;
+    uint64_t innerDim = 0;
+    uint64_t maxThread = 0;
+};
+
+struct UnsortedSegmentSumSimdSplitColTilingData {
+    uint64_t inputOuterDim = 0;
+    uint64_t outputOuterDim = 0;
+    uint64_t innerDim = 0;
+    uint64_t normBlockData = 0;
+    uint64_t tailBlockData = 0;
+    uint64_t baseS = 0;
+    uint64_t baseA = 0;
+};
+
+struct UnsortedSegmentSumSimdNonSortTilingData {
+    uint64_t inputOuterDim = 0;
+    uint64_t outputOuterDim = 0;
+    uint64_t innerDim = 0;
+    uint64_t sTileNum = 0;
+    uint64_t aTileNum = 0;
+    uint64_t normBlockS = 0;
+    uint64_t tailBlockS = 0;
+    uint64_t normBlockA = 0;
+    uint64_t tailBlockA = 0;
+    uint64_t baseS = 0;
+    uint64_t baseA = 0;
+    uint64_t usedCoreNum = 0;
+};
+
+struct UnsortedSegmentSumSimdDynSortTilingData {
+    uint64_t outputOuterDim = 0;
+    uint64_t innerDim = 0;
+    uint64_t sTileNum = 0;
+    uint64_t aTileNum = 0;
+    uint64_t normBlockS = 0;
+    uint64_t tailBlockS = 0;
+    uint64_t normBlockA = 0;
+    uint64_t tailBlockA = 0;
+    uint64_t baseS = 0;
+    uint64_t baseA = 0;
+    uint64_t sortBaseS = 0;
+    uint64_t sortBaseA = 0;
+    uint64_t sortSharedBufSize = 0;
+    uint64_t indicesCastMode = 0;
+    uint64_t indexAware = 0;
+    uint64_t sampleNum = 0;
+    uint64_t dupThreshold = 0;
+    uint64_t statBufSize = 0;
+};
+
+struct UnsortedSegmentSumDetermTilingData {
+    uint64_t inputOuterDim = 0;
+    uint64_t outputOuterDim = 0;
+    uint64_t innerDim = 0;
+    uint32_t tmpBufferSize = 0;
+    uint32_t rowsNumInUB = 0;
+    uint32_t normalCoreProcessNum = 0;
+    uint32_t tailCoreProcessNum = 0;
+    uint32_t usedCoreNum = 0;
+};
+
+struct UnsortedSegmentSumOutFlTilingData {
+    uint64_t inputOuterDim = 0;
+    uint64_t outputOuterDim = 0;
+    uint64_t innerDim = 0;
+    uint64_t maxIndexNum = 0;
+    uint64_t oneCoreUbLoopTimes = 0;
+    uint64_t rowNumUb = 0;
+};
+
+struct UnsortedSegmentSumSortSimtTilingData {
+    uint64_t inputOuterDim = 0;
+    uint64_t outputOuterDim = 0;
+    uint64_t innerDim = 0;
+    uint64_t maxIndexNum = 0;
+    uint64_t oneCoreUbLoopTimes = 0;
+    uint64_t tailCoreUbLoopTimes = 0;
+    uint64_t maxThread = 0;
+    uint64_t usedCoreNum = 0;
+    uint64_t sortTmpSize = 0;
+    uint64_t tailIndexNum = 0;
+    uint64_t indicesCastMode = 0;
+};
+
+struct UnsortedSegmentSumDeterministicBigInnerDimTilingData {
+    uint64_t inputOuterDim = 0;
+    uint64_t outputOuterDim = 0;
+    uint64_t innerDim = 0;
+    uint64_t normalCoreProcessCols = 0;
+    uint64_t tailCoreProcessCols = 0;
+    uint64_t baseS = 0;
+    uint64_t baseA = 0;
+    uint32_t sortSharedBufSize = 0;
+};
+
+struct UnsortedSegmentSumDetermSmallInnerDimTilingData {
+    uint64_t inputOuterDim = 0;
+    uint64_t outputOuterDim = 0;
+    uint64_t innerDim = 0;
+    uint32_t rowsNumInUB = 0;
+    uint32_t sortSharedBufSize = 0;
+    uint32_t usedCoreNum = 0;
+};
+
+template <typename T>
+inline void InitTilingData(uint8_t* tiling, T* constData)
+{
+    memcpy(constData, tiling, sizeof(T));
+}
+
+#define GET_TILING_DATA_WITH_STRUCT(tiling_struct, tiling_data, tiling_arg) \
+    tiling_struct tiling_data;                                              \
+    InitTilingData(tiling_arg, &tiling_data)
+
+#endif
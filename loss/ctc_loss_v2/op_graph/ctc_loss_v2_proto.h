@@ -46,12 +46,18 @@ differentiable with respect to each input node.
 *@li reduction: An optional String. Specifies the reduction to apply to the output: 'none' | 'mean' | 'sum'. Default:
 'mean'.
 *@li zero_infinity: An optional Bool. Whether to zero infinite losses and the associated gradients. Default: false.
+*@li alpha_checkpoint_stride: An optional Int. If greater than 0, log_alpha only keeps the rows of frames t with
+t % alpha_checkpoint_stride == 0, its size becomes (N, ceil(T / alpha_checkpoint_stride), X), and CTCLossV2Grad
+recomputes the other rows. Default: 0, log_alpha keeps every frame.
+*@li lattice_band: An optional Int. If greater than 0, only the states within lattice_band of the diagonal of the
+lattice are computed, and the other states are treated as -inf. The result is an approximation. Default: 0.
 
 * @par Third-party framework compatibility:
 * Compatible with Pytorch CTCLoss operator.
 
 *@attention Constraints:
 * The limit of Label’s length is 1K.
+* alpha_checkpoint_stride and lattice_band must match the values of CTCLossV2Grad.
 */
 REG_OP(CTCLossV2)
     .INPUT(log_probs, TensorType({DT_FLOAT16, DT_BF16, DT_FLOAT, DT_DOUBLE}))
@@ -63,6 +69,8 @@ REG_OP(CTCLossV2)
     .ATTR(blank, Int, 0)
     .ATTR(reduction, String, "mean")
     .ATTR(zero_infinity, Bool, false)
+    .ATTR(alpha_checkpoint_stride, Int, 0)
+    .ATTR(lattice_band, Int, 0)
     .OP_END_FACTORY_REG(CTCLossV2)
 
 } // namespace ge
@@ -30,6 +30,9 @@ static const size_t LOG_PROBS_IDX = 0;
 static const size_t TARGETS_IDX = 1;
 static const size_t INPUT_LENGTHS_IDX = 2;
 static const size_t TARGET_LENGTHS_IDX = 3;
+static const size_t ATTR_BLANK_IDX = 0;
+static const size_t ATTR_CHECKPOINT_STRIDE_IDX = 3;
+static const size_t ATTR_LATTICE_BAND_IDX = 4;
 
 static const size_t INT64_SIZE = 8;
 static const size_t DIM0 = 0;
@@ -75,6 +78,10 @@ static inline void PrintTilingData(CTCLossV2TilingData4AscendC& tilingData)
     OP_LOGI("CTCLossV2", "workspaceSize: %ld", tilingData.get_workspaceSize());
     OP_LOGI("CTCLossV2", "gridY: %ld", tilingData.get_gridY());
     OP_LOGI("CTCLossV2", "usedCoreNum: %ld", tilingData.get_usedCoreNum());
+    OP_LOGI("CTCLossV2", "alphaInUb: %ld", tilingData.get_alphaInUb());
+    OP_LOGI("CTCLossV2", "alphaRowStride: %ld", tilingData.get_alphaRowStride());
+    OP_LOGI("CTCLossV2", "checkpointStride: %ld", tilingData.get_checkpointStride());
+    OP_LOGI("CTCLossV2", "latticeBand: %ld", tilingData.get_latticeBand());
 }
 
 template <typename T>
@@ -102,6 +109,27 @@ inline static bool IsInputeLengthValid(const gert::Tensor* inputLengths, int64_t
     return true;
 }
 
+// 省内存模式: alpha 递推只依赖上一帧，一个 block 能覆盖整个 2S+1 时，每个 batch 槽位在 UB 中保留两行 alpha 即可，
+// 递推不再回读 GM 中的 log_alpha，fp16/bf16 也不再需要 [N, T, 2S+1] 的 fp32 workspace。
+inline static bool IsAlphaInUb(int64_t alphaLength, int64_t blockDimX, int64_t blockDimY, int64_t batchSize,
+                               uint64_t ubSize, int64_t& alphaRowStride)
+{
+    alphaRowStride = Ops::Base::CeilAlign(alphaLength, static_cast<int64_t>(BLOCK / FLOAT32_SIZE));
+    if (alphaLength > blockDimX) {
+        return false;
+    }
+    // targetLengths 与 targetOffset 两块 batch 大小的 buffer
+    int64_t bsAlign = Ops::Base::CeilAlign(batchSize * static_cast<int64_t>(INT64_SIZE), static_cast<int64_t>(BLOCK));
+    int64_t alphaUbSize = DIM2 * blockDimY * alphaRowStride * FLOAT32_SIZE;
+    return static_cast<uint64_t>(alphaUbSize + DIM2 * bsAlign + SIMT_RESERVED_SIZE) <= ubSize;
+}
+
+inline static int64_t GetOptionalIntAttr(const gert::RuntimeAttrs* attrs, size_t idx)
+{
+    const int64_t* attrPtr = attrs->GetAttrPointer<int64_t>(idx);
+    return attrPtr == nullptr ? 0 : *attrPtr;
+}
+
 inline static bool IsLargeSize(int64_t logProbsDimSize0, int64_t logProbsDimSize1, int64_t logProbsDimSize2,
                                int64_t maxTargetLength)
 {
@@ -186,8 +214,25 @@ ge::graphStatus Tiling4CTCLossV2ForAscendC(gert::TilingContext* context)
         tgBatchStride = targetsShape.GetDim(DIM1);
     }
     tilingData.set_tgBatchStride(tgBatchStride);
+    // set checkpointStride, latticeBand
+    auto attrs = context->GetAttrs();
+    OP_CHECK_NULL_WITH_CONTEXT(context, attrs);
+    int64_t checkpointStride = GetOptionalIntAttr(attrs, ATTR_CHECKPOINT_STRIDE_IDX);
+    int64_t latticeBand = GetOptionalIntAttr(attrs, ATTR_LATTICE_BAND_IDX);
+    OP_CHECK_IF(checkpointStride < 0 || latticeBand < 0,
+                OP_LOGE(context->GetNodeName(),
+                        "alpha_checkpoint_stride [%ld] and lattice_band [%ld] should not be negative.",
+                        checkpointStride, latticeBand),
+                return ge::GRAPH_FAILED);
+    bool memoryLean = checkpointStride > 0 || latticeBand > 0;
+    // 省内存模式下 log_alpha 只保存 t % stride == 0 的检查点行，仅开 band 时每帧都是检查点
+    if (memoryLean && checkpointStride == 0) {
+        checkpointStride = 1;
+    }
+    tilingData.set_checkpointStride(checkpointStride);
+    tilingData.set_latticeBand(latticeBand);
     // set laBatchStride, laInputStride, laTargetStride
-    int64_t dim1 = logProbsDimSize0;
+    int64_t dim1 = memoryLean ? Ops::Base::CeilDiv(logProbsDimSize0, checkpointStride) : logProbsDimSize0;
     int64_t dim2 = 2 * maxTargetLength + 1;
     tilingData.set_laBatchStride(dim1 * dim2);
     tilingData.set_laInputStride(dim2);
@@ -196,8 +241,7 @@ ge::graphStatus Tiling4CTCLossV2ForAscendC(gert::TilingContext* context)
     int64_t tgTargetStride = 1;
     tilingData.set_tgTargetStride(tgTargetStride);
     // set blank
-    auto attrs = context->GetAttrs();
-    const int64_t* blankPtr = attrs->GetAttrPointer<int64_t>(0);
+    const int64_t* blankPtr = attrs->GetAttrPointer<int64_t>(ATTR_BLANK_IDX);
     OP_CHECK_NULL_WITH_CONTEXT(context, blankPtr);
     int64_t blank = *blankPtr;
     tilingData.set_blank(blank);
@@ -225,9 +269,6 @@ ge::graphStatus Tiling4CTCLossV2ForAscendC(gert::TilingContext* context)
     uint64_t isFP32 = CTC_LOSS_V2_TPL_KEY_FALSE;
     if (logProbsDtype == DT_FLOAT) {
         isFP32 = CTC_LOSS_V2_TPL_KEY_TRUE;
-    } else {
-        EXTRA_WORKSPACE_SIZE = Ops::Base::CeilAlign(
-            (DIM2 * maxTargetLength + 1) * FLOAT32_SIZE * batchSize * logProbsDimSize0, BLOCK);
     }
     if (!IsLargeSize(logProbsDimSize0, logProbsDimSize1, logProbsDimSize2, maxTargetLength)) {
         MAX_THREAD = THREAD_NUM_1024;
@@ -249,6 +290,20 @@ ge::graphStatus Tiling4CTCLossV2ForAscendC(gert::TilingContext* context)
     threadsBatch = blockDimY;
     tilingData.set_blockDimX(blockDimX);
     tilingData.set_blockDimY(blockDimY);
+    int64_t alphaRowStride = 0;
+    bool alphaInUb = memoryLean && IsAlphaInUb(dim2, blockDimX, blockDimY, batchSize, ubSize, alphaRowStride);
+    OP_CHECK_IF(memoryLean && !alphaInUb,
+                OP_LOGE(context->GetNodeName(),
+                        "alpha_checkpoint_stride/lattice_band need 2 * max(target_lengths) + 1 [%ld] to fit in one "
+                        "block [%d] and two alpha rows per batch to fit in UB.",
+                        dim2, blockDimX),
+                return ge::GRAPH_FAILED);
+    tilingData.set_alphaInUb(alphaInUb ? 1 : 0);
+    tilingData.set_alphaRowStride(alphaRowStride);
+    if (isFP32 == CTC_LOSS_V2_TPL_KEY_FALSE && !alphaInUb) {
+        EXTRA_WORKSPACE_SIZE = Ops::Base::CeilAlign(
+            (DIM2 * maxTargetLength + 1) * FLOAT32_SIZE * batchSize * logProbsDimSize0, BLOCK);
+    }
     OP_LOGI(context->GetNodeName(), "isFP32 is %lu, threadTypeInt32 is %lu", isFP32, threadTypeInt32);
     const uint64_t tilingKey = GET_TPL_TILING_KEY(isFP32, threadTypeInt32);
     OP_LOGI(context->GetNodeName(), "tilingKey is %lu", tilingKey);
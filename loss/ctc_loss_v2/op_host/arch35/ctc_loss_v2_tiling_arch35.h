@@ -41,6 +41,10 @@ TILING_DATA_FIELD_DEF(int64_t, tgBatchStride);
 TILING_DATA_FIELD_DEF(int64_t, workspaceSize);
 TILING_DATA_FIELD_DEF(int64_t, gridY);
 TILING_DATA_FIELD_DEF(int64_t, usedCoreNum);
+TILING_DATA_FIELD_DEF(int64_t, alphaInUb);
+TILING_DATA_FIELD_DEF(int64_t, alphaRowStride);
+TILING_DATA_FIELD_DEF(int64_t, checkpointStride);
+TILING_DATA_FIELD_DEF(int64_t, latticeBand);
 END_TILING_DATA_DEF;
 
 REGISTER_TILING_DATA_CLASS(CTCLossV2, CTCLossV2TilingData4AscendC)
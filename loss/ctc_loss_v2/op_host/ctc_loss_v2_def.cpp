@@ -41,6 +41,8 @@ public:
         this->Attr("blank").AttrType(OPTIONAL).Int(0);
         this->Attr("reduction").AttrType(OPTIONAL).String("none");
         this->Attr("zero_infinity").AttrType(OPTIONAL).Bool(false);
+        this->Attr("alpha_checkpoint_stride").AttrType(OPTIONAL).Int(0);
+        this->Attr("lattice_band").AttrType(OPTIONAL).Int(0);
         OpAICoreConfig aicoreConfig;
         aicoreConfig.DynamicCompileStaticFlag(true).DynamicRankSupportFlag(true).DynamicShapeSupportFlag(true);
         this->AICore().AddConfig("ascend950", aicoreConfig);
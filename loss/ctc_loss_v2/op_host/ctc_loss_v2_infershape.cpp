@@ -32,6 +32,7 @@ constexpr int64_t TARGET_LENGTHS_IDX = 3;
 constexpr int64_t EXPECTED_LOG_PROBS_DIM_NUM = 3;
 constexpr int64_t EXPECTED_TARGETS_DIM_NUM_1D = 1;
 constexpr int64_t EXPECTED_TARGETS_DIM_NUM_2D = 2;
+constexpr size_t ATTR_CHECKPOINT_STRIDE_IDX = 3;
 } // namespace
 using namespace ge;
 namespace ops {
@@ -105,6 +106,17 @@ static ge::graphStatus CheckTarget(const gert::InferShapeContext* context, int64
     return ge::GRAPH_SUCCESS;
 }
 
+// alpha_checkpoint_stride > 0 时 log_alpha 只保存 t % stride == 0 的检查点行
+static int64_t GetLogAlphaTimeStep(const gert::InferShapeContext* context, int64_t timeStep)
+{
+    auto const attrs = context->GetAttrs();
+    const int64_t* checkpointStride = attrs->GetAttrPointer<int64_t>(ATTR_CHECKPOINT_STRIDE_IDX);
+    if (checkpointStride == nullptr || *checkpointStride <= 0 || timeStep < 0) {
+        return timeStep;
+    }
+    return (timeStep + *checkpointStride - 1) / *checkpointStride;
+}
+
 static ge::graphStatus CTCLossV2InferShapeFunc(gert::InferShapeContext* context)
 {
     OP_LOGD(context->GetNodeName(), "CTCLossV2InferShape run.");
@@ -140,7 +152,7 @@ static ge::graphStatus CTCLossV2InferShapeFunc(gert::InferShapeContext* context)
 
     if (Ops::Nn::IsConstTensor(targetLengthsTensor)) {
         logAlphaShape->SetDim(0, batchSize);
-        logAlphaShape->SetDim(STEP_INFO_IDX, timeStep);
+        logAlphaShape->SetDim(STEP_INFO_IDX, GetLogAlphaTimeStep(context, timeStep));
         int64_t labelLen = -1;
         int64_t targetLengthsSum = 0;
         if (GetMaxTargetLengths(targetLengthsTensor, batchSize, labelLen, targetLengthsSum) != ge::GRAPH_SUCCESS) {
@@ -19,6 +19,7 @@
 #include "kernel_operator.h"
 #include "kernel_tiling/kernel_tiling.h"
 #include "ctc_loss_v2_tiling_key.h"
+#include "ctc_loss_v2_lattice.h"
 #include "simt_api/asc_simt.h"
 
 #define INFINITY (__builtin_inff())
@@ -29,6 +30,7 @@ namespace CTCLossV2 {
 constexpr int64_t THREAD_NUM_1024 = 1024;
 constexpr int64_t THREAD_NUM_512 = 512;
 constexpr float neginf = -INFINITY;
+
 template <typename T, typename DataType, typename ThreadType>
 class CTCLossV2Base {
 public:
@@ -29,12 +29,17 @@ public:
     __aicore__ inline CTCLossV2FP16(){};
     __aicore__ inline void Init(GM_ADDR log_probs, GM_ADDR targets, GM_ADDR input_lengths, GM_ADDR target_lengths,
                                 GM_ADDR neg_log_likelihood, GM_ADDR log_alpha, GM_ADDR workspace,
-                                const CTCLossV2TilingData4AscendC* tilingData);
+                                const CTCLossV2TilingData4AscendC* tilingData, TPipe* pipe);
 
     __aicore__ inline void Process();
 
 private:
+    template <bool ALPHA_IN_UB>
+    __aicore__ inline void LaunchLogAlpha();
+
     GlobalTensor<float> tmpFloatData;
+    TBuf<QuePosition::VECCALC> alphaRowsBuf;
+    LocalTensor<float> alphaRowsTensor;
 };
 
 template <typename T, typename DataType, typename ThreadType>
@@ -42,11 +47,17 @@ __aicore__ inline void CTCLossV2FP16<T, DataType, ThreadType>::Init(GM_ADDR log_
                                                                     GM_ADDR input_lengths, GM_ADDR target_lengths,
                                                                     GM_ADDR neg_log_likelihood, GM_ADDR log_alpha,
                                                                     GM_ADDR workspace,
-                                                                    const CTCLossV2TilingData4AscendC* tilingData)
+                                                                    const CTCLossV2TilingData4AscendC* tilingData,
+                                                                    TPipe* pipe)
 {
     this->BaseInit(log_probs, targets, input_lengths, target_lengths, neg_log_likelihood, log_alpha, workspace,
                    tilingData);
     tmpFloatData.SetGlobalBuffer((__gm__ float*)(workspace));
+    if (this->tdPtr->alphaInUb == 1) {
+        // 两行 fp32 alpha 常驻 UB，替代 [N, T, 2S+1] 的 fp32 workspace
+        pipe->InitBuffer(alphaRowsBuf, 2 * this->tdPtr->blockDimY * this->tdPtr->alphaRowStride * sizeof(float));
+        alphaRowsTensor = alphaRowsBuf.Get<float>();
+    }
 }
 
 template <typename DataType, typename ThreadType>
@@ -65,12 +76,13 @@ __simt_callee__ __aicore__ inline DataType ProcessTgBatchOffsetsFp16(__gm__ Data
     }
 }
 
-template <typename T, typename DataType, typename ThreadType>
+template <typename T, typename DataType, typename ThreadType, bool ALPHA_IN_UB>
 __simt_callee__ __aicore__ __attribute__((always_inline)) inline void CalcLogAlphaFp16(
     int32_t batchSize, int32_t laInputStride, ThreadType laBatchStride, ThreadType lpBatchStride,
     int32_t maxInputLength, ThreadType lpInputStride, int32_t targetsDim, int32_t tgBatchStride, int32_t blank,
     int32_t tgTargetStride, __gm__ T* logProbsGm, __gm__ DataType* targetsGm, __gm__ DataType* inputLengthsGm,
-    __gm__ DataType* targetLengthsGm, __gm__ T* negLogLikelihoodGm, __gm__ T* logAlphaGm, __gm__ float* tmpDataGm)
+    __gm__ DataType* targetLengthsGm, __gm__ T* negLogLikelihoodGm, __gm__ T* logAlphaGm, __gm__ float* tmpDataGm,
+    int32_t alphaRowStride, int32_t checkpointStride, int32_t latticeBand, __ubuf__ float* alphaUb)
 {
     int32_t threadIdy = threadIdx.y;
     int32_t thread_idx = threadIdx.x;
@@ -85,6 +97,7 @@ __simt_callee__ __aicore__ __attribute__((always_inline)) inline void CalcLogAlp
         ThreadType laBatchOffset = b * laBatchStride;
         ThreadType tgBatchOffset = ProcessTgBatchOffsetsFp16<DataType, ThreadType>(targetLengthsGm, targetsDim,
                                                                                    tgBatchStride, b);
+        __ubuf__ float* alphaRows = ALPHA_IN_UB ? (alphaUb + 2 * threadIdy * alphaRowStride) : alphaUb;
 
         if (inputLength == 0) {
             if (threadIdx.x == 0) {
@@ -112,7 +125,11 @@ __simt_callee__ __aicore__ __attribute__((always_inline)) inline void CalcLogAlp
                     la = neginf;
             }
             if (s < laInputStride) {
-                tmpDataGm[laBatchOffset + s] = la;
+                if constexpr (ALPHA_IN_UB) {
+                    alphaRows[s] = la;
+                } else {
+                    tmpDataGm[laBatchOffset + s] = la;
+                }
                 logAlphaGm[laBatchOffset + s] = static_cast<T>(la);
             }
         }
@@ -131,34 +148,36 @@ __simt_callee__ __aicore__ __attribute__((always_inline)) inline void CalcLogAlp
             for (int32_t t = 1; t < maxInputLength; t++) {
                 asc_syncthreads();
                 if ((t < inputLength) && (s < 2 * targetLength + 1)) {
-                    float la1 = tmpDataGm[laBatchOffset + laInputStride * (t - 1) + s];
-                    float lamax = la1;
-                    float la2 = 0;
-                    float la3 = 0;
-                    if (s > 0) {
-                        la2 = tmpDataGm[laBatchOffset + laInputStride * (t - 1) + (s - 1)];
-                        if (la2 > lamax) {
-                            lamax = la2;
+                    // t 帧最多到达 s = 2t + 1，带外及 lattice_band 外的 alpha 恒为 -inf（log_alpha 已初始化），跳过计算
+                    bool pruned = s > 2 * t + 1;
+                    if constexpr (ALPHA_IN_UB) {
+                        pruned = pruned || IsOutOfBand<ThreadType>(s, t, inputLength, targetLength, latticeBand);
+                    }
+                    if (pruned) {
+                        if constexpr (ALPHA_IN_UB) {
+                            alphaRows[(t & 1) * alphaRowStride + s] = neginf;
+                        } else {
+                            tmpDataGm[laBatchOffset + laInputStride * t + s] = neginf;
                         }
-                    } else {
-                        la2 = neginf;
+                        continue;
                     }
-                    if (haveThree) {
-                        la3 = tmpDataGm[laBatchOffset + laInputStride * (t - 1) + (s - 2)];
-                        if (la3 > lamax) {
-                            lamax = la3;
+                    __gm__ float* prevRowGm = tmpDataGm + laBatchOffset + laInputStride * (t - 1);
+                    __ubuf__ float* prevRowUb = alphaRows + ((t - 1) & 1) * alphaRowStride;
+                    float la1 = ALPHA_IN_UB ? prevRowUb[s] : prevRowGm[s];
+                    float la2 = (s > 0) ? (ALPHA_IN_UB ? prevRowUb[s - 1] : prevRowGm[s - 1]) : neginf;
+                    float la3 = haveThree ? (ALPHA_IN_UB ? prevRowUb[s - 2] : prevRowGm[s - 2]) : neginf;
+                    float la = LogSumExp3(la1, la2, la3) +
+                               static_cast<float>(logProbsGm[lpBatchOffset + t * lpInputStride + currentChar]);
+                    if constexpr (ALPHA_IN_UB) {
+                        alphaRows[(t & 1) * alphaRowStride + s] = la;
+                        // 只落盘检查点行，其余帧由反向从检查点重算
+                        if (t % checkpointStride == 0) {
+                            logAlphaGm[laBatchOffset + laInputStride * (t / checkpointStride) + s] = static_cast<T>(la);
                         }
                     } else {
-                        la3 = neginf;
-                    }
-                    if (lamax == neginf) {
-                        lamax = 0;
+                        tmpDataGm[laBatchOffset + laInputStride * t + s] = la;
+                        logAlphaGm[laBatchOffset + laInputStride * t + s] = static_cast<T>(la);
                     }
-                    tmpDataGm[laBatchOffset + laInputStride * t +
-                              s] = log1pf(expf(la1 - lamax) + expf(la2 - lamax) + expf(la3 - lamax) - 1) + lamax +
-                                   static_cast<float>(logProbsGm[lpBatchOffset + t * lpInputStride + currentChar]);
-                    logAlphaGm[laBatchOffset + laInputStride * t + s] = static_cast<T>(
-                        tmpDataGm[laBatchOffset + laInputStride * t + s]);
                 }
             }
         }
@@ -166,10 +185,18 @@ __simt_callee__ __aicore__ __attribute__((always_inline)) inline void CalcLogAlp
 
         // compute the loss
         if (thread_idx == 0) {
-            float l1 = tmpDataGm[laBatchOffset + laInputStride * (inputLength - 1) + (targetLength * 2)];
-            float l2 = targetLength > 0 ?
-                           tmpDataGm[laBatchOffset + laInputStride * (inputLength - 1) + (targetLength * 2 - 1)] :
-                           neginf;
+            float l1;
+            float l2;
+            if constexpr (ALPHA_IN_UB) {
+                __ubuf__ float* lastRow = alphaRows + ((inputLength - 1) & 1) * alphaRowStride;
+                l1 = lastRow[targetLength * 2];
+                l2 = targetLength > 0 ? lastRow[targetLength * 2 - 1] : neginf;
+            } else {
+                l1 = tmpDataGm[laBatchOffset + laInputStride * (inputLength - 1) + (targetLength * 2)];
+                l2 = targetLength > 0 ?
+                         tmpDataGm[laBatchOffset + laInputStride * (inputLength - 1) + (targetLength * 2 - 1)] :
+                         neginf;
+            }
             float m = ((l1 > l2) ? l1 : l2);
             m = ((m == neginf) ? 0 : m);
             float log_likelihood = log1pf(expf(l1 - m) + expf(l2 - m) - 1) + m;
@@ -178,40 +205,53 @@ __simt_callee__ __aicore__ __attribute__((always_inline)) inline void CalcLogAlp
     }
 }
 
-template <typename T, typename DataType, typename ThreadType>
+template <typename T, typename DataType, typename ThreadType, bool ALPHA_IN_UB>
 __simt_vf__ LAUNCH_BOUND(THREAD_NUM_512) __aicore__
     void SimtComputeFp16(int32_t batchSize, int32_t laInputStride, ThreadType laBatchStride, ThreadType lpBatchStride,
                          int32_t maxInputLength, ThreadType lpInputStride, int32_t targetsDim, int32_t tgBatchStride,
                          int32_t blank, int32_t tgTargetStride, __gm__ T* logProbsGm, __gm__ DataType* targetsGm,
                          __gm__ DataType* inputLengthsGm, __gm__ DataType* targetLengthsGm,
-                         __gm__ T* negLogLikelihoodGm, __gm__ T* logAlphaGm, __gm__ float* tmpDataGm)
+                         __gm__ T* negLogLikelihoodGm, __gm__ T* logAlphaGm, __gm__ float* tmpDataGm,
+                         int32_t alphaRowStride, int32_t checkpointStride, int32_t latticeBand,
+                         __ubuf__ float* alphaUb)
 {
-    CalcLogAlphaFp16<T, DataType, ThreadType>(batchSize, laInputStride, laBatchStride, lpBatchStride, maxInputLength,
-                                              lpInputStride, targetsDim, tgBatchStride, blank, tgTargetStride,
-                                              logProbsGm, targetsGm, inputLengthsGm, targetLengthsGm,
-                                              negLogLikelihoodGm, logAlphaGm, tmpDataGm);
+    CalcLogAlphaFp16<T, DataType, ThreadType, ALPHA_IN_UB>(
+        batchSize, laInputStride, laBatchStride, lpBatchStride, maxInputLength, lpInputStride, targetsDim,
+        tgBatchStride, blank, tgTargetStride, logProbsGm, targetsGm, inputLengthsGm, targetLengthsGm,
+        negLogLikelihoodGm, logAlphaGm, tmpDataGm, alphaRowStride, checkpointStride, latticeBand, alphaUb);
 }
 
-template <typename T, typename DataType, typename ThreadType>
+template <typename T, typename DataType, typename ThreadType, bool ALPHA_IN_UB>
 __simt_vf__ LAUNCH_BOUND(THREAD_NUM_1024) __aicore__
     void SimtComputeFp16Int32(int32_t batchSize, int32_t laInputStride, ThreadType laBatchStride,
                               ThreadType lpBatchStride, int32_t maxInputLength, ThreadType lpInputStride,
                               int32_t targetsDim, int32_t tgBatchStride, int32_t blank, int32_t tgTargetStride,
                               __gm__ T* logProbsGm, __gm__ DataType* targetsGm, __gm__ DataType* inputLengthsGm,
                               __gm__ DataType* targetLengthsGm, __gm__ T* negLogLikelihoodGm, __gm__ T* logAlphaGm,
-                              __gm__ float* tmpDataGm)
+                              __gm__ float* tmpDataGm, int32_t alphaRowStride, int32_t checkpointStride,
+                              int32_t latticeBand, __ubuf__ float* alphaUb)
 {
-    CalcLogAlphaFp16<T, DataType, ThreadType>(batchSize, laInputStride, laBatchStride, lpBatchStride, maxInputLength,
-                                              lpInputStride, targetsDim, tgBatchStride, blank, tgTargetStride,
-                                              logProbsGm, targetsGm, inputLengthsGm, targetLengthsGm,
-                                              negLogLikelihoodGm, logAlphaGm, tmpDataGm);
+    CalcLogAlphaFp16<T, DataType, ThreadType, ALPHA_IN_UB>(
+        batchSize, laInputStride, laBatchStride, lpBatchStride, maxInputLength, lpInputStride, targetsDim,
+        tgBatchStride, blank, tgTargetStride, logProbsGm, targetsGm, inputLengthsGm, targetLengthsGm,
+        negLogLikelihoodGm, logAlphaGm, tmpDataGm, alphaRowStride, checkpointStride, latticeBand, alphaUb);
 }
 
 template <typename T, typename DataType, typename ThreadType>
 __aicore__ inline void CTCLossV2FP16<T, DataType, ThreadType>::Process()
+{
+    if (this->tdPtr->alphaInUb == 1) {
+        LaunchLogAlpha<true>();
+    } else {
+        LaunchLogAlpha<false>();
+    }
+}
+
+template <typename T, typename DataType, typename ThreadType>
+template <bool ALPHA_IN_UB>
+__aicore__ inline void CTCLossV2FP16<T, DataType, ThreadType>::LaunchLogAlpha()
 {
     int32_t maxInputLength = this->tdPtr->maxInputLength;
-    int32_t maxTargetLength = this->tdPtr->maxTargetLength;
     ThreadType lpInputStride = this->tdPtr->lpInputStride;
     ThreadType lpBatchStride = this->tdPtr->lpBatchStride;
     ThreadType laBatchStride = this->tdPtr->laBatchStride;
@@ -223,26 +263,29 @@ __aicore__ inline void CTCLossV2FP16<T, DataType, ThreadType>::Process()
     int32_t blockDimY = this->tdPtr->blockDimY;
     int32_t targetsDim = this->tdPtr->targetsDim;
     int32_t tgBatchStride = this->tdPtr->tgBatchStride;
-    int32_t gridY = this->tdPtr->gridY;
+    int32_t alphaRowStride = this->tdPtr->alphaRowStride;
+    int32_t checkpointStride = this->tdPtr->checkpointStride;
+    int32_t latticeBand = this->tdPtr->latticeBand;
+    __ubuf__ float* alphaUb = ALPHA_IN_UB ? (__ubuf__ float*)(alphaRowsTensor.GetPhyAddr()) : nullptr;
     if constexpr (sizeof(ThreadType) == sizeof(int32_t)) {
-        asc_vf_call<SimtComputeFp16Int32<T, DataType, ThreadType>>(
+        asc_vf_call<SimtComputeFp16Int32<T, DataType, ThreadType, ALPHA_IN_UB>>(
             dim3(blockDimX, blockDimY), batchSize, laInputStride, laBatchStride, lpBatchStride, maxInputLength,
             lpInputStride, targetsDim, tgBatchStride, blank, tgTargetStride,
             (__gm__ T*)(this->logProbsDataGm.GetPhyAddr()), (__gm__ DataType*)(this->targetsDataGm.GetPhyAddr()),
             (__gm__ DataType*)(this->inputLengthsGm.GetPhyAddr()),
             (__gm__ DataType*)(this->targetLengthsGm.GetPhyAddr()),
             (__gm__ T*)(this->negLogLikelihoodDataGm.GetPhyAddr()), (__gm__ T*)(this->logAlphaDataGm.GetPhyAddr()),
-            (__gm__ float*)(tmpFloatData.GetPhyAddr()));
+            (__gm__ float*)(tmpFloatData.GetPhyAddr()), alphaRowStride, checkpointStride, latticeBand, alphaUb);
     }
     if constexpr (sizeof(ThreadType) == sizeof(int64_t)) {
-        asc_vf_call<SimtComputeFp16<T, DataType, ThreadType>>(
+        asc_vf_call<SimtComputeFp16<T, DataType, ThreadType, ALPHA_IN_UB>>(
             dim3(blockDimX, blockDimY), batchSize, laInputStride, laBatchStride, lpBatchStride, maxInputLength,
             lpInputStride, targetsDim, tgBatchStride, blank, tgTargetStride,
             (__gm__ T*)(this->logProbsDataGm.GetPhyAddr()), (__gm__ DataType*)(this->targetsDataGm.GetPhyAddr()),
             (__gm__ DataType*)(this->inputLengthsGm.GetPhyAddr()),
             (__gm__ DataType*)(this->targetLengthsGm.GetPhyAddr()),
             (__gm__ T*)(this->negLogLikelihoodDataGm.GetPhyAddr()), (__gm__ T*)(this->logAlphaDataGm.GetPhyAddr()),
-            (__gm__ float*)(tmpFloatData.GetPhyAddr()));
+            (__gm__ float*)(tmpFloatData.GetPhyAddr()), alphaRowStride, checkpointStride, latticeBand, alphaUb);
     }
 }
 } // namespace CTCLossV2
@@ -33,10 +33,15 @@ public:
     __aicore__ inline void Process();
 
 private:
+    template <bool ALPHA_IN_UB>
+    __aicore__ inline void LaunchLogAlpha();
+
     LocalTensor<DataType> targetsLengthsTensor;
     TQue<QuePosition::VECIN, 1> targetsLengthsQue;
     TBuf<QuePosition::VECCALC> targetOffsetQue;
     LocalTensor<DataType> targetOffsetTensor;
+    TBuf<QuePosition::VECCALC> alphaRowsBuf;
+    LocalTensor<float> alphaRowsTensor;
     TPipe* pipe;
 };
 
@@ -67,6 +72,11 @@ __aicore__ inline void CTCLossV2FP32<T, DataType, ThreadType>::Init(
             targetOffsetTensor.SetValue(b + 1, offset);
         }
     }
+    if (this->tdPtr->alphaInUb == 1) {
+        // 每个 batch 槽位两行 alpha，按 t 的奇偶交替使用
+        pipe->InitBuffer(alphaRowsBuf, 2 * this->tdPtr->blockDimY * this->tdPtr->alphaRowStride * sizeof(float));
+        alphaRowsTensor = alphaRowsBuf.Get<float>();
+    }
 }
 
 template <typename DataType>
@@ -83,12 +93,13 @@ __simt_callee__ __aicore__ inline DataType ProcessTgBatchOffsets(__ubuf__ DataTy
     return (targetsDim == 1) ? tensor[idx] : (tgBatchStride * idx);
 }
 
-template <typename T, typename DataType, typename ThreadType>
+template <typename T, typename DataType, typename ThreadType, bool ALPHA_IN_UB>
 __simt_callee__ __aicore__ __attribute__((always_inline)) inline void CalcLogAlpha(
     int32_t batchSize, int32_t laInputStride, ThreadType laBatchStride, ThreadType lpBatchStride,
     int32_t maxInputLength, ThreadType lpInputStride, int32_t targetsDim, int32_t tgBatchStride, int32_t blank,
     int32_t tgTargetStride, __gm__ T* logProbsGm, __gm__ DataType* targetsGm, __gm__ DataType* inputLengthsGm,
-    __gm__ DataType* targetLengthsGm, __gm__ T* negLogLikelihoodGm, __gm__ T* logAlphaGm, __ubuf__ DataType* tensor)
+    __gm__ DataType* targetLengthsGm, __gm__ T* negLogLikelihoodGm, __gm__ T* logAlphaGm, __ubuf__ DataType* tensor,
+    int32_t alphaRowStride, int32_t checkpointStride, int32_t latticeBand, __ubuf__ float* alphaUb)
 {
     int32_t threadIdy = threadIdx.y;
     int32_t thread_idx = threadIdx.x;
@@ -102,6 +113,7 @@ __simt_callee__ __aicore__ __attribute__((always_inline)) inline void CalcLogAlp
         ThreadType lpBatchOffset = b * lpBatchStride;
         ThreadType laBatchOffset = b * laBatchStride;
         ThreadType tgBatchOffset = ProcessTgBatchOffsets<DataType>(tensor, targetsDim, tgBatchStride, b);
+        __ubuf__ float* alphaRows = ALPHA_IN_UB ? (alphaUb + 2 * threadIdy * alphaRowStride) : alphaUb;
 
         if (inputLength == 0) {
             if (thread_idx == 0) {
@@ -125,6 +137,9 @@ __simt_callee__ __aicore__ __attribute__((always_inline)) inline void CalcLogAlp
             }
             if (s < laInputStride) {
                 logAlphaGm[laBatchOffset + s] = la;
+                if constexpr (ALPHA_IN_UB) {
+                    alphaRows[s] = la;
+                }
             }
         }
 
@@ -143,19 +158,42 @@ __simt_callee__ __aicore__ __attribute__((always_inline)) inline void CalcLogAlp
             for (int32_t t = 1; t < maxInputLength; t++) {
                 asc_syncthreads();
                 if ((t < inputLength) && (s < 2 * targetLength + 1)) {
+                    // t 帧最多到达 s = 2t + 1，带外及 lattice_band 外的 alpha 恒为 -inf（GM 已初始化），跳过计算
+                    bool pruned = s > 2 * t + 1;
+                    if constexpr (ALPHA_IN_UB) {
+                        pruned = pruned || IsOutOfBand<ThreadType>(s, t, inputLength, targetLength, latticeBand);
+                    }
+                    if (pruned) {
+                        if constexpr (ALPHA_IN_UB) {
+                            alphaRows[(t & 1) * alphaRowStride + s] = neginf;
+                        }
+                        continue;
+                    }
                     float x = logProbsGm[lpBatchOffset + t * lpInputStride + currentChar];
-                    float la1 = logAlphaGm[laBatchOffset + laInputStride * (t - 1) + s];
-                    float lamax = la1;
-                    float la2 = 0;
-                    float la3 = 0;
-                    la2 = (s > 0) ? logAlphaGm[laBatchOffset + laInputStride * (t - 1) + (s - 1)] : neginf;
-                    lamax = (s > 0) ? (fmaxf(la2, lamax)) : lamax;
-                    la3 = (haveThree == true) ? logAlphaGm[laBatchOffset + laInputStride * (t - 1) + (s - 2)] : neginf;
-                    lamax = (haveThree == true) ? (fmaxf(la3, lamax)) : lamax;
-                    lamax = (lamax == neginf) ? 0 : lamax;
-                    logAlphaGm[laBatchOffset + laInputStride * t + s] = log1pf(expf(la1 - lamax) + expf(la2 - lamax) +
-                                                                               expf(la3 - lamax) - 1) +
-                                                                        lamax + x;
+                    float la1;
+                    float la2;
+                    float la3;
+                    if constexpr (ALPHA_IN_UB) {
+                        __ubuf__ float* prevRow = alphaRows + ((t - 1) & 1) * alphaRowStride;
+                        la1 = prevRow[s];
+                        la2 = (s > 0) ? prevRow[s - 1] : neginf;
+                        la3 = (haveThree == true) ? prevRow[s - 2] : neginf;
+                    } else {
+                        la1 = logAlphaGm[laBatchOffset + laInputStride * (t - 1) + s];
+                        la2 = (s > 0) ? logAlphaGm[laBatchOffset + laInputStride * (t - 1) + (s - 1)] : neginf;
+                        la3 = (haveThree == true) ? logAlphaGm[laBatchOffset + laInputStride * (t - 1) + (s - 2)] :
+                                                    neginf;
+                    }
+                    float la = LogSumExp3(la1, la2, la3) + x;
+                    if constexpr (ALPHA_IN_UB) {
+                        alphaRows[(t & 1) * alphaRowStride + s] = la;
+                        // 只落盘检查点行，其余帧由反向从检查点重算
+                        if (t % checkpointStride == 0) {
+                            logAlphaGm[laBatchOffset + laInputStride * (t / checkpointStride) + s] = la;
+                        }
+                    } else {
+                        logAlphaGm[laBatchOffset + laInputStride * t + s] = la;
+                    }
                 }
             }
         }
@@ -163,10 +201,18 @@ __simt_callee__ __aicore__ __attribute__((always_inline)) inline void CalcLogAlp
 
         // compute the loss
         if (thread_idx == 0) {
-            float l1 = logAlphaGm[laBatchOffset + laInputStride * (inputLength - 1) + (targetLength * 2)];
-            float l2 = targetLength > 0 ?
-                           logAlphaGm[laBatchOffset + laInputStride * (inputLength - 1) + (targetLength * 2 - 1)] :
-                           neginf;
+            float l1;
+            float l2;
+            if constexpr (ALPHA_IN_UB) {
+                __ubuf__ float* lastRow = alphaRows + ((inputLength - 1) & 1) * alphaRowStride;
+                l1 = lastRow[targetLength * 2];
+                l2 = targetLength > 0 ? lastRow[targetLength * 2 - 1] : neginf;
+            } else {
+                l1 = logAlphaGm[laBatchOffset + laInputStride * (inputLength - 1) + (targetLength * 2)];
+                l2 = targetLength > 0 ?
+                         logAlphaGm[laBatchOffset + laInputStride * (inputLength - 1) + (targetLength * 2 - 1)] :
+                         neginf;
+            }
             float m = ((l1 > l2) ? l1 : l2);
             m = ((m == neginf) ? 0 : m);
             float log_likelihood = log1pf(expf(l1 - m) + expf(l2 - m) - 1) + m;
@@ -175,39 +221,52 @@ __simt_callee__ __aicore__ __attribute__((always_inline)) inline void CalcLogAlp
     }
 }
 
-template <typename T, typename DataType, typename ThreadType>
+template <typename T, typename DataType, typename ThreadType, bool ALPHA_IN_UB>
 __simt_vf__ LAUNCH_BOUND(THREAD_NUM_1024) __aicore__
     void SimtComputeINT32(int32_t batchSize, int32_t laInputStride, ThreadType laBatchStride, ThreadType lpBatchStride,
                           int32_t maxInputLength, ThreadType lpInputStride, int32_t targetsDim, int32_t tgBatchStride,
                           int32_t blank, int32_t tgTargetStride, __gm__ T* logProbsGm, __gm__ DataType* targetsGm,
                           __gm__ DataType* inputLengthsGm, __gm__ DataType* targetLengthsGm,
-                          __gm__ T* negLogLikelihoodGm, __gm__ T* logAlphaGm, __ubuf__ DataType* tensor)
+                          __gm__ T* negLogLikelihoodGm, __gm__ T* logAlphaGm, __ubuf__ DataType* tensor,
+                          int32_t alphaRowStride, int32_t checkpointStride, int32_t latticeBand,
+                          __ubuf__ float* alphaUb)
 {
-    CalcLogAlpha<T, DataType, ThreadType>(batchSize, laInputStride, laBatchStride, lpBatchStride, maxInputLength,
-                                          lpInputStride, targetsDim, tgBatchStride, blank, tgTargetStride, logProbsGm,
-                                          targetsGm, inputLengthsGm, targetLengthsGm, negLogLikelihoodGm, logAlphaGm,
-                                          tensor);
+    CalcLogAlpha<T, DataType, ThreadType, ALPHA_IN_UB>(
+        batchSize, laInputStride, laBatchStride, lpBatchStride, maxInputLength, lpInputStride, targetsDim,
+        tgBatchStride, blank, tgTargetStride, logProbsGm, targetsGm, inputLengthsGm, targetLengthsGm,
+        negLogLikelihoodGm, logAlphaGm, tensor, alphaRowStride, checkpointStride, latticeBand, alphaUb);
 }
 
-template <typename T, typename DataType, typename ThreadType>
+template <typename T, typename DataType, typename ThreadType, bool ALPHA_IN_UB>
 __simt_vf__ LAUNCH_BOUND(THREAD_NUM_512) __aicore__
     void SimtCompute(int32_t batchSize, int32_t laInputStride, ThreadType laBatchStride, ThreadType lpBatchStride,
                      int32_t maxInputLength, ThreadType lpInputStride, int32_t targetsDim, int32_t tgBatchStride,
                      int32_t blank, int32_t tgTargetStride, __gm__ T* logProbsGm, __gm__ DataType* targetsGm,
                      __gm__ DataType* inputLengthsGm, __gm__ DataType* targetLengthsGm, __gm__ T* negLogLikelihoodGm,
-                     __gm__ T* logAlphaGm, __ubuf__ DataType* tensor)
+                     __gm__ T* logAlphaGm, __ubuf__ DataType* tensor, int32_t alphaRowStride,
+                     int32_t checkpointStride, int32_t latticeBand, __ubuf__ float* alphaUb)
 {
-    CalcLogAlpha<T, DataType, ThreadType>(batchSize, laInputStride, laBatchStride, lpBatchStride, maxInputLength,
-                                          lpInputStride, targetsDim, tgBatchStride, blank, tgTargetStride, logProbsGm,
-                                          targetsGm, inputLengthsGm, targetLengthsGm, negLogLikelihoodGm, logAlphaGm,
-                                          tensor);
+    CalcLogAlpha<T, DataType, ThreadType, ALPHA_IN_UB>(
+        batchSize, laInputStride, laBatchStride, lpBatchStride, maxInputLength, lpInputStride, targetsDim,
+        tgBatchStride, blank, tgTargetStride, logProbsGm, targetsGm, inputLengthsGm, targetLengthsGm,
+        negLogLikelihoodGm, logAlphaGm, tensor, alphaRowStride, checkpointStride, latticeBand, alphaUb);
 }
 
 template <typename T, typename DataType, typename ThreadType>
 __aicore__ inline void CTCLossV2FP32<T, DataType, ThreadType>::Process()
+{
+    if (this->tdPtr->alphaInUb == 1) {
+        LaunchLogAlpha<true>();
+    } else {
+        LaunchLogAlpha<false>();
+    }
+}
+
+template <typename T, typename DataType, typename ThreadType>
+template <bool ALPHA_IN_UB>
+__aicore__ inline void CTCLossV2FP32<T, DataType, ThreadType>::LaunchLogAlpha()
 {
     int32_t maxInputLength = this->tdPtr->maxInputLength;
-    int32_t maxTargetLength = this->tdPtr->maxTargetLength;
     ThreadType lpInputStride = this->tdPtr->lpInputStride;
     ThreadType lpBatchStride = this->tdPtr->lpBatchStride;
     ThreadType laBatchStride = this->tdPtr->laBatchStride;
@@ -219,27 +278,32 @@ __aicore__ inline void CTCLossV2FP32<T, DataType, ThreadType>::Process()
     int32_t blockDimY = this->tdPtr->blockDimY;
     int32_t targetsDim = this->tdPtr->targetsDim;
     int32_t tgBatchStride = this->tdPtr->tgBatchStride;
-    int32_t gridY = this->tdPtr->gridY;
+    int32_t alphaRowStride = this->tdPtr->alphaRowStride;
+    int32_t checkpointStride = this->tdPtr->checkpointStride;
+    int32_t latticeBand = this->tdPtr->latticeBand;
+    __ubuf__ float* alphaUb = ALPHA_IN_UB ? (__ubuf__ float*)(alphaRowsTensor.GetPhyAddr()) : nullptr;
 
     if constexpr (sizeof(ThreadType) == sizeof(int32_t)) {
-        asc_vf_call<SimtComputeINT32<T, DataType, ThreadType>>(
+        asc_vf_call<SimtComputeINT32<T, DataType, ThreadType, ALPHA_IN_UB>>(
             dim3(blockDimX, blockDimY), batchSize, laInputStride, laBatchStride, lpBatchStride, maxInputLength,
             lpInputStride, targetsDim, tgBatchStride, blank, tgTargetStride,
             (__gm__ T*)(this->logProbsDataGm.GetPhyAddr()), (__gm__ DataType*)(this->targetsDataGm.GetPhyAddr()),
             (__gm__ DataType*)(this->inputLengthsGm.GetPhyAddr()),
             (__gm__ DataType*)(this->targetLengthsGm.GetPhyAddr()),
             (__gm__ T*)(this->negLogLikelihoodDataGm.GetPhyAddr()), (__gm__ T*)(this->logAlphaDataGm.GetPhyAddr()),
-            (__ubuf__ DataType*)(targetOffsetTensor.GetPhyAddr()));
+            (__ubuf__ DataType*)(targetOffsetTensor.GetPhyAddr()), alphaRowStride, checkpointStride, latticeBand,
+            alphaUb);
     }
     if constexpr (sizeof(ThreadType) == sizeof(int64_t)) {
-        asc_vf_call<SimtCompute<T, DataType, ThreadType>>(
+        asc_vf_call<SimtCompute<T, DataType, ThreadType, ALPHA_IN_UB>>(
             dim3(blockDimX, blockDimY), batchSize, laInputStride, laBatchStride, lpBatchStride, maxInputLength,
             lpInputStride, targetsDim, tgBatchStride, blank, tgTargetStride,
             (__gm__ T*)(this->logProbsDataGm.GetPhyAddr()), (__gm__ DataType*)(this->targetsDataGm.GetPhyAddr()),
             (__gm__ DataType*)(this->inputLengthsGm.GetPhyAddr()),
             (__gm__ DataType*)(this->targetLengthsGm.GetPhyAddr()),
             (__gm__ T*)(this->negLogLikelihoodDataGm.GetPhyAddr()), (__gm__ T*)(this->logAlphaDataGm.GetPhyAddr()),
-            (__ubuf__ DataType*)(targetOffsetTensor.GetPhyAddr()));
+            (__ubuf__ DataType*)(targetOffsetTensor.GetPhyAddr()), alphaRowStride, checkpointStride, latticeBand,
+            alphaUb);
     }
 }
 } // namespace CTCLossV2
@@ -0,0 +1,47 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/* !
+ * \file ctc_loss_v2_lattice.h
+ * \brief CTCLossV2 正向与 CTCLossV2Grad 共用的 lattice 递推工具
+ */
+
+#ifndef CTC_LOSS_V2_LATTICE_H
+#define CTC_LOSS_V2_LATTICE_H
+
+#include "kernel_operator.h"
+#include "simt_api/asc_simt.h"
+
+namespace CTCLossV2 {
+constexpr float LATTICE_NEG_INF = -__builtin_inff();
+
+// lattice_band > 0 时只保留对角线两侧 band 个状态，对角线从 (0, 0) 线性走到 (inputLength - 1, 2 * targetLength)
+template <typename ThreadType>
+__simt_callee__ __aicore__ __attribute__((always_inline)) inline bool IsOutOfBand(ThreadType s, ThreadType t,
+                                                                                  ThreadType inputLength,
+                                                                                  ThreadType targetLength,
+                                                                                  ThreadType latticeBand)
+{
+    if (latticeBand <= 0) {
+        return false;
+    }
+    ThreadType center = inputLength > 1 ? (2 * targetLength * t) / (inputLength - 1) : 0;
+    return (s < center - latticeBand) || (s > center + latticeBand);
+}
+
+// log(exp(l1) + exp(l2) + exp(l3))，三项全为 -inf 时结果为 -inf；alpha 正向递推与反向检查点重算共用同一公式
+__simt_callee__ __aicore__ __attribute__((always_inline)) inline float LogSumExp3(float l1, float l2, float l3)
+{
+    float lmax = fmaxf(fmaxf(l1, l2), l3);
+    lmax = (lmax == LATTICE_NEG_INF) ? 0 : lmax;
+    return log1pf(expf(l1 - lmax) + expf(l2 - lmax) + expf(l3 - lmax) - 1) + lmax;
+}
+} // namespace CTCLossV2
+#endif // CTC_LOSS_V2_LATTICE_H
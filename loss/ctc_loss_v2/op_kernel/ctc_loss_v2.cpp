@@ -43,12 +43,12 @@ __global__ __aicore__ void ctc_loss_v2(GM_ADDR log_probs, GM_ADDR targets, GM_AD
         if constexpr (threadTypeInt32 == CTC_LOSS_V2_TPL_KEY_TRUE) {
             CTCLossV2::CTCLossV2FP16<DTYPE_LOG_PROBS, DTYPE_TARGET_LENGTHS, int32_t> op;
             op.Init(log_probs, targets, input_lengths, target_lengths, neg_log_likelihood, log_alpha, workspace,
-                    &tilingData);
+                    &tilingData, &pipe);
             op.Process();
         } else {
             CTCLossV2::CTCLossV2FP16<DTYPE_LOG_PROBS, DTYPE_TARGET_LENGTHS, int64_t> op;
             op.Init(log_probs, targets, input_lengths, target_lengths, neg_log_likelihood, log_alpha, workspace,
-                    &tilingData);
+                    &tilingData, &pipe);
             op.Process();
         }
     }
@@ -193,4 +193,196 @@ static string to_string(const std::stringstream& tiling_data)
 //     std::cout << "test>> tiling_func is valid" << std::endl;
 //     EXPECT_EQ(tiling_func(tiling_context), ge::GRAPH_SUCCESS);
 //   }
-// }
\ No newline at end of file
+// }
+
+static void RunCTCLossV2Tiling(ge::DataType dtype, int64_t targetLength, int64_t laInputDim,
+                               const std::vector<std::pair<std::string, Ops::NN::AnyValue>>& attrs,
+                               ge::graphStatus expectStatus, size_t& workspaceSize, std::vector<int64_t>& tilingData)
+{
+    std::map<std::string, std::string> soc_version_infos = {{"Short_SoC_version", "Ascend950"}, {"NpuArch", "3510"}};
+    string compile_info_string = R"({
+                                    "hardware_info": {
+                                        "BT_SIZE": 0,
+                                        "load3d_constraints": "1",
+                                        "Intrinsic_fix_pipe_l0c2out": false,
+                                        "Intrinsic_data_move_l12ub": true,
+                                        "Intrinsic_data_move_l0c2ub": true,
+                                        "Intrinsic_data_move_out2l1_nd2nz": false,
+                                        "UB_SIZE": 245760,
+                                        "L2_SIZE": 33554432,
+                                        "L1_SIZE": 524288,
+                                        "L0A_SIZE": 65536,
+                                        "L0B_SIZE": 65536,
+                                        "L0C_SIZE": 131072,
+                                        "CORE_NUM": 64
+                                    }
+                                })";
+    // 获取平台信息
+    map<string, string> soc_infos;
+    map<string, string> aicore_spec;
+    map<string, string> intrinsics;
+    GetPlatFormInfos(compile_info_string.c_str(), soc_infos, aicore_spec, intrinsics);
+
+    // 初始化平台信息
+    fe::PlatFormInfos platform_info;
+    platform_info.Init();
+
+    // 定义编译信息结构体
+    struct CTCLossV2CompileInfo {
+    } compile_info;
+
+    // 获取操作符实现
+    std::string op_type("CTCLossV2");
+    ASSERT_NE(gert::OpImplRegistry::GetInstance().GetOpImpl(op_type.c_str()), nullptr);
+    auto tiling_func = gert::OpImplRegistry::GetInstance().GetOpImpl(op_type.c_str())->tiling;
+    auto tiling_parse_func = gert::OpImplRegistry::GetInstance().GetOpImpl(op_type.c_str())->tiling_parse;
+
+    // 模拟 tilingParseFunc
+    auto kernel_holder = gert::KernelRunContextFaker()
+                             .KernelIONum(4, 2)
+                             .Inputs({const_cast<char*>(compile_info_string.c_str()),
+                                      reinterpret_cast<void*>(&platform_info)})
+                             .Outputs({&compile_info})
+                             .Build();
+    ASSERT_TRUE(kernel_holder.GetContext<gert::TilingParseContext>()->GetPlatformInfo()->Init());
+    kernel_holder.GetContext<gert::TilingParseContext>()->GetPlatformInfo()->SetPlatformRes("SoCInfo", soc_infos);
+    kernel_holder.GetContext<gert::TilingParseContext>()->GetPlatformInfo()->SetPlatformRes("AICoreSpec", aicore_spec);
+    kernel_holder.GetContext<gert::TilingParseContext>()->GetPlatformInfo()->SetCoreNumByCoreType("AICore");
+    kernel_holder.GetContext<gert::TilingParseContext>()->GetPlatformInfo()->SetPlatformRes("AICoreintrinsicDtypeMap",
+                                                                                            intrinsics);
+    kernel_holder.GetContext<gert::TilingParseContext>()->GetPlatformInfo()->SetPlatformRes("version",
+                                                                                            soc_version_infos);
+    ASSERT_EQ(tiling_parse_func(kernel_holder.GetContext<gert::KernelContext>()), ge::GRAPH_SUCCESS);
+
+    // 定义操作符和输入性状, log_probs = (T, N, C) = (32, 16, 8)
+    gert::StorageShape log_probs_shape = {{32, 16, 8}, {32, 16, 8}};
+    gert::StorageShape targets_shape = {{16, targetLength}, {16, targetLength}};
+    gert::StorageShape input_lengths_shape = {{16}, {16}};
+    gert::StorageShape target_lengths_shape = {{16}, {16}};
+    gert::StorageShape neg_log_likelihood_shape = {{16}, {16}};
+    gert::StorageShape log_alpha_shape = {{16, laInputDim, 2 * targetLength + 1},
+                                          {16, laInputDim, 2 * targetLength + 1}};
+
+    std::vector<std::pair<size_t, std::unique_ptr<uint8_t[]>>> const_tensors;
+    std::vector<int64_t> input_lengths_data(16, 32);
+    std::vector<int64_t> target_lengths_data(16, targetLength);
+    SetConstInput(2, DT_INT64, input_lengths_data.data(), 16, const_tensors);
+    SetConstInput(3, DT_INT64, target_lengths_data.data(), 16, const_tensors);
+
+    // 模拟 tilingFunc
+    auto param = gert::TilingData::CreateCap(4096);
+    ASSERT_NE(param, nullptr);
+    auto workspace_size_holer = gert::ContinuousVector::Create<size_t>(4096);
+    auto ws_size = reinterpret_cast<gert::ContinuousVector*>(workspace_size_holer.get());
+
+    auto holder = gert::TilingContextFaker()
+                      .SetOpType("CTCLossV2")
+                      .NodeIoNum(4, 2)
+                      .IrInstanceNum({1, 1, 1, 1})
+                      .InputShapes({&log_probs_shape, &targets_shape, &input_lengths_shape, &target_lengths_shape})
+                      .OutputShapes({&neg_log_likelihood_shape, &log_alpha_shape})
+                      .CompileInfo(&compile_info)
+                      .PlatformInfo(reinterpret_cast<char*>(&platform_info))
+                      .NodeInputTd(0, dtype, ge::FORMAT_ND, ge::FORMAT_ND)
+                      .NodeInputTd(1, ge::DT_INT64, ge::FORMAT_ND, ge::FORMAT_ND)
+                      .NodeInputTd(2, ge::DT_INT64, ge::FORMAT_ND, ge::FORMAT_ND)
+                      .NodeInputTd(3, ge::DT_INT64, ge::FORMAT_ND, ge::FORMAT_ND)
+                      .NodeOutputTd(0, dtype, ge::FORMAT_ND, ge::FORMAT_ND)
+                      .NodeOutputTd(1, dtype, ge::FORMAT_ND, ge::FORMAT_ND)
+                      .NodeAttrs(attrs)
+                      .TilingData(param.get())
+                      .ConstInput(const_tensors)
+                      .Workspace(ws_size)
+                      .Build();
+
+    gert::TilingContext* tiling_context = holder.GetContext<gert::TilingContext>();
+    ASSERT_NE(tiling_context->GetPlatformInfo(), nullptr);
+    holder.GetContext<gert::TilingContext>()->GetPlatformInfo()->SetPlatformRes("SoCInfo", soc_infos);
+    holder.GetContext<gert::TilingContext>()->GetPlatformInfo()->SetPlatformRes("AICoreSpec", aicore_spec);
+    holder.GetContext<gert::TilingContext>()->GetPlatformInfo()->SetCoreNumByCoreType("AICore");
+    holder.GetContext<gert::TilingContext>()->GetPlatformInfo()->SetPlatformRes("AICoreintrinsicDtypeMap", intrinsics);
+    holder.GetContext<gert::TilingContext>()->GetPlatformInfo()->SetPlatformRes("version", soc_version_infos);
+
+    ASSERT_NE(tiling_func, nullptr);
+    ASSERT_EQ(tiling_func(tiling_context), expectStatus);
+    if (expectStatus != ge::GRAPH_SUCCESS) {
+        return;
+    }
+    workspaceSize = tiling_context->GetWorkspaceSizes(1)[0];
+    auto rawTilingData = tiling_context->GetRawTilingData();
+    tilingData.resize(rawTilingData->GetDataSize() / sizeof(int64_t));
+    memcpy(tilingData.data(), rawTilingData->GetData(), tilingData.size() * sizeof(int64_t));
+}
+
+static constexpr size_t TD_LA_BATCH_STRIDE = 5;
+static constexpr size_t TD_ALPHA_IN_UB = 18;
+static constexpr size_t TD_CHECKPOINT_STRIDE = 20;
+static constexpr size_t TD_LATTICE_BAND = 21;
+static constexpr size_t SYSTEM_WORKSPACE_SIZE = 16 * 1024 * 1024;
+
+// 默认模式 fp16 需要 [N, T, 2S+1] 的 fp32 workspace；检查点模式 alpha 两行留在 UB，
+// log_alpha 只保存 t = 0, 8, 16, 24 四个检查点行，不再申请额外 workspace
+TEST_F(CTCLossV2Tiling, test_rt2_checkpoint_band_fp16_success)
+{
+    size_t baseWorkspaceSize = 0;
+    size_t workspaceSize = 0;
+    std::vector<int64_t> baseTilingData;
+    std::vector<int64_t> tilingData;
+    RunCTCLossV2Tiling(ge::DT_FLOAT16, 3, 32,
+                       {{"blank", Ops::NN::AnyValue::CreateFrom<int64_t>(0)},
+                        {"reduction", Ops::NN::AnyValue::CreateFrom<string>("mean")},
+                        {"zero_infinity", Ops::NN::AnyValue::CreateFrom<bool>(false)}},
+                       ge::GRAPH_SUCCESS, baseWorkspaceSize, baseTilingData);
+    ASSERT_GT(baseTilingData.size(), TD_LATTICE_BAND);
+    EXPECT_EQ(baseWorkspaceSize, SYSTEM_WORKSPACE_SIZE + 7 * sizeof(float) * 16 * 32);
+    EXPECT_EQ(baseTilingData[TD_LA_BATCH_STRIDE], 32 * 7);
+    EXPECT_EQ(baseTilingData[TD_ALPHA_IN_UB], 0);
+
+    RunCTCLossV2Tiling(ge::DT_FLOAT16, 3, 4,
+                       {{"blank", Ops::NN::AnyValue::CreateFrom<int64_t>(0)},
+                        {"reduction", Ops::NN::AnyValue::CreateFrom<string>("mean")},
+                        {"zero_infinity", Ops::NN::AnyValue::CreateFrom<bool>(false)},
+                        {"alpha_checkpoint_stride", Ops::NN::AnyValue::CreateFrom<int64_t>(8)},
+                        {"lattice_band", Ops::NN::AnyValue::CreateFrom<int64_t>(4)}},
+                       ge::GRAPH_SUCCESS, workspaceSize, tilingData);
+    ASSERT_GT(tilingData.size(), TD_LATTICE_BAND);
+    EXPECT_EQ(workspaceSize, SYSTEM_WORKSPACE_SIZE);
+    EXPECT_EQ(tilingData[TD_LA_BATCH_STRIDE], 4 * 7);
+    EXPECT_EQ(tilingData[TD_ALPHA_IN_UB], 1);
+    EXPECT_EQ(tilingData[TD_CHECKPOINT_STRIDE], 8);
+    EXPECT_EQ(tilingData[TD_LATTICE_BAND], 4);
+}
+
+// 仅开 band 时每帧都是检查点，log_alpha 保持完整的 T 行
+TEST_F(CTCLossV2Tiling, test_rt2_band_only_success)
+{
+    size_t workspaceSize = 0;
+    std::vector<int64_t> tilingData;
+    RunCTCLossV2Tiling(ge::DT_FLOAT, 3, 32,
+                       {{"blank", Ops::NN::AnyValue::CreateFrom<int64_t>(0)},
+                        {"reduction", Ops::NN::AnyValue::CreateFrom<string>("mean")},
+                        {"zero_infinity", Ops::NN::AnyValue::CreateFrom<bool>(false)},
+                        {"alpha_checkpoint_stride", Ops::NN::AnyValue::CreateFrom<int64_t>(0)},
+                        {"lattice_band", Ops::NN::AnyValue::CreateFrom<int64_t>(4)}},
+                       ge::GRAPH_SUCCESS, workspaceSize, tilingData);
+    ASSERT_GT(tilingData.size(), TD_LATTICE_BAND);
+    EXPECT_EQ(workspaceSize, SYSTEM_WORKSPACE_SIZE);
+    EXPECT_EQ(tilingData[TD_LA_BATCH_STRIDE], 32 * 7);
+    EXPECT_EQ(tilingData[TD_ALPHA_IN_UB], 1);
+    EXPECT_EQ(tilingData[TD_CHECKPOINT_STRIDE], 1);
+    EXPECT_EQ(tilingData[TD_LATTICE_BAND], 4);
+}
+
+// 2S+1 = 1201 超过一个 block 的线程数，alpha 无法留在 UB，检查点模式直接报错
+TEST_F(CTCLossV2Tiling, test_rt2_checkpoint_alpha_exceed_block_failed)
+{
+    size_t workspaceSize = 0;
+    std::vector<int64_t> tilingData;
+    RunCTCLossV2Tiling(ge::DT_FLOAT16, 600, 4,
+                       {{"blank", Ops::NN::AnyValue::CreateFrom<int64_t>(0)},
+                        {"reduction", Ops::NN::AnyValue::CreateFrom<string>("mean")},
+                        {"zero_infinity", Ops::NN::AnyValue::CreateFrom<bool>(false)},
+                        {"alpha_checkpoint_stride", Ops::NN::AnyValue::CreateFrom<int64_t>(8)},
+                        {"lattice_band", Ops::NN::AnyValue::CreateFrom<int64_t>(4)}},
+                       ge::GRAPH_FAILED, workspaceSize, tilingData);
+}
@@ -14,6 +14,8 @@
  */
 
 #include <iostream>
+#include <cstring>
+#include <memory>
 #include <gtest/gtest.h>
 #include "register/op_impl_registry.h"
 #include "kernel_run_context_facker.h"
@@ -229,6 +231,73 @@ TEST_F(CTCLossV2ProtoTest, ctc_loss_v2_infer_shape_test4_success)
     ASSERT_EQ(Ops::Base::ToString(*output_desc_1), Ops::Base::ToString(expected_output_shape_1));
 }
 
+static std::unique_ptr<uint8_t[]> MakeConstLengths(const gert::StorageShape& shape, const std::vector<int32_t>& data)
+{
+    std::unique_ptr<uint8_t[]> tensorHolder(new uint8_t[sizeof(gert::Tensor) + sizeof(int32_t) * data.size()]);
+    auto tensor = reinterpret_cast<gert::Tensor*>(tensorHolder.get());
+    gert::Tensor tensorValue(shape, {ge::FORMAT_ND, ge::FORMAT_ND, {}}, gert::kFollowing, ge::DT_INT32, nullptr);
+    std::memcpy(tensor, &tensorValue, sizeof(gert::Tensor));
+    auto tensorData = reinterpret_cast<int32_t*>(tensor + 1);
+    for (size_t i = 0; i < data.size(); ++i) {
+        tensorData[i] = data[i];
+    }
+    tensor->SetData(gert::TensorData(tensorData, nullptr, sizeof(int32_t) * data.size(), gert::kFollowing));
+    return tensorHolder;
+}
+
+static std::string InferLogAlphaShapeWithConstLengths(
+    const std::vector<std::pair<std::string, Ops::NN::AnyValue>>& attrs)
+{
+    auto inferShapeFunc = gert::OpImplRegistry::GetInstance().GetOpImpl("CTCLossV2")->infer_shape;
+
+    gert::StorageShape logProbsShape = {{10, 2, 6}, {10, 2, 6}};
+    gert::StorageShape targetsShape = {{2, 3}, {2, 3}};
+    gert::StorageShape lengthsShape = {{2}, {2}};
+    auto inputLengths = MakeConstLengths(lengthsShape, {10, 8});
+    auto targetLengths = MakeConstLengths(lengthsShape, {3, 2});
+
+    gert::Shape output_shape_0 = {};
+    gert::Shape output_shape_1 = {};
+    auto holder = gert::InferShapeContextFaker()
+                      .NodeIoNum(4, 2)
+                      .IrInstanceNum({1, 1, 1, 1})
+                      .InputShapes({&logProbsShape, &targetsShape, reinterpret_cast<gert::Tensor*>(inputLengths.get()),
+                                    reinterpret_cast<gert::Tensor*>(targetLengths.get())})
+                      .OutputShapes({&output_shape_0, &output_shape_1})
+                      .NodeAttrs(attrs)
+                      .NodeInputTd(0, ge::DT_FLOAT, ge::FORMAT_ND, ge::FORMAT_ND)
+                      .NodeInputTd(1, ge::DT_INT32, ge::FORMAT_ND, ge::FORMAT_ND)
+                      .NodeInputTd(2, ge::DT_INT32, ge::FORMAT_ND, ge::FORMAT_ND)
+                      .NodeInputTd(3, ge::DT_INT32, ge::FORMAT_ND, ge::FORMAT_ND)
+                      .NodeOutputTd(0, ge::DT_FLOAT, ge::FORMAT_ND, ge::FORMAT_ND)
+                      .NodeOutputTd(1, ge::DT_FLOAT, ge::FORMAT_ND, ge::FORMAT_ND)
+                      .Build();
+    EXPECT_EQ(inferShapeFunc(holder.GetContext<gert::InferShapeContext>()), ge::GRAPH_SUCCESS);
+    return Ops::Base::ToString(*holder.GetContext<gert::InferShapeContext>()->GetOutputShape(1));
+}
+
+TEST_F(CTCLossV2ProtoTest, ctc_loss_v2_infer_shape_default_keeps_all_frames)
+{
+    gert::Shape expected_output_shape_1 = {2, 10, 8};
+    EXPECT_EQ(InferLogAlphaShapeWithConstLengths({{"blank", Ops::NN::AnyValue::CreateFrom<int64_t>(0)},
+                                                  {"reduction", Ops::NN::AnyValue::CreateFrom<std::string>("none")},
+                                                  {"zero_infinity", Ops::NN::AnyValue::CreateFrom<bool>(false)}}),
+              Ops::Base::ToString(expected_output_shape_1));
+}
+
+TEST_F(CTCLossV2ProtoTest, ctc_loss_v2_infer_shape_checkpoint_stride)
+{
+    // T = 10，每 4 帧一个检查点，log_alpha 只保留 t = 0, 4, 8 三行
+    gert::Shape expected_output_shape_1 = {2, 3, 8};
+    EXPECT_EQ(
+        InferLogAlphaShapeWithConstLengths({{"blank", Ops::NN::AnyValue::CreateFrom<int64_t>(0)},
+                                            {"reduction", Ops::NN::AnyValue::CreateFrom<std::string>("none")},
+                                            {"zero_infinity", Ops::NN::AnyValue::CreateFrom<bool>(false)},
+                                            {"alpha_checkpoint_stride", Ops::NN::AnyValue::CreateFrom<int64_t>(4)},
+                                            {"lattice_band", Ops::NN::AnyValue::CreateFrom<int64_t>(2)}}),
+        Ops::Base::ToString(expected_output_shape_1));
+}
+
 TEST_F(CTCLossV2ProtoTest, ctc_loss_v2_infer_dtype_test_success)
 {
     auto data_type_func = gert::OpImplRegistry::GetInstance().GetOpImpl("CTCLossV2")->infer_datatype;
@@ -49,12 +49,18 @@ Classification loss.
 * @li reduction: An optional String. Specifies the reduction to apply to the output: 'none' | 'mean' | 'sum'. Default:
 'mean'.
 * @li zero_infinity: An optional Bool. Whether to zero infinite losses and the associated gradients. Default: false.
+* @li alpha_checkpoint_stride: An optional Int. If greater than 0, log_alpha is of size
+(N, ceil(T / alpha_checkpoint_stride), X) and only holds the checkpoint rows, the other rows are recomputed from
+them. Default: 0.
+* @li lattice_band: An optional Int. If greater than 0, only the states within lattice_band of the diagonal of the
+lattice are computed. Default: 0.
 
 * @par Third-party framework compatibility:
 * Compatible with Pytorch CTCLoss operator.
 
 * @attention Constraints:
 * The limit of Label’s length is 1K.
+* alpha_checkpoint_stride and lattice_band must match the values of CTCLossV2 that produced log_alpha.
 */
 REG_OP(CTCLossV2Grad)
     .INPUT(grad_out, TensorType({DT_FLOAT16, DT_BF16, DT_FLOAT, DT_DOUBLE}))
@@ -68,6 +74,8 @@ REG_OP(CTCLossV2Grad)
     .ATTR(blank, Int, 0)
     .ATTR(reduction, String, "mean")
     .ATTR(zero_infinity, Bool, false)
+    .ATTR(alpha_checkpoint_stride, Int, 0)
+    .ATTR(lattice_band, Int, 0)
     .OP_END_FACTORY_REG(CTCLossV2Grad)
 } // namespace ge
 
@@ -42,8 +42,12 @@ constexpr int64_t LOSS_DIM_NUM = 1;
 constexpr int64_t GRAD_DIM_NUM = 3;
 constexpr int64_t ATTR_BLANK_IDX = 0;
 constexpr int64_t ATTR_ZERO_INFINITY_IDX = 2;
+constexpr int64_t ATTR_CHECKPOINT_STRIDE_IDX = 3;
+constexpr int64_t ATTR_LATTICE_BAND_IDX = 4;
 
 constexpr int64_t FLOAT_DSIZE = 4;
+// 检查点模式下 logBeta 只保留 t + 1 与 t 两行
+constexpr int64_t BETA_ROW_NUM = 2;
 
 constexpr int64_t GRAD_OUT_DIM_NUM = 1;
 constexpr int64_t GRAD_OUT_DIM_INDEX = 1;
@@ -90,6 +94,7 @@ private:
     bool InitTargetLengths();
     bool InitNegLogLikelihood();
     bool InitGrad();
+    bool InitMemoryLeanAttrs();
     void InitLogBetaThreadParams(const int64_t maxThreadNum);
     void InitUpdateLcabThreadParams(const int64_t maxThreadNum);
     void InitCalGradThreadParams(const int64_t maxThreadNum);
@@ -146,6 +151,10 @@ private:
     int64_t logBetaThreadNum = 0;
     int64_t updateLcabThreadNum = 0;
     int64_t calGradThreadNum = 0;
+
+    int64_t checkpointStride = 0;
+    int64_t latticeBand = 0;
+    int64_t logBetaT = 0;
 };
 
 void CTCLossV2GradTiling4AscendC::InitGmParams()
@@ -158,8 +167,8 @@ void CTCLossV2GradTiling4AscendC::InitGmParams()
 
     initLogBetaGmStartBlock = perBlockNum;
     initLogBetaGmEndBlock = S_COE * perBlockNum - 1;
-    initLogBetaGmSizePerBlock = (batchSize * alphaLength * maxInputLength) / perBlockNum;
-    initLogBetaGmSizeLastBlock = initLogBetaGmSizePerBlock + (batchSize * alphaLength * maxInputLength) % perBlockNum;
+    initLogBetaGmSizePerBlock = (batchSize * alphaLength * logBetaT) / perBlockNum;
+    initLogBetaGmSizeLastBlock = initLogBetaGmSizePerBlock + (batchSize * alphaLength * logBetaT) % perBlockNum;
 
     initTempGradGmStartBlock = S_COE * perBlockNum;
     initTempGradGmEndBlock = coreNum - 1;
@@ -217,6 +226,7 @@ ge::graphStatus CTCLossV2GradTiling4AscendC::InitSimtParams()
 {
     OP_LOGD(context_->GetNodeName(), "CTCLossV2Grad SIMT tiling running");
     int64_t maxThreadNum = GetThreadNum();
+    logBetaT = checkpointStride > 0 ? BETA_ROW_NUM : maxInputLength;
     InitLogBetaThreadParams(maxThreadNum);
     InitUpdateLcabThreadParams(maxThreadNum);
     InitCalGradThreadParams(maxThreadNum);
@@ -225,9 +235,11 @@ ge::graphStatus CTCLossV2GradTiling4AscendC::InitSimtParams()
     size_t sysWorkspaceSize = static_cast<size_t>(16 * 1024 * 1024);
     size_t* currentWorkspace = context_->GetWorkspaceSizes(1);
     OP_CHECK_NULL_WITH_CONTEXT(context_, currentWorkspace);
+    // logBeta + tempGrad，检查点模式另加一段 alpha 的重算缓存
     currentWorkspace[0] = sysWorkspaceSize +
-                          static_cast<size_t>(maxInputLength * batchSize * alphaLength * FLOAT_DSIZE) +
-                          static_cast<size_t>(maxInputLength * batchSize * symbolSet * FLOAT_DSIZE);
+                          static_cast<size_t>(logBetaT * batchSize * alphaLength * FLOAT_DSIZE) +
+                          static_cast<size_t>(maxInputLength * batchSize * symbolSet * FLOAT_DSIZE) +
+                          static_cast<size_t>(checkpointStride * batchSize * alphaLength * FLOAT_DSIZE);
     PrintTilingData();
     return ge::GRAPH_SUCCESS;
 }
@@ -268,6 +280,8 @@ ge::graphStatus CTCLossV2GradTiling4AscendC::RunKernelTiling()
     tilingData.set_logBetaThreadNum(logBetaThreadNum);
     tilingData.set_updateLcabThreadNum(updateLcabThreadNum);
     tilingData.set_calGradThreadNum(calGradThreadNum);
+    tilingData.set_checkpointStride(checkpointStride);
+    tilingData.set_latticeBand(latticeBand);
     tilingData.SaveToBuffer(context_->GetRawTilingData()->GetData(), context_->GetRawTilingData()->GetCapacity());
     context_->GetRawTilingData()->SetDataSize(tilingData.GetDataSize());
     context_->SetLocalMemorySize(MAX_UB_SIZE);
@@ -306,6 +320,9 @@ void CTCLossV2GradTiling4AscendC::PrintTilingData() const
     OP_LOGD(nodeName, "logBetaThreadNum is %ld.", logBetaThreadNum);
     OP_LOGD(nodeName, "updateLcabThreadNum is %ld.", updateLcabThreadNum);
     OP_LOGD(nodeName, "calGradThreadNum is %ld.", calGradThreadNum);
+    OP_LOGD(nodeName, "checkpointStride is %ld.", checkpointStride);
+    OP_LOGD(nodeName, "latticeBand is %ld.", latticeBand);
+    OP_LOGD(nodeName, "logBetaT is %ld.", logBetaT);
     OP_LOGD(nodeName, "End printing");
     OP_LOGD(nodeName, "CTCLossV2Grad tiling end running");
 }
@@ -317,7 +334,7 @@ ge::graphStatus CTCLossV2GradTiling4AscendC::Init()
 
     coreNum = compileInfo->totalCoreNum;
 
-    if (!CheckShapeInfo()) {
+    if (!InitMemoryLeanAttrs() || !CheckShapeInfo()) {
         return ge::GRAPH_FAILED;
     }
 
@@ -337,6 +354,26 @@ ge::graphStatus CTCLossV2GradTiling4AscendC::Init()
     return InitSimtParams();
 }
 
+bool CTCLossV2GradTiling4AscendC::InitMemoryLeanAttrs()
+{
+    auto* attrs = context_->GetAttrs();
+    OP_CHECK_NULL_WITH_CONTEXT(context_, attrs);
+    const auto* checkpointStridePtr = attrs->GetAttrPointer<int64_t>(ATTR_CHECKPOINT_STRIDE_IDX);
+    const auto* latticeBandPtr = attrs->GetAttrPointer<int64_t>(ATTR_LATTICE_BAND_IDX);
+    checkpointStride = checkpointStridePtr == nullptr ? 0 : *checkpointStridePtr;
+    latticeBand = latticeBandPtr == nullptr ? 0 : *latticeBandPtr;
+    OP_CHECK_IF(checkpointStride < 0 || latticeBand < 0,
+                OP_LOGE(context_->GetNodeName(),
+                        "alpha_checkpoint_stride [%ld] and lattice_band [%ld] should not be negative.",
+                        checkpointStride, latticeBand),
+                return false);
+    // 与 CTCLossV2 一致，仅开 band 时每帧都是检查点
+    if (latticeBand > 0 && checkpointStride == 0) {
+        checkpointStride = 1;
+    }
+    return true;
+}
+
 bool CTCLossV2GradTiling4AscendC::InitGrad()
 {
     auto const gradShape = context_->GetOutputShape(OUTPUT_GRAD_INDEX);
@@ -478,7 +515,10 @@ bool CTCLossV2GradTiling4AscendC::CheckShapeInfo()
     OP_LOGD(nodeName, "maxInputLength is %ld.", maxInputLength);
     OP_LOGD(nodeName, "gradT is %ld.", gradT);
     OP_LOGD(nodeName, "logAlphaT is %ld.", logAlphaT);
-    bool TCheck = maxInputLength == gradT && gradT == logAlphaT;
+    // 检查点模式下 log_alpha 只有 ceil(T / alpha_checkpoint_stride) 行
+    int64_t expectLogAlphaT = checkpointStride > 0 ? (maxInputLength + checkpointStride - 1) / checkpointStride :
+                                                     maxInputLength;
+    bool TCheck = maxInputLength == gradT && logAlphaT == expectLogAlphaT;
     OP_CHECK_IF(!TCheck, OP_LOGE(nodeName, "Check max time failed."), return false);
 
     bool CCheck = symbolSet == gradC;
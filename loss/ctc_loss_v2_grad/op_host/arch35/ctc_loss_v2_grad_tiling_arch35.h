@@ -49,6 +49,8 @@ TILING_DATA_FIELD_DEF(int64_t, initTempGradGmStartBlock);
 TILING_DATA_FIELD_DEF(int64_t, initTempGradGmEndBlock);
 TILING_DATA_FIELD_DEF(int64_t, initTempGradGmSizePerBlock);
 TILING_DATA_FIELD_DEF(int64_t, initTempGradGmSizeEndBlock);
+TILING_DATA_FIELD_DEF(int64_t, checkpointStride);
+TILING_DATA_FIELD_DEF(int64_t, latticeBand);
 END_TILING_DATA_DEF;
 
 REGISTER_TILING_DATA_CLASS(CTCLossV2Grad, CTCLossV2GradTilingData4AscendC)
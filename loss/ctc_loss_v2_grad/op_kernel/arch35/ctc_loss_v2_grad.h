@@ -20,9 +20,12 @@
 #include "simt_api/asc_simt.h"
 #include "kernel_tiling/kernel_tiling.h"
 #include "impl/dav_c220/kernel_operator_reg_others_impl.h"
+#include "../../../ctc_loss_v2/op_kernel/arch35/ctc_loss_v2_lattice.h"
 
 namespace CTCLossV2GradNS {
 using namespace AscendC;
+using CTCLossV2::IsOutOfBand;
+using CTCLossV2::LogSumExp3;
 
 constexpr int32_t THREAD_NUM_1024 = 1024;
 constexpr int32_t THREAD_NUM_512 = 512;
@@ -30,6 +33,8 @@ constexpr int32_t INT_SIZE_32 = 4;
 constexpr int32_t INT_SIZE_64 = 8;
 constexpr int32_t ONE = 1;
 constexpr int32_t ALIGN_SIZE = 32;
+// 检查点模式下 logBeta 只保留 t + 1 与 t 两行
+constexpr int32_t BETA_ROW_NUM = 2;
 
 template <typename T, typename DataType, typename ThreadType>
 class CTCLossV2Grad {
@@ -44,6 +49,10 @@ public:
 
 private:
     __aicore__ inline void InitGlobalGm();
+    template <int32_t THREAD_NUM>
+    __aicore__ inline void LogBetaLcabStage();
+    template <int32_t THREAD_NUM>
+    __aicore__ inline void CheckpointLcabStage();
 
 private:
     // tiling data
@@ -64,10 +73,12 @@ private:
     GlobalTensor<T> logAlphaGm;
     // 输出参数grad
     GlobalTensor<T> gradGm;
-    // 中间计算参数logBeta，大小为（N, T, S）
+    // 中间计算参数logBeta，大小为（N, T, S），检查点模式下为（N, 2, S）
     GlobalTensor<float> logBetaGm;
     // 保存临时的计算结果，否则会有精度损失
     GlobalTensor<float> tempGradGm;
+    // 检查点模式下从检查点重算的一段 alpha，再原地累加 beta 得到 alpha + beta，大小为（N, checkpointStride, S）
+    GlobalTensor<float> alphaSegGm;
 
     int32_t blockInx;
 }; // CTCLossV2Grad
@@ -125,10 +136,15 @@ __aicore__ inline void CTCLossV2Grad<T, DataType, ThreadType>::Init(GM_ADDR grad
     ThreadType maxInputLength = tilingData_->maxInputLength;
     ThreadType alphaLength = tilingData_->alphaLength;
     ThreadType symbolSet = tilingData_->symbolSet;
-    logBetaGm.SetGlobalBuffer((__gm__ float*)(workspace), batchSize * maxInputLength * alphaLength);
+    ThreadType checkpointStride = tilingData_->checkpointStride;
+    ThreadType logBetaSize = batchSize * (checkpointStride > 0 ? BETA_ROW_NUM : maxInputLength) * alphaLength;
+    logBetaGm.SetGlobalBuffer((__gm__ float*)(workspace), logBetaSize);
     // 为了保证精度，申请临时空间
-    tempGradGm.SetGlobalBuffer((__gm__ float*)(workspace) + batchSize * maxInputLength * alphaLength,
-                               batchSize * maxInputLength * symbolSet);
+    tempGradGm.SetGlobalBuffer((__gm__ float*)(workspace) + logBetaSize, batchSize * maxInputLength * symbolSet);
+    if (checkpointStride > 0) {
+        alphaSegGm.SetGlobalBuffer((__gm__ float*)(workspace) + logBetaSize + batchSize * maxInputLength * symbolSet,
+                                   batchSize * checkpointStride * alphaLength);
+    }
     blockInx = GetBlockIdx();
     InitGlobalGm();
     SyncAll();
@@ -249,8 +265,13 @@ __simt_vf__ LAUNCH_BOUND(THREAD_NUM) __aicore__
                                                      logProbsGm[batchOffset + inputBatchOffset + currentTargetPrime]);
             }
         }
-        for (ThreadType s = 0; s < alphaLength; s++) {
-            if (s < 2 * targetLength + 1 && t != inputLength - 1) {
+        // alpha(t, s) 在 s > 2t + 1 时为 -inf，beta(t, s) 在 s < 2L - 1 - 2 * (inputLength - 1 - t) 时为 -inf，
+        // 带外 alpha + beta 为 -inf，不改变 lcab，只遍历带内的 s
+        ThreadType sBegin = 2 * targetLength - 1 - 2 * (inputLength - 1 - t);
+        sBegin = sBegin > 0 ? sBegin : 0;
+        ThreadType sEnd = (2 * t + 2 < 2 * targetLength + 1) ? (2 * t + 2) : (2 * targetLength + 1);
+        for (ThreadType s = sBegin; s < sEnd; s++) {
+            if (t != inputLength - 1) {
                 currentTargetPrime = GetTargetPrime<T, DataType, ThreadType>(targetsGm, targetBatchOffset,
                                                                              static_cast<ThreadType>(1), s, blank);
                 float logAlphaBetaSum = static_cast<float>(logAlphaGm[logAlphaBatchOffset + logAlphaInputOffset + s]) +
@@ -271,6 +292,54 @@ __simt_vf__ LAUNCH_BOUND(THREAD_NUM) __aicore__
     }
 }
 
+// 检查点模式：alphaBetaSegGm 中已是 [tBegin, tBegin + segLength) 帧的 alpha + beta，按 s 累加到对应字符的 lcab。
+// 末帧 beta 只在 2L 与 2L - 1 处为 log_probs，其余为 -inf，与非检查点模式末帧直接取 alpha + log_probs 等价
+template <typename T, typename DataType, typename ThreadType, int32_t THREAD_NUM>
+__simt_vf__ LAUNCH_BOUND(THREAD_NUM) __aicore__
+    void UpdateLcabSegCompute(__gm__ DataType* targetsGm, __gm__ DataType* inputLengthsGm,
+                              __gm__ DataType* targetLengthsGm, __gm__ T* negLogLikelihoodGm,
+                              __gm__ volatile float* tempGradGm, __gm__ volatile float* alphaBetaSegGm,
+                              ThreadType batchSize, ThreadType symbolSet, ThreadType zeroInfinity, ThreadType blank,
+                              ThreadType alphaLength, ThreadType targetsDimNum, ThreadType sDimRange, ThreadType tBegin,
+                              ThreadType segLength)
+{
+    constexpr float neginf = -INFINITY;
+    ThreadType thread_idx = threadIdx.x;
+    ThreadType blockDimX = blockDim.x;
+    ThreadType length = segLength * batchSize;
+    for (ThreadType index = thread_idx + block_idx * blockDimX; index < length; index += block_num * blockDimX) {
+        ThreadType b = index / segLength;
+        ThreadType t = tBegin + index % segLength;
+        ThreadType inputLength = inputLengthsGm[b];
+        float nll = negLogLikelihoodGm[b];
+        if (t >= inputLength || (zeroInfinity && nll == INFINITY)) {
+            continue;
+        }
+        ThreadType targetLength = targetLengthsGm[b];
+        ThreadType lcabOffset = t * symbolSet * batchSize + b * symbolSet;
+        ThreadType segOffset = b * segLength * alphaLength + (t - tBegin) * alphaLength;
+        ThreadType targetBatchOffset = ProcessTgBatchOffsets<T, DataType, ThreadType>(b, targetLengthsGm, targetsDimNum,
+                                                                                      sDimRange);
+        ThreadType sBegin = 2 * targetLength - 1 - 2 * (inputLength - 1 - t);
+        sBegin = sBegin > 0 ? sBegin : 0;
+        ThreadType sEnd = (2 * t + 2 < 2 * targetLength + 1) ? (2 * t + 2) : (2 * targetLength + 1);
+        for (ThreadType s = sBegin; s < sEnd; s++) {
+            ThreadType currentTargetPrime = GetTargetPrime<T, DataType, ThreadType>(
+                targetsGm, targetBatchOffset, static_cast<ThreadType>(1), s, blank);
+            float logAlphaBetaSum = alphaBetaSegGm[segOffset + s];
+            float lcab = tempGradGm[lcabOffset + currentTargetPrime];
+            if (lcab == neginf) {
+                tempGradGm[lcabOffset + currentTargetPrime] = logAlphaBetaSum;
+            } else {
+                float max = lcab > logAlphaBetaSum ? lcab : logAlphaBetaSum;
+                tempGradGm[lcabOffset + currentTargetPrime] = __logf(__expf(lcab - max) +
+                                                                     __expf(logAlphaBetaSum - max)) +
+                                                              max;
+            }
+        }
+    }
+}
+
 template <typename T, typename DataType, typename ThreadType, int32_t THREAD_NUM>
 __simt_vf__ LAUNCH_BOUND(THREAD_NUM) __aicore__
     void LogBetaCompute(__gm__ T* gradOutGm, __gm__ T* logProbsGm, __gm__ DataType* targetsGm,
@@ -278,7 +347,7 @@ __simt_vf__ LAUNCH_BOUND(THREAD_NUM) __aicore__
                         __gm__ T* logAlphaGm, __gm__ T* gradGm, __gm__ float* logBetaGm, __gm__ float* tempGradGm,
                         ThreadType maxInputLength, ThreadType batchSize, ThreadType symbolSet, ThreadType zeroInfinity,
                         ThreadType blank, ThreadType logAlphaT, ThreadType alphaLength, ThreadType targetsDimNum,
-                        ThreadType sDimRange)
+                        ThreadType sDimRange, ThreadType latticeBand)
 {
     constexpr float neginf = -INFINITY;
     ThreadType threadIdy = threadIdx.y;
@@ -293,7 +362,7 @@ __simt_vf__ LAUNCH_BOUND(THREAD_NUM) __aicore__
         }
         ThreadType targetLength = targetLengthsGm[b];
         ThreadType logProbsBatchOffset = b * symbolSet;
-        ThreadType logBetaBatchOffset = b * logAlphaT * alphaLength;
+        ThreadType logBetaBatchOffset = b * maxInputLength * alphaLength;
         ThreadType targetBatchOffset = ProcessTgBatchOffsets<T, DataType, ThreadType>(b, targetLengthsGm, targetsDimNum,
                                                                                       sDimRange);
         for (ThreadType block_s = alphaLength - 1 - ((alphaLength - 1) % blockDimx); block_s >= 0;
@@ -331,7 +400,10 @@ __simt_vf__ LAUNCH_BOUND(THREAD_NUM) __aicore__
             }
             for (ThreadType t = maxInputLength - 2; t >= 0; t--) {
                 asc_syncthreads();
-                if ((t < inputLength - 1) && (s < 2 * targetLength + 1)) {
+                // 剩余帧内无法到达末尾的状态及 lattice_band 外的状态 beta 恒为 -inf（logBeta 已初始化），跳过计算
+                if ((t < inputLength - 1) && (s < 2 * targetLength + 1) &&
+                    (s >= 2 * targetLength - 1 - 2 * (inputLength - 1 - t)) &&
+                    !IsOutOfBand<ThreadType>(s, t, inputLength, targetLength, latticeBand)) {
                     float lb1 = logBetaGm[logBetaBatchOffset + (t + 1) * alphaLength + s];
                     float lbmax = lb1;
                     float lb2, lb3;
@@ -364,33 +436,213 @@ __simt_vf__ LAUNCH_BOUND(THREAD_NUM) __aicore__
     }
 }
 
+// 检查点模式：倒序处理第 segIdx 段的帧，beta 只保留 t + 1 与 t 两行并按 t 的奇偶轮换；
+// 每帧算出的 beta 原地累加到 alphaSegGm，得到该段的 alpha + beta
+template <typename T, typename DataType, typename ThreadType, int32_t THREAD_NUM>
+__simt_vf__ LAUNCH_BOUND(THREAD_NUM) __aicore__
+    void LogBetaSegCompute(__gm__ T* logProbsGm, __gm__ DataType* targetsGm, __gm__ DataType* inputLengthsGm,
+                           __gm__ DataType* targetLengthsGm, __gm__ float* logBetaGm, __gm__ float* alphaSegGm,
+                           ThreadType maxInputLength, ThreadType batchSize, ThreadType symbolSet, ThreadType blank,
+                           ThreadType alphaLength, ThreadType targetsDimNum, ThreadType sDimRange, ThreadType segIdx,
+                           ThreadType checkpointStride, ThreadType latticeBand)
+{
+    constexpr float neginf = -INFINITY;
+    ThreadType threadIdy = threadIdx.y;
+    ThreadType thread_idx = threadIdx.x;
+    ThreadType blockDimx = blockDim.x;
+    ThreadType blockDimy = blockDim.y;
+    ThreadType tBegin = segIdx * checkpointStride;
+    ThreadType tEnd = (tBegin + checkpointStride < maxInputLength) ? (tBegin + checkpointStride) : maxInputLength;
+    for (ThreadType index = threadIdy + block_idx * blockDimy; index < batchSize; index += block_num * blockDimy) {
+        ThreadType b = index;
+        ThreadType inputLength = inputLengthsGm[b];
+        ThreadType targetLength = targetLengthsGm[b];
+        ThreadType logProbsBatchOffset = b * symbolSet;
+        ThreadType logBetaBatchOffset = b * BETA_ROW_NUM * alphaLength;
+        ThreadType segBatchOffset = b * checkpointStride * alphaLength;
+        ThreadType targetBatchOffset = ProcessTgBatchOffsets<T, DataType, ThreadType>(b, targetLengthsGm, targetsDimNum,
+                                                                                      sDimRange);
+        for (ThreadType t = tEnd - 1; t >= tBegin; t--) {
+            asc_syncthreads();
+            if (t >= inputLength) {
+                continue;
+            }
+            ThreadType curRowOffset = logBetaBatchOffset + (t & 1) * alphaLength;
+            ThreadType nextRowOffset = logBetaBatchOffset + ((t + 1) & 1) * alphaLength;
+            ThreadType lpOffset = logProbsBatchOffset + t * batchSize * symbolSet;
+            for (ThreadType block_s = 0; block_s < alphaLength; block_s += blockDimx) {
+                ThreadType s = thread_idx + block_s;
+                if (s >= alphaLength) {
+                    continue;
+                }
+                float lb = neginf;
+                if (t == inputLength - 1) {
+                    if (s == 2 * targetLength) {
+                        lb = logProbsGm[lpOffset + blank];
+                    } else if (s == 2 * targetLength - 1) {
+                        lb = logProbsGm[lpOffset + GetTargetPrime<T, DataType, ThreadType>(
+                                                       targetsGm, targetBatchOffset, static_cast<ThreadType>(1), s,
+                                                       blank)];
+                    }
+                } else if ((s < 2 * targetLength + 1) && (s >= 2 * targetLength - 1 - 2 * (inputLength - 1 - t)) &&
+                           !IsOutOfBand<ThreadType>(s, t, inputLength, targetLength, latticeBand)) {
+                    ThreadType currentTargetPrime = GetTargetPrime<T, DataType, ThreadType>(
+                        targetsGm, targetBatchOffset, static_cast<ThreadType>(1), s, blank);
+                    bool haveThree = (s < 2 * targetLength - 1) &&
+                                     (GetTargetPrime<T, DataType, ThreadType>(targetsGm, targetBatchOffset,
+                                                                              static_cast<ThreadType>(1), s + 2,
+                                                                              blank) != currentTargetPrime);
+                    float lb1 = logBetaGm[nextRowOffset + s];
+                    float lb2 = (s < 2 * targetLength) ? logBetaGm[nextRowOffset + s + 1] : neginf;
+                    float lb3 = haveThree ? logBetaGm[nextRowOffset + s + 2] : neginf;
+                    lb = LogSumExp3(lb1, lb2, lb3) + static_cast<float>(logProbsGm[lpOffset + currentTargetPrime]);
+                }
+                logBetaGm[curRowOffset + s] = lb;
+                alphaSegGm[segBatchOffset + (t - tBegin) * alphaLength + s] += lb;
+            }
+        }
+    }
+}
+
+// 从第 segIdx 个检查点行出发，重算 [segIdx * checkpointStride, (segIdx + 1) * checkpointStride) 帧的 alpha
+template <typename T, typename DataType, typename ThreadType, int32_t THREAD_NUM>
+__simt_vf__ LAUNCH_BOUND(THREAD_NUM) __aicore__
+    void AlphaRecomputeCompute(__gm__ T* logProbsGm, __gm__ DataType* targetsGm, __gm__ DataType* inputLengthsGm,
+                               __gm__ DataType* targetLengthsGm, __gm__ T* logAlphaGm, __gm__ float* alphaSegGm,
+                               ThreadType batchSize, ThreadType symbolSet, ThreadType blank, ThreadType logAlphaT,
+                               ThreadType alphaLength, ThreadType targetsDimNum, ThreadType sDimRange,
+                               ThreadType segIdx, ThreadType checkpointStride, ThreadType latticeBand)
+{
+    constexpr float neginf = -INFINITY;
+    ThreadType threadIdy = threadIdx.y;
+    ThreadType thread_idx = threadIdx.x;
+    ThreadType blockDimx = blockDim.x;
+    ThreadType blockDimy = blockDim.y;
+    ThreadType tBegin = segIdx * checkpointStride;
+    for (ThreadType index = threadIdy + block_idx * blockDimy; index < batchSize; index += block_num * blockDimy) {
+        ThreadType b = index;
+        ThreadType inputLength = inputLengthsGm[b];
+        if (tBegin >= inputLength) {
+            continue;
+        }
+        ThreadType targetLength = targetLengthsGm[b];
+        ThreadType segBatchOffset = b * checkpointStride * alphaLength;
+        ThreadType checkpointOffset = b * logAlphaT * alphaLength + segIdx * alphaLength;
+        ThreadType targetBatchOffset = ProcessTgBatchOffsets<T, DataType, ThreadType>(b, targetLengthsGm, targetsDimNum,
+                                                                                      sDimRange);
+        for (ThreadType block_s = 0; block_s < alphaLength; block_s += blockDimx) {
+            ThreadType s = thread_idx + block_s;
+            if (s < alphaLength) {
+                alphaSegGm[segBatchOffset + s] = static_cast<float>(logAlphaGm[checkpointOffset + s]);
+            }
+        }
+        for (ThreadType block_s = 0; block_s < alphaLength; block_s += blockDimx) {
+            ThreadType s = thread_idx + block_s;
+            ThreadType currentTargetPrime;
+            bool haveThree;
+            if (s < 2 * targetLength + 1 && targetLength > 0) {
+                currentTargetPrime = GetTargetPrime<T, DataType, ThreadType>(targetsGm, targetBatchOffset,
+                                                                             static_cast<ThreadType>(1), s, blank);
+                haveThree = ((s > 1) && (GetTargetPrime<T, DataType, ThreadType>(targetsGm, targetBatchOffset,
+                                                                                 static_cast<ThreadType>(1), s - 2,
+                                                                                 blank) != currentTargetPrime));
+            } else {
+                currentTargetPrime = blank;
+                haveThree = false;
+            }
+            for (ThreadType t = tBegin + 1; t < tBegin + checkpointStride; t++) {
+                asc_syncthreads();
+                if ((t < inputLength) && (s < 2 * targetLength + 1)) {
+                    ThreadType rowOffset = segBatchOffset + (t - tBegin) * alphaLength;
+                    // 与正向一致，不可达及 lattice_band 外的状态为 -inf
+                    if (s > 2 * t + 1 || IsOutOfBand<ThreadType>(s, t, inputLength, targetLength, latticeBand)) {
+                        alphaSegGm[rowOffset + s] = neginf;
+                        continue;
+                    }
+                    float la1 = alphaSegGm[rowOffset - alphaLength + s];
+                    float la2 = (s > 0) ? alphaSegGm[rowOffset - alphaLength + s - 1] : neginf;
+                    float la3 = haveThree ? alphaSegGm[rowOffset - alphaLength + s - 2] : neginf;
+                    // 与正向 alpha 递推使用同一 log-sum-exp
+                    alphaSegGm[rowOffset + s] = LogSumExp3(la1, la2, la3) +
+                                                static_cast<float>(logProbsGm[b * symbolSet +
+                                                                              t * batchSize * symbolSet +
+                                                                              currentTargetPrime]);
+                }
+            }
+        }
+    }
+}
+
 template <typename T, typename DataType, typename ThreadType>
-__aicore__ inline void CTCLossV2Grad<T, DataType, ThreadType>::Process()
+template <int32_t THREAD_NUM>
+__aicore__ inline void CTCLossV2Grad<T, DataType, ThreadType>::LogBetaLcabStage()
 {
-    ThreadType blockDimX = tilingData_->blockDimX;
-    ThreadType blockDimY = tilingData_->blockDimY;
-    if constexpr (sizeof(ThreadType) == INT_SIZE_32) {
-        asc_vf_call<LogBetaCompute<T, DataType, ThreadType, THREAD_NUM_1024>>(
-            dim3(blockDimX, blockDimY), (__gm__ T*)(gradOutGm.GetPhyAddr()), (__gm__ T*)(logProbsGm.GetPhyAddr()),
+    if (tilingData_->checkpointStride > 0) {
+        CheckpointLcabStage<THREAD_NUM>();
+        return;
+    }
+    asc_vf_call<LogBetaCompute<T, DataType, ThreadType, THREAD_NUM>>(
+        dim3(tilingData_->blockDimX, tilingData_->blockDimY), (__gm__ T*)(gradOutGm.GetPhyAddr()),
+        (__gm__ T*)(logProbsGm.GetPhyAddr()), (__gm__ DataType*)(targetsGm.GetPhyAddr()),
+        (__gm__ DataType*)(inputLengthsGm.GetPhyAddr()), (__gm__ DataType*)(targetLengthsGm.GetPhyAddr()),
+        (__gm__ T*)(negLogLikelihoodGm.GetPhyAddr()), (__gm__ T*)(logAlphaGm.GetPhyAddr()),
+        (__gm__ T*)(gradGm.GetPhyAddr()), (__gm__ float*)(logBetaGm.GetPhyAddr()),
+        (__gm__ float*)(tempGradGm.GetPhyAddr()), tilingData_->maxInputLength, tilingData_->batchSize,
+        tilingData_->symbolSet, tilingData_->zeroInfinity, tilingData_->BLANK, tilingData_->logAlphaT,
+        tilingData_->alphaLength, tilingData_->targetsDimNum, tilingData_->sDimRange, tilingData_->latticeBand);
+    SyncAll();
+    asc_vf_call<UpdateLcabCompute<T, DataType, ThreadType, THREAD_NUM>>(
+        dim3(tilingData_->updateLcabThreadNum, 1), (__gm__ T*)(gradOutGm.GetPhyAddr()),
+        (__gm__ T*)(logProbsGm.GetPhyAddr()), (__gm__ DataType*)(targetsGm.GetPhyAddr()),
+        (__gm__ DataType*)(inputLengthsGm.GetPhyAddr()), (__gm__ DataType*)(targetLengthsGm.GetPhyAddr()),
+        (__gm__ T*)(negLogLikelihoodGm.GetPhyAddr()), (__gm__ T*)(logAlphaGm.GetPhyAddr()),
+        (__gm__ volatile T*)(gradGm.GetPhyAddr()), (__gm__ volatile float*)(logBetaGm.GetPhyAddr()),
+        (__gm__ volatile float*)(tempGradGm.GetPhyAddr()), tilingData_->maxInputLength, tilingData_->batchSize,
+        tilingData_->symbolSet, tilingData_->zeroInfinity, tilingData_->BLANK, tilingData_->logAlphaT,
+        tilingData_->alphaLength, tilingData_->targetsDimNum, tilingData_->sDimRange);
+    SyncAll();
+}
+
+template <typename T, typename DataType, typename ThreadType>
+template <int32_t THREAD_NUM>
+__aicore__ inline void CTCLossV2Grad<T, DataType, ThreadType>::CheckpointLcabStage()
+{
+    // log_alpha 只保存检查点行，从最后一段倒序逐段处理：先重算该段 alpha，再沿 t 倒推两行 beta 并累加到该段，
+    // 最后把该段的 alpha + beta 累加到 lcab。中间结果只占 [N, 2, S] 的 beta 与 [N, checkpointStride, S] 的段缓存
+    ThreadType checkpointStride = tilingData_->checkpointStride;
+    for (ThreadType segIdx = tilingData_->logAlphaT - 1; segIdx >= 0; segIdx--) {
+        asc_vf_call<AlphaRecomputeCompute<T, DataType, ThreadType, THREAD_NUM>>(
+            dim3(tilingData_->blockDimX, tilingData_->blockDimY), (__gm__ T*)(logProbsGm.GetPhyAddr()),
             (__gm__ DataType*)(targetsGm.GetPhyAddr()), (__gm__ DataType*)(inputLengthsGm.GetPhyAddr()),
-            (__gm__ DataType*)(targetLengthsGm.GetPhyAddr()), (__gm__ T*)(negLogLikelihoodGm.GetPhyAddr()),
-            (__gm__ T*)(logAlphaGm.GetPhyAddr()), (__gm__ T*)(gradGm.GetPhyAddr()),
-            (__gm__ float*)(logBetaGm.GetPhyAddr()), (__gm__ float*)(tempGradGm.GetPhyAddr()),
-            tilingData_->maxInputLength, tilingData_->batchSize, tilingData_->symbolSet, tilingData_->zeroInfinity,
+            (__gm__ DataType*)(targetLengthsGm.GetPhyAddr()), (__gm__ T*)(logAlphaGm.GetPhyAddr()),
+            (__gm__ float*)(alphaSegGm.GetPhyAddr()), tilingData_->batchSize, tilingData_->symbolSet,
             tilingData_->BLANK, tilingData_->logAlphaT, tilingData_->alphaLength, tilingData_->targetsDimNum,
-            tilingData_->sDimRange);
-
+            tilingData_->sDimRange, segIdx, checkpointStride, tilingData_->latticeBand);
         SyncAll();
-        asc_vf_call<UpdateLcabCompute<T, DataType, ThreadType, THREAD_NUM_1024>>(
-            dim3(tilingData_->updateLcabThreadNum, 1), (__gm__ T*)(gradOutGm.GetPhyAddr()),
-            (__gm__ T*)(logProbsGm.GetPhyAddr()), (__gm__ DataType*)(targetsGm.GetPhyAddr()),
+        asc_vf_call<LogBetaSegCompute<T, DataType, ThreadType, THREAD_NUM>>(
+            dim3(tilingData_->blockDimX, tilingData_->blockDimY), (__gm__ T*)(logProbsGm.GetPhyAddr()),
+            (__gm__ DataType*)(targetsGm.GetPhyAddr()), (__gm__ DataType*)(inputLengthsGm.GetPhyAddr()),
+            (__gm__ DataType*)(targetLengthsGm.GetPhyAddr()), (__gm__ float*)(logBetaGm.GetPhyAddr()),
+            (__gm__ float*)(alphaSegGm.GetPhyAddr()), tilingData_->maxInputLength, tilingData_->batchSize,
+            tilingData_->symbolSet, tilingData_->BLANK, tilingData_->alphaLength, tilingData_->targetsDimNum,
+            tilingData_->sDimRange, segIdx, checkpointStride, tilingData_->latticeBand);
+        SyncAll();
+        asc_vf_call<UpdateLcabSegCompute<T, DataType, ThreadType, THREAD_NUM>>(
+            dim3(tilingData_->updateLcabThreadNum, 1), (__gm__ DataType*)(targetsGm.GetPhyAddr()),
             (__gm__ DataType*)(inputLengthsGm.GetPhyAddr()), (__gm__ DataType*)(targetLengthsGm.GetPhyAddr()),
-            (__gm__ T*)(negLogLikelihoodGm.GetPhyAddr()), (__gm__ T*)(logAlphaGm.GetPhyAddr()),
-            (__gm__ volatile T*)(gradGm.GetPhyAddr()), (__gm__ volatile float*)(logBetaGm.GetPhyAddr()),
-            (__gm__ volatile float*)(tempGradGm.GetPhyAddr()), tilingData_->maxInputLength, tilingData_->batchSize,
-            tilingData_->symbolSet, tilingData_->zeroInfinity, tilingData_->BLANK, tilingData_->logAlphaT,
-            tilingData_->alphaLength, tilingData_->targetsDimNum, tilingData_->sDimRange);
+            (__gm__ T*)(negLogLikelihoodGm.GetPhyAddr()), (__gm__ volatile float*)(tempGradGm.GetPhyAddr()),
+            (__gm__ volatile float*)(alphaSegGm.GetPhyAddr()), tilingData_->batchSize, tilingData_->symbolSet,
+            tilingData_->zeroInfinity, tilingData_->BLANK, tilingData_->alphaLength, tilingData_->targetsDimNum,
+            tilingData_->sDimRange, segIdx * checkpointStride, checkpointStride);
         SyncAll();
+    }
+}
+
+template <typename T, typename DataType, typename ThreadType>
+__aicore__ inline void CTCLossV2Grad<T, DataType, ThreadType>::Process()
+{
+    if constexpr (sizeof(ThreadType) == INT_SIZE_32) {
+        LogBetaLcabStage<THREAD_NUM_1024>();
         asc_vf_call<CalGradCompute<T, DataType, ThreadType, THREAD_NUM_1024>>(
             dim3(tilingData_->calGradThreadNum, 1), (__gm__ T*)(gradOutGm.GetPhyAddr()),
             (__gm__ T*)(logProbsGm.GetPhyAddr()), (__gm__ DataType*)(targetsGm.GetPhyAddr()),
@@ -402,27 +654,7 @@ __aicore__ inline void CTCLossV2Grad<T, DataType, ThreadType>::Process()
     }
 
     if constexpr (sizeof(ThreadType) == INT_SIZE_64) {
-        asc_vf_call<LogBetaCompute<T, DataType, ThreadType, THREAD_NUM_512>>(
-            dim3(blockDimX, blockDimY), (__gm__ T*)(gradOutGm.GetPhyAddr()), (__gm__ T*)(logProbsGm.GetPhyAddr()),
-            (__gm__ DataType*)(targetsGm.GetPhyAddr()), (__gm__ DataType*)(inputLengthsGm.GetPhyAddr()),
-            (__gm__ DataType*)(targetLengthsGm.GetPhyAddr()), (__gm__ T*)(negLogLikelihoodGm.GetPhyAddr()),
-            (__gm__ T*)(logAlphaGm.GetPhyAddr()), (__gm__ T*)(gradGm.GetPhyAddr()),
-            (__gm__ float*)(logBetaGm.GetPhyAddr()), (__gm__ float*)(tempGradGm.GetPhyAddr()),
-            tilingData_->maxInputLength, tilingData_->batchSize, tilingData_->symbolSet, tilingData_->zeroInfinity,
-            tilingData_->BLANK, tilingData_->logAlphaT, tilingData_->alphaLength, tilingData_->targetsDimNum,
-            tilingData_->sDimRange);
-
-        SyncAll();
-        asc_vf_call<UpdateLcabCompute<T, DataType, ThreadType, THREAD_NUM_512>>(
-            dim3(tilingData_->updateLcabThreadNum, 1), (__gm__ T*)(gradOutGm.GetPhyAddr()),
-            (__gm__ T*)(logProbsGm.GetPhyAddr()), (__gm__ DataType*)(targetsGm.GetPhyAddr()),
-            (__gm__ DataType*)(inputLengthsGm.GetPhyAddr()), (__gm__ DataType*)(targetLengthsGm.GetPhyAddr()),
-            (__gm__ T*)(negLogLikelihoodGm.GetPhyAddr()), (__gm__ T*)(logAlphaGm.GetPhyAddr()),
-            (__gm__ volatile T*)(gradGm.GetPhyAddr()), (__gm__ volatile float*)(logBetaGm.GetPhyAddr()),
-            (__gm__ volatile float*)(tempGradGm.GetPhyAddr()), tilingData_->maxInputLength, tilingData_->batchSize,
-            tilingData_->symbolSet, tilingData_->zeroInfinity, tilingData_->BLANK, tilingData_->logAlphaT,
-            tilingData_->alphaLength, tilingData_->targetsDimNum, tilingData_->sDimRange);
-        SyncAll();
+        LogBetaLcabStage<THREAD_NUM_512>();
         asc_vf_call<CalGradCompute<T, DataType, ThreadType, THREAD_NUM_512>>(
             dim3(tilingData_->calGradThreadNum, 1), (__gm__ T*)(gradOutGm.GetPhyAddr()),
             (__gm__ T*)(logProbsGm.GetPhyAddr()), (__gm__ DataType*)(targetsGm.GetPhyAddr()),
@@ -87,11 +87,11 @@ bool BatchMatMulV3BasicStreamKTiling::IsCapable()
         return false;
     }
     if (IsInputNonContiguousTranspose(context_, 0UL) || IsInputNonContiguousTranspose(context_, 1UL)) {
-        OP_LOGD(args_.opName, "Non-contiguous transpose does not support StreamK.");
+        OP_TILING_REJECT(args_.opName, "Non-contiguous transpose does not support StreamK.");
         return false;
     }
     if (compileInfo_.aivNum != (compileInfo_.aicNum * NUM_TWO)) {
-        OP_LOGD(args_.opName, "streamk only support aivNum == aicNum * 2");
+        OP_TILING_REJECT(args_.opName, "streamk only support aivNum == aicNum * 2");
         return false;
     }
     return CheckStreamKSKTiling();
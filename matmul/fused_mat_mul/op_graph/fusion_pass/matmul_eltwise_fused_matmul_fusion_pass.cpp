@@ -0,0 +1,568 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file matmul_eltwise_fused_matmul_fusion_pass.cpp
+ * \brief matmul eltwise fusion pass (MatMulV3/BatchMatMulV3 + Relu/Gelu/GeluV2/Add/Mul --> FusedMatMul)
+ *
+ * 融合规则：MatMulV3/BatchMatMulV3 的输出仅被一个 elementwise 算子消费时，将 elementwise 作为后处理融入
+ *           FusedMatMul，fused_op_type 取值如下：
+ *             Relu               -> relu
+ *             Gelu               -> gelu_tanh
+ *             GeluV2(none/tanh)  -> gelu_erf/gelu_tanh
+ *             Add/Mul            -> add/mul（另一输入作为 x3）
+ *
+ *     x1   x2                      x1   x2  (bias)  (x3)
+ *      \  /                          \  |   |     /
+ *    MatMulV3   (x3)                  FusedMatMul
+ *         \    /                          |
+ *        Eltwise        ====>             |
+ *           |                             |
+ *         output                        output
+ *
+ * 约束（与 FusedMatMul infershape/tiling 保持一致）：
+ *   1. gelu 不支持 bias；fp32 输入仅在使能 hf32 时融合；
+ *   2. add/mul 时 x3 与 x1 同 dtype、ND 格式，x3 维度为 2 或 3，后两维必须等于 (M, N)，3 维时 batch 为 1 或等于
+ *      输出 batch，且 elementwise 输出 shape 必须等于 matmul 输出 shape（即只允许 x3 向 matmul 输出广播）；
+ *   3. relu 以外的后处理要求 x1/x2 维度相同、不超过 3 维且 batch 不广播。
+ */
+
+#include "matmul_eltwise_fused_matmul_fusion_pass.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "common/inc/error_util.h"
+#include "common/op_graph/fusion_pass/matmul_fusion_utils_pass.h"
+#include "ge/compliant_node_builder.h"
+#include "version/ge-compiler_version.h"
+#include "acl/acl_rt.h"
+
+using namespace ge;
+using namespace fe;
+
+namespace ops {
+namespace {
+
+constexpr char kPassName[] = "MatMulEltwiseFusedMatMulFusionPass";
+constexpr char kOpTypeMatMulV3[] = "MatMulV3";
+constexpr char kOpTypeBatchMatMulV3[] = "BatchMatMulV3";
+constexpr char kOpTypeFusedMatMul[] = "FusedMatMul";
+constexpr char kOpTypeRelu[] = "Relu";
+constexpr char kOpTypeGelu[] = "Gelu";
+constexpr char kOpTypeGeluV2[] = "GeluV2";
+constexpr char kOpTypeAdd[] = "Add";
+constexpr char kOpTypeMul[] = "Mul";
+constexpr char kAttrApproximate[] = "approximate";
+constexpr char kAttrOpImplMode[] = "opImplMode";
+constexpr char kAttrEnableHf32[] = "enable_hf32";
+constexpr char kAttrFusedOpType[] = "fused_op_type";
+constexpr char kAttrInnerPrecise[] = "inner_precise";
+constexpr char kFusedOpRelu[] = "relu";
+constexpr char kFusedOpGeluErf[] = "gelu_erf";
+constexpr char kFusedOpGeluTanh[] = "gelu_tanh";
+constexpr char kFusedOpAdd[] = "add";
+constexpr char kFusedOpMul[] = "mul";
+constexpr int64_t kOpImplModeHf32 = 0x40;
+constexpr int32_t kX3InputIdx = 3;
+constexpr size_t kMinDim = 2;
+constexpr size_t kX3MaxDim = 3;
+constexpr size_t kNoBroadcastMaxDim = 3;
+constexpr size_t kReluMaxDim = 6;
+
+struct EltwiseFusionInfo {
+    GNode matmulNode;
+    GNode eltwiseNode;
+    GNodePtr x3SrcNode = nullptr;
+    int32_t x3SrcPort = 0;
+    int32_t matmulPortOnEltwise = 0;
+    int32_t x3PortOnEltwise = 1;
+    bool isBatch = false;
+    bool hasBias = false;
+    bool enableHf32 = false;
+    std::string fusedOpType;
+};
+
+bool IsTargetVersion()
+{
+    int32_t version = 0;
+    if (aclsysGetVersionNum("ge-compiler", &version) != ACL_SUCCESS) {
+        OPS_LOG_W(kPassName, "Failed to get ge-compiler version, skip fusion.");
+        return false;
+    }
+    return version >= kTargetGeCompilerVersion;
+}
+
+bool IsType(const GNodePtr& nodePtr, const char* type)
+{
+    if (nodePtr == nullptr) {
+        return false;
+    }
+    AscendString opType;
+    return nodePtr->GetType(opType) == GRAPH_SUCCESS && opType == type;
+}
+
+bool IsMatMulV3Type(const GNodePtr& nodePtr)
+{
+    return IsType(nodePtr, kOpTypeMatMulV3) || IsType(nodePtr, kOpTypeBatchMatMulV3);
+}
+
+bool IsBinaryEltwise(const std::string& fusedOpType)
+{
+    return fusedOpType == kFusedOpAdd || fusedOpType == kFusedOpMul;
+}
+
+bool IsGelu(const std::string& fusedOpType)
+{
+    return fusedOpType == kFusedOpGeluErf || fusedOpType == kFusedOpGeluTanh;
+}
+
+bool GetFusedOpType(const GNode& eltwiseNode, std::string& fusedOpType)
+{
+    AscendString opType;
+    if (eltwiseNode.GetType(opType) != GRAPH_SUCCESS) {
+        return false;
+    }
+    if (opType == kOpTypeRelu) {
+        fusedOpType = kFusedOpRelu;
+    } else if (opType == kOpTypeGelu) {
+        // Gelu 算子按 tanh 近似实现
+        fusedOpType = kFusedOpGeluTanh;
+    } else if (opType == kOpTypeGeluV2) {
+        AscendString approximate("none");
+        (void)eltwiseNode.GetAttr(kAttrApproximate, approximate);
+        if (approximate == "none") {
+            fusedOpType = kFusedOpGeluErf;
+        } else if (approximate == "tanh") {
+            fusedOpType = kFusedOpGeluTanh;
+        } else {
+            return false;
+        }
+    } else if (opType == kOpTypeAdd) {
+        fusedOpType = kFusedOpAdd;
+    } else if (opType == kOpTypeMul) {
+        fusedOpType = kFusedOpMul;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+bool HasConnectedInput(const GNode& node, int32_t idx)
+{
+    if (node.GetInputsSize() <= static_cast<size_t>(idx)) {
+        return false;
+    }
+    return node.GetInDataNodesAndPortIndexs(idx).first != nullptr;
+}
+
+bool IsPlatformSupported()
+{
+    PlatformInfo platformInfo;
+    OptionalInfo optionalInfo;
+    FUSION_PASS_CHECK(
+        PlatformInfoManager::Instance().GetPlatformInfoWithOutSocVersion(platformInfo, optionalInfo) != SUCCESS,
+        OPS_LOG_D(kPassName, "Can't get platformInfo."), return false);
+    // FusedMatMul 仅在 Ascend950 系列上提供实现，与 MatMulToMatMulV3 使用相同的平台判定
+    return IsSupportL12BtBf16(platformInfo);
+}
+
+bool GetEnableHf32(const GNode& matmulNode, bool isBatch)
+{
+    if (isBatch) {
+        bool enableHf32 = false;
+        return matmulNode.GetAttr(kAttrEnableHf32, enableHf32) == GRAPH_SUCCESS && enableHf32;
+    }
+    int64_t opImplMode = 0;
+    if (matmulNode.GetAttr(kAttrOpImplMode, opImplMode) != GRAPH_SUCCESS) {
+        return false;
+    }
+    return (opImplMode & kOpImplModeHf32) != 0;
+}
+
+bool HasUnknownDim(const std::vector<int64_t>& dims)
+{
+    for (auto dim : dims) {
+        if (dim < 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool CheckMatMulInputs(const EltwiseFusionInfo& info)
+{
+    TensorDesc x1Desc;
+    TensorDesc x2Desc;
+    TensorDesc outDesc;
+    FUSION_PASS_CHECK(info.matmulNode.GetInputDesc(0, x1Desc) != GRAPH_SUCCESS ||
+                          info.matmulNode.GetInputDesc(1, x2Desc) != GRAPH_SUCCESS ||
+                          info.matmulNode.GetOutputDesc(0, outDesc) != GRAPH_SUCCESS,
+                      OPS_LOG_W(kPassName, "Get matmul tensor desc failed."), return false);
+
+    DataType dtype = x1Desc.GetDataType();
+    if (dtype != DT_FLOAT16 && dtype != DT_BF16 && dtype != DT_FLOAT) {
+        OPS_LOG_D(kPassName, "x1 dtype %d is not supported.", static_cast<int32_t>(dtype));
+        return false;
+    }
+    if (x2Desc.GetDataType() != dtype || outDesc.GetDataType() != dtype) {
+        OPS_LOG_D(kPassName, "FusedMatMul requires x1/x2/y to have the same dtype.");
+        return false;
+    }
+    if (dtype == DT_FLOAT && (IsGelu(info.fusedOpType) || !info.enableHf32)) {
+        OPS_LOG_D(kPassName, "fp32 input requires hf32 and is not supported by %s.", info.fusedOpType.c_str());
+        return false;
+    }
+    if (IsGelu(info.fusedOpType) && info.hasBias) {
+        OPS_LOG_D(kPassName, "%s does not support bias, skip fusion.", info.fusedOpType.c_str());
+        return false;
+    }
+
+    auto x1Dims = x1Desc.GetShape().GetDims();
+    auto x2Dims = x2Desc.GetShape().GetDims();
+    if (x1Dims.size() < kMinDim || x2Dims.size() < kMinDim) {
+        OPS_LOG_D(kPassName, "matmul input dim num[%zu] [%zu] is illegal.", x1Dims.size(), x2Dims.size());
+        return false;
+    }
+    if (info.fusedOpType == kFusedOpRelu) {
+        return x1Dims.size() <= kReluMaxDim && x2Dims.size() <= kReluMaxDim;
+    }
+    // 非 relu 后处理不支持 batch 广播
+    if (x1Dims.size() != x2Dims.size() || x1Dims.size() > kNoBroadcastMaxDim) {
+        OPS_LOG_D(kPassName, "%s requires same dim num not greater than 3, actual [%zu] [%zu].",
+                  info.fusedOpType.c_str(), x1Dims.size(), x2Dims.size());
+        return false;
+    }
+    for (size_t i = 0; i + kMinDim < x1Dims.size(); ++i) {
+        if (x1Dims[i] != x2Dims[i]) {
+            OPS_LOG_D(kPassName, "%s does not support batch broadcast, skip fusion.", info.fusedOpType.c_str());
+            return false;
+        }
+    }
+    return true;
+}
+
+// x3 只允许向 matmul 输出广播：后两维等于 (M, N)，3 维时 batch 为 1 或等于输出 batch
+bool CheckX3Broadcast(const EltwiseFusionInfo& info)
+{
+    TensorDesc x1Desc;
+    TensorDesc mmOutDesc;
+    TensorDesc x3Desc;
+    TensorDesc eltwiseOutDesc;
+    FUSION_PASS_CHECK(info.matmulNode.GetInputDesc(0, x1Desc) != GRAPH_SUCCESS ||
+                          info.matmulNode.GetOutputDesc(0, mmOutDesc) != GRAPH_SUCCESS ||
+                          info.eltwiseNode.GetInputDesc(info.x3PortOnEltwise, x3Desc) != GRAPH_SUCCESS ||
+                          info.eltwiseNode.GetOutputDesc(0, eltwiseOutDesc) != GRAPH_SUCCESS,
+                      OPS_LOG_W(kPassName, "Get eltwise tensor desc failed."), return false);
+
+    if (x3Desc.GetDataType() != x1Desc.GetDataType() || x3Desc.GetFormat() != FORMAT_ND) {
+        OPS_LOG_D(kPassName, "x3 must be ND with the same dtype as x1.");
+        return false;
+    }
+
+    auto outDims = mmOutDesc.GetShape().GetDims();
+    auto x3Dims = x3Desc.GetShape().GetDims();
+    auto eltwiseOutDims = eltwiseOutDesc.GetShape().GetDims();
+    if (HasUnknownDim(outDims) || HasUnknownDim(x3Dims) || HasUnknownDim(eltwiseOutDims)) {
+        OPS_LOG_D(kPassName, "Broadcast of x3 can't be verified with unknown dims, skip fusion.");
+        return false;
+    }
+    if (outDims.size() < kMinDim || eltwiseOutDims != outDims) {
+        OPS_LOG_D(kPassName, "%s output shape differs from matmul output shape, skip fusion.",
+                  info.fusedOpType.c_str());
+        return false;
+    }
+    if (x3Dims.size() < kMinDim || x3Dims.size() > kX3MaxDim) {
+        OPS_LOG_D(kPassName, "x3 dim num[%zu] is illegal.", x3Dims.size());
+        return false;
+    }
+
+    size_t outDimNum = outDims.size();
+    size_t x3DimNum = x3Dims.size();
+    if (x3Dims[x3DimNum - 2] != outDims[outDimNum - 2] || x3Dims[x3DimNum - 1] != outDims[outDimNum - 1]) {
+        OPS_LOG_D(kPassName, "x3 shape [%lld, %lld] is not equal to matmul output [%lld, %lld].",
+                  static_cast<long long>(x3Dims[x3DimNum - 2]), static_cast<long long>(x3Dims[x3DimNum - 1]),
+                  static_cast<long long>(outDims[outDimNum - 2]), static_cast<long long>(outDims[outDimNum - 1]));
+        return false;
+    }
+    if (x3DimNum == kX3MaxDim) {
+        if (outDimNum != kX3MaxDim || (x3Dims[0] != 1 && x3Dims[0] != outDims[0])) {
+            OPS_LOG_D(kPassName, "x3 batch %lld can't be broadcast to matmul output.",
+                      static_cast<long long>(x3Dims[0]));
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ResolveX3Input(EltwiseFusionInfo& info)
+{
+    info.matmulPortOnEltwise = 0;
+    info.x3PortOnEltwise = 1;
+    if (!IsMatMulV3Type(info.eltwiseNode.GetInDataNodesAndPortIndexs(0).first)) {
+        info.matmulPortOnEltwise = 1;
+        info.x3PortOnEltwise = 0;
+    }
+    auto [x3SrcNode, x3SrcPort] = info.eltwiseNode.GetInDataNodesAndPortIndexs(info.x3PortOnEltwise);
+    if (x3SrcNode == nullptr) {
+        OPS_LOG_D(kPassName, "x3 source node is null.");
+        return false;
+    }
+    info.x3SrcNode = x3SrcNode;
+    info.x3SrcPort = x3SrcPort;
+    return true;
+}
+
+Status PrepareFusion(GNode& eltwiseNode, EltwiseFusionInfo& info)
+{
+    info.eltwiseNode = eltwiseNode;
+    if (!GetFusedOpType(eltwiseNode, info.fusedOpType)) {
+        return GRAPH_NOT_CHANGED;
+    }
+    if (IsBinaryEltwise(info.fusedOpType)) {
+        if (!ResolveX3Input(info)) {
+            return GRAPH_NOT_CHANGED;
+        }
+    }
+    auto matmulNodePtr = eltwiseNode.GetInDataNodesAndPortIndexs(info.matmulPortOnEltwise).first;
+    if (!IsMatMulV3Type(matmulNodePtr)) {
+        OPS_LOG_D(kPassName, "Input node is not MatMulV3/BatchMatMulV3, skip fusion.");
+        return GRAPH_NOT_CHANGED;
+    }
+    info.matmulNode = *matmulNodePtr;
+    info.isBatch = IsType(matmulNodePtr, kOpTypeBatchMatMulV3);
+
+    if (info.matmulNode.GetOutDataNodesAndPortIndexs(0).size() != 1) {
+        OPS_LOG_D(kPassName, "MatMul output has more than one consumer, skip fusion.");
+        return GRAPH_NOT_CHANGED;
+    }
+    if (HasConnectedInput(info.matmulNode, static_cast<int32_t>(kOffsetWInputIdx))) {
+        OPS_LOG_D(kPassName, "MatMul with offset_w is not supported, skip fusion.");
+        return GRAPH_NOT_CHANGED;
+    }
+    info.hasBias = HasConnectedInput(info.matmulNode, static_cast<int32_t>(kBiasInputIdx));
+    info.enableHf32 = GetEnableHf32(info.matmulNode, info.isBatch);
+
+    if (!CheckMatMulInputs(info)) {
+        return GRAPH_NOT_CHANGED;
+    }
+    if (IsBinaryEltwise(info.fusedOpType) && !CheckX3Broadcast(info)) {
+        return GRAPH_NOT_CHANGED;
+    }
+    return SUCCESS;
+}
+
+Status LinkFusedMatMulEdges(Graph& rawGraph, const EltwiseFusionInfo& info, GNode& newNode)
+{
+    int32_t inputNum = info.hasBias ? static_cast<int32_t>(kBiasInputIdx) + 1 : static_cast<int32_t>(kBaseNodeNum);
+    TensorDesc desc;
+    for (int32_t idx = 0; idx < inputNum; idx++) {
+        auto [srcPtr, srcPort] = info.matmulNode.GetInDataNodesAndPortIndexs(idx);
+        if (srcPtr == nullptr) {
+            OPS_LOG_E(kPassName, "matmul input %d source node is null, abort fusion.", idx);
+            return GRAPH_FAILED;
+        }
+        ge::es::AddEdgeAndUpdatePeerDesc(rawGraph, *srcPtr, srcPort, newNode, idx);
+        if (info.matmulNode.GetInputDesc(idx, desc) == GRAPH_SUCCESS) {
+            newNode.UpdateInputDesc(idx, desc);
+        }
+    }
+    if (IsBinaryEltwise(info.fusedOpType)) {
+        ge::es::AddEdgeAndUpdatePeerDesc(rawGraph, *info.x3SrcNode, info.x3SrcPort, newNode, kX3InputIdx);
+        if (info.eltwiseNode.GetInputDesc(info.x3PortOnEltwise, desc) == GRAPH_SUCCESS) {
+            newNode.UpdateInputDesc(kX3InputIdx, desc);
+        }
+    }
+    if (info.eltwiseNode.GetOutputDesc(0, desc) == GRAPH_SUCCESS) {
+        newNode.UpdateOutputDesc(0, desc);
+    }
+    return SUCCESS;
+}
+
+Status CreateFusedMatMulNode(const GraphPtr& graph, const EltwiseFusionInfo& info, GNode& newNode)
+{
+    AscendString matmulName;
+    FUSION_PASS_CHECK(info.matmulNode.GetName(matmulName) != GRAPH_SUCCESS,
+                      OPS_LOG_E(kPassName, "Get matmul name failed."), return GRAPH_FAILED);
+
+    auto* rawGraph = graph.get();
+    newNode = ge::es::CompliantNodeBuilder(rawGraph)
+                  .OpType(kOpTypeFusedMatMul)
+                  .Name(matmulName.GetString())
+                  .IrDefInputs({{"x1", ge::es::CompliantNodeBuilder::kEsIrInputRequired, ""},
+                                {"x2", ge::es::CompliantNodeBuilder::kEsIrInputRequired, ""},
+                                {"bias", ge::es::CompliantNodeBuilder::kEsIrInputOptional, ""},
+                                {"x3", ge::es::CompliantNodeBuilder::kEsIrInputOptional, ""}})
+                  .IrDefOutputs({{"y", ge::es::CompliantNodeBuilder::kEsIrOutputRequired, ""}})
+                  .IrDefAttrs({{kAttrTransposeX1, ge::es::CompliantNodeBuilder::kEsAttrOptional, "Bool",
+                                ge::es::CreateFrom(false)},
+                               {kAttrTransposeX2, ge::es::CompliantNodeBuilder::kEsAttrOptional, "Bool",
+                                ge::es::CreateFrom(false)},
+                               {kAttrEnableHf32, ge::es::CompliantNodeBuilder::kEsAttrOptional, "Bool",
+                                ge::es::CreateFrom(false)},
+                               {kAttrFusedOpType, ge::es::CompliantNodeBuilder::kEsAttrOptional, "String",
+                                ge::es::CreateFrom(AscendString(""))},
+                               {kAttrInnerPrecise, ge::es::CompliantNodeBuilder::kEsAttrOptional, "Int",
+                                ge::es::CreateFrom(static_cast<int64_t>(1))}})
+                  .Build();
+
+    FUSION_PASS_CHECK(LinkFusedMatMulEdges(*rawGraph, info, newNode) != SUCCESS,
+                      OPS_LOG_E(kPassName, "Link fused matmul edges failed."), return GRAPH_FAILED);
+
+    const char* transAttr1 = info.isBatch ? kAttrAdjX1 : kAttrTransposeX1;
+    const char* transAttr2 = info.isBatch ? kAttrAdjX2 : kAttrTransposeX2;
+    bool transX1 = false;
+    bool transX2 = false;
+    if (info.matmulNode.GetAttr(transAttr1, transX1) != GRAPH_SUCCESS) {
+        OPS_LOG_D(kPassName, "Get %s attr failed, use default false.", transAttr1);
+        transX1 = false;
+    }
+    if (info.matmulNode.GetAttr(transAttr2, transX2) != GRAPH_SUCCESS) {
+        OPS_LOG_D(kPassName, "Get %s attr failed, use default false.", transAttr2);
+        transX2 = false;
+    }
+    newNode.SetAttr(kAttrTransposeX1, transX1);
+    newNode.SetAttr(kAttrTransposeX2, transX2);
+    newNode.SetAttr(kAttrEnableHf32, info.enableHf32);
+    newNode.SetAttr(kAttrFusedOpType, AscendString(info.fusedOpType.c_str()));
+    CopyOtherAttrs(info.matmulNode, newNode, kPassName);
+
+    OPS_LOG_I(kPassName, "Created FusedMatMul node, name=%s, fused_op_type=%s.", matmulName.GetString(),
+              info.fusedOpType.c_str());
+    return SUCCESS;
+}
+
+void RelinkOutputEdges(const GraphPtr& graph, GNode& eltwiseNode, GNode& newNode)
+{
+    auto outPairs = eltwiseNode.GetOutDataNodesAndPortIndexs(0);
+    for (auto& [dstNodePtr, dstPort] : outPairs) {
+        if (dstNodePtr == nullptr) {
+            OPS_LOG_W(kPassName, "eltwise output dst node is null, skip relink.");
+            continue;
+        }
+        GNode dstNode = *dstNodePtr;
+        graph->RemoveEdge(eltwiseNode, 0, dstNode, dstPort);
+        graph->AddDataEdge(newNode, 0, dstNode, dstPort);
+    }
+}
+
+void TransferCtrlEdges(const GraphPtr& graph, const GNode& oldNode, GNode& newNode)
+{
+    for (auto& srcNodePtr : oldNode.GetInControlNodes()) {
+        if (srcNodePtr == nullptr) {
+            OPS_LOG_W(kPassName, "in control node is null, skip transfer.");
+            continue;
+        }
+        graph->AddControlEdge(*srcNodePtr, newNode);
+    }
+    for (auto& dstNodePtr : oldNode.GetOutControlNodes()) {
+        if (dstNodePtr == nullptr) {
+            OPS_LOG_W(kPassName, "out control node is null, skip transfer.");
+            continue;
+        }
+        graph->AddControlEdge(newNode, *dstNodePtr);
+    }
+}
+
+void RemoveFusedNodes(const GraphPtr& graph, EltwiseFusionInfo& info)
+{
+    graph->RemoveEdge(info.matmulNode, 0, info.eltwiseNode, info.matmulPortOnEltwise);
+    if (info.x3SrcNode != nullptr) {
+        graph->RemoveEdge(*info.x3SrcNode, info.x3SrcPort, info.eltwiseNode, info.x3PortOnEltwise);
+    }
+    graph->RemoveNode(info.eltwiseNode);
+
+    int32_t inputNum = info.hasBias ? static_cast<int32_t>(kBiasInputIdx) + 1 : static_cast<int32_t>(kBaseNodeNum);
+    for (int32_t idx = 0; idx < inputNum; idx++) {
+        auto [srcPtr, srcPort] = info.matmulNode.GetInDataNodesAndPortIndexs(idx);
+        if (srcPtr == nullptr) {
+            OPS_LOG_W(kPassName, "matmul input %d source node is null, skip removing edge.", idx);
+            continue;
+        }
+        graph->RemoveEdge(*srcPtr, srcPort, info.matmulNode, idx);
+    }
+    graph->RemoveNode(info.matmulNode);
+}
+
+Status FuseOneEltwiseNode(const GraphPtr& graph, GNode& eltwiseNode, CustomPassContext& passContext)
+{
+    EltwiseFusionInfo info;
+    auto status = PrepareFusion(eltwiseNode, info);
+    if (status != SUCCESS) {
+        return status;
+    }
+
+    GNode newNode;
+    FUSION_PASS_CHECK(CreateFusedMatMulNode(graph, info, newNode) != SUCCESS,
+                      OPS_LOG_E(kPassName, "Create FusedMatMul node failed."), return GRAPH_FAILED);
+
+    RelinkOutputEdges(graph, info.eltwiseNode, newNode);
+    TransferCtrlEdges(graph, info.matmulNode, newNode);
+    TransferCtrlEdges(graph, info.eltwiseNode, newNode);
+
+    std::vector<GNode> nodesBeforeFuse = {info.matmulNode, info.eltwiseNode};
+    ReportFusion(nodesBeforeFuse, {newNode}, passContext, kPassName);
+
+    RemoveFusedNodes(graph, info);
+    OPS_LOG_I(kPassName, "matmul eltwise fusion success! fused_op_type=%s.", info.fusedOpType.c_str());
+    return SUCCESS;
+}
+
+} // namespace
+
+Status MatMulEltwiseFusedMatMulFusionPass::Run(GraphPtr& graph, CustomPassContext& passContext)
+{
+    OPS_LOG_D(kPassName, "Begin to do MatMulEltwiseFusedMatMulFusionPass Run.");
+    if (graph == nullptr || !graph->IsValid()) {
+        OPS_LOG_W(kPassName, "Graph is null or invalid, skip fusion pass.");
+        return GRAPH_NOT_CHANGED;
+    }
+
+    if (!IsTargetVersion() || !IsPlatformSupported()) {
+        return GRAPH_NOT_CHANGED;
+    }
+
+    passContext.SetPassName(kPassName);
+
+    std::vector<GNode> eltwiseNodes;
+    std::string fusedOpType;
+    for (auto& node : graph->GetDirectNode()) {
+        if (GetFusedOpType(node, fusedOpType)) {
+            eltwiseNodes.emplace_back(node);
+        }
+    }
+    if (eltwiseNodes.empty()) {
+        OPS_LOG_D(kPassName, "No supported eltwise node, skip fusion pass.");
+        return GRAPH_NOT_CHANGED;
+    }
+
+    bool changed = false;
+    for (auto& eltwiseNode : eltwiseNodes) {
+        auto status = FuseOneEltwiseNode(graph, eltwiseNode, passContext);
+        if (status == SUCCESS) {
+            changed = true;
+            continue;
+        }
+        if (status != GRAPH_NOT_CHANGED) {
+            return status;
+        }
+    }
+
+    OPS_LOG_D(kPassName, "Exit MatMulEltwiseFusedMatMulFusionPass.");
+    return changed ? SUCCESS : GRAPH_NOT_CHANGED;
+}
+
+#if GE_COMPILER_VERSION_NUM >= 90100000
+REG_FUSION_PASS(MatMulEltwiseFusedMatMulFusionPass)
+    .Stage(IsTargetVersion() ? CustomPassStage::kCompatibleInherited : CustomPassStage::kAfterInferShape);
+#endif
+
+} // namespace ops
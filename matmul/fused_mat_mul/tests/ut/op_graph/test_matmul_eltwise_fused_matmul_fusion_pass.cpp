@@ -0,0 +1,358 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "ge/compliant_node_builder.h"
+#include "ge/es_graph_builder.h"
+#include "platform/platform_info.h"
+#include "register/register_custom_pass.h"
+#include "../../../op_graph/fusion_pass/matmul_eltwise_fused_matmul_fusion_pass.h"
+
+using namespace ge;
+using namespace ge::es;
+using namespace fe;
+using namespace ops;
+
+namespace {
+
+constexpr char kPassName[] = "MatMulEltwiseFusedMatMulFusionPass";
+
+void SetPlatformInfo950()
+{
+    PlatformInfo platformInfo;
+    OptionalInfo optionalInfo;
+    platformInfo.soc_info.ai_core_cnt = 24;
+    platformInfo.ai_core_spec.l1_size = 512 * 1024;
+    platformInfo.soc_info.l2_size = 192 * 1024 * 1024;
+    optionalInfo.soc_version = "Ascend950";
+    platformInfo.ai_core_intrinsic_dtype_map["Intrinsic_fix_pipe_l0c2out"] = {"float16"};
+    platformInfo.ai_core_intrinsic_dtype_map["Intrinsic_data_move_out2l1_nd2nz"] = {"float16"};
+    platformInfo.ai_core_intrinsic_dtype_map["Intrinsic_data_move_l12bt"] = {"bf16"};
+    platformInfo.str_info.short_soc_version = "Ascend950";
+    PlatformInfoManager::Instance().platform_info_map_["Ascend950"] = platformInfo;
+    PlatformInfoManager::Instance().SetOptionalCompilationInfo(optionalInfo);
+}
+
+TensorDesc MakeTensorDesc(const std::vector<int64_t>& dims, DataType dtype, Format format = FORMAT_ND)
+{
+    TensorDesc desc(Shape(dims), format, dtype);
+    desc.SetOriginFormat(format);
+    desc.SetOriginShape(Shape(dims));
+    return desc;
+}
+
+int CountNodes(const std::shared_ptr<Graph>& graph, const char* nodeType)
+{
+    int count = 0;
+    for (auto node : graph->GetAllNodes()) {
+        AscendString type;
+        node.GetType(type);
+        if (type == nodeType) {
+            count++;
+        }
+    }
+    return count;
+}
+
+bool FindFirstNodeByOpType(const std::shared_ptr<Graph>& graph, const char* opType, GNode& outNode)
+{
+    for (auto node : graph->GetAllNodes()) {
+        AscendString type;
+        node.GetType(type);
+        if (type == opType) {
+            outNode = node;
+            return true;
+        }
+    }
+    return false;
+}
+
+struct MatMulEltwiseCase {
+    const char* matmulOpType = "MatMulV3";
+    const char* eltwiseOpType = "Relu";
+    std::vector<int64_t> aDims;
+    std::vector<int64_t> bDims;
+    std::vector<int64_t> outDims;
+    std::vector<int64_t> x3Dims; // 仅 Add/Mul 使用
+    DataType dtype = DT_FLOAT16;
+    bool enableHf32 = false;
+    bool extraConsumer = false;
+};
+
+GNode BuildMatMulNode(Graph* graph, const MatMulEltwiseCase& param)
+{
+    bool isBatch = (strcmp(param.matmulOpType, "BatchMatMulV3") == 0);
+    const char* transAttr1 = isBatch ? "adj_x1" : "transpose_x1";
+    const char* transAttr2 = isBatch ? "adj_x2" : "transpose_x2";
+    std::vector<CompliantNodeBuilder::IrAttrDef> irAttrs = {
+        {transAttr1, CompliantNodeBuilder::kEsAttrOptional, "Bool", CreateFrom(false)},
+        {transAttr2, CompliantNodeBuilder::kEsAttrOptional, "Bool", CreateFrom(false)},
+        {"offset_x", CompliantNodeBuilder::kEsAttrOptional, "Int", CreateFrom(static_cast<int64_t>(0))},
+    };
+    if (isBatch) {
+        irAttrs.push_back({"enable_hf32", CompliantNodeBuilder::kEsAttrOptional, "Bool", CreateFrom(false)});
+    } else {
+        irAttrs.push_back({"opImplMode", CompliantNodeBuilder::kEsAttrOptional, "Int",
+                           CreateFrom(static_cast<int64_t>(1))});
+    }
+    auto matmulNode = CompliantNodeBuilder(graph)
+                          .OpType(param.matmulOpType)
+                          .Name("matmul")
+                          .IrDefInputs({{"x1", CompliantNodeBuilder::kEsIrInputRequired, ""},
+                                        {"x2", CompliantNodeBuilder::kEsIrInputRequired, ""},
+                                        {"bias", CompliantNodeBuilder::kEsIrInputOptional, ""},
+                                        {"offset_w", CompliantNodeBuilder::kEsIrInputOptional, ""}})
+                          .IrDefOutputs({{"y", CompliantNodeBuilder::kEsIrOutputRequired, ""}})
+                          .IrDefAttrs(irAttrs)
+                          .Build();
+    if (param.enableHf32) {
+        if (isBatch) {
+            matmulNode.SetAttr("enable_hf32", true);
+        } else {
+            matmulNode.SetAttr("opImplMode", static_cast<int64_t>(0x40));
+        }
+    }
+    return matmulNode;
+}
+
+std::shared_ptr<Graph> BuildMatMulEltwiseGraph(const std::string& name, const MatMulEltwiseCase& param)
+{
+    auto graphBuilder = EsGraphBuilder(name.c_str());
+    auto* graph = graphBuilder.GetCGraphBuilder()->GetGraph();
+
+    auto x1Desc = MakeTensorDesc(param.aDims, param.dtype);
+    auto x2Desc = MakeTensorDesc(param.bDims, param.dtype);
+    auto outDesc = MakeTensorDesc(param.outDims, param.dtype);
+
+    auto dataX1 = graphBuilder.CreateInput(0, "dataX1", param.dtype, FORMAT_ND, param.aDims);
+    auto dataX2 = graphBuilder.CreateInput(1, "dataX2", param.dtype, FORMAT_ND, param.bDims);
+    dataX1.GetProducer()->UpdateOutputDesc(0, x1Desc);
+    dataX2.GetProducer()->UpdateOutputDesc(0, x2Desc);
+
+    auto matmulNode = BuildMatMulNode(graph, param);
+    AddEdgeAndUpdatePeerDesc(*graph, *dataX1.GetProducer(), dataX1.GetProducerOutIndex(), matmulNode, 0);
+    AddEdgeAndUpdatePeerDesc(*graph, *dataX2.GetProducer(), dataX2.GetProducerOutIndex(), matmulNode, 1);
+    matmulNode.UpdateInputDesc(0, x1Desc);
+    matmulNode.UpdateInputDesc(1, x2Desc);
+    matmulNode.UpdateOutputDesc(0, outDesc);
+
+    bool isBinary = (strcmp(param.eltwiseOpType, "Add") == 0 || strcmp(param.eltwiseOpType, "Mul") == 0);
+    GNode eltwiseNode;
+    if (isBinary) {
+        auto x3Desc = MakeTensorDesc(param.x3Dims, param.dtype);
+        auto dataX3 = graphBuilder.CreateInput(2, "dataX3", param.dtype, FORMAT_ND, param.x3Dims);
+        dataX3.GetProducer()->UpdateOutputDesc(0, x3Desc);
+        eltwiseNode = CompliantNodeBuilder(graph)
+                          .OpType(param.eltwiseOpType)
+                          .Name("eltwise")
+                          .IrDefInputs({{"x1", CompliantNodeBuilder::kEsIrInputRequired, ""},
+                                        {"x2", CompliantNodeBuilder::kEsIrInputRequired, ""}})
+                          .IrDefOutputs({{"y", CompliantNodeBuilder::kEsIrOutputRequired, ""}})
+                          .Build();
+        AddEdgeAndUpdatePeerDesc(*graph, matmulNode, 0, eltwiseNode, 0);
+        AddEdgeAndUpdatePeerDesc(*graph, *dataX3.GetProducer(), dataX3.GetProducerOutIndex(), eltwiseNode, 1);
+        eltwiseNode.UpdateInputDesc(0, outDesc);
+        eltwiseNode.UpdateInputDesc(1, x3Desc);
+    } else {
+        std::vector<CompliantNodeBuilder::IrAttrDef> irAttrs;
+        if (strcmp(param.eltwiseOpType, "GeluV2") == 0) {
+            irAttrs.push_back({"approximate", CompliantNodeBuilder::kEsAttrOptional, "String",
+                               CreateFrom(AscendString("none"))});
+        }
+        eltwiseNode = CompliantNodeBuilder(graph)
+                          .OpType(param.eltwiseOpType)
+                          .Name("eltwise")
+                          .IrDefInputs({{"x", CompliantNodeBuilder::kEsIrInputRequired, ""}})
+                          .IrDefOutputs({{"y", CompliantNodeBuilder::kEsIrOutputRequired, ""}})
+                          .IrDefAttrs(irAttrs)
+                          .Build();
+        AddEdgeAndUpdatePeerDesc(*graph, matmulNode, 0, eltwiseNode, 0);
+        eltwiseNode.UpdateInputDesc(0, outDesc);
+    }
+    eltwiseNode.UpdateOutputDesc(0, outDesc);
+
+    std::vector<EsTensorHolder> outputs = {
+        EsTensorHolder(graphBuilder.GetCGraphBuilder()->GetTensorHolderFromNode(eltwiseNode, 0))};
+    if (param.extraConsumer) {
+        auto extraNode = CompliantNodeBuilder(graph)
+                            .OpType("Relu")
+                            .Name("extra_consumer")
+                            .IrDefInputs({{"x", CompliantNodeBuilder::kEsIrInputRequired, ""}})
+                            .IrDefOutputs({{"y", CompliantNodeBuilder::kEsIrOutputRequired, ""}})
+                            .Build();
+        AddEdgeAndUpdatePeerDesc(*graph, matmulNode, 0, extraNode, 0);
+        extraNode.UpdateInputDesc(0, outDesc);
+        extraNode.UpdateOutputDesc(0, outDesc);
+        outputs.emplace_back(graphBuilder.GetCGraphBuilder()->GetTensorHolderFromNode(extraNode, 0));
+    }
+    return graphBuilder.BuildAndReset(outputs);
+}
+
+Status RunPass(std::shared_ptr<Graph>& graph)
+{
+    CustomPassContext passContext;
+    passContext.SetPassName(kPassName);
+    MatMulEltwiseFusedMatMulFusionPass pass;
+    return pass.Run(graph, passContext);
+}
+
+void CheckFusedOpType(const std::shared_ptr<Graph>& graph, const char* expected)
+{
+    GNode node;
+    ASSERT_TRUE(FindFirstNodeByOpType(graph, "FusedMatMul", node));
+    AscendString fusedOpType;
+    ASSERT_EQ(node.GetAttr("fused_op_type", fusedOpType), GRAPH_SUCCESS);
+    EXPECT_STREQ(fusedOpType.GetString(), expected);
+}
+
+} // namespace
+
+class MatMulEltwiseFusedMatMulFusionPassTest : public testing::Test {
+protected:
+    static void SetUpTestCase() { SetPlatformInfo950(); }
+
+    static void TearDownTestCase() {}
+
+    void SetUp() override { SetPlatformInfo950(); }
+
+    void TearDown() override {}
+};
+
+TEST_F(MatMulEltwiseFusedMatMulFusionPassTest, matMulV3ReluFp16FusionSuccess)
+{
+    MatMulEltwiseCase param;
+    param.aDims = {32, 64};
+    param.bDims = {64, 128};
+    param.outDims = {32, 128};
+    auto graph = BuildMatMulEltwiseGraph("matMulV3ReluFp16", param);
+
+    EXPECT_EQ(RunPass(graph), SUCCESS);
+    EXPECT_EQ(CountNodes(graph, "Relu"), 0);
+    EXPECT_EQ(CountNodes(graph, "MatMulV3"), 0);
+    CheckFusedOpType(graph, "relu");
+}
+
+TEST_F(MatMulEltwiseFusedMatMulFusionPassTest, batchMatMulV3GeluV2Bf16FusionSuccess)
+{
+    MatMulEltwiseCase param;
+    param.matmulOpType = "BatchMatMulV3";
+    param.eltwiseOpType = "GeluV2";
+    param.aDims = {4, 32, 64};
+    param.bDims = {4, 64, 128};
+    param.outDims = {4, 32, 128};
+    param.dtype = DT_BF16;
+    auto graph = BuildMatMulEltwiseGraph("batchMatMulV3GeluV2Bf16", param);
+
+    EXPECT_EQ(RunPass(graph), SUCCESS);
+    EXPECT_EQ(CountNodes(graph, "GeluV2"), 0);
+    CheckFusedOpType(graph, "gelu_erf");
+}
+
+TEST_F(MatMulEltwiseFusedMatMulFusionPassTest, batchMatMulV3AddBroadcastBatchFusionSuccess)
+{
+    MatMulEltwiseCase param;
+    param.matmulOpType = "BatchMatMulV3";
+    param.eltwiseOpType = "Add";
+    param.aDims = {4, 32, 64};
+    param.bDims = {4, 64, 128};
+    param.outDims = {4, 32, 128};
+    param.x3Dims = {1, 32, 128};
+    auto graph = BuildMatMulEltwiseGraph("batchMatMulV3AddBroadcastBatch", param);
+
+    EXPECT_EQ(RunPass(graph), SUCCESS);
+    EXPECT_EQ(CountNodes(graph, "Add"), 0);
+    CheckFusedOpType(graph, "add");
+    GNode node;
+    ASSERT_TRUE(FindFirstNodeByOpType(graph, "FusedMatMul", node));
+    TensorDesc x3Desc;
+    ASSERT_EQ(node.GetInputDesc(3, x3Desc), GRAPH_SUCCESS);
+    EXPECT_EQ(x3Desc.GetShape().GetDims(), std::vector<int64_t>({1, 32, 128}));
+}
+
+TEST_F(MatMulEltwiseFusedMatMulFusionPassTest, matMulV3MulFp32Hf32FusionSuccess)
+{
+    MatMulEltwiseCase param;
+    param.eltwiseOpType = "Mul";
+    param.aDims = {32, 64};
+    param.bDims = {64, 128};
+    param.outDims = {32, 128};
+    param.x3Dims = {32, 128};
+    param.dtype = DT_FLOAT;
+    param.enableHf32 = true;
+    auto graph = BuildMatMulEltwiseGraph("matMulV3MulFp32Hf32", param);
+
+    EXPECT_EQ(RunPass(graph), SUCCESS);
+    CheckFusedOpType(graph, "mul");
+    GNode node;
+    ASSERT_TRUE(FindFirstNodeByOpType(graph, "FusedMatMul", node));
+    bool enableHf32 = false;
+    node.GetAttr("enable_hf32", enableHf32);
+    EXPECT_TRUE(enableHf32);
+}
+
+TEST_F(MatMulEltwiseFusedMatMulFusionPassTest, matMulV3AddRowBroadcastFail)
+{
+    // x3 需要沿 M 方向广播，FusedMatMul 不支持
+    MatMulEltwiseCase param;
+    param.eltwiseOpType = "Add";
+    param.aDims = {32, 64};
+    param.bDims = {64, 128};
+    param.outDims = {32, 128};
+    param.x3Dims = {1, 128};
+    auto graph = BuildMatMulEltwiseGraph("matMulV3AddRowBroadcast", param);
+
+    EXPECT_EQ(RunPass(graph), GRAPH_NOT_CHANGED);
+    EXPECT_EQ(CountNodes(graph, "FusedMatMul"), 0);
+}
+
+TEST_F(MatMulEltwiseFusedMatMulFusionPassTest, batchMatMulV3AddBatchMismatchFail)
+{
+    MatMulEltwiseCase param;
+    param.matmulOpType = "BatchMatMulV3";
+    param.eltwiseOpType = "Add";
+    param.aDims = {4, 32, 64};
+    param.bDims = {4, 64, 128};
+    param.outDims = {4, 32, 128};
+    param.x3Dims = {2, 32, 128};
+    auto graph = BuildMatMulEltwiseGraph("batchMatMulV3AddBatchMismatch", param);
+
+    EXPECT_EQ(RunPass(graph), GRAPH_NOT_CHANGED);
+}
+
+TEST_F(MatMulEltwiseFusedMatMulFusionPassTest, matMulV3MultiConsumerFail)
+{
+    MatMulEltwiseCase param;
+    param.aDims = {32, 64};
+    param.bDims = {64, 128};
+    param.outDims = {32, 128};
+    param.extraConsumer = true;
+    auto graph = BuildMatMulEltwiseGraph("matMulV3MultiConsumer", param);
+
+    EXPECT_EQ(RunPass(graph), GRAPH_NOT_CHANGED);
+    EXPECT_EQ(CountNodes(graph, "MatMulV3"), 1);
+}
+
+TEST_F(MatMulEltwiseFusedMatMulFusionPassTest, matMulV3ReluFp32WithoutHf32Fail)
+{
+    MatMulEltwiseCase param;
+    param.aDims = {32, 64};
+    param.bDims = {64, 128};
+    param.outDims = {32, 128};
+    param.dtype = DT_FLOAT;
+    auto graph = BuildMatMulEltwiseGraph("matMulV3ReluFp32", param);
+
+    EXPECT_EQ(RunPass(graph), GRAPH_NOT_CHANGED);
+}
@@ -16,6 +16,7 @@
 
 #include "exe_graph/runtime/tiling_context.h"
 #include "log/log.h"
+#include "op_host/tiling_trace.h"
 #include "matmul_tiling_cfg.h"
 
 namespace optiling {
@@ -27,6 +28,16 @@ public:
 
     ge::graphStatus DoTiling()
     {
+        traceCapable_ = false;
+        auto ret = DoTilingPhases();
+        Ops::NN::Optiling::TilingTraceTemplateResult(traceCapable_, ret);
+        return ret;
+    }
+
+    // 只执行到AdjustOpTiling, 不写回context, 用于模板代价排序; cycles < 0 表示模板未提供估计
+    ge::graphStatus DoEstimate(double& cycles)
+    {
+        cycles = -1.0;
         auto ret = GetShapeAttrsInfo();
         if (ret != ge::GRAPH_SUCCESS) {
             return ret;
@@ -42,11 +53,7 @@ public:
         if (ret != ge::GRAPH_SUCCESS) {
             return ret;
         }
-        ret = PostTiling();
-        if (ret != ge::GRAPH_SUCCESS) {
-            return ret;
-        }
-        DumpTilingInfo();
+        cycles = GetEstimatedCycles();
         return ge::GRAPH_SUCCESS;
     }
 
@@ -84,9 +91,55 @@ protected:
         }
         OP_LOGI(context_, "%s", oss.str().c_str());
     }
+    // 10、估算执行cycle数, 默认不提供
+    virtual double GetEstimatedCycles() const { return -1.0; }
 
 protected:
     gert::TilingContext* context_ = nullptr;
     MatMulTilingCfg& cfg_;
+
+private:
+    // 各阶段与原 DoTiling 流程一致, 仅在开启 tiling 决策追踪时额外记录耗时, AdjustOpTiling 计入 op_tiling
+    ge::graphStatus DoTilingPhases()
+    {
+        using Ops::NN::Optiling::TilingTracePhase;
+        using Ops::NN::Optiling::TilingTracePhaseTimer;
+        ge::graphStatus ret;
+        {
+            TilingTracePhaseTimer timer(TilingTracePhase::SHAPE_ATTRS);
+            ret = GetShapeAttrsInfo();
+        }
+        if (ret != ge::GRAPH_SUCCESS) {
+            return ret;
+        }
+        {
+            TilingTracePhaseTimer timer(TilingTracePhase::IS_CAPABLE);
+            traceCapable_ = IsCapable();
+        }
+        if (!traceCapable_) {
+            return ge::GRAPH_PARAM_INVALID;
+        }
+        {
+            TilingTracePhaseTimer timer(TilingTracePhase::OP_TILING);
+            ret = DoOpTiling();
+            if (ret == ge::GRAPH_SUCCESS) {
+                ret = AdjustOpTiling();
+            }
+        }
+        if (ret != ge::GRAPH_SUCCESS) {
+            return ret;
+        }
+        {
+            TilingTracePhaseTimer timer(TilingTracePhase::POST_TILING);
+            ret = PostTiling();
+        }
+        if (ret != ge::GRAPH_SUCCESS) {
+            return ret;
+        }
+        DumpTilingInfo();
+        return ge::GRAPH_SUCCESS;
+    }
+
+    bool traceCapable_ = false;
 };
 } // namespace optiling
@@ -29,6 +29,13 @@ struct TilingResult {
     std::vector<size_t> workspaceSize;
 };
 
+// 模板代价排序结果, estimatedCycles < 0 表示模板未提供代价估计
+struct MMTilingExplainItem {
+    int32_t priority;
+    bool capable;
+    double estimatedCycles;
+};
+
 class MatMulTilingCfg {
 public:
     MatMulTilingCfg(bool needUpdateIn, const void* compileInfoIn, const void* argsIn,
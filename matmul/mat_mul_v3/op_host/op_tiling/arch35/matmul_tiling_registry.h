@@ -17,6 +17,10 @@
 
 #include <map>
 #include <string>
+#include <vector>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
 #include <memory>
 #include <functional>
 
@@ -24,6 +28,7 @@
 #include "exe_graph/runtime/tiling_context.h"
 #include "tiling/platform/platform_ascendc.h"
 #include "op_host/tiling_base.h"
+#include "op_host/tiling_trace.h"
 #include "error_util.h"
 
 #include "matmul_base_tiling.h"
@@ -106,6 +111,7 @@ public:
             OPS_LOG_E(context, "DoTilingImpl failed, context or tilingCfg or args is null.");
             return ge::GRAPH_FAILED;
         }
+        Ops::NN::Optiling::TilingTraceScope traceScope(context);
         const char* opType = registerCfg.opType == nullptr ? context->GetNodeType() : registerCfg.opType;
         auto tilingTemplateRegistryMap = GetTilingTemplates(opType, registerCfg.npuArch);
         OPS_LOG_D(context, "registry map find by opType %s, npu arch %d", opType,
@@ -121,6 +127,14 @@ public:
                 priorities.push_back(it->first);
             }
         }
+        bool explain = IsEnvEnabled("MATMUL_TILING_EXPLAIN");
+        bool costSelect = IsEnvEnabled("MATMUL_TILING_COST_SELECT");
+        if (explain || costSelect) {
+            std::vector<MMTilingExplainItem> ranking;
+            if (ExplainTilingImpl(context, tilingCfg, registerCfg, ranking) == ge::GRAPH_SUCCESS && costSelect) {
+                ReorderByCost(context, ranking, priorities);
+            }
+        }
         for (auto priorityId : priorities) {
             if (tilingTemplateRegistryMap.find(priorityId) == tilingTemplateRegistryMap.end()) {
                 OPS_LOG_E(context, "no registry map find by priority %d", priorityId);
@@ -128,9 +142,11 @@ public:
             }
             auto templateFunc = tilingTemplateRegistryMap[priorityId](context, tilingCfg);
             if (templateFunc != nullptr) {
+                traceScope.BeginTemplate(priorityId);
                 ge::graphStatus status = templateFunc->DoTiling();
                 if (status == ge::GRAPH_SUCCESS) {
                     OPS_LOG_D(context, "Do general op tiling success priority=%d", priorityId);
+                    traceScope.End(status);
                     return status;
                 }
                 OPS_LOG_D(context, "Ignore general op tiling priority=%d", priorityId);
@@ -140,6 +156,51 @@ public:
         return ge::GRAPH_FAILED;
     }
 
+    // 对所有模板执行到AdjustOpTiling并按代价估计排序, 不修改context中的tiling结果
+    // 排序: 有估计的可用模板按cycle升序, 其后为无估计的可用模板, 最后为不可用模板, 同类保持优先级顺序
+    ge::graphStatus ExplainTilingImpl(gert::TilingContext* context, MatMulTilingCfg& tilingCfg,
+                                      const MMRegisterCfg& registerCfg, std::vector<MMTilingExplainItem>& ranking)
+    {
+        ranking.clear();
+        if (context == nullptr || tilingCfg.compileInfo == nullptr || tilingCfg.args == nullptr) {
+            OPS_LOG_E(context, "ExplainTilingImpl failed, context or tilingCfg or args is null.");
+            return ge::GRAPH_FAILED;
+        }
+        const char* opType = registerCfg.opType == nullptr ? context->GetNodeType() : registerCfg.opType;
+        auto tilingTemplateRegistryMap = GetTilingTemplates(opType, registerCfg.npuArch);
+        std::vector<int32_t> priorities{registerCfg.priorities};
+        if (priorities.empty()) {
+            for (auto it = tilingTemplateRegistryMap.begin(); it != tilingTemplateRegistryMap.end(); ++it) {
+                priorities.push_back(it->first);
+            }
+        }
+        for (auto priorityId : priorities) {
+            MMTilingExplainItem item{priorityId, false, -1.0};
+            auto iter = tilingTemplateRegistryMap.find(priorityId);
+            if (iter != tilingTemplateRegistryMap.end()) {
+                auto templateFunc = iter->second(context, tilingCfg);
+                item.capable = templateFunc != nullptr &&
+                               templateFunc->DoEstimate(item.estimatedCycles) == ge::GRAPH_SUCCESS;
+            }
+            ranking.push_back(item);
+        }
+        auto rank = [](const MMTilingExplainItem& item) {
+            return item.capable ? (item.estimatedCycles >= 0.0 ? 0 : 1) : 2; // 2: not capable
+        };
+        std::stable_sort(ranking.begin(), ranking.end(),
+                         [&rank](const MMTilingExplainItem& lhs, const MMTilingExplainItem& rhs) {
+                             if (rank(lhs) != rank(rhs)) {
+                                 return rank(lhs) < rank(rhs);
+                             }
+                             return rank(lhs) == 0 && lhs.estimatedCycles < rhs.estimatedCycles;
+                         });
+        for (size_t i = 0; i < ranking.size(); ++i) {
+            OPS_LOG_I(context, "tiling explain rank %zu: priority=%d, capable=%d, estimated cycles=%.0f", i,
+                      ranking[i].priority, static_cast<int32_t>(ranking[i].capable), ranking[i].estimatedCycles);
+        }
+        return ge::GRAPH_SUCCESS;
+    }
+
     const std::map<int32_t, MMTilingClassCase>& GetTilingTemplates(const std::string& opType, NpuArch npuArch)
     {
         auto socIter = registryMap_.find(npuArch);
@@ -155,6 +216,30 @@ public:
     }
 
 private:
+    static bool IsEnvEnabled(const char* name)
+    {
+        const char* value = std::getenv(name);
+        return value != nullptr && std::strcmp(value, "1") == 0;
+    }
+
+    // 仅当所有可用模板都提供代价估计时才按代价重排, 否则无法比较, 保持原优先级
+    static void ReorderByCost(gert::TilingContext* context, const std::vector<MMTilingExplainItem>& ranking,
+                              std::vector<int32_t>& priorities)
+    {
+        std::vector<int32_t> ordered;
+        for (const auto& item : ranking) {
+            if (item.capable && item.estimatedCycles < 0.0) {
+                OPS_LOG_D(context, "priority %d has no cost estimate, keep first-capable order", item.priority);
+                return;
+            }
+            ordered.push_back(item.priority);
+        }
+        if (!ordered.empty()) {
+            OPS_LOG_D(context, "select tiling by lowest estimated cost, first priority=%d", ordered.front());
+            priorities = ordered;
+        }
+    }
+
     std::map<NpuArch, std::map<std::string, std::shared_ptr<MMTilingCases>>> registryMap_; // key is socversion
     const std::map<int32_t, MMTilingClassCase> emptyTilingCase_{};
 };
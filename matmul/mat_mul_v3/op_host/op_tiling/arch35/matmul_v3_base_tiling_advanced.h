@@ -18,6 +18,7 @@
 #include "matmul_base_tiling.h"
 #include "matmul_v3_common_advanced.h"
 #include "matmul_v3_compile_info_advanced.h"
+#include "matmul_v3_cost_model.h"
 #include "matmul_v3_tiling_helper.h"
 #include "matmul_v3_tiling_data.h"
 #include "error_util.h"
@@ -113,6 +114,27 @@ protected:
 
     uint64_t GetNumBlocks() const override { return runInfo_.usedCoreNum; };
 
+    double GetEstimatedCycles() const override
+    {
+        MatMulV3CostParam param;
+        if (!MatMulV3CostModel::GetCostParam(context_, compileInfo_, args_, param)) {
+            return -1.0;
+        }
+        MatMulV3CostEstimate estimate = EstimateCost(param);
+        OP_LOGD(args_.opName,
+                "cost estimate: compute[%.0f], mte2[%.0f], fixpipe[%.0f], reduce[%.0f], total[%.0f] cycles",
+                estimate.computeCycles, estimate.mte2Cycles, estimate.fixpipeCycles, estimate.reduceCycles,
+                estimate.totalCycles);
+        return estimate.totalCycles;
+    }
+
+    // 默认按cube基本块估算, vector/切K模板按需覆写
+    virtual MatMulV3CostEstimate EstimateCost(const MatMulV3CostParam& param) const
+    {
+        uint64_t batch = batchInfo_ == nullptr ? 1UL : batchInfo_->batchC;
+        return MatMulV3CostModel::EstimateCube(param, compileInfo_, args_, runInfo_, batch);
+    }
+
     bool CheckBasicApiTilingKey(uint64_t tilingkey) const
     {
         return MatMulV3TilingKey().GetApiLevel(tilingkey) != MatMulV3ApiLevel::HIGH_LEVEL;
@@ -141,18 +141,19 @@ bool MatMulV3BasicStreamKTiling::IsCapable()
     // batch一致性控制，当开关等级为2或3时，拒绝切k模板，达到强一致性和batch一致性
     OP_LOGD(args_.opName, "deterministic_level=%d", context_->GetDeterministicLevel());
     if (context_->GetDeterministicLevel() > 1) {
+        OP_TILING_REJECT(args_.opName, "split-k is disabled when deterministic_level > 1");
         return false;
     }
     if (args_.aFormat != ge::FORMAT_ND) {
-        OP_LOGD(args_.opName, "ND is the only supported format for tensor_a in basic api");
+        OP_TILING_REJECT(args_.opName, "ND is the only supported format for tensor_a in basic api");
         return false;
     }
     if (MatMulV3TilingHelper::IsSelfNonContiguous(context_)) {
-        OP_LOGD(args_.opName, "NonContiguous self does not support StreamK");
+        OP_TILING_REJECT(args_.opName, "NonContiguous self does not support StreamK");
         return false;
     }
     if (compileInfo_.aivNum != (compileInfo_.aicNum * NUM_TWO)) {
-        OP_LOGD(args_.opName, "streamk only support aivNum == aicNum * 2");
+        OP_TILING_REJECT(args_.opName, "streamk only support aivNum == aicNum * 2");
         return false;
     }
     return CheckStreamKSKTiling() || CheckStreamKDPSKTiling();
@@ -239,5 +240,28 @@ ge::graphStatus MatMulV3BasicStreamKTiling::GetTilingData(TilingResult& tiling)
 {
     return GetTilingDataImpl<MatMulV3BasicTilingData>(tiling);
 }
+
+MatMulV3CostEstimate MatMulV3BasicStreamKTiling::EstimateCost(const MatMulV3CostParam& param) const
+{
+    // DP+SK: 前若干轮整K计算, 剩余mn块在最后一轮切K
+    uint64_t dpTileNum = 0UL;
+    if (totalMNCnt_ > compileInfo_.aicNum / NUM_TWO) {
+        dpTileNum = totalMNCnt_ - totalMNCnt_ % compileInfo_.aicNum;
+    }
+    MatMulV3CubeSplit skSplit;
+    skSplit.mnTileNum = totalMNCnt_ - dpTileNum;
+    skSplit.tileK = std::max(runInfo_.singleCoreK, NUM_ONE);
+    skSplit.kSplit = MathUtil::CeilDivision(args_.kValue, skSplit.tileK);
+    MatMulV3CostEstimate estimate = MatMulV3CostModel::EstimateCube(param, compileInfo_, args_, runInfo_, skSplit);
+    if (dpTileNum == 0UL) {
+        return estimate;
+    }
+    MatMulV3CubeSplit dpSplit;
+    dpSplit.mnTileNum = dpTileNum;
+    dpSplit.tileK = args_.kValue;
+    dpSplit.kSplit = 1UL;
+    return MatMulV3CostModel::Merge(MatMulV3CostModel::EstimateCube(param, compileInfo_, args_, runInfo_, dpSplit),
+                                    estimate);
+}
 } // namespace matmul_v3_advanced
 } // namespace optiling
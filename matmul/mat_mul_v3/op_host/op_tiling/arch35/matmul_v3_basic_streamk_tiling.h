@@ -42,6 +42,8 @@ protected:
 
     ge::graphStatus GetTilingData(TilingResult& tiling) const override;
 
+    MatMulV3CostEstimate EstimateCost(const MatMulV3CostParam& param) const override;
+
 private:
     bool CheckStreamKSKTiling() const;
 
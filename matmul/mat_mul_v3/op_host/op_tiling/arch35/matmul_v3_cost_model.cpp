@@ -0,0 +1,145 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/* !
+ * \file matmul_v3_cost_model.cpp
+ * \brief
+ */
+#include "matmul_v3_cost_model.h"
+#include <algorithm>
+#include "matmul_v3_tiling_helper.h"
+#include "matmul/common/op_host/math_util.h"
+
+using Ops::NN::MathUtil;
+namespace {
+using namespace optiling::matmul_v3_advanced;
+
+constexpr double TERA_PER_NANO = 1000.0;           // 1 TB/s = 1000 B/ns
+constexpr double CUBE_TFLOPS_PER_GHZ = 8.0;        // 16*16*16 MAC/cycle
+constexpr double CUBE_FP32_RATIO = 16.0;           // DAV_3510 fp32(非hf32)算力为fp16的1/16
+constexpr double VEC_TFLOPS_PER_GHZ = 0.128;       // 256B/cycle fp32 FMA
+constexpr double LAUNCH_OVERHEAD_CYCLES = 2000.0;  // 核启动与同步的固定开销, 经验值
+
+double BytesToCycles(double bytes, double bandwidth, double coreFreq)
+{
+    return bandwidth <= 0.0 ? 0.0 : bytes / (bandwidth * TERA_PER_NANO) * coreFreq;
+}
+
+double FlopsToCycles(double flops, double power, double coreFreq)
+{
+    return power <= 0.0 ? 0.0 : flops / (power * TERA_PER_NANO) * coreFreq;
+}
+} // namespace
+
+namespace optiling {
+namespace matmul_v3_advanced {
+bool MatMulV3CostModel::GetCostParam(const gert::TilingContext* context, const MatmulV3CompileInfo& compileInfo,
+                                     const MatMulV3Args& args, MatMulV3CostParam& param)
+{
+    if (context == nullptr) {
+        return false;
+    }
+    fe::PlatFormInfos* platformInfo = context->GetPlatformInfo();
+    if (platformInfo == nullptr) {
+        OP_LOGD(args.opName, "platformInfo is null, skip cost estimate");
+        return false;
+    }
+    param.coreFreq = MatMulV3TilingHelper::GetCoreFreq(platformInfo);
+    param.hbmBW = MatMulV3TilingHelper::GetHbmBW(platformInfo);
+    param.l2BW = MatMulV3TilingHelper::GetL2BW(platformInfo);
+    param.cubePower = param.coreFreq * CUBE_TFLOPS_PER_GHZ;
+    if (compileInfo.npuArch == NpuArch::DAV_3510 && args.aType == ge::DT_FLOAT && !args.isHf32) {
+        param.cubePower /= CUBE_FP32_RATIO;
+    }
+    param.vecPower = param.coreFreq * VEC_TFLOPS_PER_GHZ;
+    return true;
+}
+
+MatMulV3CostEstimate MatMulV3CostModel::EstimateCube(const MatMulV3CostParam& param,
+                                                     const MatmulV3CompileInfo& compileInfo, const MatMulV3Args& args,
+                                                     const MatMulV3RunInfo& runInfo, uint64_t batch)
+{
+    MatMulV3CubeSplit split;
+    uint64_t baseM = std::max(runInfo.baseM, NUM_ONE);
+    uint64_t baseN = std::max(runInfo.baseN, NUM_ONE);
+    split.mnTileNum = std::max(batch, NUM_ONE) * MathUtil::CeilDivision(args.mValue, baseM) *
+                      MathUtil::CeilDivision(args.nValue, baseN);
+    split.tileK = std::min(std::max(runInfo.singleCoreK, NUM_ONE), std::max(args.kValue, NUM_ONE));
+    split.kSplit = MathUtil::CeilDivision(std::max(args.kValue, NUM_ONE), split.tileK);
+    return EstimateCube(param, compileInfo, args, runInfo, split);
+}
+
+MatMulV3CostEstimate MatMulV3CostModel::EstimateCube(const MatMulV3CostParam& param,
+                                                     const MatmulV3CompileInfo& compileInfo, const MatMulV3Args& args,
+                                                     const MatMulV3RunInfo& runInfo, const MatMulV3CubeSplit& split)
+{
+    MatMulV3CostEstimate estimate;
+    if (split.mnTileNum == 0UL) {
+        return estimate;
+    }
+    double baseM = static_cast<double>(std::min(std::max(runInfo.baseM, NUM_ONE), args.mValue));
+    double baseN = static_cast<double>(std::min(std::max(runInfo.baseN, NUM_ONE), args.nValue));
+    double tileK = static_cast<double>(split.tileK);
+    uint64_t coreNum = std::max(std::min(runInfo.usedCoreNum, compileInfo.aicNum), NUM_ONE);
+    uint64_t tileNum = split.mnTileNum * split.kSplit;
+    double rounds = static_cast<double>(MathUtil::CeilDivision(tileNum, coreNum));
+    double activeCore = static_cast<double>(std::min(tileNum, coreNum));
+
+    // 输入能驻留L2时重复读取按L2带宽计, 否则按HBM带宽计
+    double footprint = static_cast<double>(args.mValue * args.kValue * args.aDtypeSize +
+                                           args.kValue * args.nValue * args.bDtypeSize);
+    double readBW = footprint <= static_cast<double>(compileInfo.l2Size) ? param.l2BW : param.hbmBW;
+    double tileReadBytes = (baseM * args.aDtypeSize + baseN * args.bDtypeSize) * tileK;
+    double tileComputeCycles = FlopsToCycles(NUM_TWO * baseM * baseN * tileK, param.cubePower, param.coreFreq);
+    double tileMte2Cycles = BytesToCycles(tileReadBytes * activeCore, readBW, param.coreFreq);
+
+    // 切K时每个分片以fp32写入workspace, 否则直接写输出
+    uint64_t outDtypeSize = split.kSplit > 1UL ? DATA_SIZE_FP32 : ge::GetSizeByDataType(args.cType);
+    double tileFixpipeCycles = BytesToCycles(baseM * baseN * outDtypeSize * activeCore, param.hbmBW, param.coreFreq);
+
+    estimate.computeCycles = rounds * tileComputeCycles;
+    estimate.mte2Cycles = rounds * tileMte2Cycles;
+    estimate.fixpipeCycles = rounds * tileFixpipeCycles;
+    if (split.kSplit > 1UL) {
+        // vector读回kSplit份fp32部分和并写出一份结果
+        double reduceBytes = static_cast<double>(split.mnTileNum) * baseM * baseN *
+                             (split.kSplit * DATA_SIZE_FP32 + ge::GetSizeByDataType(args.cType));
+        estimate.reduceCycles = BytesToCycles(reduceBytes, param.hbmBW, param.coreFreq);
+    }
+    // MTE2与cube按double buffer流水重叠
+    estimate.totalCycles = std::max(estimate.computeCycles, estimate.mte2Cycles) + estimate.fixpipeCycles +
+                           estimate.reduceCycles + LAUNCH_OVERHEAD_CYCLES;
+    return estimate;
+}
+
+MatMulV3CostEstimate MatMulV3CostModel::EstimateVector(const MatMulV3CostParam& param, uint64_t usedCoreNum,
+                                                       uint64_t moveBytes, uint64_t flops)
+{
+    MatMulV3CostEstimate estimate;
+    double coreNum = static_cast<double>(std::max(usedCoreNum, NUM_ONE));
+    estimate.computeCycles = FlopsToCycles(static_cast<double>(flops) / coreNum, param.vecPower, param.coreFreq);
+    estimate.mte2Cycles = BytesToCycles(static_cast<double>(moveBytes), param.hbmBW, param.coreFreq);
+    estimate.totalCycles = std::max(estimate.computeCycles, estimate.mte2Cycles) + LAUNCH_OVERHEAD_CYCLES;
+    return estimate;
+}
+
+MatMulV3CostEstimate MatMulV3CostModel::Merge(const MatMulV3CostEstimate& lhs, const MatMulV3CostEstimate& rhs)
+{
+    MatMulV3CostEstimate estimate;
+    estimate.computeCycles = lhs.computeCycles + rhs.computeCycles;
+    estimate.mte2Cycles = lhs.mte2Cycles + rhs.mte2Cycles;
+    estimate.fixpipeCycles = lhs.fixpipeCycles + rhs.fixpipeCycles;
+    estimate.reduceCycles = lhs.reduceCycles + rhs.reduceCycles;
+    // 两段串行执行, 固定开销只计一次
+    estimate.totalCycles = lhs.totalCycles + rhs.totalCycles - LAUNCH_OVERHEAD_CYCLES;
+    return estimate;
+}
+} // namespace matmul_v3_advanced
+} // namespace optiling
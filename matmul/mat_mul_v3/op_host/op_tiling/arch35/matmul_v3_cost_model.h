@@ -0,0 +1,63 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/* !
+ * \file matmul_v3_cost_model.h
+ * \brief 模板选择用的解析代价模型, 按核数、L2容量、带宽与基本块估算各模板的执行cycle数
+ */
+#pragma once
+
+#include "exe_graph/runtime/tiling_context.h"
+#include "matmul_v3_common_advanced.h"
+#include "matmul_v3_compile_info_advanced.h"
+
+namespace optiling {
+namespace matmul_v3_advanced {
+struct MatMulV3CostParam {
+    double coreFreq = 0.0;  // GHz
+    double hbmBW = 0.0;     // TB/s
+    double l2BW = 0.0;      // TB/s
+    double cubePower = 0.0; // 单核cube算力, TFLOPS
+    double vecPower = 0.0;  // 单核vector算力, TFLOPS
+};
+
+struct MatMulV3CostEstimate {
+    double computeCycles = 0.0; // cube/vector计算
+    double mte2Cycles = 0.0;    // GM->L1/UB搬运
+    double fixpipeCycles = 0.0; // 结果写出
+    double reduceCycles = 0.0;  // 切K后workspace归约
+    double totalCycles = 0.0;
+};
+
+// cube路径的切分描述: mnTileNum个输出块, 每块在K方向切kSplit份, 每份长度tileK
+struct MatMulV3CubeSplit {
+    uint64_t mnTileNum = 1UL;
+    uint64_t kSplit = 1UL;
+    uint64_t tileK = 1UL;
+};
+
+class MatMulV3CostModel {
+public:
+    static bool GetCostParam(const gert::TilingContext* context, const MatmulV3CompileInfo& compileInfo,
+                             const MatMulV3Args& args, MatMulV3CostParam& param);
+    // 按runInfo中的基本块、核数与singleCoreK估算cube模板
+    static MatMulV3CostEstimate EstimateCube(const MatMulV3CostParam& param, const MatmulV3CompileInfo& compileInfo,
+                                             const MatMulV3Args& args, const MatMulV3RunInfo& runInfo,
+                                             uint64_t batch);
+    static MatMulV3CostEstimate EstimateCube(const MatMulV3CostParam& param, const MatmulV3CompileInfo& compileInfo,
+                                             const MatMulV3Args& args, const MatMulV3RunInfo& runInfo,
+                                             const MatMulV3CubeSplit& split);
+    // 按搬运字节数与向量计算量估算vector模板
+    static MatMulV3CostEstimate EstimateVector(const MatMulV3CostParam& param, uint64_t usedCoreNum,
+                                               uint64_t moveBytes, uint64_t flops);
+    static MatMulV3CostEstimate Merge(const MatMulV3CostEstimate& lhs, const MatMulV3CostEstimate& rhs);
+};
+} // namespace matmul_v3_advanced
+} // namespace optiling
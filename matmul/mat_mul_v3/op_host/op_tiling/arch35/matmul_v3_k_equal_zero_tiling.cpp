@@ -62,5 +62,12 @@ ge::graphStatus MatMulV3KEqZeroTiling::GetTilingData(TilingResult& tiling) const
 {
     return GetTilingDataImpl<MatMulV3KEqZeroBasicTilingData>(tiling);
 }
+
+MatMulV3CostEstimate MatMulV3KEqZeroTiling::EstimateCost(const MatMulV3CostParam& param) const
+{
+    // 只需对输出清零
+    uint64_t moveBytes = runInfo_.totalDataAmount * ge::GetSizeByDataType(args_.cType);
+    return MatMulV3CostModel::EstimateVector(param, runInfo_.usedCoreNum, moveBytes, 0UL);
+}
 } // namespace matmul_v3_advanced
 } // namespace optiling
\ No newline at end of file
@@ -34,6 +34,8 @@ protected:
     uint64_t GetNumBlocks() const override;
 
     ge::graphStatus GetTilingData(TilingResult& tiling) const override;
+
+    MatMulV3CostEstimate EstimateCost(const MatMulV3CostParam& param) const override;
 };
 } // namespace matmul_v3_advanced
 } // namespace optiling
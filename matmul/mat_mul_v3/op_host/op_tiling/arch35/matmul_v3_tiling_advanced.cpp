@@ -394,7 +394,7 @@ std::vector<std::vector<ge::DataType>> MatMulV3Tiling::GetDtypeSupportList() con
 }
 
 // ====== DoTiling: orchestrates all phases ======
-ge::graphStatus MatMulV3Tiling::DoTiling()
+ge::graphStatus MatMulV3Tiling::PrepareArgs()
 {
     if (GetShapeAttrsInfo() != ge::GRAPH_SUCCESS) {
         return ge::GRAPH_FAILED;
@@ -411,6 +411,14 @@ ge::graphStatus MatMulV3Tiling::DoTiling()
     if (ValidateOptionalBatchInfo() != ge::GRAPH_SUCCESS) {
         return ge::GRAPH_FAILED;
     }
+    return ge::GRAPH_SUCCESS;
+}
+
+ge::graphStatus MatMulV3Tiling::DoTiling()
+{
+    if (PrepareArgs() != ge::GRAPH_SUCCESS) {
+        return ge::GRAPH_FAILED;
+    }
     MatMulTilingCfg tilingCfg(false, context_->GetCompileInfo(), reinterpret_cast<void*>(&args_), GetTilingKeyObj());
     OPS_CHECK_NULL_WITH_CONTEXT(context_, tilingCfg.compileInfo);
     NpuArch npuArch = reinterpret_cast<const MatmulV3CompileInfo*>(tilingCfg.compileInfo)->npuArch;
@@ -418,6 +426,18 @@ ge::graphStatus MatMulV3Tiling::DoTiling()
     return MMTilingRegistry::GetInstance().DoTilingImpl(context_, tilingCfg, registerCfg);
 }
 
+ge::graphStatus MatMulV3Tiling::Explain(std::vector<MMTilingExplainItem>& ranking)
+{
+    if (PrepareArgs() != ge::GRAPH_SUCCESS) {
+        return ge::GRAPH_FAILED;
+    }
+    MatMulTilingCfg tilingCfg(false, context_->GetCompileInfo(), reinterpret_cast<void*>(&args_), GetTilingKeyObj());
+    OPS_CHECK_NULL_WITH_CONTEXT(context_, tilingCfg.compileInfo);
+    NpuArch npuArch = reinterpret_cast<const MatmulV3CompileInfo*>(tilingCfg.compileInfo)->npuArch;
+    MMRegisterCfg registerCfg{GetRegistryOpType(), npuArch, GetRegistryPriorities(npuArch)};
+    return MMTilingRegistry::GetInstance().ExplainTilingImpl(context_, tilingCfg, registerCfg, ranking);
+}
+
 // ====== Old interface: GetShapeAttrsInfo (delegates to new phases) ======
 ge::graphStatus MatMulV3Tiling::GetShapeAttrsInfo()
 {
@@ -18,6 +18,7 @@
 #include "runtime/tiling_context.h"
 #include "matmul_v3_common_advanced.h"
 #include "matmul_v3_tiling_key.h"
+#include "matmul_tiling_cfg.h"
 #include "tiling/platform/platform_ascendc.h"
 #include "platform/soc_spec.h"
 
@@ -28,6 +29,8 @@ public:
     explicit MatMulV3Tiling(gert::TilingContext* context) : context_(context) {};
     virtual ~MatMulV3Tiling() = default;
     virtual ge::graphStatus DoTiling();
+    // 按代价估计输出所有模板的排序, 不写回tiling结果, 用于定位模板选择问题
+    ge::graphStatus Explain(std::vector<MMTilingExplainItem>& ranking);
 
 protected:
     // ====== Phase 1: Context initialization ======
@@ -87,6 +90,7 @@ protected:
     NpuArch arch_ = NpuArch::DAV_3510;
 
 private:
+    ge::graphStatus PrepareArgs();
     bool ExtractNonContiguousDims(int64_t (&mkDims)[2], int64_t (&knDims)[2]);
     ge::graphStatus ExtractSliceDims(int64_t (&dims)[2]);
     ge::graphStatus ExtractTransposeDims(int64_t (&dims)[2], int64_t idx) const;
@@ -122,5 +122,14 @@ ge::graphStatus MatMulV3ToVectorTiling::GetTilingData(TilingResult& tiling) cons
 {
     return GetTilingDataImpl<MatMulToVectorBasicTilingData>(tiling);
 }
+
+MatMulV3CostEstimate MatMulV3ToVectorTiling::EstimateCost(const MatMulV3CostParam& param) const
+{
+    uint64_t moveBytes = args_.mValue * args_.kValue * args_.aDtypeSize +
+                         args_.kValue * args_.nValue * args_.bDtypeSize +
+                         args_.mValue * args_.nValue * ge::GetSizeByDataType(args_.cType);
+    uint64_t flops = NUM_TWO * args_.mValue * args_.nValue * args_.kValue;
+    return MatMulV3CostModel::EstimateVector(param, runInfo_.usedCoreNum, moveBytes, flops);
+}
 } // namespace matmul_v3_advanced
 } // namespace optiling
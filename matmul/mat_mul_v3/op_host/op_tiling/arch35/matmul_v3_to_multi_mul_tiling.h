@@ -35,6 +35,8 @@ protected:
 
     ge::graphStatus GetTilingData(TilingResult& tiling) const override;
 
+    MatMulV3CostEstimate EstimateCost(const MatMulV3CostParam& param) const override;
+
 private:
     static constexpr uint64_t BASE = 64;
 };
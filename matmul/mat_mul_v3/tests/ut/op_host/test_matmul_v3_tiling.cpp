@@ -5010,4 +5010,99 @@ TEST_F(MatMulV3TilingRuntime, 950_rowstride_noncontiguous_2d_slice)
     ASSERT_EQ(tiling_data_result, golden_tiling_data);
 }
 
+// 以{4, 8192} x {1280, 8192}^T为例执行tiling并输出模板代价排序
+static void RunStreamKShapeCase(const string& compile_info_string, std::vector<optiling::MMTilingExplainItem>& ranking)
+{
+    gert::StorageShape x1_shape = {{4, 8192}, {4, 8192}};
+    gert::StorageShape x2_shape = {{1280, 8192}, {1280, 8192}};
+    std::vector<gert::StorageShape> output_shapes(1, {{4, 1280}, {4, 1280}});
+    std::vector<void*> output_shapes_ref(1);
+    for (size_t i = 0; i < output_shapes.size(); ++i) {
+        output_shapes_ref[i] = &output_shapes[i];
+    }
+
+    fe::PlatFormInfos platform_info;
+    platform_info.Init();
+    optiling::MatmulV3CompileInfo compile_info;
+    auto kernel_holder = gert::KernelRunContextFaker()
+                             .KernelIONum(2, 1)
+                             .Inputs({const_cast<char*>(compile_info_string.c_str()),
+                                      reinterpret_cast<void*>(&platform_info)})
+                             .Outputs({&compile_info})
+                             .Build();
+
+    map<string, string> soc_infos;
+    map<string, string> aicore_spec;
+    map<string, string> intrinsics;
+    map<string, string> soc_version;
+    GetPlatFormInfos(compile_info_string.c_str(), soc_infos, aicore_spec, intrinsics, soc_version);
+    aicore_spec["cube_freq"] = "1800";
+
+    auto tiling_func = gert::OpImplRegistry::GetInstance().GetOpImpl("MatMulV3")->tiling;
+    auto tiling_parse_func = gert::OpImplRegistry::GetInstance().GetOpImpl("MatMulV3")->tiling_parse;
+    kernel_holder.GetContext<gert::TilingParseContext>()->GetPlatformInfo()->Init();
+    kernel_holder.GetContext<gert::TilingParseContext>()->GetPlatformInfo()->SetPlatformRes("version", soc_version);
+    kernel_holder.GetContext<gert::TilingParseContext>()->GetPlatformInfo()->SetPlatformRes("SoCInfo", soc_infos);
+    kernel_holder.GetContext<gert::TilingParseContext>()->GetPlatformInfo()->SetPlatformRes("AICoreSpec", aicore_spec);
+    kernel_holder.GetContext<gert::TilingParseContext>()->GetPlatformInfo()->SetCoreNumByCoreType("AICore");
+    kernel_holder.GetContext<gert::TilingParseContext>()->GetPlatformInfo()->SetCoreNumByCoreType("VectorCore");
+    kernel_holder.GetContext<gert::TilingParseContext>()->GetPlatformInfo()->SetPlatformRes("AICoreintrinsicDtypeMap",
+                                                                                            intrinsics);
+    EXPECT_EQ(tiling_parse_func(kernel_holder.GetContext<gert::KernelContext>()), ge::GRAPH_SUCCESS);
+    compile_info.aivNum = std::stoi(soc_infos["vector_core_cnt"]);
+
+    auto tiling_data = gert::TilingData::CreateCap(2048);
+    auto workspace_size_holer = gert::ContinuousVector::Create<size_t>(4096);
+    auto ws_size = reinterpret_cast<gert::ContinuousVector*>(workspace_size_holer.get());
+    gert::KernelRunContextHolder holder = gert::TilingContextFaker()
+                                              .SetOpType("MatMulV3")
+                                              .NodeIoNum(2, 1)
+                                              .IrInstanceNum({1, 1})
+                                              .InputShapes({&x1_shape, &x2_shape})
+                                              .OutputShapes(output_shapes_ref)
+                                              .NodeAttrs({{"adj_x1", Ops::NN::AnyValue::CreateFrom<bool>(false)},
+                                                          {"adj_x2", Ops::NN::AnyValue::CreateFrom<bool>(true)},
+                                                          {"offset_x", Ops::NN::AnyValue::CreateFrom<int64_t>(0)},
+                                                          {"opImplMode", Ops::NN::AnyValue::CreateFrom<int64_t>(0)}})
+                                              .NodeInputTd(0, DT_FLOAT16, ge::FORMAT_ND, ge::FORMAT_ND)
+                                              .NodeInputTd(1, DT_FLOAT16, ge::FORMAT_ND, ge::FORMAT_ND)
+                                              .NodeOutputTd(0, DT_FLOAT16, ge::FORMAT_ND, ge::FORMAT_ND)
+                                              .CompileInfo(&compile_info)
+                                              .PlatformInfo(reinterpret_cast<char*>(&platform_info))
+                                              .TilingData(tiling_data.get())
+                                              .Workspace(ws_size)
+                                              .Build();
+
+    auto tiling_context = holder.GetContext<gert::TilingContext>();
+    EXPECT_EQ(tiling_func(tiling_context), ge::GRAPH_SUCCESS);
+    optiling::matmul_v3_advanced::MatMulV3Tiling mmv3Tiling(tiling_context);
+    EXPECT_EQ(mmv3Tiling.Explain(ranking), ge::GRAPH_SUCCESS);
+}
+
+TEST_F(MatMulV3TilingRuntime, 950_explain_streamk_ranking)
+{
+    string compile_info_string =
+        R"({"_pattern": "MatMul", "attrs":{"transpose_a":false,"transpose_b":true, "offset_x":0, "opImplMode":0},
+      "binary_attrs":{"bias_flag":false, "nd_flag":true, "split_k_flag":false, "zero_flag":false, "weight_nz": false, "l2_size":134217728},"binary_mode_flag":true,
+      "block_dim":{"CORE_NUM":32, "vector_core_cnt": 64},"corerect_range_flag":null,"dynamic_mode":"dynamic_mkn", "fused_double_operand_num": 0,
+      "hardware_info": {"BT_SIZE": 4096, "load3d_constraints": "unknown", "Intrinsic_fix_pipe_l0c2out": true, "Intrinsic_data_move_l12ub": false, "Intrinsic_data_move_l0c2ub": false, "Intrinsic_data_move_l12bt": true, "Intrinsic_data_move_out2l1_nd2nz": true, "UB_SIZE": 253952, "L2_SIZE": 134217728, "L1_SIZE": 524288, "L0A_SIZE": 65536, "L0B_SIZE": 65536, "L0C_SIZE": 262144, "CORE_NUM": 32, "vector_core_cnt": 64, "socVersion": "Ascend950" },
+      "format_a":"ND","format_b":"ND","repo_range":{},"repo_seeds":{}})";
+    std::vector<optiling::MMTilingExplainItem> ranking;
+    RunStreamKShapeCase(compile_info_string, ranking);
+    // stream-k与aswt均可用且给出代价估计，k=0/to_mul模板不可用排在最后
+    ASSERT_EQ(ranking.size(), 5UL);
+    size_t capableNum = 0;
+    for (size_t i = 0; i < ranking.size(); ++i) {
+        if (ranking[i].capable) {
+            ASSERT_EQ(i, capableNum);
+            ASSERT_GT(ranking[i].estimatedCycles, 0.0);
+            ++capableNum;
+        }
+    }
+    ASSERT_EQ(capableNum, 2UL);
+    for (size_t i = 1; i < capableNum; ++i) {
+        ASSERT_LE(ranking[i - 1].estimatedCycles, ranking[i].estimatedCycles);
+    }
+}
+
 } // namespace
@@ -0,0 +1,372 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * \file add_layer_norm_fusion_pass.cpp
+ * \brief Fusion pass for Add + LayerNorm/LayerNormV3 -> AddLayerNorm/InplaceAddLayerNorm.
+ *
+ * Fusion pattern:
+ *      x1    x2
+ *        \  /
+ *        Add ----------------> other consumers (optional)
+ *         |   gamma  beta
+ *         |  /      /
+ *      LayerNorm(V3)
+ *      /    |    \
+ *     y   mean  variance/rstd
+ *
+ *  ==>  AddLayerNorm(x1, x2, gamma, beta) -> (y, mean, rstd, x)
+ *       InplaceAddLayerNorm 在 x1/x2 除 Add 外无其他消费者时使用, y 复用 x1 内存, x 复用 x2 内存
+ *
+ * The residual sum is kept as output x (additional_output=true) only when Add has consumers other than
+ * LayerNorm. LayerNorm mean/variance must be unused: AddLayerNorm emits float mean/rstd whose layout and
+ * semantics differ from LayerNorm's variance.
+ */
+
+#include "add_layer_norm_fusion_pass.h"
+
+#include <algorithm>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "common/inc/error_util.h"
+#include "ge/compliant_node_builder.h"
+#include "ge/es_graph_builder.h"
+#include "ge/ge_utils.h"
+#include "norm/norm_common/op_graph/add_norm_fusion_utils.h"
+#include "platform/platform_info.h"
+
+using namespace ge;
+using namespace fe;
+using namespace fusion;
+
+namespace ops {
+namespace {
+using add_norm_fusion::GetNodeType;
+
+constexpr char kPassName[] = "AddLayerNormFusionPass";
+
+constexpr char kAddType[] = "Add";
+constexpr char kLayerNormType[] = "LayerNorm";
+constexpr char kLayerNormV3Type[] = "LayerNormV3";
+constexpr char kAddLayerNormType[] = "AddLayerNorm";
+constexpr char kInplaceAddLayerNormType[] = "InplaceAddLayerNorm";
+
+constexpr int64_t kAddCaptureIdx = 0;
+constexpr int64_t kLayerNormCaptureIdx = 1;
+
+constexpr int32_t kAddX1Idx = 0;
+constexpr int32_t kAddX2Idx = 1;
+constexpr int32_t kLayerNormXIdx = 0;
+constexpr int32_t kLayerNormGammaIdx = 1;
+constexpr int32_t kLayerNormBetaIdx = 2;
+constexpr int32_t kLayerNormYOutIdx = 0;
+constexpr int32_t kLayerNormMeanOutIdx = 1;
+constexpr int32_t kLayerNormVarOutIdx = 2;
+constexpr int32_t kFusedOutputNum = 4;
+
+constexpr size_t kSubgraphInputNum = 4;
+constexpr float kLayerNormDefaultEps = 1e-7f;
+constexpr float kLayerNormV3DefaultEps = 1e-5f;
+
+const std::vector<DataType> kSupportDtypes = {DT_FLOAT16, DT_BF16, DT_FLOAT};
+
+bool IsTargetPlatform(DataType dtype)
+{
+    PlatformInfo platformInfo;
+    OptionalInfo optionalInfo;
+    OP_LOGE_IF(PlatformInfoManager::Instance().GetPlatformInfoWithOutSocVersion(platformInfo, optionalInfo) != SUCCESS,
+               false, kPassName, "Get platform_info failed.");
+    const std::string soc = platformInfo.str_info.short_soc_version;
+    OPS_LOG_D(kPassName, "Platform short soc: %s", soc.c_str());
+    const static std::set<std::string> kSupportSoc = {"Ascend910B", "Ascend910_93", "Ascend950", "Ascend310P"};
+    if (kSupportSoc.count(soc) == 0) {
+        OPS_LOG_D(kPassName, "Platform %s is not supported.", soc.c_str());
+        return false;
+    }
+    // 310P 上 AddLayerNorm 不支持 bf16
+    if (soc == "Ascend310P" && dtype == DT_BF16) {
+        OPS_LOG_D(kPassName, "bf16 is not supported on %s.", soc.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool GetCapturedNode(const std::unique_ptr<MatchResult>& matchResult, int64_t index, GNode& node)
+{
+    NodeIo nodeIo;
+    OP_LOGE_IF(matchResult->GetCapturedTensor(index, nodeIo) != SUCCESS, false, kPassName,
+               "get captured node failed, index is %ld.", index);
+    node = nodeIo.node;
+    return true;
+}
+
+es::EsTensorHolder BuildAddNode(es::EsGraphBuilder& graphBuilder, const es::EsTensorHolder& x1,
+                                const es::EsTensorHolder& x2)
+{
+    auto graph = graphBuilder.GetCGraphBuilder()->GetGraph();
+    GNode node = es::CompliantNodeBuilder(graph)
+                     .OpType(kAddType)
+                     .Name("add")
+                     .IrDefInputs({{"x1", es::CompliantNodeBuilder::kEsIrInputRequired, ""},
+                                   {"x2", es::CompliantNodeBuilder::kEsIrInputRequired, ""}})
+                     .IrDefOutputs({{"y", es::CompliantNodeBuilder::kEsIrOutputRequired, ""}})
+                     .Build();
+    es::AddEdgeAndUpdatePeerDesc(*graph, *x1.GetProducer(), x1.GetProducerOutIndex(), node, kAddX1Idx);
+    es::AddEdgeAndUpdatePeerDesc(*graph, *x2.GetProducer(), x2.GetProducerOutIndex(), node, kAddX2Idx);
+    return es::EsTensorHolder(graphBuilder.GetCGraphBuilder()->GetTensorHolderFromNode(node, 0));
+}
+
+void BuildLayerNormNode(es::EsGraphBuilder& graphBuilder, const char* opType,
+                        const std::vector<es::EsTensorHolder>& inputs, std::vector<es::EsTensorHolder>& outputs)
+{
+    auto graph = graphBuilder.GetCGraphBuilder()->GetGraph();
+    const bool isV3 = std::string(opType) == kLayerNormV3Type;
+    GNode node = es::CompliantNodeBuilder(graph)
+                     .OpType(opType)
+                     .Name("layer_norm")
+                     .IrDefInputs({{"x", es::CompliantNodeBuilder::kEsIrInputRequired, ""},
+                                   {"gamma", es::CompliantNodeBuilder::kEsIrInputRequired, ""},
+                                   {"beta", es::CompliantNodeBuilder::kEsIrInputRequired, ""}})
+                     .IrDefOutputs({{"y", es::CompliantNodeBuilder::kEsIrOutputRequired, ""},
+                                    {"mean", es::CompliantNodeBuilder::kEsIrOutputRequired, ""},
+                                    {isV3 ? "rstd" : "variance", es::CompliantNodeBuilder::kEsIrOutputRequired, ""}})
+                     .Build();
+    for (int32_t i = 0; i < static_cast<int32_t>(inputs.size()); ++i) {
+        es::AddEdgeAndUpdatePeerDesc(*graph, *inputs[i].GetProducer(), inputs[i].GetProducerOutIndex(), node, i);
+    }
+    for (int32_t i = kLayerNormYOutIdx; i <= kLayerNormVarOutIdx; ++i) {
+        outputs.emplace_back(graphBuilder.GetCGraphBuilder()->GetTensorHolderFromNode(node, i));
+    }
+}
+
+PatternUniqPtr MakePattern(const char* layerNormType)
+{
+    std::string patternName = std::string(kPassName) + layerNormType;
+    auto graphBuilder = es::EsGraphBuilder(patternName.c_str());
+    auto [x1, x2, gamma, beta] = graphBuilder.CreateInputs<4>();
+    auto addOut = BuildAddNode(graphBuilder, x1, x2);
+    std::vector<es::EsTensorHolder> lnOutputs;
+    BuildLayerNormNode(graphBuilder, layerNormType, {addOut, gamma, beta}, lnOutputs);
+
+    // 输出顺序与 AddLayerNorm 的 (y, mean, rstd, x) 一一对应
+    std::vector<es::EsTensorHolder> outputs = {lnOutputs[kLayerNormYOutIdx], lnOutputs[kLayerNormMeanOutIdx],
+                                               lnOutputs[kLayerNormVarOutIdx], addOut};
+    auto graph = graphBuilder.BuildAndReset(outputs);
+    auto pattern = std::make_unique<Pattern>(std::move(*graph));
+    pattern->CaptureTensor({*addOut.GetProducer(), 0})
+        .CaptureTensor({*lnOutputs[kLayerNormYOutIdx].GetProducer(), kLayerNormYOutIdx});
+    return pattern;
+}
+
+bool IsDtypeSupported(DataType dtype)
+{
+    return std::find(kSupportDtypes.begin(), kSupportDtypes.end(), dtype) != kSupportDtypes.end();
+}
+
+bool IsInputDescValid(const GNode& addNode, const GNode& lnNode)
+{
+    TensorDesc x1Desc;
+    TensorDesc x2Desc;
+    TensorDesc gammaDesc;
+    TensorDesc betaDesc;
+    OP_LOGE_IF(addNode.GetInputDesc(kAddX1Idx, x1Desc) != GRAPH_SUCCESS ||
+                   addNode.GetInputDesc(kAddX2Idx, x2Desc) != GRAPH_SUCCESS ||
+                   lnNode.GetInputDesc(kLayerNormGammaIdx, gammaDesc) != GRAPH_SUCCESS ||
+                   lnNode.GetInputDesc(kLayerNormBetaIdx, betaDesc) != GRAPH_SUCCESS,
+               false, kPassName, "get Add/LayerNorm input desc failed.");
+    const DataType dtype = x1Desc.GetDataType();
+    if (!IsDtypeSupported(dtype) || x2Desc.GetDataType() != dtype || gammaDesc.GetDataType() != dtype ||
+        betaDesc.GetDataType() != dtype) {
+        OPS_LOG_D(kPassName, "x1/x2/gamma/beta dtype must be the same and in fp16/bf16/fp32.");
+        return false;
+    }
+    // AddLayerNorm 不支持 x1/x2 广播
+    if (x1Desc.GetShape().GetDims() != x2Desc.GetShape().GetDims()) {
+        OPS_LOG_D(kPassName, "Add inputs need broadcast, not supported.");
+        return false;
+    }
+    if (gammaDesc.GetShape().GetDims() != betaDesc.GetShape().GetDims()) {
+        OPS_LOG_D(kPassName, "gamma and beta shape are different.");
+        return false;
+    }
+    return IsTargetPlatform(dtype);
+}
+
+// AddLayerNorm 按 gamma 的维度归一化, 要求 begin_norm_axis == begin_params_axis 且 gamma 与 x 的尾轴一致
+bool IsNormAxisValid(const GNode& lnNode)
+{
+    TensorDesc xDesc;
+    TensorDesc gammaDesc;
+    OP_LOGE_IF(lnNode.GetInputDesc(kLayerNormXIdx, xDesc) != GRAPH_SUCCESS ||
+                   lnNode.GetInputDesc(kLayerNormGammaIdx, gammaDesc) != GRAPH_SUCCESS,
+               false, kPassName, "get LayerNorm input desc failed.");
+    const auto xDims = xDesc.GetShape().GetDims();
+    const auto gammaDims = gammaDesc.GetShape().GetDims();
+    const int64_t xRank = static_cast<int64_t>(xDims.size());
+    int64_t beginNormAxis = 0;
+    int64_t beginParamsAxis = 0;
+    (void)lnNode.GetAttr("begin_norm_axis", beginNormAxis);
+    (void)lnNode.GetAttr("begin_params_axis", beginParamsAxis);
+    beginNormAxis = beginNormAxis < 0 ? beginNormAxis + xRank : beginNormAxis;
+    beginParamsAxis = beginParamsAxis < 0 ? beginParamsAxis + xRank : beginParamsAxis;
+    if (beginNormAxis < 0 || beginNormAxis >= xRank || beginNormAxis != beginParamsAxis) {
+        OPS_LOG_D(kPassName, "LayerNorm begin_norm_axis %ld / begin_params_axis %ld is not supported.", beginNormAxis,
+                  beginParamsAxis);
+        return false;
+    }
+    if (!std::equal(gammaDims.begin(), gammaDims.end(), xDims.begin() + beginNormAxis, xDims.end())) {
+        OPS_LOG_D(kPassName, "LayerNorm gamma shape does not match the normalized axes.");
+        return false;
+    }
+    return true;
+}
+
+bool IsStatsUnused(const GNode& lnNode)
+{
+    if (!lnNode.GetOutDataNodesAndPortIndexs(kLayerNormMeanOutIdx).empty() ||
+        !lnNode.GetOutDataNodesAndPortIndexs(kLayerNormVarOutIdx).empty()) {
+        OPS_LOG_D(kPassName, "LayerNorm mean/variance is used, can't be replaced by AddLayerNorm.");
+        return false;
+    }
+    return true;
+}
+
+// x1/x2 由普通计算节点产生且只被 Add 消费时, 残差 buffer 在融合后即失效, 可以原地改写
+bool IsResidualDead(const GNode& addNode)
+{
+    return add_norm_fusion::IsInplaceWritableInput(addNode, kAddX1Idx) &&
+           add_norm_fusion::IsInplaceWritableInput(addNode, kAddX2Idx);
+}
+
+Status InferShape(const GraphUniqPtr& replaceGraph, const std::vector<SubgraphInput>& subgraphInputs)
+{
+    std::vector<Shape> inputShapes;
+    for (const auto& subgraphInput : subgraphInputs) {
+        const auto allInputs = subgraphInput.GetAllInputs();
+        if (allInputs.empty()) {
+            OPS_LOG_E(kPassName, "subgraph input is empty.");
+            return FAILED;
+        }
+        TensorDesc tensorDesc;
+        const auto matchNode = allInputs.at(0);
+        if (matchNode.node.GetInputDesc(matchNode.index, tensorDesc) != GRAPH_SUCCESS) {
+            OPS_LOG_E(kPassName, "get subgraph input desc failed.");
+            return FAILED;
+        }
+        inputShapes.emplace_back(tensorDesc.GetShape());
+    }
+    return GeUtils::InferShape(*replaceGraph, inputShapes);
+}
+
+GNode BuildFusedNode(es::EsGraphBuilder& graphBuilder, const std::vector<es::EsTensorHolder>& inputs, bool inplace,
+                     float eps, bool additionalOutput)
+{
+    auto graph = graphBuilder.GetCGraphBuilder()->GetGraph();
+    GNode node =
+        es::CompliantNodeBuilder(graph)
+            .OpType(inplace ? kInplaceAddLayerNormType : kAddLayerNormType)
+            .Name(inplace ? "inplace_add_layer_norm" : "add_layer_norm")
+            .IrDefInputs({{"x1", es::CompliantNodeBuilder::kEsIrInputRequired, ""},
+                          {"x2", es::CompliantNodeBuilder::kEsIrInputRequired, ""},
+                          {"gamma", es::CompliantNodeBuilder::kEsIrInputRequired, ""},
+                          {"beta", es::CompliantNodeBuilder::kEsIrInputRequired, ""},
+                          {"bias", es::CompliantNodeBuilder::kEsIrInputOptional, ""}})
+            .IrDefOutputs({{inplace ? "x1" : "y", es::CompliantNodeBuilder::kEsIrOutputRequired, ""},
+                           {"mean", es::CompliantNodeBuilder::kEsIrOutputRequired, ""},
+                           {"rstd", es::CompliantNodeBuilder::kEsIrOutputRequired, ""},
+                           {inplace ? "x2" : "x", es::CompliantNodeBuilder::kEsIrOutputRequired, ""}})
+            .IrDefAttrs({{"epsilon", es::CompliantNodeBuilder::kEsAttrOptional, "Float", es::CreateFrom(eps)},
+                         {"additional_output", es::CompliantNodeBuilder::kEsAttrOptional, "Bool",
+                          es::CreateFrom(additionalOutput)}})
+            .Build();
+    for (int32_t i = 0; i < static_cast<int32_t>(inputs.size()); ++i) {
+        es::AddEdgeAndUpdatePeerDesc(*graph, *inputs[i].GetProducer(), inputs[i].GetProducerOutIndex(), node, i);
+    }
+    return node;
+}
+} // namespace
+
+std::vector<PatternUniqPtr> AddLayerNormFusionPass::Patterns()
+{
+    OPS_LOG_D(kPassName, "Enter Patterns for AddLayerNormFusionPass");
+    std::vector<PatternUniqPtr> patterns;
+    patterns.emplace_back(MakePattern(kLayerNormType));
+    patterns.emplace_back(MakePattern(kLayerNormV3Type));
+    return patterns;
+}
+
+bool AddLayerNormFusionPass::MeetRequirements(const std::unique_ptr<MatchResult>& matchResult)
+{
+    OPS_LOG_D(kPassName, "Enter MeetRequirements for AddLayerNormFusionPass");
+    GNode addNode;
+    GNode lnNode;
+    if (!GetCapturedNode(matchResult, kAddCaptureIdx, addNode) ||
+        !GetCapturedNode(matchResult, kLayerNormCaptureIdx, lnNode)) {
+        return false;
+    }
+    return IsStatsUnused(lnNode) && IsInputDescValid(addNode, lnNode) && IsNormAxisValid(lnNode);
+}
+
+GraphUniqPtr AddLayerNormFusionPass::Replacement(const std::unique_ptr<MatchResult>& matchResult)
+{
+    OPS_LOG_D(kPassName, "Enter Replacement for AddLayerNormFusionPass");
+    GNode addNode;
+    GNode lnNode;
+    if (!GetCapturedNode(matchResult, kAddCaptureIdx, addNode) ||
+        !GetCapturedNode(matchResult, kLayerNormCaptureIdx, lnNode)) {
+        return nullptr;
+    }
+    std::vector<SubgraphInput> subgraphInputs;
+    matchResult->ToSubgraphBoundary()->GetAllInputs(subgraphInputs);
+    OP_LOGE_IF(subgraphInputs.size() != kSubgraphInputNum, nullptr, kPassName,
+               "Subgraph input num %zu is not equal to 4.", subgraphInputs.size());
+
+    float eps = GetNodeType(lnNode) == kLayerNormV3Type ? kLayerNormV3DefaultEps : kLayerNormDefaultEps;
+    OP_LOGW_IF(lnNode.GetAttr("epsilon", eps) != GRAPH_SUCCESS, kPassName, "Get epsilon attr failed.");
+    // Add 只被 LayerNorm 消费时无需输出残差和
+    const bool additionalOutput = addNode.GetOutDataNodesAndPortIndexs(0).size() > 1U;
+    const bool inplace = IsResidualDead(addNode);
+
+    std::vector<TensorDesc> inputDescs(kSubgraphInputNum);
+    OP_LOGE_IF(addNode.GetInputDesc(kAddX1Idx, inputDescs[0]) != GRAPH_SUCCESS ||
+                   addNode.GetInputDesc(kAddX2Idx, inputDescs[1]) != GRAPH_SUCCESS ||
+                   lnNode.GetInputDesc(kLayerNormGammaIdx, inputDescs[2]) != GRAPH_SUCCESS ||
+                   lnNode.GetInputDesc(kLayerNormBetaIdx, inputDescs[3]) != GRAPH_SUCCESS,
+               nullptr, kPassName, "get Add/LayerNorm input desc failed.");
+    auto graphBuilder = es::EsGraphBuilder("replacement");
+    std::vector<es::EsTensorHolder> inputs;
+    for (int32_t i = 0; i < static_cast<int32_t>(kSubgraphInputNum); ++i) {
+        inputs.emplace_back(graphBuilder.CreateInput(i, ("replacement_input_" + std::to_string(i)).c_str(),
+                                                     inputDescs[i].GetDataType(), inputDescs[i].GetFormat(),
+                                                     inputDescs[i].GetShape().GetDims()));
+    }
+    GNode fusedNode = BuildFusedNode(graphBuilder, inputs, inplace, eps, additionalOutput);
+    for (int32_t i = 0; i < static_cast<int32_t>(kSubgraphInputNum); ++i) {
+        fusedNode.UpdateInputDesc(i, inputDescs[i]);
+    }
+
+    std::vector<es::EsTensorHolder> outputs;
+    for (int32_t i = 0; i < kFusedOutputNum; ++i) {
+        outputs.emplace_back(graphBuilder.GetCGraphBuilder()->GetTensorHolderFromNode(fusedNode, i));
+    }
+    auto graph = graphBuilder.BuildAndReset(outputs);
+    if (InferShape(graph, subgraphInputs) != SUCCESS) {
+        OPS_LOG_E(kPassName, "Infershape for replacement failed.");
+        return nullptr;
+    }
+    OPS_LOG_I(kPassName, "Replace Add + %s with %s, additional_output %d.", GetNodeType(lnNode).c_str(),
+              inplace ? kInplaceAddLayerNormType : kAddLayerNormType, additionalOutput);
+    return graph;
+}
+
+REG_FUSION_PASS(AddLayerNormFusionPass).Stage(CustomPassStage::kAfterInferShape);
+} // namespace ops
@@ -0,0 +1,244 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ge/compliant_node_builder.h"
+#include "ge/es_graph_builder.h"
+#include "platform/platform_info.h"
+#include "register/register_custom_pass.h"
+#include "../../../op_graph/fusion_pass/add_layer_norm_fusion_pass.h"
+
+using namespace fe;
+using namespace ge;
+using namespace ops;
+
+namespace {
+struct AddLayerNormCase {
+    const char* layerNormType = "LayerNorm";
+    std::vector<int64_t> x2Shape = {2, 128, 1024};
+    bool residualFromRelu = false;
+    // 非空时 x2 改由该类型的无输入源节点产生
+    const char* residualSourceType = nullptr;
+    bool extraAddConsumer = false;
+    bool useStats = false;
+};
+
+class AddLayerNormFusionPassTest : public testing::Test {
+protected:
+    void SetUp() override
+    {
+        PlatformInfo platform_info;
+        OptionalInfo optional_info;
+        platform_info.soc_info.ai_core_cnt = 48;
+        platform_info.str_info.short_soc_version = "Ascend910B";
+        optional_info.soc_version = "Ascend910B";
+        PlatformInfoManager::Instance().platform_info_map_["Ascend910B"] = platform_info;
+        PlatformInfoManager::Instance().SetOptionalCompilationInfo(optional_info);
+    }
+
+    static void UpdateDesc(GNode& node, bool isInput, int32_t index, const std::vector<int64_t>& shape)
+    {
+        TensorDesc desc;
+        if (isInput) {
+            node.GetInputDesc(index, desc);
+        } else {
+            node.GetOutputDesc(index, desc);
+        }
+        desc.SetDataType(DT_FLOAT16);
+        desc.SetFormat(FORMAT_ND);
+        desc.SetShape(Shape(shape));
+        desc.SetOriginShape(Shape(shape));
+        if (isInput) {
+            node.UpdateInputDesc(index, desc);
+        } else {
+            node.UpdateOutputDesc(index, desc);
+        }
+    }
+
+    static GNode AddNode(Graph* graph, const char* opType, const char* name,
+                         const std::vector<std::pair<GNode, int32_t>>& inputs, int32_t outputNum = 1)
+    {
+        std::vector<es::CompliantNodeBuilder::IrInputDef> irInputs;
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            irInputs.push_back({("x" + std::to_string(i)).c_str(), es::CompliantNodeBuilder::kEsIrInputRequired, ""});
+        }
+        std::vector<es::CompliantNodeBuilder::IrOutputDef> irOutputs;
+        for (int32_t i = 0; i < outputNum; ++i) {
+            irOutputs.push_back({("y" + std::to_string(i)).c_str(), es::CompliantNodeBuilder::kEsIrOutputRequired, ""});
+        }
+        GNode node =
+            es::CompliantNodeBuilder(graph).OpType(opType).Name(name).IrDefInputs(irInputs).IrDefOutputs(irOutputs).Build();
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            es::AddEdgeAndUpdatePeerDesc(*graph, inputs[i].first, inputs[i].second, node, static_cast<int32_t>(i));
+        }
+        return node;
+    }
+
+    static std::shared_ptr<Graph> BuildGraph(const AddLayerNormCase& param)
+    {
+        const std::vector<int64_t> xShape = {2, 128, 1024};
+        const std::vector<int64_t> gammaShape = {1024};
+        const std::vector<int64_t> statsShape = {2, 128, 1};
+
+        auto graphBuilder = es::EsGraphBuilder("add_layer_norm_fusion_test");
+        auto* graph = graphBuilder.GetCGraphBuilder()->GetGraph();
+        auto x1 = graphBuilder.CreateInput(0, "x1", DT_FLOAT16, FORMAT_ND, xShape);
+        auto x2 = graphBuilder.CreateInput(1, "x2", DT_FLOAT16, FORMAT_ND, param.x2Shape);
+        auto gamma = graphBuilder.CreateInput(2, "gamma", DT_FLOAT16, FORMAT_ND, gammaShape);
+        auto beta = graphBuilder.CreateInput(3, "beta", DT_FLOAT16, FORMAT_ND, gammaShape);
+
+        std::pair<GNode, int32_t> addIn1 = {*x1.GetProducer(), x1.GetProducerOutIndex()};
+        std::pair<GNode, int32_t> addIn2 = {*x2.GetProducer(), x2.GetProducerOutIndex()};
+        if (param.residualFromRelu) {
+            GNode relu1 = AddNode(graph, "Relu", "relu1", {addIn1});
+            GNode relu2 = AddNode(graph, "Relu", "relu2", {addIn2});
+            UpdateDesc(relu1, false, 0, xShape);
+            UpdateDesc(relu2, false, 0, param.x2Shape);
+            addIn1 = {relu1, 0};
+            addIn2 = {relu2, 0};
+        }
+        if (param.residualSourceType != nullptr) {
+            GNode source = AddNode(graph, param.residualSourceType, "residual_source", {});
+            UpdateDesc(source, false, 0, param.x2Shape);
+            addIn2 = {source, 0};
+        }
+        GNode add = AddNode(graph, "Add", "add", {addIn1, addIn2});
+        UpdateDesc(add, true, 0, xShape);
+        UpdateDesc(add, true, 1, param.x2Shape);
+        UpdateDesc(add, false, 0, xShape);
+
+        GNode ln = AddNode(graph, param.layerNormType, "layer_norm",
+                           {{add, 0},
+                            {*gamma.GetProducer(), gamma.GetProducerOutIndex()},
+                            {*beta.GetProducer(), beta.GetProducerOutIndex()}},
+                           3);
+        ln.SetAttr("begin_norm_axis", static_cast<int64_t>(-1));
+        ln.SetAttr("begin_params_axis", static_cast<int64_t>(-1));
+        ln.SetAttr("epsilon", 1e-5f);
+        UpdateDesc(ln, true, 0, xShape);
+        UpdateDesc(ln, true, 1, gammaShape);
+        UpdateDesc(ln, true, 2, gammaShape);
+        UpdateDesc(ln, false, 0, xShape);
+        UpdateDesc(ln, false, 1, statsShape);
+        UpdateDesc(ln, false, 2, statsShape);
+
+        std::vector<es::EsTensorHolder> outputs = {
+            es::EsTensorHolder(graphBuilder.GetCGraphBuilder()->GetTensorHolderFromNode(ln, 0))};
+        if (param.extraAddConsumer) {
+            outputs.emplace_back(graphBuilder.GetCGraphBuilder()->GetTensorHolderFromNode(add, 0));
+        }
+        if (param.useStats) {
+            outputs.emplace_back(graphBuilder.GetCGraphBuilder()->GetTensorHolderFromNode(ln, 2));
+        }
+        return graphBuilder.BuildAndReset(outputs);
+    }
+
+    static Status RunPass(std::shared_ptr<Graph>& graph)
+    {
+        CustomPassContext pass_context;
+        AddLayerNormFusionPass pass;
+        return pass.Run(graph, pass_context);
+    }
+
+    static bool FindNode(const std::shared_ptr<Graph>& graph, const std::string& op_type, GNode& out)
+    {
+        for (auto node : graph->GetAllNodes()) {
+            AscendString type;
+            node.GetType(type);
+            if (type == op_type.c_str()) {
+                out = node;
+                return true;
+            }
+        }
+        return false;
+    }
+};
+} // namespace
+
+TEST_F(AddLayerNormFusionPassTest, pattern_test)
+{
+    AddLayerNormFusionPass pass;
+    EXPECT_EQ(pass.Patterns().size(), 2U);
+}
+
+TEST_F(AddLayerNormFusionPassTest, add_layer_norm_fusion_success)
+{
+    AddLayerNormCase param;
+    auto graph = BuildGraph(param);
+    EXPECT_EQ(RunPass(graph), SUCCESS);
+    GNode fused;
+    ASSERT_TRUE(FindNode(graph, "AddLayerNorm", fused));
+    bool additionalOutput = true;
+    fused.GetAttr("additional_output", additionalOutput);
+    EXPECT_FALSE(additionalOutput);
+    float eps = 0.0f;
+    fused.GetAttr("epsilon", eps);
+    EXPECT_FLOAT_EQ(eps, 1e-5f);
+    GNode tmp;
+    EXPECT_FALSE(FindNode(graph, "LayerNorm", tmp));
+    EXPECT_FALSE(FindNode(graph, "Add", tmp));
+}
+
+TEST_F(AddLayerNormFusionPassTest, layer_norm_v3_residual_used_keep_x_output)
+{
+    AddLayerNormCase param;
+    param.layerNormType = "LayerNormV3";
+    param.extraAddConsumer = true;
+    auto graph = BuildGraph(param);
+    EXPECT_EQ(RunPass(graph), SUCCESS);
+    GNode fused;
+    ASSERT_TRUE(FindNode(graph, "AddLayerNorm", fused));
+    bool additionalOutput = false;
+    fused.GetAttr("additional_output", additionalOutput);
+    EXPECT_TRUE(additionalOutput);
+}
+
+TEST_F(AddLayerNormFusionPassTest, dead_residual_use_inplace)
+{
+    AddLayerNormCase param;
+    param.residualFromRelu = true;
+    auto graph = BuildGraph(param);
+    EXPECT_EQ(RunPass(graph), SUCCESS);
+    GNode fused;
+    EXPECT_TRUE(FindNode(graph, "InplaceAddLayerNorm", fused));
+    EXPECT_FALSE(FindNode(graph, "AddLayerNorm", fused));
+}
+
+TEST_F(AddLayerNormFusionPassTest, layer_norm_variance_used_not_fuse)
+{
+    AddLayerNormCase param;
+    param.useStats = true;
+    auto graph = BuildGraph(param);
+    EXPECT_EQ(RunPass(graph), GRAPH_NOT_CHANGED);
+}
+
+TEST_F(AddLayerNormFusionPassTest, add_broadcast_not_fuse)
+{
+    AddLayerNormCase param;
+    param.x2Shape = {1, 1, 1024};
+    auto graph = BuildGraph(param);
+    EXPECT_EQ(RunPass(graph), GRAPH_NOT_CHANGED);
+}
+
+TEST_F(AddLayerNormFusionPassTest, file_constant_residual_not_inplace)
+{
+    AddLayerNormCase param;
+    param.residualFromRelu = true;
+    param.residualSourceType = "FileConstant";
+    auto graph = BuildGraph(param);
+    EXPECT_EQ(RunPass(graph), SUCCESS);
+    GNode fused;
+    EXPECT_TRUE(FindNode(graph, "AddLayerNorm", fused));
+    EXPECT_FALSE(FindNode(graph, "InplaceAddLayerNorm", fused));
+}
@@ -0,0 +1,296 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * \file add_rms_norm_fusion_pass.cpp
+ * \brief Fusion pass for Add + RmsNorm -> AddRmsNorm/InplaceAddRmsNorm.
+ *
+ * Fusion pattern:
+ *      x1    x2
+ *        \  /
+ *        Add ----------------> other consumers (optional)
+ *         |   gamma
+ *         |  /
+ *       RmsNorm
+ *       /    \
+ *      y     rstd
+ *
+ *  ==>  AddRmsNorm(x1, x2, gamma) -> (y, rstd, x)
+ *       InplaceAddRmsNorm 在 x1/x2 除 Add 外无其他消费者时使用, y 复用 x1 内存, x 复用 x2 内存
+ *
+ * RmsNorm.rstd has the same shape and dtype as AddRmsNorm.rstd, so its consumers are kept.
+ */
+
+#include "add_rms_norm_fusion_pass.h"
+
+#include <algorithm>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "common/inc/error_util.h"
+#include "ge/compliant_node_builder.h"
+#include "ge/es_graph_builder.h"
+#include "ge/ge_utils.h"
+#include "norm/norm_common/op_graph/add_norm_fusion_utils.h"
+#include "platform/platform_info.h"
+
+using namespace ge;
+using namespace fe;
+using namespace fusion;
+
+namespace ops {
+namespace {
+constexpr char kPassName[] = "AddRmsNormFusionPass";
+
+constexpr char kAddType[] = "Add";
+constexpr char kRmsNormType[] = "RmsNorm";
+constexpr char kAddRmsNormType[] = "AddRmsNorm";
+constexpr char kInplaceAddRmsNormType[] = "InplaceAddRmsNorm";
+
+constexpr int64_t kAddCaptureIdx = 0;
+constexpr int64_t kRmsNormCaptureIdx = 1;
+
+constexpr int32_t kAddX1Idx = 0;
+constexpr int32_t kAddX2Idx = 1;
+constexpr int32_t kRmsNormGammaIdx = 1;
+constexpr int32_t kRmsNormYOutIdx = 0;
+constexpr int32_t kRmsNormRstdOutIdx = 1;
+constexpr int32_t kFusedOutputNum = 3;
+
+constexpr size_t kSubgraphInputNum = 3;
+constexpr float kDefaultEps = 1e-6f;
+
+const std::vector<DataType> kSupportDtypes = {DT_FLOAT16, DT_BF16, DT_FLOAT};
+
+bool IsTargetPlatform(DataType dtype)
+{
+    PlatformInfo platformInfo;
+    OptionalInfo optionalInfo;
+    OP_LOGE_IF(PlatformInfoManager::Instance().GetPlatformInfoWithOutSocVersion(platformInfo, optionalInfo) != SUCCESS,
+               false, kPassName, "Get platform_info failed.");
+    const std::string soc = platformInfo.str_info.short_soc_version;
+    OPS_LOG_D(kPassName, "Platform short soc: %s", soc.c_str());
+    const static std::set<std::string> kSupportSoc = {"Ascend910B", "Ascend910_93", "Ascend950", "Ascend310P"};
+    if (kSupportSoc.count(soc) == 0) {
+        OPS_LOG_D(kPassName, "Platform %s is not supported.", soc.c_str());
+        return false;
+    }
+    // 310P 上 AddRmsNorm 不支持 bf16
+    if (soc == "Ascend310P" && dtype == DT_BF16) {
+        OPS_LOG_D(kPassName, "bf16 is not supported on %s.", soc.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool GetCapturedNode(const std::unique_ptr<MatchResult>& matchResult, int64_t index, GNode& node)
+{
+    NodeIo nodeIo;
+    OP_LOGE_IF(matchResult->GetCapturedTensor(index, nodeIo) != SUCCESS, false, kPassName,
+               "get captured node failed, index is %ld.", index);
+    node = nodeIo.node;
+    return true;
+}
+
+PatternUniqPtr MakePattern()
+{
+    auto graphBuilder = es::EsGraphBuilder(kPassName);
+    auto graph = graphBuilder.GetCGraphBuilder()->GetGraph();
+    auto [x1, x2, gamma] = graphBuilder.CreateInputs<3>();
+
+    GNode addNode = es::CompliantNodeBuilder(graph)
+                        .OpType(kAddType)
+                        .Name("add")
+                        .IrDefInputs({{"x1", es::CompliantNodeBuilder::kEsIrInputRequired, ""},
+                                      {"x2", es::CompliantNodeBuilder::kEsIrInputRequired, ""}})
+                        .IrDefOutputs({{"y", es::CompliantNodeBuilder::kEsIrOutputRequired, ""}})
+                        .Build();
+    es::AddEdgeAndUpdatePeerDesc(*graph, *x1.GetProducer(), x1.GetProducerOutIndex(), addNode, kAddX1Idx);
+    es::AddEdgeAndUpdatePeerDesc(*graph, *x2.GetProducer(), x2.GetProducerOutIndex(), addNode, kAddX2Idx);
+
+    GNode rmsNormNode = es::CompliantNodeBuilder(graph)
+                            .OpType(kRmsNormType)
+                            .Name("rms_norm")
+                            .IrDefInputs({{"x", es::CompliantNodeBuilder::kEsIrInputRequired, ""},
+                                          {"gamma", es::CompliantNodeBuilder::kEsIrInputRequired, ""}})
+                            .IrDefOutputs({{"y", es::CompliantNodeBuilder::kEsIrOutputRequired, ""},
+                                           {"rstd", es::CompliantNodeBuilder::kEsIrOutputRequired, ""}})
+                            .Build();
+    es::AddEdgeAndUpdatePeerDesc(*graph, addNode, 0, rmsNormNode, 0);
+    es::AddEdgeAndUpdatePeerDesc(*graph, *gamma.GetProducer(), gamma.GetProducerOutIndex(), rmsNormNode,
+                                 kRmsNormGammaIdx);
+
+    // 输出顺序与 AddRmsNorm 的 (y, rstd, x) 一一对应
+    auto y = es::EsTensorHolder(graphBuilder.GetCGraphBuilder()->GetTensorHolderFromNode(rmsNormNode, kRmsNormYOutIdx));
+    auto rstd =
+        es::EsTensorHolder(graphBuilder.GetCGraphBuilder()->GetTensorHolderFromNode(rmsNormNode, kRmsNormRstdOutIdx));
+    auto addOut = es::EsTensorHolder(graphBuilder.GetCGraphBuilder()->GetTensorHolderFromNode(addNode, 0));
+    auto patternGraph = graphBuilder.BuildAndReset({y, rstd, addOut});
+    auto pattern = std::make_unique<Pattern>(std::move(*patternGraph));
+    pattern->CaptureTensor({addNode, 0}).CaptureTensor({rmsNormNode, kRmsNormYOutIdx});
+    return pattern;
+}
+
+bool IsDtypeSupported(DataType dtype)
+{
+    return std::find(kSupportDtypes.begin(), kSupportDtypes.end(), dtype) != kSupportDtypes.end();
+}
+
+bool IsInputDescValid(const GNode& addNode, const GNode& rmsNormNode)
+{
+    TensorDesc x1Desc;
+    TensorDesc x2Desc;
+    TensorDesc gammaDesc;
+    OP_LOGE_IF(addNode.GetInputDesc(kAddX1Idx, x1Desc) != GRAPH_SUCCESS ||
+                   addNode.GetInputDesc(kAddX2Idx, x2Desc) != GRAPH_SUCCESS ||
+                   rmsNormNode.GetInputDesc(kRmsNormGammaIdx, gammaDesc) != GRAPH_SUCCESS,
+               false, kPassName, "get Add/RmsNorm input desc failed.");
+    const DataType dtype = x1Desc.GetDataType();
+    if (!IsDtypeSupported(dtype) || x2Desc.GetDataType() != dtype || gammaDesc.GetDataType() != dtype) {
+        OPS_LOG_D(kPassName, "x1/x2/gamma dtype must be the same and in fp16/bf16/fp32.");
+        return false;
+    }
+    // AddRmsNorm 不支持 x1/x2 广播
+    const auto xDims = x1Desc.GetShape().GetDims();
+    if (xDims != x2Desc.GetShape().GetDims()) {
+        OPS_LOG_D(kPassName, "Add inputs need broadcast, not supported.");
+        return false;
+    }
+    // RmsNorm 在 gamma 覆盖的尾轴上归一化
+    const auto gammaDims = gammaDesc.GetShape().GetDims();
+    if (gammaDims.empty() || gammaDims.size() > xDims.size() ||
+        !std::equal(gammaDims.begin(), gammaDims.end(), xDims.end() - gammaDims.size())) {
+        OPS_LOG_D(kPassName, "RmsNorm gamma shape does not match the tail axes of x.");
+        return false;
+    }
+    return IsTargetPlatform(dtype);
+}
+
+// x1/x2 由普通计算节点产生且只被 Add 消费时, 残差 buffer 在融合后即失效, 可以原地改写
+bool IsResidualDead(const GNode& addNode)
+{
+    return add_norm_fusion::IsInplaceWritableInput(addNode, kAddX1Idx) &&
+           add_norm_fusion::IsInplaceWritableInput(addNode, kAddX2Idx);
+}
+
+Status InferShape(const GraphUniqPtr& replaceGraph, const std::vector<SubgraphInput>& subgraphInputs)
+{
+    std::vector<Shape> inputShapes;
+    for (const auto& subgraphInput : subgraphInputs) {
+        const auto allInputs = subgraphInput.GetAllInputs();
+        if (allInputs.empty()) {
+            OPS_LOG_E(kPassName, "subgraph input is empty.");
+            return FAILED;
+        }
+        TensorDesc tensorDesc;
+        const auto matchNode = allInputs.at(0);
+        if (matchNode.node.GetInputDesc(matchNode.index, tensorDesc) != GRAPH_SUCCESS) {
+            OPS_LOG_E(kPassName, "get subgraph input desc failed.");
+            return FAILED;
+        }
+        inputShapes.emplace_back(tensorDesc.GetShape());
+    }
+    return GeUtils::InferShape(*replaceGraph, inputShapes);
+}
+
+GNode BuildFusedNode(es::EsGraphBuilder& graphBuilder, const std::vector<es::EsTensorHolder>& inputs, bool inplace,
+                     float eps)
+{
+    auto graph = graphBuilder.GetCGraphBuilder()->GetGraph();
+    GNode node =
+        es::CompliantNodeBuilder(graph)
+            .OpType(inplace ? kInplaceAddRmsNormType : kAddRmsNormType)
+            .Name(inplace ? "inplace_add_rms_norm" : "add_rms_norm")
+            .IrDefInputs({{"x1", es::CompliantNodeBuilder::kEsIrInputRequired, ""},
+                          {"x2", es::CompliantNodeBuilder::kEsIrInputRequired, ""},
+                          {"gamma", es::CompliantNodeBuilder::kEsIrInputRequired, ""}})
+            .IrDefOutputs({{inplace ? "x1" : "y", es::CompliantNodeBuilder::kEsIrOutputRequired, ""},
+                           {"rstd", es::CompliantNodeBuilder::kEsIrOutputRequired, ""},
+                           {inplace ? "x2" : "x", es::CompliantNodeBuilder::kEsIrOutputRequired, ""}})
+            .IrDefAttrs({{"epsilon", es::CompliantNodeBuilder::kEsAttrOptional, "Float", es::CreateFrom(eps)}})
+            .Build();
+    for (int32_t i = 0; i < static_cast<int32_t>(inputs.size()); ++i) {
+        es::AddEdgeAndUpdatePeerDesc(*graph, *inputs[i].GetProducer(), inputs[i].GetProducerOutIndex(), node, i);
+    }
+    return node;
+}
+} // namespace
+
+std::vector<PatternUniqPtr> AddRmsNormFusionPass::Patterns()
+{
+    OPS_LOG_D(kPassName, "Enter Patterns for AddRmsNormFusionPass");
+    std::vector<PatternUniqPtr> patterns;
+    patterns.emplace_back(MakePattern());
+    return patterns;
+}
+
+bool AddRmsNormFusionPass::MeetRequirements(const std::unique_ptr<MatchResult>& matchResult)
+{
+    OPS_LOG_D(kPassName, "Enter MeetRequirements for AddRmsNormFusionPass");
+    GNode addNode;
+    GNode rmsNormNode;
+    if (!GetCapturedNode(matchResult, kAddCaptureIdx, addNode) ||
+        !GetCapturedNode(matchResult, kRmsNormCaptureIdx, rmsNormNode)) {
+        return false;
+    }
+    return IsInputDescValid(addNode, rmsNormNode);
+}
+
+GraphUniqPtr AddRmsNormFusionPass::Replacement(const std::unique_ptr<MatchResult>& matchResult)
+{
+    OPS_LOG_D(kPassName, "Enter Replacement for AddRmsNormFusionPass");
+    GNode addNode;
+    GNode rmsNormNode;
+    if (!GetCapturedNode(matchResult, kAddCaptureIdx, addNode) ||
+        !GetCapturedNode(matchResult, kRmsNormCaptureIdx, rmsNormNode)) {
+        return nullptr;
+    }
+    std::vector<SubgraphInput> subgraphInputs;
+    matchResult->ToSubgraphBoundary()->GetAllInputs(subgraphInputs);
+    OP_LOGE_IF(subgraphInputs.size() != kSubgraphInputNum, nullptr, kPassName,
+               "Subgraph input num %zu is not equal to 3.", subgraphInputs.size());
+
+    float eps = kDefaultEps;
+    OP_LOGW_IF(rmsNormNode.GetAttr("epsilon", eps) != GRAPH_SUCCESS, kPassName, "Get epsilon attr failed.");
+    const bool inplace = IsResidualDead(addNode);
+
+    std::vector<TensorDesc> inputDescs(kSubgraphInputNum);
+    OP_LOGE_IF(addNode.GetInputDesc(kAddX1Idx, inputDescs[0]) != GRAPH_SUCCESS ||
+                   addNode.GetInputDesc(kAddX2Idx, inputDescs[1]) != GRAPH_SUCCESS ||
+                   rmsNormNode.GetInputDesc(kRmsNormGammaIdx, inputDescs[2]) != GRAPH_SUCCESS,
+               nullptr, kPassName, "get Add/RmsNorm input desc failed.");
+    auto graphBuilder = es::EsGraphBuilder("replacement");
+    std::vector<es::EsTensorHolder> inputs;
+    for (int32_t i = 0; i < static_cast<int32_t>(kSubgraphInputNum); ++i) {
+        inputs.emplace_back(graphBuilder.CreateInput(i, ("replacement_input_" + std::to_string(i)).c_str(),
+                                                     inputDescs[i].GetDataType(), inputDescs[i].GetFormat(),
+                                                     inputDescs[i].GetShape().GetDims()));
+    }
+    GNode fusedNode = BuildFusedNode(graphBuilder, inputs, inplace, eps);
+    for (int32_t i = 0; i < static_cast<int32_t>(kSubgraphInputNum); ++i) {
+        fusedNode.UpdateInputDesc(i, inputDescs[i]);
+    }
+
+    std::vector<es::EsTensorHolder> outputs;
+    for (int32_t i = 0; i < kFusedOutputNum; ++i) {
+        outputs.emplace_back(graphBuilder.GetCGraphBuilder()->GetTensorHolderFromNode(fusedNode, i));
+    }
+    auto graph = graphBuilder.BuildAndReset(outputs);
+    if (InferShape(graph, subgraphInputs) != SUCCESS) {
+        OPS_LOG_E(kPassName, "Infershape for replacement failed.");
+        return nullptr;
+    }
+    OPS_LOG_I(kPassName, "Replace Add + RmsNorm with %s.", inplace ? kInplaceAddRmsNormType : kAddRmsNormType);
+    return graph;
+}
+
+REG_FUSION_PASS(AddRmsNormFusionPass).Stage(CustomPassStage::kAfterInferShape);
+} // namespace ops
@@ -13,6 +13,7 @@
  * \brief
  */
 
+#include <algorithm>
 #include "op_host/tiling_util.h"
 #include "add_rms_norm_tiling.h"
 
@@ -36,6 +37,15 @@ constexpr uint32_t MODE_SPLIT_D = 1;
 constexpr uint32_t MODE_MERGE_N = 2;
 constexpr uint32_t MODE_SINGLE_N = 3;
 constexpr uint32_t MODE_MULTI_N = 4;
+constexpr uint32_t MODE_SPLIT_D_X_RESIDENT = 5;
+// split-D UB 占用：每个列切块元素 b16 为 x1/x2(4B) + gamma/y(4B) + xFp32/sqx(8B)，b32 为 x1/x2(8B) + gamma/y/sqx(12B)
+constexpr uint64_t SPLIT_D_TILE_WEIGHT_B16 = 16;
+constexpr uint64_t SPLIT_D_TILE_WEIGHT_B32 = 20;
+// 每行额外占用：rstd(4B) + 块内 reduce 结果(8 * 4B)
+constexpr uint64_t SPLIT_D_ROW_EXTRA_BYTES = 36;
+constexpr uint64_t SPLIT_D_FIXED_BYTES = 256;
+// 常驻模式下列切块不小于该值，避免切块过碎导致 vector 指令效率下降
+constexpr uint64_t SPLIT_D_X_RESIDENT_MIN_TILE = 2048;
 constexpr int32_t RMS_INPUT_X1_INDEX = 0;
 constexpr int32_t RMS_INPUT_X2_INDEX = 1;
 constexpr int32_t RMS_INPUT_GAMMA_INDEX = 2;
@@ -359,16 +369,44 @@ static ge::DataType SetDataTypeParameters(gert::TilingContext* context, uint32_t
     return data_type;
 }
 
+// split-D 时若 rowFactor 行的 x1+x2 能与列切块 buffer 一起放入 UB，则常驻 UB，第二遍不再回读 GM
+static bool TrySplitDXResident(uint32_t numCol, uint32_t numColAlign, uint32_t blockFactor, uint32_t dtypKey,
+                               uint64_t ubSize, uint32_t dataPerBlock, uint32_t& ubFactor, uint32_t& rowFactor)
+{
+    if (addRmsNormSocVersion == platform_ascendc::SocVersion::ASCEND310P) {
+        return false;
+    }
+    uint64_t dtypeSize = (dtypKey == DTYPE_KEY_FP32) ? sizeof(float) : sizeof(uint16_t);
+    uint64_t tileWeight = (dtypKey == DTYPE_KEY_FP32) ? SPLIT_D_TILE_WEIGHT_B32 : SPLIT_D_TILE_WEIGHT_B16;
+    uint64_t rowBytes = static_cast<uint64_t>(numColAlign) * dtypeSize + SPLIT_D_ROW_EXTRA_BYTES;
+    uint64_t minTileBytes = tileWeight * SPLIT_D_X_RESIDENT_MIN_TILE;
+    if (ubSize < SPLIT_D_FIXED_BYTES + minTileBytes + rowBytes) {
+        return false;
+    }
+    uint64_t residentRows = (ubSize - SPLIT_D_FIXED_BYTES - minTileBytes) / rowBytes;
+    residentRows = std::min(residentRows, static_cast<uint64_t>(std::min(blockFactor, rowFactor)));
+    uint64_t tileNum = (ubSize - SPLIT_D_FIXED_BYTES - residentRows * rowBytes) / tileWeight;
+    tileNum = tileNum / dataPerBlock * dataPerBlock;
+    uint32_t colTileNum = Ops::Base::CeilDiv(numCol, static_cast<uint32_t>(tileNum));
+    ubFactor = Ops::Base::CeilDiv(numCol, colTileNum * dataPerBlock) * dataPerBlock;
+    rowFactor = static_cast<uint32_t>(residentRows);
+    return true;
+}
+
 static void DetermineModeParameters(AddRMSNormTilingData* tiling, uint32_t numCol, uint32_t& ubFactor,
                                     uint32_t& rowFactor, uint32_t blockFactor, uint32_t latsBlockFactor,
                                     ge::DataType dataType, uint32_t dtypKey, uint64_t ubSize, uint32_t dataPerBlock,
                                     uint32_t numColAlign, uint32_t& modeKey, uint32_t isPerformance)
 {
     if (numCol > ubFactor) {
-        modeKey = MODE_SPLIT_D;
-        ubFactor = (dataType == ge::DT_FLOAT) ? UB_FACTOR_B32_CUTD : UB_FACTOR_B16_CUTD;
-        uint32_t colTileNum = Ops::Base::CeilDiv(numCol, ubFactor);
-        ubFactor = Ops::Base::CeilDiv(numCol, colTileNum * dataPerBlock) * dataPerBlock;
+        if (TrySplitDXResident(numCol, numColAlign, blockFactor, dtypKey, ubSize, dataPerBlock, ubFactor, rowFactor)) {
+            modeKey = MODE_SPLIT_D_X_RESIDENT;
+        } else {
+            modeKey = MODE_SPLIT_D;
+            ubFactor = (dataType == ge::DT_FLOAT) ? UB_FACTOR_B32_CUTD : UB_FACTOR_B16_CUTD;
+            uint32_t colTileNum = Ops::Base::CeilDiv(numCol, ubFactor);
+            ubFactor = Ops::Base::CeilDiv(numCol, colTileNum * dataPerBlock) * dataPerBlock;
+        }
     } else if (blockFactor == 1 && addRmsNormSocVersion != platform_ascendc::SocVersion::ASCEND310P) {
         modeKey = MODE_SINGLE_N;
     } else if (numColAlign <= SMALL_REDUCE_NUM && addRmsNormSocVersion != platform_ascendc::SocVersion::ASCEND310P) {
@@ -47,6 +47,14 @@ extern "C" __global__ __aicore__ void add_rms_norm(GM_ADDR x1, GM_ADDR x2, GM_AD
     } else if (TILING_KEY_IS(31)) {
 #if !(defined(__NPU_ARCH__) && (__NPU_ARCH__ == 3003 || __NPU_ARCH__ == 3113))
         GENERAL_OP_IMPL(KernelAddRmsNormSplitD, bfloat16_t, 1);
+#endif
+    } else if (TILING_KEY_IS(15)) {
+        GENERAL_OP_IMPL(KernelAddRmsNormSplitD, half, 1, true);
+    } else if (TILING_KEY_IS(25)) {
+        GENERAL_OP_IMPL(KernelAddRmsNormSplitD, float, 1, true);
+    } else if (TILING_KEY_IS(35)) {
+#if !(defined(__NPU_ARCH__) && (__NPU_ARCH__ == 3003 || __NPU_ARCH__ == 3113))
+        GENERAL_OP_IMPL(KernelAddRmsNormSplitD, bfloat16_t, 1, true);
 #endif
     } else if (TILING_KEY_IS(12)) {
         GENERAL_OP_IMPL(KernelAddRmsNormMergeN, half, 1);
@@ -79,6 +87,12 @@ extern "C" __global__ __aicore__ void add_rms_norm(GM_ADDR x1, GM_ADDR x2, GM_AD
     } else if (TILING_KEY_IS(131)) {
 #if !(defined(__NPU_ARCH__) && __NPU_ARCH__ == 3003)
         GENERAL_OP_IMPL(KernelAddRmsNormSplitD, bfloat16_t, 2);
+#endif
+    } else if (TILING_KEY_IS(115)) {
+        GENERAL_OP_IMPL(KernelAddRmsNormSplitD, half, 2, true);
+    } else if (TILING_KEY_IS(135)) {
+#if !(defined(__NPU_ARCH__) && __NPU_ARCH__ == 3003)
+        GENERAL_OP_IMPL(KernelAddRmsNormSplitD, bfloat16_t, 2, true);
 #endif
     } else if (TILING_KEY_IS(112)) {
         GENERAL_OP_IMPL(KernelAddRmsNormMergeN, half, 2);
@@ -107,6 +121,12 @@ extern "C" __global__ __aicore__ void add_rms_norm(GM_ADDR x1, GM_ADDR x2, GM_AD
     } else if (TILING_KEY_IS(1031)) {
 #if !(defined(__NPU_ARCH__) && __NPU_ARCH__ == 3003)
         GENERAL_OP_IMPL(KernelAddRmsNormSplitD, bfloat16_t, 3);
+#endif
+    } else if (TILING_KEY_IS(1015)) {
+        GENERAL_OP_IMPL(KernelAddRmsNormSplitD, half, 3, true);
+    } else if (TILING_KEY_IS(1035)) {
+#if !(defined(__NPU_ARCH__) && __NPU_ARCH__ == 3003)
+        GENERAL_OP_IMPL(KernelAddRmsNormSplitD, bfloat16_t, 3, true);
 #endif
     } else if (TILING_KEY_IS(1012)) {
         GENERAL_OP_IMPL(KernelAddRmsNormMergeN, half, 3);
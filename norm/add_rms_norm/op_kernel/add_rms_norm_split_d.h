@@ -19,7 +19,12 @@
 using namespace AscendC;
 using namespace RmsNorm;
 
-template <typename T, int32_t MODE>
+/*
+ * X_RESIDENT: x1 + x2 of the rows in flight stays in UB across all column tiles, so the second pass
+ * (x * rstd * gamma) reads it from UB instead of re-reading x_out (or x1 and x2 in post mode) from GM.
+ * Chosen by tiling when rowFactor * numColAlign * sizeof(T) fits next to the tile buffers.
+ */
+template <typename T, int32_t MODE, bool X_RESIDENT = false>
 class KernelAddRmsNormSplitD {
 public:
     __aicore__ inline KernelAddRmsNormSplitD(TPipe* pipe) { Ppipe = pipe; }
@@ -32,6 +37,7 @@ public:
         this->blockFactor = tiling->block_factor;
         this->rowFactor = tiling->row_factor;
         this->ubFactor = tiling->ub_factor;
+        this->numColAlign = tiling->num_col_align;
         this->epsilon = tiling->epsilon;
         this->avgFactor = (this->numCol != 0) ? (float)1.0 / this->numCol : 0;
 
@@ -71,6 +77,9 @@ public:
         Ppipe->InitBuffer(sqxBuf, ubFactor * sizeof(float));
         Ppipe->InitBuffer(sumBuf, rowFactor * NUM_PER_BLK_FP32 * sizeof(float));
         Ppipe->InitBuffer(reduceFp32Buf, NUM_PER_REP_FP32 * sizeof(float));
+        if constexpr (X_RESIDENT) {
+            Ppipe->InitBuffer(xResidentBuf, rowFactor * numColAlign * sizeof(T));
+        }
     }
 
     __aicore__ inline void Process()
@@ -147,7 +156,13 @@ private:
         inQueueX.EnQue(splitX1X2Local);
     }
 
-    __aicore__ inline void CopyInAndAdd(uint32_t i_idx, uint32_t j_idx, uint32_t num)
+    __aicore__ inline uint32_t BlockAlignNum(uint32_t num)
+    {
+        constexpr uint32_t numPerBlock = BLOCK_SIZE / sizeof(T);
+        return RmsNorm::CeilDiv(num, numPerBlock) * numPerBlock;
+    }
+
+    __aicore__ inline void CopyInAndAdd(uint32_t i_idx, uint32_t i_i_idx, uint32_t j_idx, uint32_t num)
     {
         CopyInX1X2(i_idx, j_idx, num);
         LocalTensor<T> splitX1X2Local = inQueueX.DeQue<T>();
@@ -186,6 +201,13 @@ private:
         }
         inQueueX.FreeTensor(splitX1X2Local);
 
+        if constexpr (X_RESIDENT) {
+            // keep x1+x2 of this tile for ComputeLatter, tile tail is padded up to numColAlign
+            PipeBarrier<PIPE_V>();
+            LocalTensor<T> xResident = xResidentBuf.Get<T>();
+            DataCopy(xResident[i_i_idx * numColAlign + j_idx * ubFactor], splitXLocal, BlockAlignNum(num));
+        }
+
         // copy out to workspace && x_out
         outQueueY.EnQue(splitXLocal);
         auto x_out = outQueueY.DeQue<T>();
@@ -199,7 +221,7 @@ private:
                                          LocalTensor<float>& rstdLocal, LocalTensor<float>& sumLocal, uint32_t num)
     {
         for (uint32_t i_i = 0; i_i < calc_row_num; i_i++) {
-            CopyInAndAdd(i_o_idx * rowFactor + i_i, j_idx, num);
+            CopyInAndAdd(i_o_idx * rowFactor + i_i, i_i, j_idx, num);
             ComputeSum(i_i, sumLocal, num);
         }
         BlockReduceSumFP32(sumLocal, sumLocal, calc_row_num * NUM_PER_BLK_FP32);
@@ -246,7 +268,7 @@ private:
         CopyInGamma(j_idx, num);
         LocalTensor<T> splitGammaLocal = inQueueGamma.DeQue<T>();
         for (uint32_t i_i = 0; i_i < calc_row_num; i_i++) {
-            CopyInX(i_o_idx * rowFactor + i_i, j_idx, num);
+            CopyInX(i_o_idx * rowFactor + i_i, i_i, j_idx, num);
             ComputeY(i_i, splitGammaLocal, rstdLocal, num);
             CopyOutY(i_o_idx * rowFactor + i_i, j_idx, num);
         }
@@ -260,14 +282,19 @@ private:
         inQueueGamma.EnQue(gammaLocal);
     }
 
-    __aicore__ inline void CopyInX(uint32_t i_idx, uint32_t j_idx, uint32_t num)
+    __aicore__ inline void CopyInX(uint32_t i_idx, uint32_t i_i_idx, uint32_t j_idx, uint32_t num)
     {
-        if constexpr (MODE == ADD_RMS_NORM_MODE || MODE == PRE_RMS_NORM_MODE) {
+        if constexpr (X_RESIDENT) {
+            LocalTensor<T> xLocal = inQueueX.AllocTensor<T>();
+            LocalTensor<T> xResident = xResidentBuf.Get<T>();
+            DataCopy(xLocal, xResident[i_i_idx * numColAlign + j_idx * ubFactor], BlockAlignNum(num));
+            PipeBarrier<PIPE_V>();
+            inQueueX.EnQue<T>(xLocal);
+        } else if constexpr (MODE == ADD_RMS_NORM_MODE || MODE == PRE_RMS_NORM_MODE) {
             LocalTensor<T> xLocal = inQueueX.AllocTensor<T>();
             DataCopyCustom<T>(xLocal, xGm[i_idx * numCol + j_idx * ubFactor], num);
             inQueueX.EnQue<T>(xLocal);
-        }
-        if constexpr (MODE == POST_RMS_NORM_MODE) {
+        } else if constexpr (MODE == POST_RMS_NORM_MODE) {
             AddX(i_idx, j_idx, num);
         }
         if constexpr (is_same<T, half>::value || is_same<T, bfloat16_t>::value) {
@@ -380,6 +407,7 @@ private:
     TBuf<TPosition::VECCALC> sqxBuf;
     TBuf<TPosition::VECCALC> sumBuf;
     TBuf<TPosition::VECCALC> reduceFp32Buf;
+    TBuf<TPosition::VECCALC> xResidentBuf;
 
     GlobalTensor<T> x1Gm;
     GlobalTensor<T> x2Gm;
@@ -393,6 +421,7 @@ private:
     uint32_t blockFactor;
     uint32_t rowFactor;
     uint32_t ubFactor;
+    uint32_t numColAlign;
     float epsilon;
     float avgFactor;
     int32_t blockIdx_;
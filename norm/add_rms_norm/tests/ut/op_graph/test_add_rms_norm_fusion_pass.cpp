@@ -0,0 +1,218 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ge/compliant_node_builder.h"
+#include "ge/es_graph_builder.h"
+#include "platform/platform_info.h"
+#include "register/register_custom_pass.h"
+#include "../../../op_graph/fusion_pass/add_rms_norm_fusion_pass.h"
+
+using namespace fe;
+using namespace ge;
+using namespace ops;
+
+namespace {
+struct AddRmsNormCase {
+    std::vector<int64_t> x2Shape = {4, 2048};
+    std::vector<int64_t> gammaShape = {2048};
+    bool residualFromRelu = false;
+    // 非空时 x2 改由该类型的无输入源节点产生
+    const char* residualSourceType = nullptr;
+    bool useRstd = false;
+};
+
+class AddRmsNormFusionPassTest : public testing::Test {
+protected:
+    void SetUp() override
+    {
+        PlatformInfo platform_info;
+        OptionalInfo optional_info;
+        platform_info.soc_info.ai_core_cnt = 48;
+        platform_info.str_info.short_soc_version = "Ascend910B";
+        optional_info.soc_version = "Ascend910B";
+        PlatformInfoManager::Instance().platform_info_map_["Ascend910B"] = platform_info;
+        PlatformInfoManager::Instance().SetOptionalCompilationInfo(optional_info);
+    }
+
+    static void UpdateDesc(GNode& node, bool isInput, int32_t index, DataType dtype, const std::vector<int64_t>& shape)
+    {
+        TensorDesc desc;
+        if (isInput) {
+            node.GetInputDesc(index, desc);
+        } else {
+            node.GetOutputDesc(index, desc);
+        }
+        desc.SetDataType(dtype);
+        desc.SetFormat(FORMAT_ND);
+        desc.SetShape(Shape(shape));
+        desc.SetOriginShape(Shape(shape));
+        if (isInput) {
+            node.UpdateInputDesc(index, desc);
+        } else {
+            node.UpdateOutputDesc(index, desc);
+        }
+    }
+
+    static GNode AddNode(Graph* graph, const char* opType, const char* name,
+                         const std::vector<std::pair<GNode, int32_t>>& inputs, int32_t outputNum = 1)
+    {
+        std::vector<es::CompliantNodeBuilder::IrInputDef> irInputs;
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            irInputs.push_back({("x" + std::to_string(i)).c_str(), es::CompliantNodeBuilder::kEsIrInputRequired, ""});
+        }
+        std::vector<es::CompliantNodeBuilder::IrOutputDef> irOutputs;
+        for (int32_t i = 0; i < outputNum; ++i) {
+            irOutputs.push_back({("y" + std::to_string(i)).c_str(), es::CompliantNodeBuilder::kEsIrOutputRequired, ""});
+        }
+        GNode node =
+            es::CompliantNodeBuilder(graph).OpType(opType).Name(name).IrDefInputs(irInputs).IrDefOutputs(irOutputs).Build();
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            es::AddEdgeAndUpdatePeerDesc(*graph, inputs[i].first, inputs[i].second, node, static_cast<int32_t>(i));
+        }
+        return node;
+    }
+
+    static std::shared_ptr<Graph> BuildGraph(const AddRmsNormCase& param)
+    {
+        const std::vector<int64_t> xShape = {4, 2048};
+        const std::vector<int64_t> rstdShape = {4, 1};
+
+        auto graphBuilder = es::EsGraphBuilder("add_rms_norm_fusion_test");
+        auto* graph = graphBuilder.GetCGraphBuilder()->GetGraph();
+        auto x1 = graphBuilder.CreateInput(0, "x1", DT_BF16, FORMAT_ND, xShape);
+        auto x2 = graphBuilder.CreateInput(1, "x2", DT_BF16, FORMAT_ND, param.x2Shape);
+        auto gamma = graphBuilder.CreateInput(2, "gamma", DT_BF16, FORMAT_ND, param.gammaShape);
+
+        std::pair<GNode, int32_t> addIn1 = {*x1.GetProducer(), x1.GetProducerOutIndex()};
+        std::pair<GNode, int32_t> addIn2 = {*x2.GetProducer(), x2.GetProducerOutIndex()};
+        if (param.residualFromRelu) {
+            GNode relu1 = AddNode(graph, "Relu", "relu1", {addIn1});
+            GNode relu2 = AddNode(graph, "Relu", "relu2", {addIn2});
+            UpdateDesc(relu1, false, 0, DT_BF16, xShape);
+            UpdateDesc(relu2, false, 0, DT_BF16, param.x2Shape);
+            addIn1 = {relu1, 0};
+            addIn2 = {relu2, 0};
+        }
+        if (param.residualSourceType != nullptr) {
+            GNode source = AddNode(graph, param.residualSourceType, "residual_source", {});
+            UpdateDesc(source, false, 0, DT_BF16, param.x2Shape);
+            addIn2 = {source, 0};
+        }
+        GNode add = AddNode(graph, "Add", "add", {addIn1, addIn2});
+        UpdateDesc(add, true, 0, DT_BF16, xShape);
+        UpdateDesc(add, true, 1, DT_BF16, param.x2Shape);
+        UpdateDesc(add, false, 0, DT_BF16, xShape);
+
+        GNode rmsNorm =
+            AddNode(graph, "RmsNorm", "rms_norm", {{add, 0}, {*gamma.GetProducer(), gamma.GetProducerOutIndex()}}, 2);
+        rmsNorm.SetAttr("epsilon", 1e-6f);
+        UpdateDesc(rmsNorm, true, 0, DT_BF16, xShape);
+        UpdateDesc(rmsNorm, true, 1, DT_BF16, param.gammaShape);
+        UpdateDesc(rmsNorm, false, 0, DT_BF16, xShape);
+        UpdateDesc(rmsNorm, false, 1, DT_FLOAT, rstdShape);
+
+        std::vector<es::EsTensorHolder> outputs = {
+            es::EsTensorHolder(graphBuilder.GetCGraphBuilder()->GetTensorHolderFromNode(rmsNorm, 0))};
+        if (param.useRstd) {
+            outputs.emplace_back(graphBuilder.GetCGraphBuilder()->GetTensorHolderFromNode(rmsNorm, 1));
+        }
+        return graphBuilder.BuildAndReset(outputs);
+    }
+
+    static Status RunPass(std::shared_ptr<Graph>& graph)
+    {
+        CustomPassContext pass_context;
+        AddRmsNormFusionPass pass;
+        return pass.Run(graph, pass_context);
+    }
+
+    static bool FindNode(const std::shared_ptr<Graph>& graph, const std::string& op_type)
+    {
+        for (auto node : graph->GetAllNodes()) {
+            AscendString type;
+            node.GetType(type);
+            if (type == op_type.c_str()) {
+                return true;
+            }
+        }
+        return false;
+    }
+};
+} // namespace
+
+TEST_F(AddRmsNormFusionPassTest, pattern_test)
+{
+    AddRmsNormFusionPass pass;
+    EXPECT_EQ(pass.Patterns().size(), 1U);
+}
+
+TEST_F(AddRmsNormFusionPassTest, add_rms_norm_fusion_success)
+{
+    AddRmsNormCase param;
+    param.useRstd = true;
+    auto graph = BuildGraph(param);
+    EXPECT_EQ(RunPass(graph), SUCCESS);
+    EXPECT_TRUE(FindNode(graph, "AddRmsNorm"));
+    EXPECT_FALSE(FindNode(graph, "RmsNorm"));
+    EXPECT_FALSE(FindNode(graph, "Add"));
+}
+
+TEST_F(AddRmsNormFusionPassTest, dead_residual_use_inplace)
+{
+    AddRmsNormCase param;
+    param.residualFromRelu = true;
+    auto graph = BuildGraph(param);
+    EXPECT_EQ(RunPass(graph), SUCCESS);
+    EXPECT_TRUE(FindNode(graph, "InplaceAddRmsNorm"));
+    EXPECT_FALSE(FindNode(graph, "AddRmsNorm"));
+}
+
+TEST_F(AddRmsNormFusionPassTest, add_broadcast_not_fuse)
+{
+    AddRmsNormCase param;
+    param.x2Shape = {1, 2048};
+    auto graph = BuildGraph(param);
+    EXPECT_EQ(RunPass(graph), GRAPH_NOT_CHANGED);
+}
+
+TEST_F(AddRmsNormFusionPassTest, gamma_shape_mismatch_not_fuse)
+{
+    AddRmsNormCase param;
+    param.gammaShape = {4, 1};
+    auto graph = BuildGraph(param);
+    EXPECT_EQ(RunPass(graph), GRAPH_NOT_CHANGED);
+}
+
+TEST_F(AddRmsNormFusionPassTest, file_constant_residual_not_inplace)
+{
+    AddRmsNormCase param;
+    param.residualFromRelu = true;
+    param.residualSourceType = "FileConstant";
+    auto graph = BuildGraph(param);
+    EXPECT_EQ(RunPass(graph), SUCCESS);
+    EXPECT_TRUE(FindNode(graph, "AddRmsNorm"));
+    EXPECT_FALSE(FindNode(graph, "InplaceAddRmsNorm"));
+}
+
+TEST_F(AddRmsNormFusionPassTest, const_place_holder_residual_not_inplace)
+{
+    AddRmsNormCase param;
+    param.residualFromRelu = true;
+    param.residualSourceType = "ConstPlaceHolder";
+    auto graph = BuildGraph(param);
+    EXPECT_EQ(RunPass(graph), SUCCESS);
+    EXPECT_TRUE(FindNode(graph, "AddRmsNorm"));
+    EXPECT_FALSE(FindNode(graph, "InplaceAddRmsNorm"));
+}
@@ -291,6 +291,112 @@ TEST_F(add_rms_norm_test, test_case_21)
     free(path_);
 }
 
+TEST_F(add_rms_norm_test, test_case_15)
+{
+    size_t inputByteSize = 2 * 25600 * sizeof(int16_t);
+    size_t gammaByteSize = 25600 * sizeof(int16_t);
+    size_t outputByteSize = 2 * 25600 * sizeof(int16_t);
+    size_t rstdByteSize = 2 * sizeof(float);
+    size_t tiling_data_size = sizeof(AddRMSNormTilingData);
+
+    uint8_t* x1 = (uint8_t*)AscendC::GmAlloc(inputByteSize);
+    uint8_t* x2 = (uint8_t*)AscendC::GmAlloc(inputByteSize);
+    uint8_t* gamma = (uint8_t*)AscendC::GmAlloc(gammaByteSize);
+    uint8_t* y = (uint8_t*)AscendC::GmAlloc(outputByteSize);
+    uint8_t* rstd = (uint8_t*)AscendC::GmAlloc(rstdByteSize);
+    uint8_t* x = (uint8_t*)AscendC::GmAlloc(outputByteSize);
+    uint8_t* workspace = (uint8_t*)AscendC::GmAlloc(16 * 2);
+    uint8_t* tiling = (uint8_t*)AscendC::GmAlloc(tiling_data_size);
+    uint32_t blockDim = 2;
+    // system("cp -r ../../../../../../../ops/built-in/tests/ut/fast_op_test/rms_norm/rms_norm_data ./");
+    // system("chmod -R 755 ./rms_norm_data/");
+    // system("cd ./rms_norm_data/ && rm -rf ./*bin");
+    // system("cd ./rms_norm_data/ && python3 gen_data.py 1 80 2560 float16");
+    // system("cd ./rms_norm_data/ && python3 gen_tiling.py case0");
+
+    char* path_ = get_current_dir_name();
+    string path(path_);
+
+    AddRMSNormTilingData* tilingDatafromBin = reinterpret_cast<AddRMSNormTilingData*>(tiling);
+
+    tilingDatafromBin->num_row = 2;
+    tilingDatafromBin->num_col = 25600;
+    tilingDatafromBin->block_factor = 1;
+    tilingDatafromBin->row_factor = 1;
+    tilingDatafromBin->ub_factor = 8544;
+    tilingDatafromBin->num_col_align = 25600;
+    tilingDatafromBin->epsilon = 0.01;
+    tilingDatafromBin->avg_factor = 0.01;
+
+    // ReadFile(path + "/rms_norm_data/input_x.bin", inputByteSize, x, inputByteSize);
+    ICPU_SET_TILING_KEY(15);
+    AscendC::SetKernelMode(KernelMode::AIV_MODE);
+    ICPU_RUN_KF(add_rms_norm, blockDim, x1, x2, gamma, y, rstd, x, workspace, (uint8_t*)(tilingDatafromBin));
+
+    AscendC::GmFree(x1);
+    AscendC::GmFree(x2);
+    AscendC::GmFree(gamma);
+    AscendC::GmFree(y);
+    AscendC::GmFree(rstd);
+    AscendC::GmFree(x);
+    AscendC::GmFree(workspace);
+    AscendC::GmFree(tiling);
+    free(path_);
+}
+
+TEST_F(add_rms_norm_test, test_case_25)
+{
+    size_t inputByteSize = 2 * 25600 * sizeof(float);
+    size_t gammaByteSize = 25600 * sizeof(float);
+    size_t outputByteSize = 2 * 25600 * sizeof(float);
+    size_t rstdByteSize = 2 * sizeof(float);
+    size_t tiling_data_size = sizeof(AddRMSNormTilingData);
+
+    uint8_t* x1 = (uint8_t*)AscendC::GmAlloc(inputByteSize);
+    uint8_t* x2 = (uint8_t*)AscendC::GmAlloc(inputByteSize);
+    uint8_t* gamma = (uint8_t*)AscendC::GmAlloc(gammaByteSize);
+    uint8_t* y = (uint8_t*)AscendC::GmAlloc(outputByteSize);
+    uint8_t* rstd = (uint8_t*)AscendC::GmAlloc(rstdByteSize);
+    uint8_t* x = (uint8_t*)AscendC::GmAlloc(outputByteSize);
+    uint8_t* workspace = (uint8_t*)AscendC::GmAlloc(16 * 2);
+    uint8_t* tiling = (uint8_t*)AscendC::GmAlloc(tiling_data_size);
+    uint32_t blockDim = 2;
+    // system("cp -r ../../../../../../../ops/built-in/tests/ut/fast_op_test/rms_norm/rms_norm_data ./");
+    // system("chmod -R 755 ./rms_norm_data/");
+    // system("cd ./rms_norm_data/ && rm -rf ./*bin");
+    // system("cd ./rms_norm_data/ && python3 gen_data.py 1 80 2560 float16");
+    // system("cd ./rms_norm_data/ && python3 gen_tiling.py case0");
+
+    char* path_ = get_current_dir_name();
+    string path(path_);
+
+    AddRMSNormTilingData* tilingDatafromBin = reinterpret_cast<AddRMSNormTilingData*>(tiling);
+
+    tilingDatafromBin->num_row = 2;
+    tilingDatafromBin->num_col = 25600;
+    tilingDatafromBin->block_factor = 1;
+    tilingDatafromBin->row_factor = 1;
+    tilingDatafromBin->ub_factor = 4272;
+    tilingDatafromBin->num_col_align = 25600;
+    tilingDatafromBin->epsilon = 0.01;
+    tilingDatafromBin->avg_factor = 0.01;
+
+    // ReadFile(path + "/rms_norm_data/input_x.bin", inputByteSize, x, inputByteSize);
+    ICPU_SET_TILING_KEY(25);
+    AscendC::SetKernelMode(KernelMode::AIV_MODE);
+    ICPU_RUN_KF(add_rms_norm, blockDim, x1, x2, gamma, y, rstd, x, workspace, (uint8_t*)(tilingDatafromBin));
+
+    AscendC::GmFree(x1);
+    AscendC::GmFree(x2);
+    AscendC::GmFree(gamma);
+    AscendC::GmFree(y);
+    AscendC::GmFree(rstd);
+    AscendC::GmFree(x);
+    AscendC::GmFree(workspace);
+    AscendC::GmFree(tiling);
+    free(path_);
+}
+
 // TEST_F(add_rms_norm_test, test_case_31)
 // {
 //     size_t inputByteSize = 2 * 25600 * sizeof(int16_t);
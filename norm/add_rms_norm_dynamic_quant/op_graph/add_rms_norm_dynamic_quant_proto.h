@@ -35,6 +35,8 @@ namespace ge {
 *  if smooth_scales2 not exist:  \n
 *    scale2 = row_max(abs(rmsnorm_out)) / 127 \n
 *  y2 = round(rmsnorm_out / scale2) \n
+*  if group_index exist, row i uses row e of smooth_scale1/smooth_scale2, where e is the first expert with
+*  group_index[e] > i (rows are already permuted and grouped by expert). \n
 
 * @par Inputs:
 * @li x1: A tensor of type float16/bfloat16. Supported format "ND". \n
@@ -47,6 +49,10 @@ namespace ge {
 * The dtype is the same as x1, and the shape matches the last axis of x1. \n
 * @li beta: Optional Input. A tensor of type float16/bfloat16. Supported format "ND". \n
 * The dtype is the same as x1, and the shape matches the last axis of x1. \n
+* @li group_index: Optional Input. A tensor of type int32. Supported format "ND". \n
+* 1-D with shape [E], the cumulative row count of each expert, E must be not greater than 1024. \n
+* When group_index exists, smooth_scale1 must exist, smooth_scale1 and smooth_scale2 are 2-D with shape [E, D],
+* D is the last axis of x1. Only supported on Atlas A2/A3 series products. \n
 
 * @par Attributes:
 * epsilon: An optional Float, default value is 1e-6.
@@ -75,6 +81,7 @@ REG_OP(AddRmsNormDynamicQuant)
     .OPTIONAL_INPUT(smooth_scale1, TensorType({DT_FLOAT16, DT_BF16}))
     .OPTIONAL_INPUT(smooth_scale2, TensorType({DT_FLOAT16, DT_BF16}))
     .OPTIONAL_INPUT(beta, TensorType({DT_FLOAT16, DT_BF16}))
+    .OPTIONAL_INPUT(group_index, TensorType({DT_INT32}))
     .OUTPUT(y1, TensorType({DT_INT8, DT_HIFLOAT8, DT_FP8_E5M2, DT_FP8_E4M3FN, DT_INT4}))
     .OUTPUT(y2, TensorType({DT_INT8, DT_HIFLOAT8, DT_FP8_E5M2, DT_FP8_E4M3FN, DT_INT4}))
     .OUTPUT(x, TensorType({DT_FLOAT16, DT_BF16}))
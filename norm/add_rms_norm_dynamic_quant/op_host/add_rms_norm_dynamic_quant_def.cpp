@@ -24,6 +24,9 @@ static const std::vector<ge::DataType> scalesOutDataType950 = {ge::DT_FLOAT, ge:
 static const std::vector<ge::DataType> yDataType950 = {
     ge::DT_INT8,        ge::DT_INT8,     ge::DT_FLOAT8_E4M3FN, ge::DT_FLOAT8_E4M3FN, ge::DT_FLOAT8_E5M2,
     ge::DT_FLOAT8_E5M2, ge::DT_HIFLOAT8, ge::DT_HIFLOAT8,      ge::DT_INT4,          ge::DT_INT4};
+static const std::vector<ge::DataType> groupIndexDataType950 = {
+    ge::DT_INT32, ge::DT_INT32, ge::DT_INT32, ge::DT_INT32, ge::DT_INT32,
+    ge::DT_INT32, ge::DT_INT32, ge::DT_INT32, ge::DT_INT32, ge::DT_INT32};
 static const std::vector<ge::Format> format950 = {ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND,
                                                   ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND,
                                                   ge::FORMAT_ND, ge::FORMAT_ND};
@@ -67,6 +70,12 @@ public:
             .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND})
             .UnknownShapeFormat({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND})
             .AutoContiguous();
+        this->Input("group_index")
+            .ParamType(OPTIONAL)
+            .DataType({ge::DT_INT32, ge::DT_INT32, ge::DT_INT32, ge::DT_INT32})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND})
+            .AutoContiguous();
         this->Output("y1")
             .ParamType(REQUIRED)
             .DataType({ge::DT_INT8, ge::DT_INT8, ge::DT_INT4, ge::DT_INT4})
@@ -138,6 +147,12 @@ public:
             .Format(format950)
             .UnknownShapeFormat(format950)
             .AutoContiguous();
+        aicoreConfig.Input("group_index")
+            .ParamType(OPTIONAL)
+            .DataType(groupIndexDataType950)
+            .Format(format950)
+            .UnknownShapeFormat(format950)
+            .AutoContiguous();
         aicoreConfig.Output("y1")
             .ParamType(REQUIRED)
             .DataType(yDataType950)
@@ -224,6 +239,12 @@ private:
             .Format({ge::FORMAT_ND})
             .UnknownShapeFormat({ge::FORMAT_ND})
             .AutoContiguous();
+        config_kirin.Input("group_index")
+            .ParamType(OPTIONAL)
+            .DataType({ge::DT_INT32})
+            .Format({ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND})
+            .AutoContiguous();
         config_kirin.Output("y1")
             .ParamType(REQUIRED)
             .DataType({ge::DT_INT8})
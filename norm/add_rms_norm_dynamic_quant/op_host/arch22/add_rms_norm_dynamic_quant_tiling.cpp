@@ -22,6 +22,7 @@ constexpr int GAMMA_IDX = 2;
 constexpr int SMOOTH1_IDX = 3;
 constexpr int SMOOTH2_IDX = 4;
 constexpr int BETA_IDX = 5;
+constexpr int GROUP_INDEX_IDX = 6;
 
 constexpr int Y1_IDX = 0;
 constexpr int Y2_IDX = 1;
@@ -49,6 +50,8 @@ constexpr uint32_t INT4_ALIGN_SIZE = 64;
 constexpr uint32_t UB_TILING_POLICY_NORMAL = 1;
 constexpr uint32_t UB_TILING_POLICY_SINGLE_ROW = 2;
 constexpr uint32_t UB_TILING_POLICY_SLICE_D = 3;
+constexpr uint32_t UB_TILING_POLICY_NORMAL_GROUP = 4;
+constexpr uint32_t MAX_EXPERT_NUM = 1024;
 
 constexpr uint32_t SLICE_COL_LEN = 8864;
 constexpr uint32_t SLICE_COL_LEN_INT4 = 8832;
@@ -105,11 +108,12 @@ void AddRmsNormDynamicQuantTilingHelper::SetTilingDataAndTilingKeyAndWorkSpace(A
     tiling->set_outQuant2Flag(this->outQuant2Flag);
     tiling->set_avgFactor(this->avgFactor_);
     tiling->set_betaFlag(this->betaFlag_);
+    tiling->set_groupNum(this->groupNum_);
     uint32_t tilingKey = 0;
     size_t usrSize = USR_WORKSPACE_SIZE_910B;
 
     if (this->ubTilingPolicy_ == UB_TILING_POLICY::NORMAL) {
-        tilingKey += UB_TILING_POLICY_NORMAL;
+        tilingKey += (this->groupNum_ > 0) ? UB_TILING_POLICY_NORMAL_GROUP : UB_TILING_POLICY_NORMAL;
     } else if (this->ubTilingPolicy_ == UB_TILING_POLICY::SINGLE_ROW) {
         tilingKey += UB_TILING_POLICY_SINGLE_ROW;
     } else {
@@ -128,8 +132,9 @@ void AddRmsNormDynamicQuantTilingHelper::SetTilingDataAndTilingKeyAndWorkSpace(A
     size_t* currentWorkspace = context_->GetWorkspaceSizes(1);
     currentWorkspace[0] = this->sysWorkspaceSize_ + usrSize;
 
-    OP_LOGI("SetTilingDataAndTilingKeyAndWorkSpace", "Tilingdata useCore_: %lu, smoothNum1_: %u, smoothNum2_: %u",
-            this->useCore_, this->smoothNum1_, this->smoothNum2_);
+    OP_LOGI("SetTilingDataAndTilingKeyAndWorkSpace",
+            "Tilingdata useCore_: %lu, smoothNum1_: %u, smoothNum2_: %u, groupNum_: %u", this->useCore_,
+            this->smoothNum1_, this->smoothNum2_, this->groupNum_);
     OP_LOGI("Set TilingDataAndTilingKeyAndWorkSpace", "Tilingdata N: %lu, D:%lu, DAligned: %lu", numFirstDim_,
             numLastDim_, numLastDimAligned_);
     OP_LOGI("Set TilingDataAndTilingKeyAndWorkSpace", "Tilingdata firstDimPerCore_: %lu, firstDimPerCoreTail_: %lu",
@@ -379,17 +384,24 @@ bool AddRmsNormDynamicQuantTilingHelper::SetFlagsAndCheckConsistency()
     this->smoothNum2_ = (smooth2Exist) ? 1 : 0;
     this->betaFlag_ = (betaExist) ? 1 : 0;
 
+    // group_index 存在时 smooth 为 [E, D]，按专家取行，形状由 CheckGroupIndex 校验
+    const gert::StorageShape* groupShape = this->context_->GetOptionalInputShape(GROUP_INDEX_IDX);
+    bool groupExist = CheckOptionalShapeExisting(groupShape);
+    if (groupExist && !CheckGroupIndex(groupShape, smooth1Exist)) {
+        return false;
+    }
+
     // 检查形状匹配性
     auto gammaShape = context_->GetInputShape(GAMMA_IDX)->GetStorageShape();
     OP_TILING_CHECK(
-        (smooth1Exist && smooth1Shape->GetStorageShape() != gammaShape),
+        (!groupExist && smooth1Exist && smooth1Shape->GetStorageShape() != gammaShape),
         OP_LOGE_FOR_INVALID_SHAPES_WITH_REASON(
             context_->GetNodeName(), "gamma and smoothScale1",
             (Ops::Base::ToString(gammaShape) + " and " + Ops::Base::ToString(smooth1Shape->GetStorageShape())).c_str(),
             "The shapes of smoothScale1 and gamma should be the same when smoothScale1 is existed"),
         return false);
     OP_TILING_CHECK(
-        (smooth2Exist && smooth2Shape->GetStorageShape() != gammaShape),
+        (!groupExist && smooth2Exist && smooth2Shape->GetStorageShape() != gammaShape),
         OP_LOGE_FOR_INVALID_SHAPES_WITH_REASON(
             context_->GetNodeName(), "gamma and smoothScale2",
             (Ops::Base::ToString(gammaShape) + " and " + Ops::Base::ToString(smooth2Shape->GetStorageShape())).c_str(),
@@ -402,7 +414,64 @@ bool AddRmsNormDynamicQuantTilingHelper::SetFlagsAndCheckConsistency()
                         OP_LOGE(context_->GetNodeName(), "Smooth2 exist but smooth1 not exist, bad input."),
                         return false);
     }
+    // group_index 场景按专家 smooth 只在对应输出开启时生效，指定 output_mask 时不能关闭已提供 smooth 的输出
+    if (groupExist && this->outQuant1Flag != INT_NEGATIVE_ONE) {
+        OP_TILING_CHECK((smooth1Exist && this->outQuant1Flag != INT_ONE) ||
+                            (smooth2Exist && this->outQuant2Flag != INT_ONE),
+                        OP_LOGE(context_->GetNodeName(),
+                                "output_mask [%d, %d] must enable every output whose smooth scale is given "
+                                "when group_index is existed.",
+                                this->outQuant1Flag, this->outQuant2Flag),
+                        return false);
+    }
+
+    return true;
+}
+
+bool AddRmsNormDynamicQuantTilingHelper::CheckGroupIndex(const gert::StorageShape* groupShape, bool smooth1Exist)
+{
+    auto groupDtype = this->context_->GetOptionalInputDesc(GROUP_INDEX_IDX)->GetDataType();
+    OP_TILING_CHECK(groupDtype != ge::DataType::DT_INT32,
+                    OP_LOGE_FOR_INVALID_DTYPE(context_->GetNodeName(), "group_index",
+                                              Ops::Base::ToString(groupDtype).c_str(), "DT_INT32"),
+                    return false);
+    const gert::Shape& groupStorageShape = groupShape->GetStorageShape();
+    OP_TILING_CHECK(groupStorageShape.GetDimNum() != 1,
+                    OP_LOGE_FOR_INVALID_SHAPEDIM(context_->GetNodeName(), "group_index",
+                                                 std::to_string(groupStorageShape.GetDimNum()).c_str(), "1"),
+                    return false);
+    int64_t groupNum = groupStorageShape.GetDim(0);
+    OP_TILING_CHECK(groupNum > static_cast<int64_t>(MAX_EXPERT_NUM),
+                    OP_LOGE_FOR_INVALID_VALUE_WITH_REASON(context_->GetNodeName(), "group_index",
+                                                          std::to_string(groupNum).c_str(),
+                                                          "The expert num must be less than or equal to 1024"),
+                    return false);
+    OP_TILING_CHECK(!smooth1Exist,
+                    OP_LOGE_FOR_INVALID_VALUE_WITH_REASON(context_->GetNodeName(), "smoothScale1", "nullptr",
+                                                          "smoothScale1 must exist when group_index is existed"),
+                    return false);
 
+    // smooth_scale1/smooth_scale2: [E, D]
+    gert::Shape expectSmoothShape({groupNum, static_cast<int64_t>(this->numLastDim_)});
+    const auto checkSmoothShape = [this, &expectSmoothShape](int32_t idx, const char* name) -> bool {
+        const gert::StorageShape* shape = this->context_->GetOptionalInputShape(idx);
+        if (!CheckOptionalShapeExisting(shape)) {
+            return true;
+        }
+        OP_TILING_CHECK(shape->GetStorageShape() != expectSmoothShape,
+                        OP_LOGE_FOR_INVALID_SHAPE_WITH_REASON(
+                            this->context_->GetNodeName(), name,
+                            Ops::Base::ToString(shape->GetStorageShape()).c_str(),
+                            ("The shape should be " + Ops::Base::ToString(expectSmoothShape) +
+                             " when group_index is existed")
+                                .c_str()),
+                        return false);
+        return true;
+    };
+    if (!checkSmoothShape(SMOOTH1_IDX, "smoothScale1") || !checkSmoothShape(SMOOTH2_IDX, "smoothScale2")) {
+        return false;
+    }
+    this->groupNum_ = static_cast<uint32_t>(groupNum);
     return true;
 }
 
@@ -431,6 +500,15 @@ bool AddRmsNormDynamicQuantTilingHelper::GetShapeInfo()
 
 bool AddRmsNormDynamicQuantTilingHelper::DoUbTiling()
 {
+    if (this->groupNum_ > 0) {
+        // 按专家切换 smooth 仅在整行放得下 UB 时支持
+        OP_TILING_CHECK(!CheckUbNormalTiling(),
+                        OP_LOGE(context_->GetNodeName(),
+                                "Last dim %lu is too large to apply per-expert smooth scales with group_index.",
+                                this->numLastDim_),
+                        return false);
+        return true;
+    }
     OP_TILING_CHECK(CheckUbNormalTiling(), OP_LOGI(context_->GetNodeName(), "Ub Tiling: Normal."), return true);
     OP_TILING_CHECK(CheckUbSingleRowTiling(), OP_LOGI(context_->GetNodeName(), "Ub Tiling: SingleRow."), return true);
     OP_TILING_CHECK(CheckUbSliceDTiling(), OP_LOGI(context_->GetNodeName(), "Ub Tiling: SliceD."), return true);
@@ -44,6 +44,7 @@ TILING_DATA_FIELD_DEF(int32_t, outQuant1Flag);
 TILING_DATA_FIELD_DEF(int32_t, outQuant2Flag);
 TILING_DATA_FIELD_DEF(float, avgFactor);
 TILING_DATA_FIELD_DEF(uint32_t, betaFlag);
+TILING_DATA_FIELD_DEF(uint32_t, groupNum);
 END_TILING_DATA_DEF;
 
 REGISTER_TILING_DATA_CLASS(AddRmsNormDynamicQuant, AddRmsNormDynamicQuantTilingData)
@@ -97,6 +98,7 @@ private:
     bool ValidateInputOutputDtype();
     bool CalculateShapeParameters();
     bool SetFlagsAndCheckConsistency();
+    bool CheckGroupIndex(const gert::StorageShape* groupShape, bool smooth1Exist);
 
     gert::TilingContext* context_;
 
@@ -123,6 +125,7 @@ private:
     uint32_t smoothNum1_{0};
     uint32_t smoothNum2_{0};
     uint32_t betaFlag_{0};
+    uint32_t groupNum_{0};
     uint32_t dstType_{2};
 
     UB_TILING_POLICY ubTilingPolicy_{UB_TILING_POLICY::SINGLE_ROW};
@@ -509,6 +509,10 @@ ge::graphStatus Tiling4AddRmsNormDynamicQuant(gert::TilingContext* context)
 {
     OP_TILING_CHECK(nullptr == context, OP_LOGE("AddRmsNormDynamicQuant", "Context is null"), return ge::GRAPH_FAILED);
     OP_LOGI(context->GetNodeName(), "Enter Tiling4AddRmsNormDynamicQuant (A5)");
+    auto groupIndexShape = context->GetOptionalInputShape(GROUP_INDEX_INDEX);
+    OP_TILING_CHECK((groupIndexShape != nullptr) && (groupIndexShape->GetStorageShape().GetShapeSize() > 0),
+                    OP_LOGE(context->GetNodeName(), "group_index is not supported on this soc version."),
+                    return ge::GRAPH_FAILED);
     auto colShape = context->GetInputShape(GAMMA_INDEX);
     OPS_CHECK_NULL_WITH_CONTEXT(context, colShape);
     auto colStorageShape = colShape->GetStorageShape();
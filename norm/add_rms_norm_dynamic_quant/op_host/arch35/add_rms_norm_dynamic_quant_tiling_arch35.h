@@ -36,6 +36,7 @@ constexpr uint64_t GAMMA_INDEX = 2;
 constexpr uint64_t SMOOTH_SCALE1_INDEX = 3;
 constexpr uint64_t SMOOTH_SCALE2_INDEX = 4;
 constexpr uint64_t BETA_INDEX = 5;
+constexpr uint64_t GROUP_INDEX_INDEX = 6;
 constexpr uint64_t Y1_INDEX = 0;
 constexpr uint64_t Y2_INDEX = 1;
 constexpr uint64_t X_INDEX = 2;
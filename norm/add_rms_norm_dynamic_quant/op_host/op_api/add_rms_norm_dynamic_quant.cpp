@@ -73,7 +73,7 @@ inline static const std::array<aclTensor*, ADD_RMS_NORM_DYNAMIC_QUANT_OUT_NUM> A
             op::ToString(y2Out->GetViewShape()).GetString(), op::ToString(xOut->GetViewShape()).GetString());
 
     ADD_TO_LAUNCHER_LIST_AICORE(
-        AddRmsNormDynamicQuant, OP_INPUT(x1, x2, gamma, smoothScale1Optional, smoothScale2Optional, betaOptional),
+        AddRmsNormDynamicQuant, OP_INPUT(x1, x2, gamma, smoothScale1Optional, smoothScale2Optional, betaOptional, nullptr),
         OP_OUTPUT(y1Out, y2Out, xOut, scale1Out, scale2Out), OP_ATTR(static_cast<float>(epsilon), outputMask, dstType));
     OP_LOGI("AddRmsNormDynamicQuant Launch finish.");
 
@@ -17,9 +17,9 @@
 #include "add_rms_norm_dynamic_quant_cut_d_kernel.h"
 
 extern "C" __global__ __aicore__ void add_rms_norm_dynamic_quant(GM_ADDR x1, GM_ADDR x2, GM_ADDR gamma, GM_ADDR smooth1,
-                                                                 GM_ADDR smooth2, GM_ADDR beta, GM_ADDR y1, GM_ADDR y2,
-                                                                 GM_ADDR x, GM_ADDR outScale1, GM_ADDR outScale2,
-                                                                 GM_ADDR workspace, GM_ADDR tiling)
+                                                                 GM_ADDR smooth2, GM_ADDR beta, GM_ADDR groupIndex,
+                                                                 GM_ADDR y1, GM_ADDR y2, GM_ADDR x, GM_ADDR outScale1,
+                                                                 GM_ADDR outScale2, GM_ADDR workspace, GM_ADDR tiling)
 {
     TPipe pipe;
     GET_TILING_DATA(tilingData, tiling);
@@ -39,5 +39,10 @@ extern "C" __global__ __aicore__ void add_rms_norm_dynamic_quant(GM_ADDR x1, GM_
     } else if (TILING_KEY_IS(3)) {
         KernelAddRmsNormDynamicQuantSliceD<DTYPE_X1, DTYPE_Y1, 3> op(&pipe);
         INIT_AND_PROCESS;
+    } else if (TILING_KEY_IS(4)) {
+        // Normal + group_index: smooth scales are [E, D], picked per row by expert.
+        KernelAddRmsNormDynamicQuantNormal<DTYPE_X1, DTYPE_Y1, 4> op(&pipe);
+        op.InitGroupIndex(groupIndex, &tilingData);
+        INIT_AND_PROCESS;
     }
 }
\ No newline at end of file
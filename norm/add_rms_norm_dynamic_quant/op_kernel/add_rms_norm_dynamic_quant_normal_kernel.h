@@ -18,6 +18,8 @@
 
 #include "add_rms_norm_dynamic_quant_base.h"
 
+constexpr int TILING_KEY_NORMAL_GROUP = 4;
+
 template <typename T, typename T_Y, int TILING_KEY, int BUFFER_NUM = 1>
 class KernelAddRmsNormDynamicQuantNormal : public KernelAddRmsNormDynamicQuantBase<T, T_Y, TILING_KEY, BUFFER_NUM> {
 public:
@@ -52,6 +54,17 @@ public:
         Ppipe->InitBuffer(scalesBuf, 2 * this->numRowsAligned * sizeof(float));
     }
 
+    /*
+      group_index[e] 为专家 e 的累计行数，行 r 使用首个 group_index[e] > r 的专家 e 的 smooth 行，
+      超出 group_index[E - 1] 的行归最后一个专家。
+    */
+    __aicore__ inline void InitGroupIndex(GM_ADDR groupIndex, const AddRmsNormDynamicQuantTilingData* tiling)
+    {
+        groupIndexGm.SetGlobalBuffer((__gm__ int32_t*)groupIndex);
+        groupNum = tiling->groupNum;
+        blockExpertId = 0;
+    }
+
     __aicore__ inline void Process()
     {
         int32_t rowMoveCnt1 = CEIL_DIV(this->rowWork, this->rowStep);
@@ -68,7 +81,7 @@ public:
             AddX1X2(gmOffset, elementCount);
             CopyOutX(gmOffset, this->rowStep, elementCount);
             ComputeRmsNorm(this->rowStep, elementCount, gammaLocal);
-            ComputeDynamicQuant(this->rowStep, elementCount);
+            ComputeDynamicQuant(this->rowStep, elementCount, gmOffsetScale);
             CopyOut(gmOffset, gmOffsetScale, this->rowStep);
             gmOffset += static_cast<int64_t>(this->rowStep) * this->numLastDim;
             gmOffsetScale += this->rowStep;
@@ -80,7 +93,7 @@ public:
             AddX1X2(gmOffset, elementCount);
             CopyOutX(gmOffset, this->rowTail_, elementCount);
             ComputeRmsNorm(this->rowTail_, elementCount, gammaLocal);
-            ComputeDynamicQuant(this->rowTail_, elementCount);
+            ComputeDynamicQuant(this->rowTail_, elementCount, gmOffsetScale);
             CopyOut(gmOffset, gmOffsetScale, this->rowTail_);
         }
     }
@@ -147,11 +160,12 @@ private:
     {
         LocalTensor<T> gammaLocal = weightBuf01.template Get<T>();
         DataCopyEx(gammaLocal, this->gammaGm, this->numLastDim);
-        if ((this->isOld && this->smooth1Exist) || this->newSingleFirst) {
+        // group 模式下 smooth 按专家在 quant 阶段加载
+        if (TILING_KEY != TILING_KEY_NORMAL_GROUP && ((this->isOld && this->smooth1Exist) || this->newSingleFirst)) {
             LocalTensor<T> smooth1Local = weightBuf02.template Get<T>();
             DataCopyEx(smooth1Local, this->smooth1Gm, this->numLastDim);
         }
-        if (this->oldDouble || this->newSingleSecond) {
+        if (TILING_KEY != TILING_KEY_NORMAL_GROUP && (this->oldDouble || this->newSingleSecond)) {
             LocalTensor<T> smooth2Local = weightBuf03.template Get<T>();
             DataCopyEx(smooth2Local, this->smooth2Gm, this->numLastDim);
         }
@@ -204,17 +218,57 @@ private:
         }
     }
 
-    __aicore__ inline void ComputeDynamicQuant(int32_t nums, int64_t elementCount)
+    __aicore__ inline void ComputeDynamicQuant(int32_t nums, int64_t elementCount, int64_t rowOffset)
     {
         LocalTensor<float> xLocalFp32 = xBufFp32.Get<float>(); // xLocalFp32 <-- y
         LocalTensor<float> scaleLocal = scalesBuf.Get<float>();
         LocalTensor<float> zLocalFp32 = outRowsQue.template AllocTensor<float>();
         LocalTensor<T_Y> outQuant01 = zLocalFp32.ReinterpretCast<T_Y>();
+        if constexpr (TILING_KEY == TILING_KEY_NORMAL_GROUP) {
+            blockRowStart = static_cast<int64_t>(this->blockIdx_ * this->firstDimPerCore) + rowOffset;
+            blockExpertId = SeekExpert(blockExpertId, blockRowStart);
+        }
         doQuant1withFlag(scaleLocal, xLocalFp32, outQuant01, nums, elementCount);
         doQuant2withFlag(scaleLocal, xLocalFp32, outQuant01, nums, elementCount);
         outRowsQue.EnQue(zLocalFp32);
     }
 
+    // 从 expertId 开始单调前移，返回全局行 row 所属专家
+    __aicore__ inline uint32_t SeekExpert(uint32_t expertId, int64_t row)
+    {
+        while (expertId + 1 < groupNum && static_cast<int64_t>(groupIndexGm.GetValue(expertId)) <= row) {
+            expertId++;
+        }
+        return expertId;
+    }
+
+    // dst[rid] = src[rid] * smooth[expert(rid)]，连续同专家的行共用一次加载
+    __aicore__ inline void MulGroupSmooth(LocalTensor<float>& dstFp32, LocalTensor<float>& srcFp32,
+                                          LocalTensor<float>& smoothFp32, LocalTensor<T>& smoothLocal,
+                                          GlobalTensor<T>& smoothGm, int32_t nums)
+    {
+        uint32_t expertId = blockExpertId;
+        uint32_t loadedExpertId = groupNum;
+        for (int32_t rid = 0; rid < nums; ++rid) {
+            expertId = SeekExpert(expertId, blockRowStart + rid);
+            if (expertId != loadedExpertId) {
+                event_t eventVMte2 = static_cast<event_t>(GetTPipePtr()->FetchEventID(HardEvent::V_MTE2));
+                SetFlag<HardEvent::V_MTE2>(eventVMte2);
+                WaitFlag<HardEvent::V_MTE2>(eventVMte2);
+                DataCopyEx(smoothLocal, smoothGm[expertId * this->numLastDim], this->numLastDim);
+                event_t eventMte2V = static_cast<event_t>(GetTPipePtr()->FetchEventID(HardEvent::MTE2_V));
+                SetFlag<HardEvent::MTE2_V>(eventMte2V);
+                WaitFlag<HardEvent::MTE2_V>(eventMte2V);
+                Cast(smoothFp32, smoothLocal, RoundMode::CAST_NONE, this->numLastDim);
+                PipeBarrier<PIPE_V>();
+                loadedExpertId = expertId;
+            }
+            Mul(dstFp32[rid * this->numLastDimAligned], srcFp32[rid * this->numLastDimAligned], smoothFp32,
+                this->numLastDim);
+            PipeBarrier<PIPE_V>();
+        }
+    }
+
     __aicore__ inline void doQuant1withFlag(LocalTensor<float> scaleLocal, LocalTensor<float> xLocalFp32,
                                             LocalTensor<T_Y> outQuant01, int32_t nums, int64_t elementCount)
     {
@@ -224,7 +278,12 @@ private:
         LocalTensor<float> tmpFp32 = inRowsQue.template AllocTensor<float>();
         LocalTensor<float> yLocalFp32 = yBufFp32.Get<float>();
         LocalTensor<float> scale1Local = scaleLocal[0];
-        if (this->smooth1Exist) {
+        if constexpr (TILING_KEY == TILING_KEY_NORMAL_GROUP) {
+            // smooth1 一定存在，最后一行作为 fp32 smooth 暂存区，按行递增处理不会覆盖未计算的行
+            LocalTensor<T> smooth1Local = weightBuf02.Get<T>();
+            LocalTensor<float> smooth1Fp32 = yLocalFp32[(nums - 1) * this->numLastDimAligned];
+            MulGroupSmooth(yLocalFp32, xLocalFp32, smooth1Fp32, smooth1Local, this->smooth1Gm, nums);
+        } else if (this->smooth1Exist) {
             // compute smooth1
             LocalTensor<T> smooth1Local = weightBuf02.Get<T>();
             LocalTensor<float> smooth1Fp32 = yLocalFp32[(nums - 1) * this->numLastDimAligned];
@@ -266,7 +325,10 @@ private:
         LocalTensor<float> scale2Local = scaleLocal[this->numRowsAligned];
         LocalTensor<float> yLocalFp32 = yBufFp32.Get<float>();
         LocalTensor<T_Y> outQuant02 = outQuant01[elementCount];
-        if (this->smooth2Exist) {
+        if (TILING_KEY == TILING_KEY_NORMAL_GROUP && this->smooth2Exist) {
+            LocalTensor<T> smooth2Local = weightBuf03.Get<T>();
+            MulGroupSmooth(xLocalFp32, xLocalFp32, tmpFp32, smooth2Local, this->smooth2Gm, nums);
+        } else if (this->smooth2Exist) {
             LocalTensor<T> smooth2Local = weightBuf03.Get<T>();
             Cast(tmpFp32, smooth2Local, RoundMode::CAST_NONE, this->numLastDim);
             PipeBarrier<PIPE_V>();
@@ -356,6 +418,11 @@ private:
 
     uint32_t numRowsAligned;
     uint32_t ubAligned;
+
+    GlobalTensor<int32_t> groupIndexGm;
+    uint32_t groupNum = 0;
+    uint32_t blockExpertId = 0;
+    int64_t blockRowStart = 0;
 };
 
 #endif // __ADD_RMS_NORM_DYNAMIC_QUANT_NORMAL_KERNEL_H_
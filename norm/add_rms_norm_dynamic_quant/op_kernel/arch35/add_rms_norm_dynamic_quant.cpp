@@ -16,10 +16,12 @@
 
 template <int8_t COMPUTE_MODE, bool Y3_MODE, bool Y4_MODE>
 __global__ __aicore__ void add_rms_norm_dynamic_quant(GM_ADDR x1, GM_ADDR x2, GM_ADDR gamma, GM_ADDR smoothScale1,
-                                                      GM_ADDR smoothScale2, GM_ADDR beta, GM_ADDR y1, GM_ADDR y2,
-                                                      GM_ADDR x, GM_ADDR scale1, GM_ADDR scale2, GM_ADDR workspace,
-                                                      GM_ADDR tiling)
+                                                      GM_ADDR smoothScale2, GM_ADDR beta, GM_ADDR groupIndex,
+                                                      GM_ADDR y1, GM_ADDR y2, GM_ADDR x, GM_ADDR scale1, GM_ADDR scale2,
+                                                      GM_ADDR workspace, GM_ADDR tiling)
 {
+    // group_index is rejected by arch35 tiling.
+    (void)groupIndex;
     add_rms_norm_dynamic_quant_impl<COMPUTE_MODE, Y3_MODE, Y4_MODE>(x1, x2, gamma, smoothScale1, smoothScale2, beta, y1,
                                                                     y2, nullptr, nullptr, x, scale1, scale2, workspace,
                                                                     tiling);
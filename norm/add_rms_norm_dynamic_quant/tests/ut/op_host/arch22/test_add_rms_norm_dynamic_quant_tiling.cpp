@@ -153,6 +153,98 @@ static void ExecuteTestCase(gert::StorageShape input_shape, gert::StorageShape g
     ASSERT_EQ(tiling_key, expected_tiling_key);
 }
 
+static void ExecuteGroupTestCase(gert::StorageShape input_shape, gert::StorageShape gamma_shape,
+                                 gert::StorageShape smooth_shape, gert::StorageShape group_shape,
+                                 ge::DataType group_dtype, int expected_tiling_key,
+                                 ge::graphStatus status = ge::GRAPH_SUCCESS,
+                                 const std::vector<bool>& output_mask = {})
+{
+    string compile_info_string = R"({
+   "hardware_info": {"BT_SIZE": 0, "load3d_constraints": "1",
+                     "Intrinsic_fix_pipe_l0c2out": false, "Intrinsic_data_move_l12ub": true, "Intrinsic_data_move_l0c2ub": true, "Intrinsic_data_move_out2l1_nd2nz": false,
+                     "UB_SIZE": 196608, "L2_SIZE": 33554432, "L1_SIZE": 524288,
+                     "L0A_SIZE": 65536, "L0B_SIZE": 65536, "L0C_SIZE": 131072,
+                     "CORE_NUM": 40}
+                     })";
+    map<string, string> soc_infos;
+    map<string, string> aicore_spec;
+    map<string, string> intrinsics;
+    GetPlatFormInfos(compile_info_string.c_str(), soc_infos, aicore_spec, intrinsics);
+
+    fe::PlatFormInfos platform_info;
+    platform_info.Init();
+    optiling::AddRmsNormDynamicQuantCompileInfo compile_info;
+
+    std::string op_type("AddRmsNormDynamicQuant");
+    ASSERT_NE(gert::OpImplRegistry::GetInstance().GetOpImpl(op_type.c_str()), nullptr);
+    auto tiling_func = gert::OpImplRegistry::GetInstance().GetOpImpl(op_type.c_str())->tiling;
+    auto tiling_parse_func = gert::OpImplRegistry::GetInstance().GetOpImpl(op_type.c_str())->tiling_parse;
+
+    auto kernel_holder = gert::KernelRunContextFaker()
+                             .KernelIONum(2, 1)
+                             .Inputs({const_cast<char*>(compile_info_string.c_str()),
+                                      reinterpret_cast<void*>(&platform_info)})
+                             .Outputs({&compile_info})
+                             .Build();
+
+    ASSERT_TRUE(kernel_holder.GetContext<gert::TilingParseContext>()->GetPlatformInfo()->Init());
+    kernel_holder.GetContext<gert::TilingParseContext>()->GetPlatformInfo()->SetPlatformRes("SoCInfo", soc_infos);
+    kernel_holder.GetContext<gert::TilingParseContext>()->GetPlatformInfo()->SetPlatformRes("AICoreSpec", aicore_spec);
+    kernel_holder.GetContext<gert::TilingParseContext>()->GetPlatformInfo()->SetCoreNumByCoreType("AICore");
+    kernel_holder.GetContext<gert::TilingParseContext>()->GetPlatformInfo()->SetPlatformRes("AICoreintrinsicDtypeMap",
+                                                                                            intrinsics);
+
+    ASSERT_EQ(tiling_parse_func(kernel_holder.GetContext<gert::KernelContext>()), ge::GRAPH_SUCCESS);
+
+    auto param = gert::TilingData::CreateCap(4096);
+    auto workspace_size_holer = gert::ContinuousVector::Create<size_t>(4096);
+    auto ws_size = reinterpret_cast<gert::ContinuousVector*>(workspace_size_holer.get());
+    ASSERT_NE(param, nullptr);
+
+    gert::StorageShape reduce_shape = {{input_shape.GetStorageShape().GetDim(0)},
+                                       {input_shape.GetStorageShape().GetDim(0)}};
+    // x1, x2, gamma, smooth1, smooth2, beta(absent), group_index
+    gert::StorageShape beta_shape = {{0}, {0}};
+    auto holder = gert::TilingContextFaker()
+                      .NodeIoNum(7, 5)
+                      .IrInstanceNum({1, 1, 1, 1, 1, 1, 1})
+                      .InputShapes({&input_shape, &input_shape, &gamma_shape, &smooth_shape, &smooth_shape,
+                                    &beta_shape, &group_shape})
+                      .OutputShapes({&input_shape, &input_shape, &input_shape, &reduce_shape, &reduce_shape})
+                      .CompileInfo(&compile_info)
+                      .PlatformInfo(reinterpret_cast<char*>(&platform_info))
+                      .NodeInputTd(0, ge::DT_FLOAT16, ge::FORMAT_ND, ge::FORMAT_ND)
+                      .NodeInputTd(1, ge::DT_FLOAT16, ge::FORMAT_ND, ge::FORMAT_ND)
+                      .NodeInputTd(2, ge::DT_FLOAT16, ge::FORMAT_ND, ge::FORMAT_ND)
+                      .NodeInputTd(3, ge::DT_FLOAT16, ge::FORMAT_ND, ge::FORMAT_ND)
+                      .NodeInputTd(4, ge::DT_FLOAT16, ge::FORMAT_ND, ge::FORMAT_ND)
+                      .NodeInputTd(5, ge::DT_FLOAT16, ge::FORMAT_ND, ge::FORMAT_ND)
+                      .NodeInputTd(6, group_dtype, ge::FORMAT_ND, ge::FORMAT_ND)
+                      .NodeOutputTd(0, ge::DT_INT8, ge::FORMAT_ND, ge::FORMAT_ND)
+                      .NodeOutputTd(1, ge::DT_INT8, ge::FORMAT_ND, ge::FORMAT_ND)
+                      .NodeOutputTd(2, ge::DT_FLOAT16, ge::FORMAT_ND, ge::FORMAT_ND)
+                      .NodeOutputTd(3, ge::DT_FLOAT, ge::FORMAT_ND, ge::FORMAT_ND)
+                      .NodeOutputTd(4, ge::DT_FLOAT, ge::FORMAT_ND, ge::FORMAT_ND)
+                      .NodeAttrs({{"epsilon", Ops::NN::AnyValue::CreateFrom<float>(0.01f)},
+                                  {"output_mask", Ops::NN::AnyValue::CreateFrom<std::vector<bool>>(output_mask)}})
+                      .TilingData(param.get())
+                      .Workspace(ws_size)
+                      .Build();
+
+    gert::TilingContext* tiling_context = holder.GetContext<gert::TilingContext>();
+    ASSERT_NE(tiling_context->GetPlatformInfo(), nullptr);
+    holder.GetContext<gert::TilingContext>()->GetPlatformInfo()->SetPlatformRes("SoCInfo", soc_infos);
+    holder.GetContext<gert::TilingContext>()->GetPlatformInfo()->SetPlatformRes("AICoreSpec", aicore_spec);
+    holder.GetContext<gert::TilingContext>()->GetPlatformInfo()->SetCoreNumByCoreType("AICore");
+    holder.GetContext<gert::TilingContext>()->GetPlatformInfo()->SetPlatformRes("AICoreintrinsicDtypeMap", intrinsics);
+
+    EXPECT_EQ(tiling_func(tiling_context), status);
+    if (status == ge::GRAPH_FAILED) {
+        return;
+    }
+    ASSERT_EQ(tiling_context->GetTilingKey(), expected_tiling_key);
+}
+
 // ========== Output INT8 ==========
 
 TEST_F(AddRmsNormDynamicQuantTilingArch22, add_rms_norm_dynamic_quant_tiling_001)
@@ -206,3 +298,58 @@ TEST_F(AddRmsNormDynamicQuantTilingArch22, add_rms_norm_dynamic_quant_tiling_wit
 
     ExecuteTestCase(input_shape, gamma_shape, out_shape, reduce_shape, 6, ge::DT_INT8, 1);
 }
+
+// ========== group_index ==========
+
+TEST_F(AddRmsNormDynamicQuantTilingArch22, add_rms_norm_dynamic_quant_tiling_group_index)
+{
+    gert::StorageShape input_shape = {{64, 256}, {64, 256}};
+    gert::StorageShape gamma_shape = {{256}, {256}};
+    gert::StorageShape smooth_shape = {{8, 256}, {8, 256}};
+    gert::StorageShape group_shape = {{8}, {8}};
+
+    ExecuteGroupTestCase(input_shape, gamma_shape, smooth_shape, group_shape, ge::DT_INT32, 4);
+}
+
+TEST_F(AddRmsNormDynamicQuantTilingArch22, add_rms_norm_dynamic_quant_tiling_group_index_smooth_shape_invalid)
+{
+    gert::StorageShape input_shape = {{64, 256}, {64, 256}};
+    gert::StorageShape gamma_shape = {{256}, {256}};
+    gert::StorageShape smooth_shape = {{4, 256}, {4, 256}};
+    gert::StorageShape group_shape = {{8}, {8}};
+
+    ExecuteGroupTestCase(input_shape, gamma_shape, smooth_shape, group_shape, ge::DT_INT32, 4, ge::GRAPH_FAILED);
+}
+
+TEST_F(AddRmsNormDynamicQuantTilingArch22, add_rms_norm_dynamic_quant_tiling_group_index_too_many_experts)
+{
+    gert::StorageShape input_shape = {{64, 256}, {64, 256}};
+    gert::StorageShape gamma_shape = {{256}, {256}};
+    gert::StorageShape smooth_shape = {{1025, 256}, {1025, 256}};
+    gert::StorageShape group_shape = {{1025}, {1025}};
+
+    ExecuteGroupTestCase(input_shape, gamma_shape, smooth_shape, group_shape, ge::DT_INT32, 4, ge::GRAPH_FAILED);
+}
+
+TEST_F(AddRmsNormDynamicQuantTilingArch22, add_rms_norm_dynamic_quant_tiling_group_index_output_mask_valid)
+{
+    gert::StorageShape input_shape = {{64, 256}, {64, 256}};
+    gert::StorageShape gamma_shape = {{256}, {256}};
+    gert::StorageShape smooth_shape = {{8, 256}, {8, 256}};
+    gert::StorageShape group_shape = {{8}, {8}};
+
+    ExecuteGroupTestCase(input_shape, gamma_shape, smooth_shape, group_shape, ge::DT_INT32, 4, ge::GRAPH_SUCCESS,
+                         {true, true});
+}
+
+TEST_F(AddRmsNormDynamicQuantTilingArch22, add_rms_norm_dynamic_quant_tiling_group_index_output_mask_inconsistent)
+{
+    gert::StorageShape input_shape = {{64, 256}, {64, 256}};
+    gert::StorageShape gamma_shape = {{256}, {256}};
+    gert::StorageShape smooth_shape = {{8, 256}, {8, 256}};
+    gert::StorageShape group_shape = {{8}, {8}};
+
+    // smooth_scale2 已提供但 output_mask 关闭 y2
+    ExecuteGroupTestCase(input_shape, gamma_shape, smooth_shape, group_shape, ge::DT_INT32, 4, ge::GRAPH_FAILED,
+                         {true, false});
+}
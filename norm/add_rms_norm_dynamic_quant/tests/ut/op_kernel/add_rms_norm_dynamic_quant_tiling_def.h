@@ -41,6 +41,7 @@ struct AddRmsNormDynamicQuantTilingData {
     int32_t outQuant2Flag = -1;
     float avgFactor = 0;
     uint32_t betaFlag = 0;
+    uint32_t groupNum = 0;
 };
 
 #pragma pack()
@@ -71,6 +72,7 @@ struct AddRmsNormDynamicQuantTilingData {
     (tilingData).avgFactor = tilingDataPointer->avgFactor;                                \
     (tilingData).outQuant1Flag = tilingDataPointer->outQuant1Flag;                        \
     (tilingData).outQuant2Flag = tilingDataPointer->outQuant2Flag;                        \
-    (tilingData).betaFlag = tilingDataPointer->betaFlag;
+    (tilingData).betaFlag = tilingDataPointer->betaFlag;                                  \
+    (tilingData).groupNum = tilingDataPointer->groupNum;
 
 #endif
\ No newline at end of file
@@ -23,8 +23,9 @@
 using namespace std;
 
 extern "C" void add_rms_norm_dynamic_quant(uint8_t* x1, uint8_t* x2, uint8_t* gamma, uint8_t* scales1, uint8_t* scales2,
-                                           uint8_t* beta, uint8_t* y1, uint8_t* y2, uint8_t* x, uint8_t* outScale1,
-                                           uint8_t* outScale2, uint8_t* workspace, uint8_t* tiling);
+                                           uint8_t* beta, uint8_t* groupIndex, uint8_t* y1, uint8_t* y2, uint8_t* x,
+                                           uint8_t* outScale1, uint8_t* outScale2, uint8_t* workspace,
+                                           uint8_t* tiling);
 
 class add_rms_norm_dynamic_quant_test : public testing::Test {
 protected:
@@ -85,11 +86,11 @@ TEST_F(add_rms_norm_dynamic_quant_test, test_case_dynamic_dual_smooth)
 
     // dual normal bf16/fp16
     ICPU_SET_TILING_KEY(1);
-    ICPU_RUN_KF(add_rms_norm_dynamic_quant, blockDim, x1, x2, gamma, smooth1, smooth2, beta, y1, y2, x, outScale1,
-                outScale2, workspace, (uint8_t*)(tilingDatafromBin));
+    ICPU_RUN_KF(add_rms_norm_dynamic_quant, blockDim, x1, x2, gamma, smooth1, smooth2, beta, nullptr, y1, y2, x,
+                outScale1, outScale2, workspace, (uint8_t*)(tilingDatafromBin));
     ICPU_SET_TILING_KEY(2);
-    ICPU_RUN_KF(add_rms_norm_dynamic_quant, blockDim, x1, x2, gamma, smooth1, smooth2, beta, y1, y2, x, outScale1,
-                outScale2, workspace, (uint8_t*)(tilingDatafromBin));
+    ICPU_RUN_KF(add_rms_norm_dynamic_quant, blockDim, x1, x2, gamma, smooth1, smooth2, beta, nullptr, y1, y2, x,
+                outScale1, outScale2, workspace, (uint8_t*)(tilingDatafromBin));
 
     AscendC::GmFree(x1);
     AscendC::GmFree(x2);
@@ -160,8 +161,8 @@ TEST_F(add_rms_norm_dynamic_quant_test, test_case_dynamic_case_3)
 
     // dual normal bf16/fp16
     ICPU_SET_TILING_KEY(3);
-    ICPU_RUN_KF(add_rms_norm_dynamic_quant, blockDim, x1, x2, gamma, smooth1, smooth2, beta, y1, y2, x, outScale1,
-                outScale2, workspace, (uint8_t*)(tilingDatafromBin));
+    ICPU_RUN_KF(add_rms_norm_dynamic_quant, blockDim, x1, x2, gamma, smooth1, smooth2, beta, nullptr, y1, y2, x,
+                outScale1, outScale2, workspace, (uint8_t*)(tilingDatafromBin));
 
     AscendC::GmFree(x1);
     AscendC::GmFree(x2);
@@ -177,4 +178,81 @@ TEST_F(add_rms_norm_dynamic_quant_test, test_case_dynamic_case_3)
     AscendC::GmFree(workspace);
     AscendC::GmFree(tiling);
     free(path_);
-}
\ No newline at end of file
+}
+
+TEST_F(add_rms_norm_dynamic_quant_test, test_case_dynamic_group_index)
+{
+    int N = 6;
+    int D = 256;
+    int E = 3;
+    size_t rowsByteSize = N * D * sizeof(int16_t);
+    size_t weightBetaByteSize = D * sizeof(int16_t);
+    size_t smoothByteSize = E * D * sizeof(int16_t);
+    size_t groupByteSize = E * sizeof(int32_t);
+    size_t outQuantByteSize = N * D * sizeof(int8_t);
+    size_t reducedByteSize = N * sizeof(float);
+    size_t tilingDataSize = sizeof(AddRmsNormDynamicQuantTilingData);
+
+    uint8_t* x1 = (uint8_t*)AscendC::GmAlloc(rowsByteSize);
+    uint8_t* x2 = (uint8_t*)AscendC::GmAlloc(rowsByteSize);
+    uint8_t* gamma = (uint8_t*)AscendC::GmAlloc(weightBetaByteSize);
+    uint8_t* smooth1 = (uint8_t*)AscendC::GmAlloc(smoothByteSize);
+    uint8_t* smooth2 = (uint8_t*)AscendC::GmAlloc(smoothByteSize);
+    uint8_t* groupIndex = (uint8_t*)AscendC::GmAlloc(groupByteSize);
+
+    uint8_t* y1 = (uint8_t*)AscendC::GmAlloc(outQuantByteSize);
+    uint8_t* y2 = (uint8_t*)AscendC::GmAlloc(outQuantByteSize);
+    uint8_t* x = (uint8_t*)AscendC::GmAlloc(rowsByteSize);
+    uint8_t* outScale1 = (uint8_t*)AscendC::GmAlloc(reducedByteSize);
+    uint8_t* outScale2 = (uint8_t*)AscendC::GmAlloc(reducedByteSize);
+
+    uint8_t* workspace = (uint8_t*)AscendC::GmAlloc(16 * 4096 + 1);
+    uint8_t* tiling = (uint8_t*)AscendC::GmAlloc(tilingDataSize);
+    uint32_t blockDim = 2;
+    AscendC::SetKernelMode(KernelMode::AIV_MODE);
+
+    // expert 0: rows [0, 1), expert 1: rows [1, 4), expert 2: rows [4, 6)
+    int32_t* groupIndexData = reinterpret_cast<int32_t*>(groupIndex);
+    groupIndexData[0] = 1;
+    groupIndexData[1] = 4;
+    groupIndexData[2] = 6;
+
+    AddRmsNormDynamicQuantTilingData* tilingDatafromBin = reinterpret_cast<AddRmsNormDynamicQuantTilingData*>(tiling);
+
+    tilingDatafromBin->useCore = blockDim;
+    tilingDatafromBin->numFirstDim = N;
+    tilingDatafromBin->numLastDim = D;
+    tilingDatafromBin->numLastDimAligned = (D + 32 - 1) / 32 * 32;
+    tilingDatafromBin->firstDimPerCore = 3;
+    tilingDatafromBin->firstDimPerCoreTail = 3;
+    tilingDatafromBin->firstDimPerLoop = 2;
+    tilingDatafromBin->lastDimLoopNum = 1;
+    tilingDatafromBin->lastDimSliceLen = 8864;
+    tilingDatafromBin->lastDimSliceLenTail = D;
+    tilingDatafromBin->smoothNum1 = 1;
+    tilingDatafromBin->smoothNum2 = 1;
+    tilingDatafromBin->epsilon = 1e-5;
+    tilingDatafromBin->outQuant1Flag = -1;
+    tilingDatafromBin->outQuant2Flag = -1;
+    tilingDatafromBin->avgFactor = (1.0 / D);
+    tilingDatafromBin->betaFlag = 0;
+    tilingDatafromBin->groupNum = E;
+
+    ICPU_SET_TILING_KEY(4);
+    ICPU_RUN_KF(add_rms_norm_dynamic_quant, blockDim, x1, x2, gamma, smooth1, smooth2, nullptr, groupIndex, y1, y2, x,
+                outScale1, outScale2, workspace, (uint8_t*)(tilingDatafromBin));
+
+    AscendC::GmFree(x1);
+    AscendC::GmFree(x2);
+    AscendC::GmFree(gamma);
+    AscendC::GmFree(smooth1);
+    AscendC::GmFree(smooth2);
+    AscendC::GmFree(groupIndex);
+    AscendC::GmFree(y1);
+    AscendC::GmFree(y2);
+    AscendC::GmFree(x);
+    AscendC::GmFree(outScale1);
+    AscendC::GmFree(outScale2);
+    AscendC::GmFree(workspace);
+    AscendC::GmFree(tiling);
+}
@@ -0,0 +1,475 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * \file group_norm_silu_fusion_pass.cpp
+ * \brief Fusion pass for GroupNorm/GroupNormV2 + Silu/Swish/Sigmoid*x -> GroupNormSilu/GroupNormSwish.
+ *
+ * Fusion pattern:
+ *        x  gamma  beta               x  gamma  beta               x  gamma  beta
+ *         \   |   /                    \   |   /                    \   |   /
+ *         GroupNorm                    GroupNorm                    GroupNorm
+ *        /    |    \                  /    |    \                  /    |    \
+ *     mean    y    rstd            mean    y    rstd            mean    y    rstd
+ *             |                           |  \                          |
+ *            Silu                         | Sigmoid                 Swish(scale)
+ *             |                           |  /                          |
+ *                                         Mul
+ *
+ *  ==>  GroupNormSilu(x, gamma, beta)           for Silu, Sigmoid*x and Swish with scale 1
+ *       GroupNormSwish(x, gamma, beta, scale)   for Swish with other scales
+ *
+ * GroupNorm.y must have no consumer outside the pattern. The mean/rstd outputs of the fused op are
+ * (N, num_groups), so they may only be unused or feed GroupNormGrad, whose tiling expects that layout.
+ * GroupNorm (v1) outputs variance instead of rstd, so it is only fused when mean/variance are unused.
+ */
+
+#include "group_norm_silu_fusion_pass.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "common/inc/error_util.h"
+#include "ge/compliant_node_builder.h"
+#include "ge/es_graph_builder.h"
+#include "ge/ge_utils.h"
+#include "platform/platform_info.h"
+
+using namespace ge;
+using namespace fe;
+using namespace fusion;
+
+namespace ops {
+namespace {
+constexpr char kPassName[] = "GroupNormSiluFusionPass";
+
+constexpr char kGroupNormType[] = "GroupNorm";
+constexpr char kGroupNormV2Type[] = "GroupNormV2";
+constexpr char kGroupNormGradType[] = "GroupNormGrad";
+constexpr char kSiluType[] = "Silu";
+constexpr char kSwishType[] = "Swish";
+constexpr char kSigmoidType[] = "Sigmoid";
+constexpr char kMulType[] = "Mul";
+constexpr char kGroupNormSiluType[] = "GroupNormSilu";
+constexpr char kGroupNormSwishType[] = "GroupNormSwish";
+
+constexpr int64_t kGroupNormCaptureIdx = 0;
+constexpr int64_t kActCaptureIdx = 1;
+
+constexpr int32_t kGroupNormXIdx = 0;
+constexpr int32_t kGroupNormGammaIdx = 1;
+constexpr int32_t kGroupNormBetaIdx = 2;
+constexpr int32_t kGroupNormYOutIdx = 0;
+constexpr int32_t kGroupNormMeanOutIdx = 1;
+constexpr int32_t kGroupNormRstdOutIdx = 2;
+constexpr int32_t kGroupNormGradMeanIdx = 1;
+constexpr int32_t kGroupNormGradRstdIdx = 2;
+
+constexpr size_t kSubgraphInputNum = 3;
+constexpr size_t kXMinDim = 2;
+constexpr float kDefaultEps = 0.00001f;
+constexpr float kDefaultSwishScale = 1.0f;
+
+enum class ActType { SILU, SWISH, SIGMOID_MUL, MUL_SIGMOID };
+
+// 与 GroupNormSilu/GroupNormSwish 算子定义一致的 (x, gamma) dtype 组合, bf16 仅 910B/910_93/950 支持
+const std::vector<std::pair<DataType, DataType>> kSupportDtypePairs = {
+    {DT_FLOAT16, DT_FLOAT16}, {DT_FLOAT, DT_FLOAT}, {DT_FLOAT16, DT_FLOAT}};
+const std::vector<std::pair<DataType, DataType>> kBf16DtypePairs = {{DT_BF16, DT_BF16}, {DT_BF16, DT_FLOAT}};
+constexpr char kNoBf16Soc[] = "Ascend310P";
+
+bool IsTargetPlatform(bool isSwish, std::string& shortSoc)
+{
+    PlatformInfo platformInfo;
+    OptionalInfo optionalInfo;
+    OP_LOGE_IF(PlatformInfoManager::Instance().GetPlatformInfoWithOutSocVersion(platformInfo, optionalInfo) != SUCCESS,
+               false, kPassName, "Get platform_info failed.");
+    const std::string soc = platformInfo.str_info.short_soc_version;
+    shortSoc = soc;
+    OPS_LOG_D(kPassName, "Platform short soc: %s", soc.c_str());
+    // GroupNormSwish 无 310P 实现
+    const static std::set<std::string> kSiluSoc = {"Ascend910B", "Ascend910_93", "Ascend950", "Ascend310P"};
+    const static std::set<std::string> kSwishSoc = {"Ascend910B", "Ascend910_93", "Ascend950"};
+    if ((isSwish ? kSwishSoc : kSiluSoc).count(soc) == 0) {
+        OPS_LOG_D(kPassName, "Platform %s is not supported.", soc.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool GetCapturedNode(const std::unique_ptr<MatchResult>& matchResult, int64_t index, GNode& node)
+{
+    NodeIo nodeIo;
+    OP_LOGE_IF(matchResult->GetCapturedTensor(index, nodeIo) != SUCCESS, false, kPassName,
+               "get captured node failed, index is %ld.", index);
+    node = nodeIo.node;
+    return true;
+}
+
+std::string GetNodeType(const GNode& node)
+{
+    AscendString type;
+    if (node.GetType(type) != GRAPH_SUCCESS) {
+        return "";
+    }
+    return type.GetString();
+}
+
+es::EsTensorHolder BuildGroupNormNode(es::EsGraphBuilder& graphBuilder, const char* opType,
+                                      const std::vector<es::EsTensorHolder>& inputs,
+                                      std::vector<es::EsTensorHolder>& outputs)
+{
+    auto graph = graphBuilder.GetCGraphBuilder()->GetGraph();
+    const bool isV2 = std::string(opType) == kGroupNormV2Type;
+    GNode node = es::CompliantNodeBuilder(graph)
+                     .OpType(opType)
+                     .Name("group_norm")
+                     .IrDefInputs({{"x", es::CompliantNodeBuilder::kEsIrInputRequired, ""},
+                                   {"gamma", es::CompliantNodeBuilder::kEsIrInputRequired, ""},
+                                   {"beta", es::CompliantNodeBuilder::kEsIrInputRequired, ""}})
+                     .IrDefOutputs({{"y", es::CompliantNodeBuilder::kEsIrOutputRequired, ""},
+                                    {"mean", es::CompliantNodeBuilder::kEsIrOutputRequired, ""},
+                                    {isV2 ? "rstd" : "variance", es::CompliantNodeBuilder::kEsIrOutputRequired, ""}})
+                     .IrDefAttrs({{"num_groups", es::CompliantNodeBuilder::kEsAttrRequired, "Int",
+                                   es::CreateFrom(static_cast<int64_t>(1))}})
+                     .Build();
+    for (int32_t i = 0; i < static_cast<int32_t>(inputs.size()); ++i) {
+        es::AddEdgeAndUpdatePeerDesc(*graph, *inputs[i].GetProducer(), inputs[i].GetProducerOutIndex(), node, i);
+    }
+    for (int32_t i = kGroupNormYOutIdx; i <= kGroupNormRstdOutIdx; ++i) {
+        outputs.emplace_back(graphBuilder.GetCGraphBuilder()->GetTensorHolderFromNode(node, i));
+    }
+    return outputs[kGroupNormYOutIdx];
+}
+
+es::EsTensorHolder BuildEltwiseNode(es::EsGraphBuilder& graphBuilder, const char* opType, const char* name,
+                                    const std::vector<es::EsTensorHolder>& inputs)
+{
+    auto graph = graphBuilder.GetCGraphBuilder()->GetGraph();
+    std::vector<es::CompliantNodeBuilder::IrInputDef> irInputs;
+    if (inputs.size() == 1) {
+        irInputs.push_back({"x", es::CompliantNodeBuilder::kEsIrInputRequired, ""});
+    } else {
+        irInputs.push_back({"x1", es::CompliantNodeBuilder::kEsIrInputRequired, ""});
+        irInputs.push_back({"x2", es::CompliantNodeBuilder::kEsIrInputRequired, ""});
+    }
+    GNode node = es::CompliantNodeBuilder(graph)
+                     .OpType(opType)
+                     .Name(name)
+                     .IrDefInputs(irInputs)
+                     .IrDefOutputs({{"y", es::CompliantNodeBuilder::kEsIrOutputRequired, ""}})
+                     .Build();
+    for (int32_t i = 0; i < static_cast<int32_t>(inputs.size()); ++i) {
+        es::AddEdgeAndUpdatePeerDesc(*graph, *inputs[i].GetProducer(), inputs[i].GetProducerOutIndex(), node, i);
+    }
+    return es::EsTensorHolder(graphBuilder.GetCGraphBuilder()->GetTensorHolderFromNode(node, 0));
+}
+
+PatternUniqPtr MakePattern(const char* groupNormType, ActType actType)
+{
+    std::string patternName = std::string(kPassName) + groupNormType + std::to_string(static_cast<int32_t>(actType));
+    auto graphBuilder = es::EsGraphBuilder(patternName.c_str());
+    auto [x, gamma, beta] = graphBuilder.CreateInputs<3>();
+
+    std::vector<es::EsTensorHolder> gnOutputs;
+    auto y = BuildGroupNormNode(graphBuilder, groupNormType, {x, gamma, beta}, gnOutputs);
+    es::EsTensorHolder act;
+    switch (actType) {
+        case ActType::SILU:
+            act = BuildEltwiseNode(graphBuilder, kSiluType, "silu", {y});
+            break;
+        case ActType::SWISH:
+            act = BuildEltwiseNode(graphBuilder, kSwishType, "swish", {y});
+            break;
+        case ActType::SIGMOID_MUL:
+            act = BuildEltwiseNode(graphBuilder, kMulType, "mul",
+                                   {BuildEltwiseNode(graphBuilder, kSigmoidType, "sigmoid", {y}), y});
+            break;
+        default:
+            act = BuildEltwiseNode(graphBuilder, kMulType, "mul",
+                                   {y, BuildEltwiseNode(graphBuilder, kSigmoidType, "sigmoid", {y})});
+            break;
+    }
+
+    std::vector<es::EsTensorHolder> outputs = {act, gnOutputs[kGroupNormMeanOutIdx], gnOutputs[kGroupNormRstdOutIdx]};
+    auto graph = graphBuilder.BuildAndReset(outputs);
+    auto pattern = std::make_unique<Pattern>(std::move(*graph));
+    pattern->CaptureTensor({*y.GetProducer(), kGroupNormYOutIdx}).CaptureTensor({*act.GetProducer(), 0});
+    return pattern;
+}
+
+bool IsDtypePairSupported(DataType xDtype, DataType gammaDtype, const std::string& shortSoc)
+{
+    const std::pair<DataType, DataType> dtypePair = {xDtype, gammaDtype};
+    if (std::find(kSupportDtypePairs.begin(), kSupportDtypePairs.end(), dtypePair) != kSupportDtypePairs.end()) {
+        return true;
+    }
+    return shortSoc != kNoBf16Soc &&
+           std::find(kBf16DtypePairs.begin(), kBf16DtypePairs.end(), dtypePair) != kBf16DtypePairs.end();
+}
+
+// scale 为 1 的 Swish 即 Silu, 融合为 GroupNormSilu, 其余 Swish 融合为 GroupNormSwish
+bool IsFuseToGroupNormSwish(const GNode& actNode, float& swishScale)
+{
+    swishScale = kDefaultSwishScale;
+    if (GetNodeType(actNode) != kSwishType) {
+        return false;
+    }
+    OP_LOGW_IF(actNode.GetAttr("scale", swishScale) != GRAPH_SUCCESS, kPassName, "Get swish scale attr failed.");
+    return std::fabs(swishScale - kDefaultSwishScale) > std::numeric_limits<float>::epsilon();
+}
+
+// GroupNorm.y 只能被模式内的激活消费: Silu/Swish 为 1 个, Sigmoid*x 为 Sigmoid 与 Mul 共 2 个
+bool IsGroupNormYConsumersValid(const GNode& gnNode, const std::string& actType)
+{
+    auto yConsumers = gnNode.GetOutDataNodesAndPortIndexs(kGroupNormYOutIdx);
+    const size_t expectCount = (actType == kMulType) ? 2U : 1U;
+    if (yConsumers.size() != expectCount) {
+        OPS_LOG_D(kPassName, "GroupNorm y has %zu consumers, expect %zu.", yConsumers.size(), expectCount);
+        return false;
+    }
+    if (actType != kMulType) {
+        return true;
+    }
+    for (const auto& [consumer, port] : yConsumers) {
+        (void)port;
+        if (consumer == nullptr) {
+            return false;
+        }
+        const std::string type = GetNodeType(*consumer);
+        if (type == kSigmoidType && consumer->GetOutDataNodesAndPortIndexs(0).size() != 1U) {
+            OPS_LOG_D(kPassName, "Sigmoid output is used outside the pattern.");
+            return false;
+        }
+    }
+    return true;
+}
+
+bool IsStatsConsumersValid(const GNode& gnNode, bool isV2)
+{
+    for (int32_t outIdx : {kGroupNormMeanOutIdx, kGroupNormRstdOutIdx}) {
+        for (const auto& [consumer, port] : gnNode.GetOutDataNodesAndPortIndexs(outIdx)) {
+            if (consumer == nullptr) {
+                continue;
+            }
+            if (!isV2) {
+                OPS_LOG_D(kPassName, "GroupNorm mean/variance is used, variance can't be replaced by rstd.");
+                return false;
+            }
+            const int32_t expectPort = (outIdx == kGroupNormMeanOutIdx) ? kGroupNormGradMeanIdx : kGroupNormGradRstdIdx;
+            if (GetNodeType(*consumer) != kGroupNormGradType || port != expectPort) {
+                OPS_LOG_D(kPassName, "GroupNormV2 output %d feeds %s, only GroupNormGrad is allowed.", outIdx,
+                          GetNodeType(*consumer).c_str());
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool IsGroupNormValid(const GNode& gnNode, bool isV2, bool statsUsed, const std::string& shortSoc)
+{
+    TensorDesc xDesc;
+    TensorDesc gammaDesc;
+    TensorDesc betaDesc;
+    OP_LOGE_IF(gnNode.GetInputDesc(kGroupNormXIdx, xDesc) != GRAPH_SUCCESS ||
+                   gnNode.GetInputDesc(kGroupNormGammaIdx, gammaDesc) != GRAPH_SUCCESS ||
+                   gnNode.GetInputDesc(kGroupNormBetaIdx, betaDesc) != GRAPH_SUCCESS,
+               false, kPassName, "get GroupNorm input desc failed.");
+    if (!IsDtypePairSupported(xDesc.GetDataType(), gammaDesc.GetDataType(), shortSoc)) {
+        OPS_LOG_D(kPassName, "GroupNorm x dtype %d with gamma dtype %d is not supported on %s.", xDesc.GetDataType(),
+                  gammaDesc.GetDataType(), shortSoc.c_str());
+        return false;
+    }
+    if (gammaDesc.GetDataType() != betaDesc.GetDataType()) {
+        OPS_LOG_D(kPassName, "gamma and beta must have the same dtype.");
+        return false;
+    }
+    // 融合算子的 mean/rstd 与 gamma 同 dtype, 被下游使用时要求与原 GroupNorm 输出一致
+    if (statsUsed && gammaDesc.GetDataType() != xDesc.GetDataType()) {
+        OPS_LOG_D(kPassName, "mean/rstd dtype would change after fusion.");
+        return false;
+    }
+    if (xDesc.GetShape().GetDimNum() < kXMinDim) {
+        OPS_LOG_D(kPassName, "x dim num %zu is less than 2.", xDesc.GetShape().GetDimNum());
+        return false;
+    }
+    if (!isV2) {
+        AscendString dataFormat("NCHW");
+        (void)gnNode.GetAttr("data_format", dataFormat);
+        if (std::string(dataFormat.GetString()) != "NCHW") {
+            OPS_LOG_D(kPassName, "GroupNorm data_format %s is not supported.", dataFormat.GetString());
+            return false;
+        }
+    }
+    int64_t numGroups = 0;
+    OP_LOGE_IF(gnNode.GetAttr("num_groups", numGroups) != GRAPH_SUCCESS, false, kPassName,
+               "get GroupNorm num_groups attr failed.");
+    return numGroups > 0;
+}
+
+bool HasStatsConsumers(const GNode& gnNode)
+{
+    return !gnNode.GetOutDataNodesAndPortIndexs(kGroupNormMeanOutIdx).empty() ||
+           !gnNode.GetOutDataNodesAndPortIndexs(kGroupNormRstdOutIdx).empty();
+}
+
+Status InferShape(const GraphUniqPtr& replaceGraph, const std::vector<SubgraphInput>& subgraphInputs)
+{
+    std::vector<Shape> inputShapes;
+    for (const auto& subgraphInput : subgraphInputs) {
+        const auto allInputs = subgraphInput.GetAllInputs();
+        if (allInputs.empty()) {
+            OPS_LOG_E(kPassName, "subgraph input is empty.");
+            return FAILED;
+        }
+        TensorDesc tensorDesc;
+        const auto matchNode = allInputs.at(0);
+        if (matchNode.node.GetInputDesc(matchNode.index, tensorDesc) != GRAPH_SUCCESS) {
+            OPS_LOG_E(kPassName, "get subgraph input desc failed.");
+            return FAILED;
+        }
+        inputShapes.emplace_back(tensorDesc.GetShape());
+    }
+    return GeUtils::InferShape(*replaceGraph, inputShapes);
+}
+
+GNode BuildFusedNode(es::EsGraphBuilder& graphBuilder, const std::vector<es::EsTensorHolder>& inputs, bool isSwish,
+                     int64_t numGroups, float eps, float swishScale)
+{
+    auto graph = graphBuilder.GetCGraphBuilder()->GetGraph();
+    std::vector<es::CompliantNodeBuilder::IrAttrDef> attrs = {
+        {"num_groups", es::CompliantNodeBuilder::kEsAttrRequired, "Int", es::CreateFrom(numGroups)}};
+    if (isSwish) {
+        attrs.push_back(
+            {"data_format", es::CompliantNodeBuilder::kEsAttrOptional, "String", es::CreateFrom(AscendString("NCHW"))});
+        attrs.push_back({"eps", es::CompliantNodeBuilder::kEsAttrOptional, "Float", es::CreateFrom(eps)});
+        attrs.push_back({"activate_swish", es::CompliantNodeBuilder::kEsAttrOptional, "Bool", es::CreateFrom(true)});
+        attrs.push_back({"swish_scale", es::CompliantNodeBuilder::kEsAttrOptional, "Float", es::CreateFrom(swishScale)});
+    } else {
+        attrs.push_back({"eps", es::CompliantNodeBuilder::kEsAttrOptional, "Float", es::CreateFrom(eps)});
+        attrs.push_back({"activate_silu", es::CompliantNodeBuilder::kEsAttrOptional, "Bool", es::CreateFrom(true)});
+    }
+    const auto paramInputType =
+        isSwish ? es::CompliantNodeBuilder::kEsIrInputRequired : es::CompliantNodeBuilder::kEsIrInputOptional;
+    GNode node = es::CompliantNodeBuilder(graph)
+                     .OpType(isSwish ? kGroupNormSwishType : kGroupNormSiluType)
+                     .Name(isSwish ? "group_norm_swish" : "group_norm_silu")
+                     .IrDefInputs({{"x", es::CompliantNodeBuilder::kEsIrInputRequired, ""},
+                                   {"gamma", paramInputType, ""},
+                                   {"beta", paramInputType, ""}})
+                     .IrDefOutputs({{"y", es::CompliantNodeBuilder::kEsIrOutputRequired, ""},
+                                    {"mean", es::CompliantNodeBuilder::kEsIrOutputRequired, ""},
+                                    {"rstd", es::CompliantNodeBuilder::kEsIrOutputRequired, ""}})
+                     .IrDefAttrs(attrs)
+                     .Build();
+    for (int32_t i = 0; i < static_cast<int32_t>(inputs.size()); ++i) {
+        es::AddEdgeAndUpdatePeerDesc(*graph, *inputs[i].GetProducer(), inputs[i].GetProducerOutIndex(), node, i);
+    }
+    return node;
+}
+} // namespace
+
+std::vector<PatternUniqPtr> GroupNormSiluFusionPass::Patterns()
+{
+    OPS_LOG_D(kPassName, "Enter Patterns for GroupNormSiluFusionPass");
+    std::vector<PatternUniqPtr> patterns;
+    for (const char* groupNormType : {kGroupNormType, kGroupNormV2Type}) {
+        for (ActType actType : {ActType::SILU, ActType::SWISH, ActType::SIGMOID_MUL, ActType::MUL_SIGMOID}) {
+            patterns.emplace_back(MakePattern(groupNormType, actType));
+        }
+    }
+    return patterns;
+}
+
+bool GroupNormSiluFusionPass::MeetRequirements(const std::unique_ptr<MatchResult>& matchResult)
+{
+    OPS_LOG_D(kPassName, "Enter MeetRequirements for GroupNormSiluFusionPass");
+    GNode gnNode;
+    GNode actNode;
+    if (!GetCapturedNode(matchResult, kGroupNormCaptureIdx, gnNode) ||
+        !GetCapturedNode(matchResult, kActCaptureIdx, actNode)) {
+        return false;
+    }
+    const std::string actType = GetNodeType(actNode);
+    float swishScale = kDefaultSwishScale;
+    std::string shortSoc;
+    if (!IsTargetPlatform(IsFuseToGroupNormSwish(actNode, swishScale), shortSoc)) {
+        return false;
+    }
+    const bool isV2 = GetNodeType(gnNode) == kGroupNormV2Type;
+    if (!IsGroupNormYConsumersValid(gnNode, actType)) {
+        return false;
+    }
+    if (!IsStatsConsumersValid(gnNode, isV2)) {
+        return false;
+    }
+    return IsGroupNormValid(gnNode, isV2, HasStatsConsumers(gnNode), shortSoc);
+}
+
+GraphUniqPtr GroupNormSiluFusionPass::Replacement(const std::unique_ptr<MatchResult>& matchResult)
+{
+    OPS_LOG_D(kPassName, "Enter Replacement for GroupNormSiluFusionPass");
+    GNode gnNode;
+    GNode actNode;
+    if (!GetCapturedNode(matchResult, kGroupNormCaptureIdx, gnNode) ||
+        !GetCapturedNode(matchResult, kActCaptureIdx, actNode)) {
+        return nullptr;
+    }
+    std::vector<SubgraphInput> subgraphInputs;
+    matchResult->ToSubgraphBoundary()->GetAllInputs(subgraphInputs);
+    OP_LOGE_IF(subgraphInputs.size() != kSubgraphInputNum, nullptr, kPassName,
+               "Subgraph input num %zu is not equal to 3.", subgraphInputs.size());
+
+    float swishScale = kDefaultSwishScale;
+    const bool isSwish = IsFuseToGroupNormSwish(actNode, swishScale);
+    int64_t numGroups = 0;
+    OP_LOGE_IF(gnNode.GetAttr("num_groups", numGroups) != GRAPH_SUCCESS, nullptr, kPassName,
+               "get GroupNorm num_groups attr failed.");
+    float eps = kDefaultEps;
+    OP_LOGW_IF(gnNode.GetAttr("eps", eps) != GRAPH_SUCCESS, kPassName, "Get eps attr failed.");
+
+    auto graphBuilder = es::EsGraphBuilder("replacement");
+    std::vector<es::EsTensorHolder> inputs;
+    for (int32_t i = 0; i < static_cast<int32_t>(kSubgraphInputNum); ++i) {
+        TensorDesc desc;
+        OP_LOGE_IF(gnNode.GetInputDesc(i, desc) != GRAPH_SUCCESS, nullptr, kPassName,
+                   "get GroupNorm input %d desc failed.", i);
+        inputs.emplace_back(graphBuilder.CreateInput(i, ("replacement_input_" + std::to_string(i)).c_str(),
+                                                     desc.GetDataType(), desc.GetFormat(), desc.GetShape().GetDims()));
+    }
+    GNode fusedNode = BuildFusedNode(graphBuilder, inputs, isSwish, numGroups, eps, swishScale);
+    for (int32_t i = 0; i < static_cast<int32_t>(kSubgraphInputNum); ++i) {
+        TensorDesc desc;
+        gnNode.GetInputDesc(i, desc);
+        fusedNode.UpdateInputDesc(i, desc);
+    }
+
+    std::vector<es::EsTensorHolder> outputs;
+    for (int32_t i = kGroupNormYOutIdx; i <= kGroupNormRstdOutIdx; ++i) {
+        outputs.emplace_back(graphBuilder.GetCGraphBuilder()->GetTensorHolderFromNode(fusedNode, i));
+    }
+    auto graph = graphBuilder.BuildAndReset(outputs);
+    if (InferShape(graph, subgraphInputs) != SUCCESS) {
+        OPS_LOG_E(kPassName, "Infershape for replacement failed.");
+        return nullptr;
+    }
+    OPS_LOG_I(kPassName, "Replace GroupNorm + %s with %s.", GetNodeType(actNode).c_str(),
+              isSwish ? kGroupNormSwishType : kGroupNormSiluType);
+    return graph;
+}
+
+REG_FUSION_PASS(GroupNormSiluFusionPass).Stage(CustomPassStage::kAfterInferShape);
+} // namespace ops
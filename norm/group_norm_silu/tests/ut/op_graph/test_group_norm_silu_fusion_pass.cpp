@@ -0,0 +1,323 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ge/compliant_node_builder.h"
+#include "ge/es_graph_builder.h"
+#include "platform/platform_info.h"
+#include "register/register_custom_pass.h"
+#include "../../../op_graph/fusion_pass/group_norm_silu_fusion_pass.h"
+
+using namespace fe;
+using namespace ge;
+using namespace ops;
+
+namespace {
+constexpr int64_t kNumGroups = 4;
+
+enum class TestAct { SILU, SWISH, SIGMOID_MUL };
+
+struct GroupNormCase {
+    const char* groupNormType = "GroupNormV2";
+    TestAct act = TestAct::SILU;
+    DataType dtype = DT_FLOAT16;
+    DataType gammaDtype = DT_UNDEFINED; // 默认与 x 同 dtype
+    float swishScale = 1.0f;
+    bool extraYConsumer = false;
+    bool useStats = false;
+};
+
+class GroupNormSiluFusionPassTest : public testing::Test {
+protected:
+    void SetUp() override { SetPlatform("Ascend910B"); }
+
+    static void SetPlatform(const std::string& soc)
+    {
+        PlatformInfo platform_info;
+        OptionalInfo optional_info;
+        platform_info.soc_info.ai_core_cnt = 48;
+        platform_info.str_info.short_soc_version = soc;
+        optional_info.soc_version = soc;
+        PlatformInfoManager::Instance().platform_info_map_[soc] = platform_info;
+        PlatformInfoManager::Instance().SetOptionalCompilationInfo(optional_info);
+    }
+
+    static void UpdateDesc(GNode& node, bool isInput, int32_t index, DataType dtype, const std::vector<int64_t>& shape)
+    {
+        TensorDesc desc;
+        if (isInput) {
+            node.GetInputDesc(index, desc);
+        } else {
+            node.GetOutputDesc(index, desc);
+        }
+        desc.SetDataType(dtype);
+        desc.SetFormat(FORMAT_ND);
+        desc.SetShape(Shape(shape));
+        desc.SetOriginShape(Shape(shape));
+        if (isInput) {
+            node.UpdateInputDesc(index, desc);
+        } else {
+            node.UpdateOutputDesc(index, desc);
+        }
+    }
+
+    static GNode AddNode(Graph* graph, const char* opType, const char* name,
+                         const std::vector<std::pair<GNode, int32_t>>& inputs, int32_t outputNum = 1)
+    {
+        std::vector<es::CompliantNodeBuilder::IrInputDef> irInputs;
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            irInputs.push_back({("x" + std::to_string(i)).c_str(), es::CompliantNodeBuilder::kEsIrInputRequired, ""});
+        }
+        std::vector<es::CompliantNodeBuilder::IrOutputDef> irOutputs;
+        for (int32_t i = 0; i < outputNum; ++i) {
+            irOutputs.push_back({("y" + std::to_string(i)).c_str(), es::CompliantNodeBuilder::kEsIrOutputRequired, ""});
+        }
+        GNode node =
+            es::CompliantNodeBuilder(graph).OpType(opType).Name(name).IrDefInputs(irInputs).IrDefOutputs(irOutputs).Build();
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            es::AddEdgeAndUpdatePeerDesc(*graph, inputs[i].first, inputs[i].second, node, static_cast<int32_t>(i));
+        }
+        return node;
+    }
+
+    static std::shared_ptr<Graph> BuildGraph(const GroupNormCase& param)
+    {
+        const std::vector<int64_t> xShape = {2, 32, 16, 16};
+        const std::vector<int64_t> cShape = {32};
+        const std::vector<int64_t> statsShape = {2 * kNumGroups};
+
+        const DataType gammaDtype = param.gammaDtype == DT_UNDEFINED ? param.dtype : param.gammaDtype;
+
+        auto graphBuilder = es::EsGraphBuilder("group_norm_silu_fusion_test");
+        auto* graph = graphBuilder.GetCGraphBuilder()->GetGraph();
+        auto x = graphBuilder.CreateInput(0, "x", param.dtype, FORMAT_ND, xShape);
+        auto gamma = graphBuilder.CreateInput(1, "gamma", gammaDtype, FORMAT_ND, cShape);
+        auto beta = graphBuilder.CreateInput(2, "beta", gammaDtype, FORMAT_ND, cShape);
+
+        GNode gn = AddNode(graph, param.groupNormType, "group_norm",
+                           {{*x.GetProducer(), x.GetProducerOutIndex()},
+                            {*gamma.GetProducer(), gamma.GetProducerOutIndex()},
+                            {*beta.GetProducer(), beta.GetProducerOutIndex()}},
+                           3);
+        gn.SetAttr("num_groups", kNumGroups);
+        gn.SetAttr("eps", 1e-5f);
+        UpdateDesc(gn, true, 0, param.dtype, xShape);
+        UpdateDesc(gn, true, 1, gammaDtype, cShape);
+        UpdateDesc(gn, true, 2, gammaDtype, cShape);
+        UpdateDesc(gn, false, 0, param.dtype, xShape);
+        UpdateDesc(gn, false, 1, param.dtype, statsShape);
+        UpdateDesc(gn, false, 2, param.dtype, statsShape);
+
+        GNode act;
+        if (param.act == TestAct::SIGMOID_MUL) {
+            GNode sigmoid = AddNode(graph, "Sigmoid", "sigmoid", {{gn, 0}});
+            UpdateDesc(sigmoid, true, 0, param.dtype, xShape);
+            UpdateDesc(sigmoid, false, 0, param.dtype, xShape);
+            act = AddNode(graph, "Mul", "mul", {{gn, 0}, {sigmoid, 0}});
+            UpdateDesc(act, true, 1, param.dtype, xShape);
+        } else {
+            act = AddNode(graph, param.act == TestAct::SWISH ? "Swish" : "Silu", "act", {{gn, 0}});
+            if (param.act == TestAct::SWISH) {
+                act.SetAttr("scale", param.swishScale);
+            }
+        }
+        UpdateDesc(act, true, 0, param.dtype, xShape);
+        UpdateDesc(act, false, 0, param.dtype, xShape);
+
+        std::vector<es::EsTensorHolder> outputs = {
+            es::EsTensorHolder(graphBuilder.GetCGraphBuilder()->GetTensorHolderFromNode(act, 0))};
+        if (param.extraYConsumer) {
+            GNode relu = AddNode(graph, "Relu", "relu", {{gn, 0}});
+            UpdateDesc(relu, true, 0, param.dtype, xShape);
+            UpdateDesc(relu, false, 0, param.dtype, xShape);
+            outputs.emplace_back(graphBuilder.GetCGraphBuilder()->GetTensorHolderFromNode(relu, 0));
+        }
+        if (param.useStats) {
+            outputs.emplace_back(graphBuilder.GetCGraphBuilder()->GetTensorHolderFromNode(gn, 1));
+            outputs.emplace_back(graphBuilder.GetCGraphBuilder()->GetTensorHolderFromNode(gn, 2));
+        }
+        return graphBuilder.BuildAndReset(outputs);
+    }
+
+    static Status RunPass(std::shared_ptr<Graph>& graph)
+    {
+        CustomPassContext pass_context;
+        GroupNormSiluFusionPass pass;
+        return pass.Run(graph, pass_context);
+    }
+
+    static int CountOpType(const std::shared_ptr<Graph>& graph, const std::string& op_type)
+    {
+        int count = 0;
+        for (auto node : graph->GetAllNodes()) {
+            AscendString type;
+            node.GetType(type);
+            if (type == op_type.c_str()) {
+                ++count;
+            }
+        }
+        return count;
+    }
+
+    static bool FindNode(const std::shared_ptr<Graph>& graph, const std::string& op_type, GNode& out)
+    {
+        for (auto node : graph->GetAllNodes()) {
+            AscendString type;
+            node.GetType(type);
+            if (type == op_type.c_str()) {
+                out = node;
+                return true;
+            }
+        }
+        return false;
+    }
+};
+} // namespace
+
+TEST_F(GroupNormSiluFusionPassTest, pattern_test)
+{
+    GroupNormSiluFusionPass pass;
+    EXPECT_EQ(pass.Patterns().size(), 8U);
+}
+
+TEST_F(GroupNormSiluFusionPassTest, group_norm_v2_silu_fusion_success)
+{
+    GroupNormCase param;
+    auto graph = BuildGraph(param);
+    EXPECT_EQ(RunPass(graph), SUCCESS);
+    EXPECT_EQ(CountOpType(graph, "GroupNormSilu"), 1);
+    EXPECT_EQ(CountOpType(graph, "GroupNormV2"), 0);
+    EXPECT_EQ(CountOpType(graph, "Silu"), 0);
+}
+
+TEST_F(GroupNormSiluFusionPassTest, group_norm_sigmoid_mul_fusion_success)
+{
+    GroupNormCase param;
+    param.groupNormType = "GroupNorm";
+    param.act = TestAct::SIGMOID_MUL;
+    param.dtype = DT_FLOAT;
+    auto graph = BuildGraph(param);
+    EXPECT_EQ(RunPass(graph), SUCCESS);
+    EXPECT_EQ(CountOpType(graph, "GroupNormSilu"), 1);
+    EXPECT_EQ(CountOpType(graph, "Sigmoid"), 0);
+    EXPECT_EQ(CountOpType(graph, "Mul"), 0);
+}
+
+TEST_F(GroupNormSiluFusionPassTest, group_norm_v2_swish_fusion_keep_scale)
+{
+    GroupNormCase param;
+    param.act = TestAct::SWISH;
+    param.swishScale = 2.0f;
+    auto graph = BuildGraph(param);
+    EXPECT_EQ(RunPass(graph), SUCCESS);
+    GNode fused;
+    ASSERT_TRUE(FindNode(graph, "GroupNormSwish", fused));
+    float scale = 0.0f;
+    fused.GetAttr("swish_scale", scale);
+    EXPECT_FLOAT_EQ(scale, 2.0f);
+}
+
+TEST_F(GroupNormSiluFusionPassTest, group_norm_y_extra_consumer_not_fuse)
+{
+    GroupNormCase param;
+    param.extraYConsumer = true;
+    auto graph = BuildGraph(param);
+    EXPECT_EQ(RunPass(graph), GRAPH_NOT_CHANGED);
+    EXPECT_EQ(CountOpType(graph, "GroupNormSilu"), 0);
+}
+
+TEST_F(GroupNormSiluFusionPassTest, group_norm_stats_used_not_fuse)
+{
+    GroupNormCase param;
+    param.groupNormType = "GroupNorm";
+    param.useStats = true;
+    auto graph = BuildGraph(param);
+    EXPECT_EQ(RunPass(graph), GRAPH_NOT_CHANGED);
+}
+
+TEST_F(GroupNormSiluFusionPassTest, swish_scale_one_fuse_to_group_norm_silu)
+{
+    GroupNormCase param;
+    param.act = TestAct::SWISH;
+    param.swishScale = 1.0f;
+    auto graph = BuildGraph(param);
+    EXPECT_EQ(RunPass(graph), SUCCESS);
+    EXPECT_EQ(CountOpType(graph, "GroupNormSilu"), 1);
+    EXPECT_EQ(CountOpType(graph, "GroupNormSwish"), 0);
+    EXPECT_EQ(CountOpType(graph, "Swish"), 0);
+}
+
+TEST_F(GroupNormSiluFusionPassTest, swish_scale_one_on_310p_fuse_to_group_norm_silu)
+{
+    SetPlatform("Ascend310P");
+    GroupNormCase param;
+    param.act = TestAct::SWISH;
+    param.swishScale = 1.0f;
+    auto graph = BuildGraph(param);
+    EXPECT_EQ(RunPass(graph), SUCCESS);
+    EXPECT_EQ(CountOpType(graph, "GroupNormSilu"), 1);
+}
+
+TEST_F(GroupNormSiluFusionPassTest, swish_on_310p_not_fuse)
+{
+    SetPlatform("Ascend310P");
+    GroupNormCase param;
+    param.act = TestAct::SWISH;
+    param.swishScale = 2.0f;
+    auto graph = BuildGraph(param);
+    EXPECT_EQ(RunPass(graph), GRAPH_NOT_CHANGED);
+}
+
+TEST_F(GroupNormSiluFusionPassTest, x_fp16_gamma_fp32_fusion_success)
+{
+    GroupNormCase param;
+    param.gammaDtype = DT_FLOAT;
+    auto graph = BuildGraph(param);
+    EXPECT_EQ(RunPass(graph), SUCCESS);
+    EXPECT_EQ(CountOpType(graph, "GroupNormSilu"), 1);
+}
+
+TEST_F(GroupNormSiluFusionPassTest, x_fp32_gamma_fp16_not_fuse)
+{
+    GroupNormCase param;
+    param.dtype = DT_FLOAT;
+    param.gammaDtype = DT_FLOAT16;
+    auto graph = BuildGraph(param);
+    EXPECT_EQ(RunPass(graph), GRAPH_NOT_CHANGED);
+    EXPECT_EQ(CountOpType(graph, "GroupNormSilu"), 0);
+}
+
+TEST_F(GroupNormSiluFusionPassTest, x_bf16_gamma_fp16_not_fuse)
+{
+    GroupNormCase param;
+    param.dtype = DT_BF16;
+    param.gammaDtype = DT_FLOAT16;
+    auto graph = BuildGraph(param);
+    EXPECT_EQ(RunPass(graph), GRAPH_NOT_CHANGED);
+}
+
+TEST_F(GroupNormSiluFusionPassTest, bf16_dtype_pair_by_platform)
+{
+    GroupNormCase param;
+    param.dtype = DT_BF16;
+    param.gammaDtype = DT_FLOAT;
+    auto graph = BuildGraph(param);
+    EXPECT_EQ(RunPass(graph), SUCCESS);
+    EXPECT_EQ(CountOpType(graph, "GroupNormSilu"), 1);
+
+    // 310P 的 GroupNormSilu 不支持 bf16
+    SetPlatform("Ascend310P");
+    auto graph310p = BuildGraph(param);
+    EXPECT_EQ(RunPass(graph310p), GRAPH_NOT_CHANGED);
+}
@@ -47,6 +47,14 @@ extern "C" __global__ __aicore__ void inplace_add_rms_norm(GM_ADDR x1, GM_ADDR x
     } else if (TILING_KEY_IS(31)) {
 #if !(defined(__NPU_ARCH__) && (__NPU_ARCH__ == 3003 || __NPU_ARCH__ == 3113))
         GENERAL_OP_IMPL(KernelAddRmsNormSplitD, bfloat16_t, 1);
+#endif
+    } else if (TILING_KEY_IS(15)) {
+        GENERAL_OP_IMPL(KernelAddRmsNormSplitD, half, 1, true);
+    } else if (TILING_KEY_IS(25)) {
+        GENERAL_OP_IMPL(KernelAddRmsNormSplitD, float, 1, true);
+    } else if (TILING_KEY_IS(35)) {
+#if !(defined(__NPU_ARCH__) && (__NPU_ARCH__ == 3003 || __NPU_ARCH__ == 3113))
+        GENERAL_OP_IMPL(KernelAddRmsNormSplitD, bfloat16_t, 1, true);
 #endif
     } else if (TILING_KEY_IS(12)) {
         GENERAL_OP_IMPL(KernelAddRmsNormMergeN, half, 1);
@@ -0,0 +1,70 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file add_norm_fusion_utils.h
+ * \brief Add + Norm 融合 pass 的公共判断: 残差输入能否被 Inplace 融合算子原地改写
+ */
+#ifndef OPS_NORM_NORM_COMMON_OP_GRAPH_ADD_NORM_FUSION_UTILS_H_
+#define OPS_NORM_NORM_COMMON_OP_GRAPH_ADD_NORM_FUSION_UTILS_H_
+
+#include <set>
+#include <string>
+
+#include "graph/gnode.h"
+
+namespace ops {
+namespace add_norm_fusion {
+// 输出与输入共用同一块内存的节点, 是否可写取决于其输入
+const std::set<std::string> kAliasOutputTypes = {"Identity",   "RefIdentity", "ReadVariableOp", "Reshape",
+                                                 "Squeeze",    "Unsqueeze",   "ExpandDims",     "Flatten"};
+// 输出引用变量内存的节点, 改写会修改变量
+const std::set<std::string> kRefOutputTypes = {"Assign", "AssignAdd", "AssignSub"};
+
+inline std::string GetNodeType(const ge::GNode& node)
+{
+    ge::AscendString type;
+    if (node.GetType(type) != ge::GRAPH_SUCCESS) {
+        return "";
+    }
+    return type.GetString();
+}
+
+inline bool HasDataInput(const ge::GNode& node)
+{
+    for (size_t i = 0; i < node.GetInputsSize(); ++i) {
+        if (node.GetInDataNodesAndPortIndexs(static_cast<int32_t>(i)).first != nullptr) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// node 第 inIdx 个输入可被原地改写的条件: 生产者是由数据输入计算得到的普通节点, 且该输出只有 node 一个消费者.
+// 没有数据输入的源节点 (Data/Const/FileConstant/ConstPlaceHolder/Variable 等) 是图输入、常量或变量, 一律不改写.
+inline bool IsInplaceWritableInput(const ge::GNode& node, int32_t inIdx)
+{
+    auto [peer, outIdx] = node.GetInDataNodesAndPortIndexs(inIdx);
+    if (peer == nullptr || peer->GetOutDataNodesAndPortIndexs(outIdx).size() != 1U) {
+        return false;
+    }
+    const std::string peerType = GetNodeType(*peer);
+    if (peerType.empty() || kRefOutputTypes.count(peerType) != 0) {
+        return false;
+    }
+    if (kAliasOutputTypes.count(peerType) != 0) {
+        return IsInplaceWritableInput(*peer, 0);
+    }
+    return HasDataInput(*peer);
+}
+} // namespace add_norm_fusion
+} // namespace ops
+
+#endif // OPS_NORM_NORM_COMMON_OP_GRAPH_ADD_NORM_FUSION_UTILS_H_
@@ -0,0 +1,42 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file sparse_apply_adam_w_graph_infer.cpp
+ * \brief SparseApplyAdamW operator graph infer resource
+ */
+
+#include "register/op_impl_registry.h"
+#include "log/log.h"
+
+namespace ops {
+using namespace ge;
+
+static constexpr int64_t IDX_VAR = 0;
+static constexpr int64_t IDX_M = 1;
+static constexpr int64_t IDX_V = 2;
+
+static ge::graphStatus InferDataTypeSparseApplyAdamW(gert::InferDataTypeContext* context)
+{
+    OP_LOGD(context->GetNodeName(), "Begin to do InferDataTypeSparseApplyAdamW");
+
+    // Output dtypes follow input var dtype
+    ge::DataType varDtype = context->GetInputDataType(IDX_VAR);
+    context->SetOutputDataType(IDX_VAR, varDtype);
+    context->SetOutputDataType(IDX_M, varDtype);
+    context->SetOutputDataType(IDX_V, varDtype);
+
+    OP_LOGD(context->GetNodeName(), "End to do InferDataTypeSparseApplyAdamW");
+    return GRAPH_SUCCESS;
+}
+
+IMPL_OP(SparseApplyAdamW).InferDataType(InferDataTypeSparseApplyAdamW);
+
+}; // namespace ops
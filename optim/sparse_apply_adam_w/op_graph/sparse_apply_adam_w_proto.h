@@ -0,0 +1,94 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file sparse_apply_adam_w_proto.h
+ * \brief Proto definition for SparseApplyAdamW operator
+ */
+#ifndef OPS_OP_PROTO_INC_SPARSE_APPLY_ADAM_W_H_
+#define OPS_OP_PROTO_INC_SPARSE_APPLY_ADAM_W_H_
+
+#include "graph/operator_reg.h"
+#include "graph/types.h"
+
+namespace ge {
+
+/**
+ *@brief Applies the AdamW algorithm to the rows of "var", "m" and "v" selected by "indices".
+ * For clarity, the output variable is suffixed with "_out" in the fomulas below (e.g. m_out).
+ * @code{.c}
+ *   gt = maximize ? -grad[k] : grad[k]
+ *   m_out[i] = m[i] * beta1 + (1 - beta1) * gt
+ *   v_out[i] = v[i] * beta2 + (1 - beta2) * gt * gt
+ *   beta1_power_out = beta1_power * beta1
+ *   beta2_power_out = beta2_power * beta2
+ *   denom = sqrt(v_out[i] / (1 - beta2_power_out)) + epsilon
+ *   var_out[i] = var[i] * (1 - lr * weight_decay) - lr / (1 - beta1_power_out) * m_out[i] / denom
+ * @endcode
+ * where i = indices[k]. When "lazy_mode" is false, every row of "var" is updated and the rows not referenced
+ * by "indices" use gt = 0, which matches ApplyAdamW on the densified gradient. When "lazy_mode" is true, only
+ * the referenced rows are read and written.
+ *
+ *@par Inputs:
+ *Twelve inputs, including:
+ * @li var: A Tensor of type float32. The variable to be updated. Should be from a Variable().
+ * @li m: A Tensor of type float32. First moment, same shape as var. Should be from a Variable().
+ * @li v: A Tensor of type float32. Second moment, same shape as var. Should be from a Variable().
+ * @li beta1_power: A Tensor of type float32. Scalar, value is beta1^(step-1).
+ * @li beta2_power: A Tensor of type float32. Scalar, value is beta2^(step-1).
+ * @li lr: A Tensor of type float32. Learning rate scalar.
+ * @li weight_decay: A Tensor of type float32. Decoupled weight decay scalar.
+ * @li beta1: A Tensor of type float32. Decay rate of the first moment scalar.
+ * @li beta2: A Tensor of type float32. Decay rate of the second moment scalar.
+ * @li epsilon: A Tensor of type float32. Numerical stability scalar.
+ * @li grad: A Tensor of type float32. Gradient rows, first dim equals indices length.
+ * @li indices: A Tensor of type int32 or int64. Row indices to update, values must be unique in lazy mode,
+ * repeated values are summed in index order in dense mode.
+ *
+ *@par Outputs:
+ *Three outputs, including:
+ * @li var: A Tensor of type float32. Updated variable, same shape as input var.
+ * @li m: A Tensor of type float32. Updated first moment.
+ * @li v: A Tensor of type float32. Updated second moment.
+ *
+ *@par Attributes:
+ * @li use_locking: An optional bool. Defaults to false. If true, use locks for variable update.
+ * @li maximize: An optional bool. Defaults to false. If true, maximize the objective instead of minimizing.
+ * @li lazy_mode: An optional bool. Defaults to false. If true, only the rows referenced by indices are updated.
+ *
+ *@par Restrictions:
+ *Warning: THIS FUNCTION IS EXPERIMENTAL. Please do not use.
+ */
+#ifndef OPS_PROTO_DEF_SPARSEAPPLYADAMW
+#define OPS_PROTO_DEF_SPARSEAPPLYADAMW
+REG_OP(SparseApplyAdamW)
+    .INPUT(var, TensorType({DT_FLOAT}))
+    .INPUT(m, TensorType({DT_FLOAT}))
+    .INPUT(v, TensorType({DT_FLOAT}))
+    .INPUT(beta1_power, TensorType({DT_FLOAT}))
+    .INPUT(beta2_power, TensorType({DT_FLOAT}))
+    .INPUT(lr, TensorType({DT_FLOAT}))
+    .INPUT(weight_decay, TensorType({DT_FLOAT}))
+    .INPUT(beta1, TensorType({DT_FLOAT}))
+    .INPUT(beta2, TensorType({DT_FLOAT}))
+    .INPUT(epsilon, TensorType({DT_FLOAT}))
+    .INPUT(grad, TensorType({DT_FLOAT}))
+    .INPUT(indices, TensorType({DT_INT32, DT_INT64}))
+    .OUTPUT(var, TensorType({DT_FLOAT}))
+    .OUTPUT(m, TensorType({DT_FLOAT}))
+    .OUTPUT(v, TensorType({DT_FLOAT}))
+    .ATTR(use_locking, Bool, false)
+    .ATTR(maximize, Bool, false)
+    .ATTR(lazy_mode, Bool, false)
+    .OP_END_FACTORY_REG(SparseApplyAdamW)
+#endif
+} // namespace ge
+
+#endif // OPS_OP_PROTO_INC_SPARSE_APPLY_ADAM_W_H_
@@ -0,0 +1,228 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file sparse_apply_adam_w_tiling.cpp
+ * \brief Tiling implementation for sparse_apply_adam_w operator
+ *
+ * Lazy mode: core distribution based on kCount * rowSize (actual work items), like the other sparse_apply_* ops.
+ * Dense mode: every row is updated, rows are split into contiguous per-core ranges and each core links the
+ * grad slots of its own rows into per-row lists in the user workspace (int32 head per row, int32 next per slot).
+ */
+
+#include <algorithm>
+#include <limits>
+#include "log/log.h"
+#include "platform/platform_ascendc.h"
+#include "util/math_util.h"
+#include "op_host/tiling_util.h"
+#include "op_host/tiling_templates_registry.h"
+#include "optim/sparse_apply_adam_w/op_kernel/arch35/sparse_apply_adam_w_tiling_data.h"
+#include "optim/sparse_apply_adam_w/op_kernel/arch35/sparse_apply_adam_w_tiling_key.h"
+
+namespace optiling {
+
+using namespace Ops::NN::Optiling;
+
+constexpr uint32_t DCACHE_SIZE = 128 * 1024;
+constexpr uint32_t STATIC_UB_ESTIMATE = 0;
+constexpr int64_t MIN_ELEMENTS_PER_CORE = 1024;
+
+constexpr int32_t IDX_VAR = 0;
+constexpr int32_t IDX_M = 1;
+constexpr int32_t IDX_V = 2;
+constexpr int32_t IDX_SCALAR_BEGIN = 3;
+constexpr int32_t IDX_SCALAR_END = 9;
+constexpr int32_t IDX_GRAD = 10;
+constexpr int32_t IDX_INDICES = 11;
+
+constexpr size_t ATTR_IDX_MAXIMIZE = 1;
+constexpr size_t ATTR_IDX_LAZY_MODE = 2;
+
+struct SparseApplyAdamWCompileInfo {};
+
+static ge::graphStatus GetPlatformInfo(gert::TilingContext* context, uint64_t& ubSize, int64_t& coreNum)
+{
+    fe::PlatFormInfos* platformInfoPtr = context->GetPlatformInfo();
+    OP_CHECK_NULL_WITH_CONTEXT(context, platformInfoPtr);
+    auto ascendcPlatform = platform_ascendc::PlatformAscendC(platformInfoPtr);
+    coreNum = ascendcPlatform.GetCoreNumAiv();
+    OP_CHECK_IF(coreNum == 0, OP_LOGE(context, "coreNum is 0"), return ge::GRAPH_FAILED);
+    ascendcPlatform.GetCoreMemSize(platform_ascendc::CoreMemType::UB, ubSize);
+    OP_CHECK_IF(ubSize == 0, OP_LOGE(context, "ubSize is 0"), return ge::GRAPH_FAILED);
+    return ge::GRAPH_SUCCESS;
+}
+
+static bool GetBoolAttr(gert::TilingContext* context, size_t idx)
+{
+    auto attrs = context->GetAttrs();
+    if (attrs == nullptr) {
+        return false;
+    }
+    const bool* value = attrs->GetAttrPointer<bool>(idx);
+    return value != nullptr && *value;
+}
+
+static ge::graphStatus GetWorkspaceSize(gert::TilingContext* context, size_t userWorkspaceSize)
+{
+    auto ascendcPlatform = platform_ascendc::PlatformAscendC(context->GetPlatformInfo());
+    uint64_t sysWorkspaceSize = ascendcPlatform.GetLibApiWorkSpaceSize();
+    size_t* currentWorkspace = context->GetWorkspaceSizes(1);
+    OP_CHECK_NULL_WITH_CONTEXT(context, currentWorkspace);
+    currentWorkspace[0] = static_cast<size_t>(sysWorkspaceSize) + userWorkspaceSize;
+    return ge::GRAPH_SUCCESS;
+}
+
+static ge::graphStatus SetLocalMemory(gert::TilingContext* context, uint64_t ubSize)
+{
+    OP_CHECK_IF((ubSize <= DCACHE_SIZE + STATIC_UB_ESTIMATE),
+                OP_LOGE(context, "ubSize %lu <= DCACHE_SIZE + STATIC_UB_ESTIMATE", ubSize), return ge::GRAPH_FAILED);
+    auto res = context->SetLocalMemorySize(static_cast<uint32_t>(ubSize - DCACHE_SIZE - STATIC_UB_ESTIMATE));
+    OP_CHECK_IF((res != ge::GRAPH_SUCCESS), OP_LOGE(context, "SetLocalMemorySize failed"), return ge::GRAPH_FAILED);
+    return ge::GRAPH_SUCCESS;
+}
+
+static ge::graphStatus CheckDtypes(gert::TilingContext* context)
+{
+    for (int32_t idx = IDX_VAR; idx <= IDX_GRAD; idx++) {
+        auto desc = context->GetInputDesc(idx);
+        OP_CHECK_NULL_WITH_CONTEXT(context, desc);
+        OP_CHECK_IF(desc->GetDataType() != ge::DT_FLOAT,
+                    OP_LOGE(context, "input[%d] dtype %d must be float32", idx,
+                            static_cast<int32_t>(desc->GetDataType())),
+                    return ge::GRAPH_FAILED);
+    }
+    auto indicesDesc = context->GetInputDesc(IDX_INDICES);
+    OP_CHECK_NULL_WITH_CONTEXT(context, indicesDesc);
+    auto indicesDtype = indicesDesc->GetDataType();
+    OP_CHECK_IF(indicesDtype != ge::DT_INT32 && indicesDtype != ge::DT_INT64,
+                OP_LOGE(context, "indices dtype %d must be int32 or int64", static_cast<int32_t>(indicesDtype)),
+                return ge::GRAPH_FAILED);
+    return ge::GRAPH_SUCCESS;
+}
+
+static ge::graphStatus CheckShapes(gert::TilingContext* context, const gert::Shape& varShape,
+                                   const gert::Shape& indicesShape)
+{
+    OP_CHECK_IF(varShape.GetDimNum() == 0, OP_LOGE(context, "var must be at least 1D"), return ge::GRAPH_FAILED);
+    OP_CHECK_IF(indicesShape.GetDimNum() != 1,
+                OP_LOGE(context, "indices must be 1D, but got %zu dims", indicesShape.GetDimNum()),
+                return ge::GRAPH_FAILED);
+
+    for (int32_t idx = IDX_SCALAR_BEGIN; idx <= IDX_SCALAR_END; idx++) {
+        auto scalarInput = context->GetInputShape(idx);
+        OP_CHECK_NULL_WITH_CONTEXT(context, scalarInput);
+        auto scalarShape = scalarInput->GetStorageShape();
+        OP_CHECK_IF(scalarShape.GetDimNum() != 0 && !(scalarShape.GetDimNum() == 1 && scalarShape.GetDim(0) == 1),
+                    OP_LOGE(context, "input[%d] must be a scalar (shape empty or [1]), but got shape with %zu dims",
+                            idx, scalarShape.GetDimNum()),
+                    return ge::GRAPH_FAILED);
+    }
+
+    for (int32_t idx : {IDX_M, IDX_V}) {
+        auto stateInput = context->GetInputShape(idx);
+        OP_CHECK_NULL_WITH_CONTEXT(context, stateInput);
+        OP_CHECK_IF(stateInput->GetStorageShape() != varShape,
+                    OP_LOGE(context, "input[%d] shape must be equal to var shape", idx), return ge::GRAPH_FAILED);
+    }
+
+    auto gradInput = context->GetInputShape(IDX_GRAD);
+    OP_CHECK_NULL_WITH_CONTEXT(context, gradInput);
+    auto gradShape = gradInput->GetStorageShape();
+    OP_CHECK_IF(gradShape.GetDimNum() != varShape.GetDimNum(),
+                OP_LOGE(context, "grad dim num %zu != var dim num %zu", gradShape.GetDimNum(), varShape.GetDimNum()),
+                return ge::GRAPH_FAILED);
+    OP_CHECK_IF(gradShape.GetDim(0) != indicesShape.GetDim(0),
+                OP_LOGE(context, "grad first dim %ld != indices length %ld", gradShape.GetDim(0),
+                        indicesShape.GetDim(0)),
+                return ge::GRAPH_FAILED);
+    for (size_t i = 1; i < varShape.GetDimNum(); i++) {
+        OP_CHECK_IF(
+            gradShape.GetDim(i) != varShape.GetDim(i),
+            OP_LOGE(context, "grad dim[%zu]=%ld != var dim[%zu]=%ld", i, gradShape.GetDim(i), i, varShape.GetDim(i)),
+            return ge::GRAPH_FAILED);
+    }
+    return ge::GRAPH_SUCCESS;
+}
+
+static ge::graphStatus SparseApplyAdamWTilingFunc(gert::TilingContext* context)
+{
+    uint64_t ubSize = 0;
+    int64_t coreNum = 0;
+    OP_CHECK_IF(GetPlatformInfo(context, ubSize, coreNum) != ge::GRAPH_SUCCESS,
+                OP_LOGE(context, "GetPlatformInfo error"), return ge::GRAPH_FAILED);
+    OP_CHECK_IF(CheckDtypes(context) != ge::GRAPH_SUCCESS, OP_LOGE(context, "CheckDtypes error"),
+                return ge::GRAPH_FAILED);
+
+    auto varInput = context->GetInputShape(IDX_VAR);
+    OP_CHECK_NULL_WITH_CONTEXT(context, varInput);
+    auto indicesInput = context->GetInputShape(IDX_INDICES);
+    OP_CHECK_NULL_WITH_CONTEXT(context, indicesInput);
+    auto varShape = varInput->GetStorageShape();
+    auto indicesShape = indicesInput->GetStorageShape();
+    OP_CHECK_IF(CheckShapes(context, varShape, indicesShape) != ge::GRAPH_SUCCESS,
+                OP_LOGE(context, "CheckShapes error"), return ge::GRAPH_FAILED);
+
+    int64_t kCount = indicesShape.GetShapeSize();
+    int64_t varShapeSize = varShape.GetShapeSize();
+    int64_t firstDim = varShape.GetDim(0);
+    int64_t rowSize = (firstDim > 0) ? (varShapeSize / firstDim) : 0;
+    int32_t indicesDType = (context->GetInputDesc(IDX_INDICES)->GetDataType() == ge::DT_INT64) ? 1 : 0;
+    bool lazyMode = GetBoolAttr(context, ATTR_IDX_LAZY_MODE);
+    OP_CHECK_IF(!lazyMode && kCount > static_cast<int64_t>(std::numeric_limits<int32_t>::max()),
+                OP_LOGE(context, "indices length %ld exceeds int32 range in dense mode", kCount),
+                return ge::GRAPH_FAILED);
+
+    SparseApplyAdamWTilingData* tiling = context->GetTilingData<SparseApplyAdamWTilingData>();
+    OP_CHECK_NULL_WITH_CONTEXT(context, tiling);
+    OP_CHECK_IF(memset_s(tiling, sizeof(SparseApplyAdamWTilingData), 0, sizeof(SparseApplyAdamWTilingData)) != EOK,
+                OP_LOGE(context, "set tiling data error"), return ge::GRAPH_FAILED);
+    tiling->kCount = kCount;
+    tiling->rowSize = rowSize;
+    tiling->varTotalSize = varShapeSize;
+    tiling->firstDim = firstDim;
+    tiling->indicesDType = indicesDType;
+    tiling->maximize = GetBoolAttr(context, ATTR_IDX_MAXIMIZE) ? 1 : 0;
+
+    int64_t workElements = lazyMode ? kCount * rowSize : varShapeSize;
+    int64_t calcCoreNum = Ops::Base::CeilDiv(workElements, MIN_ELEMENTS_PER_CORE);
+    int64_t needCoreNum = std::max(std::min(calcCoreNum, coreNum), static_cast<int64_t>(1));
+    size_t userWorkspaceSize = 0;
+    if (!lazyMode) {
+        // Contiguous row ranges per core; recompute the core count so that no core is left without rows.
+        tiling->rowsPerCore = std::max(Ops::Base::CeilDiv(firstDim, needCoreNum), static_cast<int64_t>(1));
+        needCoreNum = std::max(Ops::Base::CeilDiv(firstDim, tiling->rowsPerCore), static_cast<int64_t>(1));
+        userWorkspaceSize = static_cast<size_t>(firstDim + kCount) * sizeof(int32_t);
+    }
+    context->SetBlockDim(static_cast<uint32_t>(needCoreNum));
+
+    OP_CHECK_IF(GetWorkspaceSize(context, userWorkspaceSize) != ge::GRAPH_SUCCESS,
+                OP_LOGE(context, "GetWorkspaceSize error"), return ge::GRAPH_FAILED);
+    OP_CHECK_IF(SetLocalMemory(context, ubSize) != ge::GRAPH_SUCCESS, OP_LOGE(context, "SetLocalMemory error"),
+                return ge::GRAPH_FAILED);
+
+    uint32_t schMode = (indicesDType == 0) ? TILING_KEY_IDX_INT32 : TILING_KEY_IDX_INT64;
+    uint32_t modeKey = lazyMode ? TILING_KEY_LAZY_MODE : TILING_KEY_DENSE_MODE;
+    context->SetTilingKey(GET_TPL_TILING_KEY(schMode, modeKey));
+    OP_LOGD(context, "SparseApplyAdamW tiling: kCount=%ld, rowSize=%ld, firstDim=%ld, lazyMode=%d, blockDim=%ld",
+            kCount, rowSize, firstDim, static_cast<int32_t>(lazyMode), needCoreNum);
+    return ge::GRAPH_SUCCESS;
+}
+
+static ge::graphStatus TilingParseForSparseApplyAdamW([[maybe_unused]] gert::TilingParseContext* context)
+{
+    return ge::GRAPH_SUCCESS;
+}
+
+IMPL_OP_OPTILING(SparseApplyAdamW)
+    .Tiling(SparseApplyAdamWTilingFunc)
+    .TilingParse<SparseApplyAdamWCompileInfo>(TilingParseForSparseApplyAdamW);
+
+} // namespace optiling
@@ -0,0 +1,99 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file sparse_apply_adam_w_infershape.cpp
+ * \brief Infershape implementation for sparse_apply_adam_w operator
+ *
+ * Output shapes: var_out=var, m_out=m, v_out=v
+ */
+#include "register/op_impl_registry.h"
+#include "log/log.h"
+
+using namespace ge;
+
+namespace ops {
+static constexpr int64_t IDX_VAR = 0;
+static constexpr int64_t IDX_M = 1;
+static constexpr int64_t IDX_V = 2;
+static constexpr int64_t IDX_GRAD = 10;
+static constexpr int64_t IDX_INDICES = 11;
+
+static void CopyShape(const gert::Shape* src, gert::Shape* dst)
+{
+    dst->SetDimNum(src->GetDimNum());
+    for (size_t i = 0; i < src->GetDimNum(); i++) {
+        dst->SetDim(i, src->GetDim(i));
+    }
+}
+
+static ge::graphStatus InferShapeSparseApplyAdamW(gert::InferShapeContext* context)
+{
+    OP_LOGD(context->GetNodeName(), "Begin InferShapeSparseApplyAdamW");
+
+    // var_out.shape = var.shape
+    const gert::Shape* varShape = context->GetInputShape(IDX_VAR);
+    OP_CHECK_NULL_WITH_CONTEXT(context, varShape);
+    gert::Shape* varOutShape = context->GetOutputShape(IDX_VAR);
+    OP_CHECK_NULL_WITH_CONTEXT(context, varOutShape);
+    CopyShape(varShape, varOutShape);
+
+    // m_out.shape = m.shape
+    const gert::Shape* mShape = context->GetInputShape(IDX_M);
+    OP_CHECK_NULL_WITH_CONTEXT(context, mShape);
+    gert::Shape* mOutShape = context->GetOutputShape(IDX_M);
+    OP_CHECK_NULL_WITH_CONTEXT(context, mOutShape);
+    CopyShape(mShape, mOutShape);
+
+    // v_out.shape = v.shape
+    const gert::Shape* vShape = context->GetInputShape(IDX_V);
+    OP_CHECK_NULL_WITH_CONTEXT(context, vShape);
+    gert::Shape* vOutShape = context->GetOutputShape(IDX_V);
+    OP_CHECK_NULL_WITH_CONTEXT(context, vOutShape);
+    CopyShape(vShape, vOutShape);
+
+    // 校验：var/m/v rank 一致
+    if (varShape->GetDimNum() != mShape->GetDimNum()) {
+        OP_LOGE(context->GetNodeName(), "var and m must have same rank");
+        return ge::GRAPH_FAILED;
+    }
+    if (varShape->GetDimNum() != vShape->GetDimNum()) {
+        OP_LOGE(context->GetNodeName(), "var and v must have same rank");
+        return ge::GRAPH_FAILED;
+    }
+
+    // 校验：grad.shape[0] == indices.shape[0]
+    const gert::Shape* gradShape = context->GetInputShape(IDX_GRAD);
+    OP_CHECK_NULL_WITH_CONTEXT(context, gradShape);
+    const gert::Shape* indicesShape = context->GetInputShape(IDX_INDICES);
+    OP_CHECK_NULL_WITH_CONTEXT(context, indicesShape);
+    if (gradShape->GetDim(0) != indicesShape->GetDim(0)) {
+        OP_LOGE(context->GetNodeName(), "grad first dim must equal indices length");
+        return ge::GRAPH_FAILED;
+    }
+
+    // 校验：grad.shape[1:] == var.shape[1:]
+    if (gradShape->GetDimNum() != varShape->GetDimNum()) {
+        OP_LOGE(context->GetNodeName(), "grad and var must have same rank");
+        return ge::GRAPH_FAILED;
+    }
+    for (size_t i = 1; i < varShape->GetDimNum(); i++) {
+        if (gradShape->GetDim(i) != varShape->GetDim(i)) {
+            OP_LOGE(context->GetNodeName(), "grad trailing dims must match var trailing dims");
+            return ge::GRAPH_FAILED;
+        }
+    }
+
+    OP_LOGD(context->GetNodeName(), "End InferShapeSparseApplyAdamW");
+    return GRAPH_SUCCESS;
+}
+
+IMPL_OP_INFERSHAPE(SparseApplyAdamW).InferShape(InferShapeSparseApplyAdamW);
+} // namespace ops
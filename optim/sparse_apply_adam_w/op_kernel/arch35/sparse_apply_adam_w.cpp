@@ -0,0 +1,43 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file sparse_apply_adam_w.cpp
+ * \brief Kernel entry for sparse_apply_adam_w operator
+ *
+ * Template parameters:
+ *   schMode (uint32_t): indices dtype (0=int32, 1=int64)
+ *   lazyMode (uint32_t): 0=update every row, 1=update indexed rows only
+ */
+
+#include "sparse_apply_adam_w_simt.h"
+
+template <uint32_t schMode, uint32_t lazyMode>
+__global__ __aicore__ void sparse_apply_adam_w(GM_ADDR var, GM_ADDR m, GM_ADDR v, GM_ADDR beta1_power,
+                                               GM_ADDR beta2_power, GM_ADDR lr, GM_ADDR weight_decay, GM_ADDR beta1,
+                                               GM_ADDR beta2, GM_ADDR epsilon, GM_ADDR grad, GM_ADDR indices,
+                                               GM_ADDR var_out, GM_ADDR m_out, GM_ADDR v_out, GM_ADDR workspace,
+                                               GM_ADDR tiling)
+{
+    REGISTER_TILING_DEFAULT(SparseApplyAdamWTilingData);
+    GET_TILING_DATA_WITH_STRUCT(SparseApplyAdamWTilingData, tilingData, tiling);
+    GM_ADDR userWorkspace = AscendC::GetUserWorkspace(workspace);
+    constexpr bool isLazy = (lazyMode == TILING_KEY_LAZY_MODE);
+
+    if constexpr (schMode == TILING_KEY_IDX_INT32) {
+        NsSparseApplyAdamW::Process<float, int32_t, isLazy>(beta1_power, beta2_power, lr, weight_decay, beta1, beta2,
+                                                            epsilon, grad, indices, var_out, m_out, v_out,
+                                                            userWorkspace, &tilingData);
+    } else if constexpr (schMode == TILING_KEY_IDX_INT64) {
+        NsSparseApplyAdamW::Process<float, int64_t, isLazy>(beta1_power, beta2_power, lr, weight_decay, beta1, beta2,
+                                                            epsilon, grad, indices, var_out, m_out, v_out,
+                                                            userWorkspace, &tilingData);
+    }
+}
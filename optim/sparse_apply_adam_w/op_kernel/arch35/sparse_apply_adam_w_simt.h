@@ -0,0 +1,184 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file sparse_apply_adam_w_simt.h
+ * \brief SIMT kernel implementation for sparse_apply_adam_w operator
+ *
+ * Lazy mode: Grid-Stride loop over kCount * rowSize elements (indices_count x tail_axis),
+ * non-indexed rows are untouched (inplace operation), same as the other sparse_apply_* kernels.
+ *
+ * Dense mode: every row of var/m/v decays, rows absent from indices see a zero gradient.
+ * Rows are split into contiguous ranges of rowsPerCore, one range per core. Each core links the grad
+ * slots of its own rows into per-row lists in workspace (head per row, next per slot), ordered by
+ * ascending slot, so duplicate indices are summed in index order and the result does not depend on
+ * thread scheduling. The lists never cross cores and only an intra-core asc_syncthreads() is needed
+ * between the list build and the update.
+ */
+
+#ifndef SPARSE_APPLY_ADAM_W_SIMT_H_
+#define SPARSE_APPLY_ADAM_W_SIMT_H_
+
+#include "kernel_operator.h"
+#include "kernel_tiling/kernel_tiling.h"
+#include "simt_api/common_functions.h"
+#include "simt_api/asc_simt.h"
+#include "simt_api/math_functions.h"
+#include "sparse_apply_adam_w_tiling_data.h"
+#include "sparse_apply_adam_w_tiling_key.h"
+
+namespace NsSparseApplyAdamW {
+using namespace AscendC;
+
+static constexpr uint32_t THREAD_NUM = 512;
+static constexpr int32_t NO_GRAD_SLOT = -1;
+
+struct AdamWScalars {
+    float lr;
+    float beta1;
+    float beta2;
+    float epsilon;
+    float decay;       // 1 - lr * weight_decay
+    float stepSize;    // lr / (1 - beta1_power * beta1)
+    float biasCorr2;   // 1 / (1 - beta2_power * beta2)
+    float gradFactor;  // -1 when maximize, else 1
+};
+
+template <typename T>
+__simt_callee__ inline void AdamWUpdateElement(int64_t offset, float g, const AdamWScalars& s, __gm__ T* varGm,
+                                               __gm__ T* mGm, __gm__ T* vGm)
+{
+    float gt = g * s.gradFactor;
+    float mNew = s.beta1 * static_cast<float>(mGm[offset]) + (1.0f - s.beta1) * gt;
+    float vNew = s.beta2 * static_cast<float>(vGm[offset]) + (1.0f - s.beta2) * gt * gt;
+    float denom = sqrtf(vNew * s.biasCorr2) + s.epsilon;
+    float varNew = static_cast<float>(varGm[offset]) * s.decay - s.stepSize * (mNew / denom);
+
+    mGm[offset] = static_cast<T>(mNew);
+    vGm[offset] = static_cast<T>(vNew);
+    varGm[offset] = static_cast<T>(varNew);
+}
+
+// Lazy mode: only rows referenced by indices are read and written.
+template <typename T, typename Tindices>
+__simt_vf__ __aicore__ LAUNCH_BOUND(THREAD_NUM) inline void OpSparseApplyAdamWLazyKernel(
+    int64_t kCount, int64_t rowSize, int64_t firstDim, AdamWScalars scalars, __gm__ T* varGm, __gm__ T* mGm,
+    __gm__ T* vGm, __gm__ T* gradGm, __gm__ Tindices* indicesGm)
+{
+    uint64_t totalU64 = static_cast<uint64_t>(kCount * rowSize);
+    uint64_t uRowSize = static_cast<uint64_t>(rowSize);
+
+    for (uint64_t idx =
+             static_cast<uint64_t>(blockIdx.x) * static_cast<uint64_t>(blockDim.x) + static_cast<uint64_t>(threadIdx.x);
+         idx < totalU64; idx += static_cast<uint64_t>(blockDim.x) * static_cast<uint64_t>(gridDim.x)) {
+        int64_t k = static_cast<int64_t>(idx / uRowSize);
+        int64_t j = static_cast<int64_t>(idx % uRowSize);
+
+        int64_t index = static_cast<int64_t>(indicesGm[k]);
+        if (index < 0 || index >= firstDim) {
+            continue;
+        }
+        float g = static_cast<float>(gradGm[k * rowSize + j]);
+        AdamWUpdateElement<T>(index * rowSize + j, g, scalars, varGm, mGm, vGm);
+    }
+}
+
+// Dense mode: the core owning rows [rowStart, rowEnd) links their grad slots, then updates all of them.
+template <typename T, typename Tindices>
+__simt_vf__ __aicore__ LAUNCH_BOUND(THREAD_NUM) inline void OpSparseApplyAdamWDenseKernel(
+    int64_t kCount, int64_t rowSize, int64_t firstDim, int64_t rowsPerCore, AdamWScalars scalars, __gm__ T* varGm,
+    __gm__ T* mGm, __gm__ T* vGm, __gm__ T* gradGm, __gm__ Tindices* indicesGm, __gm__ int32_t* headGm,
+    __gm__ int32_t* nextGm)
+{
+    int64_t rowStart = static_cast<int64_t>(blockIdx.x) * rowsPerCore;
+    int64_t rowEnd = rowStart + rowsPerCore < firstDim ? rowStart + rowsPerCore : firstDim;
+    if (rowStart >= rowEnd) {
+        return;
+    }
+    int64_t tid = static_cast<int64_t>(threadIdx.x);
+    int64_t stride = static_cast<int64_t>(blockDim.x);
+
+    for (int64_t r = rowStart + tid; r < rowEnd; r += stride) {
+        headGm[r] = NO_GRAD_SLOT;
+    }
+    asc_syncthreads();
+
+    // Head insertion in descending slot order leaves every list in ascending slot order. One thread builds
+    // the lists so that duplicate indices never race on headGm.
+    if (tid == 0) {
+        for (int64_t k = kCount - 1; k >= 0; --k) {
+            int64_t index = static_cast<int64_t>(indicesGm[k]);
+            if (index >= rowStart && index < rowEnd) {
+                nextGm[k] = headGm[index];
+                headGm[index] = static_cast<int32_t>(k);
+            }
+        }
+    }
+    asc_syncthreads();
+
+    uint64_t uRowSize = static_cast<uint64_t>(rowSize);
+    uint64_t begin = static_cast<uint64_t>(rowStart * rowSize);
+    uint64_t end = static_cast<uint64_t>(rowEnd * rowSize);
+    for (uint64_t idx = begin + static_cast<uint64_t>(tid); idx < end; idx += static_cast<uint64_t>(stride)) {
+        int64_t r = static_cast<int64_t>(idx / uRowSize);
+        int64_t j = static_cast<int64_t>(idx % uRowSize);
+        float g = 0.0f;
+        for (int32_t slot = headGm[r]; slot != NO_GRAD_SLOT; slot = nextGm[slot]) {
+            g += static_cast<float>(gradGm[static_cast<int64_t>(slot) * rowSize + j]);
+        }
+        AdamWUpdateElement<T>(static_cast<int64_t>(idx), g, scalars, varGm, mGm, vGm);
+    }
+}
+
+template <typename T, typename Tindices, bool isLazy>
+__aicore__ inline void Process(GM_ADDR beta1Power, GM_ADDR beta2Power, GM_ADDR lr, GM_ADDR weightDecay, GM_ADDR beta1,
+                               GM_ADDR beta2, GM_ADDR epsilon, GM_ADDR grad, GM_ADDR indices, GM_ADDR varOut,
+                               GM_ADDR mOut, GM_ADDR vOut, GM_ADDR userWorkspace,
+                               const SparseApplyAdamWTilingData* tilingData)
+{
+    int64_t kCount = tilingData->kCount;
+    if (isLazy && kCount == 0) {
+        return;
+    }
+
+    float beta1Val = *((__gm__ float*)beta1);
+    float beta2Val = *((__gm__ float*)beta2);
+    float lrVal = *((__gm__ float*)lr);
+    AdamWScalars scalars;
+    scalars.lr = lrVal;
+    scalars.beta1 = beta1Val;
+    scalars.beta2 = beta2Val;
+    scalars.epsilon = *((__gm__ float*)epsilon);
+    scalars.decay = 1.0f - lrVal * *((__gm__ float*)weightDecay);
+    scalars.stepSize = lrVal / (1.0f - *((__gm__ float*)beta1Power) * beta1Val);
+    scalars.biasCorr2 = 1.0f / (1.0f - *((__gm__ float*)beta2Power) * beta2Val);
+    scalars.gradFactor = tilingData->maximize != 0 ? -1.0f : 1.0f;
+
+    __gm__ T* varGm = (__gm__ T*)varOut;
+    __gm__ T* mGm = (__gm__ T*)mOut;
+    __gm__ T* vGm = (__gm__ T*)vOut;
+    __gm__ T* gradGm = (__gm__ T*)grad;
+    __gm__ Tindices* indicesGm = (__gm__ Tindices*)indices;
+
+    if constexpr (isLazy) {
+        asc_vf_call<OpSparseApplyAdamWLazyKernel<T, Tindices>>(dim3(THREAD_NUM), kCount, tilingData->rowSize,
+                                                               tilingData->firstDim, scalars, varGm, mGm, vGm, gradGm,
+                                                               indicesGm);
+    } else {
+        asc_vf_call<OpSparseApplyAdamWDenseKernel<T, Tindices>>(
+            dim3(THREAD_NUM), kCount, tilingData->rowSize, tilingData->firstDim, tilingData->rowsPerCore, scalars,
+            varGm, mGm, vGm, gradGm, indicesGm, (__gm__ int32_t*)userWorkspace,
+            (__gm__ int32_t*)userWorkspace + tilingData->firstDim);
+    }
+}
+
+} // namespace NsSparseApplyAdamW
+
+#endif // SPARSE_APPLY_ADAM_W_SIMT_H_
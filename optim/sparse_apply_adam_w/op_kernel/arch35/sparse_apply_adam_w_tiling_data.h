@@ -0,0 +1,29 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file sparse_apply_adam_w_tiling_data.h
+ * \brief Tiling data struct for sparse_apply_adam_w operator
+ */
+
+#ifndef SPARSE_APPLY_ADAM_W_TILING_DATA_H_
+#define SPARSE_APPLY_ADAM_W_TILING_DATA_H_
+
+struct SparseApplyAdamWTilingData {
+    int64_t kCount = 0;
+    int64_t rowSize = 0;
+    int64_t varTotalSize = 0;
+    int64_t firstDim = 0;
+    int64_t rowsPerCore = 0;
+    int32_t indicesDType = 0;
+    int32_t maximize = 0;
+};
+
+#endif // SPARSE_APPLY_ADAM_W_TILING_DATA_H_
@@ -0,0 +1,46 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file sparse_apply_adam_w_tiling_key.h
+ * \brief Tiling key declaration for sparse_apply_adam_w operator
+ *
+ * Two template parameters:
+ *   schMode (UINT 1-bit): indices dtype
+ *     0 = int32, 1 = int64
+ *   lazyMode (UINT 1-bit): row update range
+ *     0 = every row of var (untouched rows see a zero gradient), 1 = indexed rows only
+ */
+
+#ifndef SPARSE_APPLY_ADAM_W_TILING_KEY_H_
+#define SPARSE_APPLY_ADAM_W_TILING_KEY_H_
+
+#include "ascendc/host_api/tiling/template_argument.h"
+
+#define TILING_KEY_IDX_INT32 0
+#define TILING_KEY_IDX_INT64 1
+
+#define TILING_KEY_DENSE_MODE 0
+#define TILING_KEY_LAZY_MODE 1
+
+ASCENDC_TPL_ARGS_DECL(SparseApplyAdamW,
+                      ASCENDC_TPL_UINT_DECL(schMode, 1, ASCENDC_TPL_UI_LIST, TILING_KEY_IDX_INT32,
+                                            TILING_KEY_IDX_INT64),
+                      ASCENDC_TPL_UINT_DECL(lazyMode, 1, ASCENDC_TPL_UI_LIST, TILING_KEY_DENSE_MODE,
+                                            TILING_KEY_LAZY_MODE));
+
+ASCENDC_TPL_SEL(ASCENDC_TPL_ARGS_SEL(ASCENDC_TPL_KERNEL_TYPE_SEL(ASCENDC_TPL_AIV_ONLY),
+                                     ASCENDC_TPL_UINT_SEL(schMode, ASCENDC_TPL_UI_LIST, TILING_KEY_IDX_INT32,
+                                                          TILING_KEY_IDX_INT64),
+                                     ASCENDC_TPL_UINT_SEL(lazyMode, ASCENDC_TPL_UI_LIST, TILING_KEY_DENSE_MODE,
+                                                          TILING_KEY_LAZY_MODE),
+                                     ASCENDC_TPL_TILING_STRUCT_SEL(SparseApplyAdamWTilingData)));
+
+#endif // SPARSE_APPLY_ADAM_W_TILING_KEY_H_
@@ -0,0 +1,63 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+# Copyright (c) 2026 Huawei Technologies Co., Ltd.
+# This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+# CANN Open Software License Agreement Version 2.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+# INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+# See LICENSE in the root of the software repository for the full text of the License.
+# ----------------------------------------------------------------------------
+
+
+import numpy as np
+
+__golden__ = {
+    "kernel": {"sparse_apply_adam_w": "sparse_apply_adam_w_golden"}
+}
+
+
+def _scalar(x):
+    return float(np.asarray(x).flatten()[0])
+
+
+def sparse_apply_adam_w_golden(var, m, v, beta1_power, beta2_power, lr, weight_decay, beta1, beta2, epsilon, grad,
+                               indices, *, use_locking=False, maximize=False, lazy_mode=False, **kwargs):
+    '''
+    Golden function for sparse_apply_adam_w.
+    There is no framework operator with the same semantics, so the reference is computed with numpy in float64.
+    Dense mode (lazy_mode=False) equals ApplyAdamW on the densified gradient; lazy mode only touches the rows
+    referenced by indices.
+
+    Args:
+        var/m/v: numpy.ndarray, shape=(D0, D1, ...), dtype=float32
+        beta1_power/beta2_power/lr/weight_decay/beta1/beta2/epsilon: numpy.ndarray, shape=(1,), dtype=float32
+        grad: numpy.ndarray, shape=(N, D1, ...), dtype=float32
+        indices: numpy.ndarray, shape=(N,), dtype=int32/int64, unique in lazy mode, may repeat in dense mode
+        use_locking/maximize/lazy_mode: bool
+        **kwargs: TTK metadata
+
+    Returns:
+        tuple: (var_out, m_out, v_out)
+    '''
+    b1p, b2p, lr_val, wd, b1, b2, eps = [_scalar(x) for x in
+                                         (beta1_power, beta2_power, lr, weight_decay, beta1, beta2, epsilon)]
+    var_out = var.astype(np.float64)
+    m_out = m.astype(np.float64)
+    v_out = v.astype(np.float64)
+    idx = np.asarray(indices).astype(np.int64)
+
+    dense_grad = np.zeros_like(var_out)
+    # duplicate indices accumulate, same as densifying the sparse gradient
+    np.add.at(dense_grad, idx, grad.astype(np.float64))
+    if maximize:
+        dense_grad = -dense_grad
+    rows = np.unique(idx) if lazy_mode else np.arange(var.shape[0])
+
+    g = dense_grad[rows]
+    m_out[rows] = b1 * m_out[rows] + (1.0 - b1) * g
+    v_out[rows] = b2 * v_out[rows] + (1.0 - b2) * g * g
+    denom = np.sqrt(v_out[rows] / (1.0 - b2p * b2)) + eps
+    var_out[rows] = var_out[rows] * (1.0 - lr_val * wd) - lr_val / (1.0 - b1p * b1) * m_out[rows] / denom
+
+    return var_out.astype(var.dtype), m_out.astype(m.dtype), v_out.astype(v.dtype)
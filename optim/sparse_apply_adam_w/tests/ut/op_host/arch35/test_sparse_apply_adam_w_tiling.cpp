@@ -0,0 +1,232 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+#include "../../../../op_kernel/arch35/sparse_apply_adam_w_tiling_data.h"
+#include "ut_op_util.h"
+#include "exe_graph/runtime/storage_format.h"
+#include "exe_graph/runtime/storage_shape.h"
+#include "kernel_run_context_facker.h"
+#include "test_cube_util.h"
+
+using namespace ut_util;
+using namespace std;
+using namespace ge;
+
+class TestSparseApplyAdamWTiling : public testing::Test {
+protected:
+    static void SetUpTestCase() { std::cout << "TestSparseApplyAdamWTiling SetUp" << std::endl; }
+
+    static void TearDownTestCase() { std::cout << "TestSparseApplyAdamWTiling TearDown" << std::endl; }
+};
+
+// tiling key = schMode | (lazyMode << 1)
+static constexpr uint64_t TILING_KEY_INT32_DENSE = 0;
+static constexpr uint64_t TILING_KEY_INT64_DENSE = 1;
+static constexpr uint64_t TILING_KEY_INT32_LAZY = 2;
+static constexpr uint64_t TILING_KEY_INT64_LAZY = 3;
+
+static void InitPlatForm(fe::PlatFormInfos& platFormInfo, map<string, string>& socInfos,
+                         map<string, string>& aicoreSpec, map<string, string>& intrinsics,
+                         map<string, string>& socVersion)
+{
+    string compile_info_string = R"({
+         "hardware_info": {"BT_SIZE": 0, "load3d_constraints": "1",
+                           "Intrinsic_fix_pipe_l0c2out": false,
+                           "Intrinsic_data_move_l12ub": true,
+                           "Intrinsic_data_move_l0c2ub": true,
+                           "Intrinsic_data_move_out2l1_nd2nz": false,
+                           "UB_SIZE": 245760, "L2_SIZE": 33554432, "L1_SIZE": 524288,
+                           "L0A_SIZE": 65536, "L0B_SIZE": 65536, "L0C_SIZE": 131072,
+                           "CORE_NUM": 64, "socVersion": "Ascend950"}})";
+    GetPlatFormInfos(compile_info_string.c_str(), socInfos, aicoreSpec, intrinsics, socVersion);
+    platFormInfo.Init();
+}
+
+struct SparseApplyAdamWUtCompileInfo {};
+
+struct SparseApplyAdamWTilingResult {
+    ge::graphStatus status;
+    uint64_t tilingKey;
+    uint32_t blockDim;
+    size_t workspaceSize;
+    int64_t kCount;
+    int64_t rowSize;
+    int64_t firstDim;
+    int64_t rowsPerCore;
+    int32_t maximize;
+};
+
+static SparseApplyAdamWTilingResult DoSparseApplyAdamWTilingCase(const std::initializer_list<int64_t>& varShape,
+                                                                 const std::initializer_list<int64_t>& indicesShape,
+                                                                 ge::DataType indicesDtype, bool lazyMode,
+                                                                 bool maximize = false)
+{
+    SparseApplyAdamWTilingResult result{ge::GRAPH_FAILED, 0, 0, 0, 0, 0, 0, 0, 0};
+
+    fe::PlatFormInfos platFormInfo;
+    map<string, string> socInfos;
+    map<string, string> aicoreSpec;
+    map<string, string> intrinsics;
+    map<string, string> socVersion = {{"Short_SoC_version", "ASCEND950"}};
+    InitPlatForm(platFormInfo, socInfos, aicoreSpec, intrinsics, socVersion);
+
+    std::string opType("SparseApplyAdamW");
+    EXPECT_NE(gert::OpImplRegistry::GetInstance().GetOpImpl(opType.c_str()), nullptr);
+    if (gert::OpImplRegistry::GetInstance().GetOpImpl(opType.c_str()) == nullptr) {
+        return result;
+    }
+
+    auto tiling_func = gert::OpImplRegistry::GetInstance().GetOpImpl(opType.c_str())->tiling;
+
+    auto param = gert::TilingData::CreateCap(4096);
+    auto workspace_size_holer = gert::ContinuousVector::Create<size_t>(4096);
+    auto ws_size = reinterpret_cast<gert::ContinuousVector*>(workspace_size_holer.get());
+    EXPECT_NE(param, nullptr);
+    if (param == nullptr) {
+        return result;
+    }
+
+    std::vector<int64_t> varVec(varShape);
+    std::vector<int64_t> gradVec;
+    gradVec.push_back(*indicesShape.begin());
+    for (size_t i = 1; i < varVec.size(); i++) {
+        gradVec.push_back(varVec[i]);
+    }
+    gert::StorageShape gradStorage;
+    gradStorage.MutableShape().SetDimNum(gradVec.size());
+    gradStorage.MutableStorageShape().SetDimNum(gradVec.size());
+    for (size_t i = 0; i < gradVec.size(); i++) {
+        gradStorage.MutableShape().SetDim(i, gradVec[i]);
+        gradStorage.MutableStorageShape().SetDim(i, gradVec[i]);
+    }
+
+    gert::StorageShape varStorage = {varShape, varShape};
+    gert::StorageShape scalarStorage = {{1}, {1}};
+    gert::StorageShape indicesStorage = {indicesShape, indicesShape};
+
+    SparseApplyAdamWUtCompileInfo compileInfo;
+
+    auto holder = gert::TilingContextFaker()
+                      .SetOpType(opType)
+                      .NodeIoNum(12, 3)
+                      .IrInstanceNum({1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1})
+                      .InputShapes({&varStorage, &varStorage, &varStorage, &scalarStorage, &scalarStorage,
+                                    &scalarStorage, &scalarStorage, &scalarStorage, &scalarStorage, &scalarStorage,
+                                    &gradStorage, &indicesStorage})
+                      .OutputShapes({&varStorage, &varStorage, &varStorage})
+                      .CompileInfo(&compileInfo)
+                      .PlatformInfo(reinterpret_cast<char*>(&platFormInfo))
+                      .NodeInputTd(0, ge::DT_FLOAT, ge::FORMAT_ND, ge::FORMAT_ND)
+                      .NodeInputTd(1, ge::DT_FLOAT, ge::FORMAT_ND, ge::FORMAT_ND)
+                      .NodeInputTd(2, ge::DT_FLOAT, ge::FORMAT_ND, ge::FORMAT_ND)
+                      .NodeInputTd(3, ge::DT_FLOAT, ge::FORMAT_ND, ge::FORMAT_ND)
+                      .NodeInputTd(4, ge::DT_FLOAT, ge::FORMAT_ND, ge::FORMAT_ND)
+                      .NodeInputTd(5, ge::DT_FLOAT, ge::FORMAT_ND, ge::FORMAT_ND)
+                      .NodeInputTd(6, ge::DT_FLOAT, ge::FORMAT_ND, ge::FORMAT_ND)
+                      .NodeInputTd(7, ge::DT_FLOAT, ge::FORMAT_ND, ge::FORMAT_ND)
+                      .NodeInputTd(8, ge::DT_FLOAT, ge::FORMAT_ND, ge::FORMAT_ND)
+                      .NodeInputTd(9, ge::DT_FLOAT, ge::FORMAT_ND, ge::FORMAT_ND)
+                      .NodeInputTd(10, ge::DT_FLOAT, ge::FORMAT_ND, ge::FORMAT_ND)
+                      .NodeInputTd(11, indicesDtype, ge::FORMAT_ND, ge::FORMAT_ND)
+                      .NodeOutputTd(0, ge::DT_FLOAT, ge::FORMAT_ND, ge::FORMAT_ND)
+                      .NodeOutputTd(1, ge::DT_FLOAT, ge::FORMAT_ND, ge::FORMAT_ND)
+                      .NodeOutputTd(2, ge::DT_FLOAT, ge::FORMAT_ND, ge::FORMAT_ND)
+                      .NodeAttrs({{"use_locking", Ops::NN::AnyValue::CreateFrom<bool>(false)},
+                                  {"maximize", Ops::NN::AnyValue::CreateFrom<bool>(maximize)},
+                                  {"lazy_mode", Ops::NN::AnyValue::CreateFrom<bool>(lazyMode)}})
+                      .TilingData(param.get())
+                      .Workspace(ws_size)
+                      .Build();
+
+    gert::TilingContext* tiling_context = holder.GetContext<gert::TilingContext>();
+    EXPECT_NE(tiling_context->GetPlatformInfo(), nullptr);
+    holder.GetContext<gert::TilingContext>()->GetPlatformInfo()->SetPlatformRes("SoCInfo", socInfos);
+    holder.GetContext<gert::TilingContext>()->GetPlatformInfo()->SetPlatformRes("AICoreSpec", aicoreSpec);
+    holder.GetContext<gert::TilingContext>()->GetPlatformInfo()->SetCoreNumByCoreType("AICore");
+    holder.GetContext<gert::TilingContext>()->GetPlatformInfo()->SetPlatformRes("AICoreintrinsicDtypeMap", intrinsics);
+    tiling_context->GetPlatformInfo()->SetPlatformRes("version", socVersion);
+
+    result.status = tiling_func(tiling_context);
+    if (result.status == ge::GRAPH_SUCCESS) {
+        result.tilingKey = tiling_context->GetTilingKey();
+        result.blockDim = tiling_context->GetBlockDim();
+        result.workspaceSize = tiling_context->GetWorkspaceSizes(1)[0];
+        auto rawTilingData = tiling_context->GetRawTilingData();
+        if (rawTilingData != nullptr && rawTilingData->GetDataSize() >= sizeof(SparseApplyAdamWTilingData)) {
+            const auto* td = reinterpret_cast<const SparseApplyAdamWTilingData*>(rawTilingData->GetData());
+            result.kCount = td->kCount;
+            result.rowSize = td->rowSize;
+            result.firstDim = td->firstDim;
+            result.rowsPerCore = td->rowsPerCore;
+            result.maximize = td->maximize;
+        }
+    }
+    return result;
+}
+
+TEST_F(TestSparseApplyAdamWTiling, sparse_apply_adam_w_int32_lazy)
+{
+    auto result = DoSparseApplyAdamWTilingCase({4, 8}, {2}, ge::DT_INT32, true);
+    ASSERT_EQ(result.status, ge::GRAPH_SUCCESS);
+    ASSERT_EQ(result.tilingKey, TILING_KEY_INT32_LAZY);
+    EXPECT_EQ(result.kCount, 2);
+    EXPECT_EQ(result.rowSize, 8);
+    EXPECT_EQ(result.blockDim, 1U);
+}
+
+TEST_F(TestSparseApplyAdamWTiling, sparse_apply_adam_w_int64_lazy)
+{
+    auto result = DoSparseApplyAdamWTilingCase({4, 8}, {2}, ge::DT_INT64, true);
+    ASSERT_EQ(result.status, ge::GRAPH_SUCCESS);
+    ASSERT_EQ(result.tilingKey, TILING_KEY_INT64_LAZY);
+}
+
+TEST_F(TestSparseApplyAdamWTiling, sparse_apply_adam_w_int32_dense)
+{
+    auto result = DoSparseApplyAdamWTilingCase({4, 8}, {2}, ge::DT_INT32, false, true);
+    ASSERT_EQ(result.status, ge::GRAPH_SUCCESS);
+    ASSERT_EQ(result.tilingKey, TILING_KEY_INT32_DENSE);
+    EXPECT_EQ(result.firstDim, 4);
+    EXPECT_EQ(result.rowsPerCore, 4);
+    EXPECT_EQ(result.maximize, 1);
+    // row list heads for 4 rows plus next links for 2 grad slots
+    EXPECT_GE(result.workspaceSize, (4 + 2) * sizeof(int32_t));
+}
+
+TEST_F(TestSparseApplyAdamWTiling, sparse_apply_adam_w_int64_dense_multi_core)
+{
+    // 1000 rows x 1024 cols: each core owns a contiguous row range, no core is left empty
+    auto result = DoSparseApplyAdamWTilingCase({1000, 1024}, {16}, ge::DT_INT64, false);
+    ASSERT_EQ(result.status, ge::GRAPH_SUCCESS);
+    ASSERT_EQ(result.tilingKey, TILING_KEY_INT64_DENSE);
+    ASSERT_GT(result.rowsPerCore, 0);
+    EXPECT_GT(result.blockDim, 1U);
+    EXPECT_GE(static_cast<int64_t>(result.blockDim) * result.rowsPerCore, 1000);
+    EXPECT_LT(static_cast<int64_t>(result.blockDim - 1) * result.rowsPerCore, 1000);
+}
+
+TEST_F(TestSparseApplyAdamWTiling, sparse_apply_adam_w_empty_indices)
+{
+    auto result = DoSparseApplyAdamWTilingCase({4, 8}, {0}, ge::DT_INT32, true);
+    ASSERT_EQ(result.status, ge::GRAPH_SUCCESS);
+    EXPECT_EQ(result.kCount, 0);
+}
+
+TEST_F(TestSparseApplyAdamWTiling, sparse_apply_adam_w_invalid_indices_dtype)
+{
+    auto result = DoSparseApplyAdamWTilingCase({4, 8}, {2}, ge::DT_FLOAT, true);
+    EXPECT_EQ(result.status, ge::GRAPH_FAILED);
+}
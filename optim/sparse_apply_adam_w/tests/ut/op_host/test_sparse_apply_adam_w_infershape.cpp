@@ -0,0 +1,65 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <gtest/gtest.h>
+#include <iostream>
+#include "infershape_case_executor.h"
+
+class SparseApplyAdamWInfershape : public testing::Test {
+protected:
+    static void SetUpTestCase() { std::cout << "SparseApplyAdamWInfershape SetUp" << std::endl; }
+
+    static void TearDownTestCase() { std::cout << "SparseApplyAdamWInfershape TearDown" << std::endl; }
+};
+
+static gert::InfershapeContextPara MakeSparseApplyAdamWPara(const gert::StorageShape& gradShape,
+                                                            const gert::StorageShape& indicesShape)
+{
+    return gert::InfershapeContextPara(
+        "SparseApplyAdamW",
+        {
+            {{{4, 8}, {4, 8}}, ge::DT_FLOAT, ge::FORMAT_ND}, // var
+            {{{4, 8}, {4, 8}}, ge::DT_FLOAT, ge::FORMAT_ND}, // m
+            {{{4, 8}, {4, 8}}, ge::DT_FLOAT, ge::FORMAT_ND}, // v
+            {{{1}, {1}}, ge::DT_FLOAT, ge::FORMAT_ND},       // beta1_power
+            {{{1}, {1}}, ge::DT_FLOAT, ge::FORMAT_ND},       // beta2_power
+            {{{1}, {1}}, ge::DT_FLOAT, ge::FORMAT_ND},       // lr
+            {{{1}, {1}}, ge::DT_FLOAT, ge::FORMAT_ND},       // weight_decay
+            {{{1}, {1}}, ge::DT_FLOAT, ge::FORMAT_ND},       // beta1
+            {{{1}, {1}}, ge::DT_FLOAT, ge::FORMAT_ND},       // beta2
+            {{{1}, {1}}, ge::DT_FLOAT, ge::FORMAT_ND},       // epsilon
+            {gradShape, ge::DT_FLOAT, ge::FORMAT_ND},        // grad
+            {indicesShape, ge::DT_INT32, ge::FORMAT_ND},     // indices
+        },
+        {
+            {{{}, {}}, ge::DT_FLOAT, ge::FORMAT_ND}, // var output
+            {{{}, {}}, ge::DT_FLOAT, ge::FORMAT_ND}, // m output
+            {{{}, {}}, ge::DT_FLOAT, ge::FORMAT_ND}, // v output
+        });
+}
+
+// Test case: var=(4,8), grad=(2,8), indices=(2,), float32, int32 indices
+TEST_F(SparseApplyAdamWInfershape, sparse_apply_adam_w_infershape_test1)
+{
+    auto infershapeContextPara = MakeSparseApplyAdamWPara({{2, 8}, {2, 8}}, {{2}, {2}});
+    std::vector<std::vector<int64_t>> expectOutputShape = {
+        {4, 8}, // var_out.shape = var.shape
+        {4, 8}, // m_out.shape = m.shape
+        {4, 8}, // v_out.shape = v.shape
+    };
+    ExecuteTestCase(infershapeContextPara, ge::GRAPH_SUCCESS, expectOutputShape);
+}
+
+// Test case: grad first dim does not match indices length
+TEST_F(SparseApplyAdamWInfershape, sparse_apply_adam_w_infershape_grad_mismatch)
+{
+    auto infershapeContextPara = MakeSparseApplyAdamWPara({{3, 8}, {3, 8}}, {{2}, {2}});
+    ExecuteTestCase(infershapeContextPara, ge::GRAPH_FAILED);
+}
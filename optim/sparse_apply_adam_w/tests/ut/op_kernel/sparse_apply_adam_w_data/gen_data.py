@@ -0,0 +1,94 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+# ----------------------------------------------------------------------------
+# This program is free software, you can redistribute it and/or modify it.
+# Copyright (c) 2026 Huawei Technologies Co., Ltd.
+# This file is a part of the CANN Open Software.
+# Licensed under CANN Open Software License Agreement Version 2.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING
+# BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+# See LICENSE in the root of the software repository for the full text of the License.
+# ----------------------------------------------------------------------------
+
+import sys
+import os
+import numpy as np
+
+
+def parse_str_to_shape_list(shape_str):
+    shape_str = shape_str.strip('(').strip(')')
+    shape_list = [int(x) for x in shape_str.split(",") if x.strip()]
+    return tuple(shape_list)
+
+
+def sparse_apply_adam_w_golden(var, m, v, scalars, grad, indices, lazy_mode, maximize):
+    """Reference in float64: dense mode equals ApplyAdamW on the densified gradient."""
+    beta1_power, beta2_power, lr, weight_decay, beta1, beta2, epsilon = [np.float64(x) for x in scalars]
+    var_out = var.astype(np.float64)
+    m_out = m.astype(np.float64)
+    v_out = v.astype(np.float64)
+
+    dense_grad = np.zeros_like(var_out)
+    # duplicate indices accumulate, same as densifying the sparse gradient
+    np.add.at(dense_grad, indices.astype(np.int64), grad.astype(np.float64))
+    if maximize:
+        dense_grad = -dense_grad
+    rows = np.unique(indices.astype(np.int64)) if lazy_mode else np.arange(var.shape[0])
+
+    g = dense_grad[rows]
+    m_out[rows] = beta1 * m_out[rows] + (1.0 - beta1) * g
+    v_out[rows] = beta2 * v_out[rows] + (1.0 - beta2) * g * g
+    step_size = lr / (1.0 - beta1_power * beta1)
+    denom = np.sqrt(v_out[rows] / (1.0 - beta2_power * beta2)) + epsilon
+    var_out[rows] = var_out[rows] * (1.0 - lr * weight_decay) - step_size * m_out[rows] / denom
+    return var_out, m_out, v_out
+
+
+def gen_data_and_golden(var_shape_str, indices_shape_str, idx_dtype="int32", d_type="float32", lazy_mode="1",
+                        dup_indices="0"):
+    np_type = np.float32
+    idx_type = {"int32": np.int32, "int64": np.int64}[idx_dtype]
+
+    var_shape = parse_str_to_shape_list(var_shape_str)
+    indices_shape = parse_str_to_shape_list(indices_shape_str)
+    grad_shape = indices_shape[:1] + var_shape[1:]
+
+    var_data = np.random.uniform(-1.0, 1.0, var_shape).astype(np_type)
+    m_data = np.random.uniform(-0.1, 0.1, var_shape).astype(np_type)
+    v_data = np.random.uniform(0.0, 0.1, var_shape).astype(np_type)
+    # beta1_power, beta2_power, lr, weight_decay, beta1, beta2, epsilon
+    scalars = [np.array([x], dtype=np_type) for x in (0.9 ** 3, 0.999 ** 3, 1e-3, 1e-2, 0.9, 0.999, 1e-8)]
+    grad_data = np.random.uniform(-1.0, 1.0, grad_shape).astype(np_type)
+    if dup_indices == "1":
+        # sample with replacement and force at least one repeated index
+        indices_data = np.random.choice(var_shape[0], size=indices_shape[0], replace=True).astype(idx_type)
+        indices_data[-1] = indices_data[0]
+    else:
+        indices_data = np.random.choice(var_shape[0], size=indices_shape[0], replace=False).astype(idx_type)
+
+    var_out, m_out, v_out = sparse_apply_adam_w_golden(var_data, m_data, v_data, [s[0] for s in scalars],
+                                                       grad_data, indices_data, lazy_mode == "1", False)
+
+    var_data.tofile(f"{d_type}_var_sparse_apply_adam_w.bin")
+    m_data.tofile(f"{d_type}_m_sparse_apply_adam_w.bin")
+    v_data.tofile(f"{d_type}_v_sparse_apply_adam_w.bin")
+    scalar_names = ["beta1_power", "beta2_power", "lr", "weight_decay", "beta1", "beta2", "epsilon"]
+    for name, value in zip(scalar_names, scalars):
+        value.tofile(f"{d_type}_{name}_sparse_apply_adam_w.bin")
+    grad_data.tofile(f"{d_type}_grad_sparse_apply_adam_w.bin")
+    indices_data.tofile(f"{idx_dtype}_indices_sparse_apply_adam_w.bin")
+
+    var_out.astype(np_type).tofile(f"{d_type}_var_golden_sparse_apply_adam_w.bin")
+    m_out.astype(np_type).tofile(f"{d_type}_m_golden_sparse_apply_adam_w.bin")
+    v_out.astype(np_type).tofile(f"{d_type}_v_golden_sparse_apply_adam_w.bin")
+
+
+if __name__ == "__main__":
+    if len(sys.argv) not in (6, 7):
+        print("Usage: gen_data.py '<var_shape>' '<indices_shape>' '<idx_dtype>' '<dtype>' '<lazy_mode>' "
+              "['<dup_indices>']")
+        exit(1)
+    os.system("rm -rf *.bin")
+    gen_data_and_golden(sys.argv[1], sys.argv[2], sys.argv[3], sys.argv[4], sys.argv[5],
+                        sys.argv[6] if len(sys.argv) == 7 else "0")
@@ -0,0 +1,142 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file test_sparse_apply_adam_w.cpp
+ * \brief Kernel UT for sparse_apply_adam_w operator
+ */
+
+#include "../../../op_kernel/sparse_apply_adam_w_apt.cpp"
+#include "sparse_apply_adam_w_tiling.h"
+#include <array>
+#include <vector>
+#include <iostream>
+#include <string>
+#include <cstdint>
+#include <cstdlib>
+#include "gtest/gtest.h"
+#include "tikicpulib.h"
+#include "data_utils.h"
+
+using namespace std;
+
+class SparseApplyAdamWTest : public testing::Test {
+protected:
+    static void SetUpTestCase()
+    {
+        cout << "SparseApplyAdamWTest SetUp" << endl;
+        const string cmd = "cp -rf " + dataPath + " ./";
+        system(cmd.c_str());
+        system("chmod -R 755 ./sparse_apply_adam_w_data/");
+    }
+    static void TearDownTestCase() { cout << "SparseApplyAdamWTest TearDown" << endl; }
+
+private:
+    const static std::string rootPath;
+    const static std::string dataPath;
+};
+
+const std::string SparseApplyAdamWTest::rootPath = "../../../../";
+const std::string SparseApplyAdamWTest::dataPath = rootPath +
+                                                   "optim/sparse_apply_adam_w/tests/ut/op_kernel/sparse_apply_adam_w_data";
+
+static const std::array<std::string, 7> SCALAR_NAMES = {"beta1_power", "beta2_power", "lr",     "weight_decay",
+                                                        "beta1",       "beta2",       "epsilon"};
+
+static uint8_t* ReadInput(const std::string& name, size_t byteSize)
+{
+    uint8_t* buf = (uint8_t*)AscendC::GmAlloc(byteSize);
+    std::string path = "./sparse_apply_adam_w_data/" + name + "_sparse_apply_adam_w.bin";
+    ReadFile(path, byteSize, buf, byteSize);
+    return buf;
+}
+
+template <uint32_t schMode, uint32_t lazyMode>
+static void RunSparseApplyAdamWCase(int64_t D0, int64_t D1, int64_t N, const std::string& idxDtype,
+                                    size_t idxTypeSize, bool dupIndices = false)
+{
+    size_t varByteSize = D0 * D1 * sizeof(float);
+    size_t gradByteSize = N * D1 * sizeof(float);
+    size_t indicesByteSize = N * idxTypeSize;
+    size_t scalarByteSize = sizeof(float);
+    size_t workspaceByteSize = 16 * 1024 * 1024 + (D0 + N) * sizeof(int32_t);
+    size_t tilingDataSize = sizeof(SparseApplyAdamWTilingData);
+    uint32_t numBlocks = 2;
+
+    std::string cmd = "cd ./sparse_apply_adam_w_data/ && python3 gen_data.py '(" + std::to_string(D0) + ", " +
+                      std::to_string(D1) + ")' '(" + std::to_string(N) + ",)' '" + idxDtype + "' 'float32' '" +
+                      std::to_string(lazyMode) + "' '" + (dupIndices ? "1" : "0") + "'";
+    system(cmd.c_str());
+
+    // var/m/v are updated inplace, so the output buffers alias the inputs
+    uint8_t* varBuf = ReadInput("float32_var", varByteSize);
+    uint8_t* mBuf = ReadInput("float32_m", varByteSize);
+    uint8_t* vBuf = ReadInput("float32_v", varByteSize);
+    std::vector<uint8_t*> scalarBufs;
+    for (const auto& name : SCALAR_NAMES) {
+        scalarBufs.push_back(ReadInput("float32_" + name, scalarByteSize));
+    }
+    uint8_t* gradBuf = ReadInput("float32_grad", gradByteSize);
+    uint8_t* indicesBuf = ReadInput(idxDtype + "_indices", indicesByteSize);
+
+    uint8_t* workspace = (uint8_t*)AscendC::GmAlloc(workspaceByteSize);
+    uint8_t* tiling = (uint8_t*)AscendC::GmAlloc(tilingDataSize);
+    SparseApplyAdamWTilingData* tilingDatafromBin = reinterpret_cast<SparseApplyAdamWTilingData*>(tiling);
+    tilingDatafromBin->kCount = N;
+    tilingDatafromBin->rowSize = D1;
+    tilingDatafromBin->varTotalSize = D0 * D1;
+    tilingDatafromBin->firstDim = D0;
+    tilingDatafromBin->rowsPerCore = (D0 + numBlocks - 1) / numBlocks;
+    tilingDatafromBin->indicesDType = schMode;
+    tilingDatafromBin->maximize = 0;
+
+    ICPU_SET_TILING_KEY(schMode | (lazyMode << 1));
+    AscendC::SetKernelMode(KernelMode::AIV_MODE);
+
+    ICPU_RUN_KF(sparse_apply_adam_w<schMode, lazyMode>, numBlocks, varBuf, mBuf, vBuf, scalarBufs[0],
+                scalarBufs[1], scalarBufs[2], scalarBufs[3], scalarBufs[4], scalarBufs[5], scalarBufs[6], gradBuf,
+                indicesBuf, varBuf, mBuf, vBuf, workspace, (uint8_t*)(tilingDatafromBin));
+
+    WriteFile("./sparse_apply_adam_w_data/float32_var_output_sparse_apply_adam_w.bin", varBuf, varByteSize);
+    WriteFile("./sparse_apply_adam_w_data/float32_m_output_sparse_apply_adam_w.bin", mBuf, varByteSize);
+    WriteFile("./sparse_apply_adam_w_data/float32_v_output_sparse_apply_adam_w.bin", vBuf, varByteSize);
+
+    AscendC::GmFree(varBuf);
+    AscendC::GmFree(mBuf);
+    AscendC::GmFree(vBuf);
+    for (auto buf : scalarBufs) {
+        AscendC::GmFree(buf);
+    }
+    AscendC::GmFree(gradBuf);
+    AscendC::GmFree(indicesBuf);
+    AscendC::GmFree(workspace);
+    AscendC::GmFree(tiling);
+
+    int ret = system("cd ./sparse_apply_adam_w_data/ && python3 compare_data.py 'float32'");
+    EXPECT_EQ(ret, 0);
+}
+
+// Lazy mode: var=(16,8), grad=(5,8), int32 indices, only indexed rows change
+TEST_F(SparseApplyAdamWTest, test_case_int32_lazy)
+{
+    RunSparseApplyAdamWCase<TILING_KEY_IDX_INT32, TILING_KEY_LAZY_MODE>(16, 8, 5, "int32", sizeof(int32_t));
+}
+
+// Dense mode: var=(16,8), grad=(5,8), int64 indices, untouched rows decay with zero gradient
+TEST_F(SparseApplyAdamWTest, test_case_int64_dense)
+{
+    RunSparseApplyAdamWCase<TILING_KEY_IDX_INT64, TILING_KEY_DENSE_MODE>(16, 8, 5, "int64", sizeof(int64_t));
+}
+
+// Dense mode with repeated indices: var=(16,8), grad=(24,8), gradients of the same row are summed
+TEST_F(SparseApplyAdamWTest, test_case_int32_dense_dup_indices)
+{
+    RunSparseApplyAdamWCase<TILING_KEY_IDX_INT32, TILING_KEY_DENSE_MODE>(16, 8, 24, "int32", sizeof(int32_t), true);
+}
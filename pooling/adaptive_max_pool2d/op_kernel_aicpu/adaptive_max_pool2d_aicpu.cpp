@@ -9,7 +9,9 @@
  */
 
 #include "adaptive_max_pool2d_aicpu.h"
+#include <algorithm>
 #include <cmath>
+#include <vector>
 #include "utils/eigen_tensor.h"
 #include "utils/kernel_util.h"
 #include "cpu_kernel_utils.h"
@@ -35,14 +37,38 @@ struct AdaptiveCalcArgs {
     int64_t in_stride_w = 0;
 };
 
-inline int64_t StartIndex(int64_t offset, int64_t out_size, int64_t in_size)
+// 总比较次数低于该值时串行执行
+constexpr int64_t kParallelMinCompareNum = 64 * 1024;
+// 平面数不足核数时, 每核期望的输出行分块数
+constexpr int64_t kRowTilesPerCore = 2;
+
+// 自适应窗口表: 第 i 个输出对应输入区间 [start[i], end[i])
+struct AdaptiveWindowTable {
+    std::vector<int64_t> start;
+    std::vector<int64_t> end;
+    // 所有窗口长度之和
+    int64_t span_sum = 0;
+};
+
+AdaptiveWindowTable BuildWindowTable(int64_t out_size, int64_t in_size)
 {
-    return (int64_t)std::floor((double)(offset * in_size) / out_size);
+    AdaptiveWindowTable table;
+    table.start.resize(out_size);
+    table.end.resize(out_size);
+    for (int64_t i = 0; i < out_size; i++) {
+        // 等价于 floor(i * in / out) 与 ceil((i + 1) * in / out), 调用方已校验乘法不溢出
+        table.start[i] = (i * in_size) / out_size;
+        table.end[i] = ((i + 1) * in_size + out_size - 1) / out_size;
+        table.span_sum += table.end[i] - table.start[i];
+    }
+    return table;
 }
 
-inline int64_t EndIndex(int64_t offset, int64_t out_size, int64_t in_size)
+// 与逐元素扫描保持一致: 严格大于才替换(相等取先出现者), NaN 总是替换(取最后一个 NaN)
+template <typename SCALAR_T>
+inline bool IsBetter(SCALAR_T val, SCALAR_T max_val)
 {
-    return (int64_t)std::ceil((double)((offset + 1) * in_size) / out_size);
+    return (val > max_val) || std::isnan(static_cast<double>(val));
 }
 } // namespace
 
@@ -52,65 +78,146 @@ inline bool CheckMulIsOverflow(int64_t in_size_h, int64_t out_size_h, int64_t in
     int64_t tmp = 0;
     return (!MulWithoutOverflow(in_size_h, out_size_h, tmp)) || (!MulWithoutOverflow(in_size_w, out_size_w, tmp));
 }
+// 直接扫描窗口, 计算平面 plane 的输出行 [oh_start, oh_end)
 template <typename SCALAR_T, typename INDICES_T>
-void AdaptiveMaxPool2dSingleOutFrame(const CpuKernelContext& ctx, AdaptiveCalcArgs<SCALAR_T, INDICES_T> args)
+void AdaptiveMaxPool2dDirect(const AdaptiveCalcArgs<SCALAR_T, INDICES_T>& args, const AdaptiveWindowTable& table_h,
+                             const AdaptiveWindowTable& table_w, int64_t plane, int64_t oh_start, int64_t oh_end)
 {
-    (void)CpuKernelUtils::ParallelFor(ctx, args.in_size_d, 1, [&](int64_t start, int64_t end) {
-        for (auto d = start; d < end; d++) {
-            for (int64_t offset_h = 0; offset_h < args.out_size_h; offset_h++) {
-                int64_t in_start_h = StartIndex(offset_h, args.out_size_h, args.in_size_h);
-                int64_t in_end_h = EndIndex(offset_h, args.out_size_h, args.in_size_h);
-                int64_t step_h = in_end_h - in_start_h;
-
-                for (int64_t offset_w = 0; offset_w < args.out_size_w; offset_w++) {
-                    int64_t in_start_w = StartIndex(offset_w, args.out_size_w, args.in_size_w);
-                    int64_t in_end_w = EndIndex(offset_w, args.out_size_w, args.in_size_w);
-                    int64_t step_w = in_end_w - in_start_w;
-
-                    SCALAR_T* in_point = args.input_data + d * args.in_stride_d + in_start_h * args.in_stride_h +
-                                         in_start_w * args.in_stride_w;
-                    SCALAR_T* out_point = args.output_data + d * args.out_size_h * args.out_size_w +
-                                          offset_h * args.out_size_w + offset_w;
-                    INDICES_T* indices_point = args.indices_data + d * args.out_size_h * args.out_size_w +
-                                               offset_h * args.out_size_w + offset_w;
-
-                    int64_t ih = 0;
-                    int64_t iw = 0;
-                    INDICES_T max_index = static_cast<INDICES_T>((ih + in_start_h) * args.in_size_w +
-                                                                 (iw + in_start_w));
-                    SCALAR_T max_val = -std::numeric_limits<SCALAR_T>::infinity();
-                    for (ih = 0; ih < step_h; ih++) {
-                        for (iw = 0; iw < step_w; iw++) {
-                            SCALAR_T val = *(in_point + ih * args.in_stride_h + iw * args.in_stride_w);
-                            if ((val > max_val) || std::isnan(static_cast<double>(val))) {
-                                max_val = val;
-                                max_index = static_cast<INDICES_T>((ih + in_start_h) * args.in_size_w +
-                                                                   (iw + in_start_w));
-                            }
-                        }
+    const SCALAR_T* in_plane = args.input_data + plane * args.in_stride_d;
+    SCALAR_T* out_plane = args.output_data + plane * args.out_size_h * args.out_size_w;
+    INDICES_T* indices_plane = args.indices_data + plane * args.out_size_h * args.out_size_w;
+    for (int64_t oh = oh_start; oh < oh_end; oh++) {
+        const int64_t ih_start = table_h.start[oh];
+        const int64_t ih_end = table_h.end[oh];
+        for (int64_t ow = 0; ow < args.out_size_w; ow++) {
+            const int64_t iw_start = table_w.start[ow];
+            const int64_t iw_end = table_w.end[ow];
+            int64_t max_index = ih_start * args.in_size_w + iw_start;
+            SCALAR_T max_val = -std::numeric_limits<SCALAR_T>::infinity();
+            for (int64_t ih = ih_start; ih < ih_end; ih++) {
+                const SCALAR_T* in_row = in_plane + ih * args.in_stride_h;
+                for (int64_t iw = iw_start; iw < iw_end; iw++) {
+                    const SCALAR_T val = in_row[iw];
+                    if (IsBetter(val, max_val)) {
+                        max_val = val;
+                        max_index = ih * args.in_size_w + iw;
                     }
+                }
+            }
+            out_plane[oh * args.out_size_w + ow] = max_val;
+            indices_plane[oh * args.out_size_w + ow] = static_cast<INDICES_T>(max_index);
+        }
+    }
+}
 
-                    *out_point = max_val;
-                    *indices_point = max_index;
+// 可分离计算: 先对每个输入行求各列窗口的最大值及位置, 再沿 H 方向在行结果上求最大值.
+// 行内取第一个最大值/最后一个 NaN, 行间同样规则, 结果与按行优先顺序直接扫描一致.
+template <typename SCALAR_T, typename INDICES_T>
+void AdaptiveMaxPool2dSeparable(const AdaptiveCalcArgs<SCALAR_T, INDICES_T>& args,
+                                const AdaptiveWindowTable& table_h, const AdaptiveWindowTable& table_w,
+                                int64_t plane, int64_t oh_start, int64_t oh_end, std::vector<SCALAR_T>& row_val,
+                                std::vector<int64_t>& row_idx)
+{
+    const SCALAR_T* in_plane = args.input_data + plane * args.in_stride_d;
+    SCALAR_T* out_plane = args.output_data + plane * args.out_size_h * args.out_size_w;
+    INDICES_T* indices_plane = args.indices_data + plane * args.out_size_h * args.out_size_w;
+    const int64_t out_w = args.out_size_w;
+    const int64_t ih_start = table_h.start[oh_start];
+    const int64_t ih_end = table_h.end[oh_end - 1];
+    row_val.resize(static_cast<size_t>((ih_end - ih_start) * out_w));
+    row_idx.resize(row_val.size());
+
+    for (int64_t ih = ih_start; ih < ih_end; ih++) {
+        const SCALAR_T* in_row = in_plane + ih * args.in_stride_h;
+        SCALAR_T* val_row = row_val.data() + (ih - ih_start) * out_w;
+        int64_t* idx_row = row_idx.data() + (ih - ih_start) * out_w;
+        for (int64_t ow = 0; ow < out_w; ow++) {
+            const int64_t iw_end = table_w.end[ow];
+            int64_t max_index = table_w.start[ow];
+            SCALAR_T max_val = -std::numeric_limits<SCALAR_T>::infinity();
+            for (int64_t iw = table_w.start[ow]; iw < iw_end; iw++) {
+                const SCALAR_T val = in_row[iw];
+                if (IsBetter(val, max_val)) {
+                    max_val = val;
+                    max_index = iw;
                 }
             }
+            val_row[ow] = max_val;
+            idx_row[ow] = ih * args.in_size_w + max_index;
+        }
+    }
+
+    for (int64_t oh = oh_start; oh < oh_end; oh++) {
+        SCALAR_T* out_row = out_plane + oh * out_w;
+        INDICES_T* indices_row = indices_plane + oh * out_w;
+        // 窗口首行结果即为扫描首行后的状态
+        const int64_t first = (table_h.start[oh] - ih_start) * out_w;
+        for (int64_t ow = 0; ow < out_w; ow++) {
+            out_row[ow] = row_val[first + ow];
+            indices_row[ow] = static_cast<INDICES_T>(row_idx[first + ow]);
         }
-    });
+        for (int64_t ih = table_h.start[oh] + 1; ih < table_h.end[oh]; ih++) {
+            const SCALAR_T* val_row = row_val.data() + (ih - ih_start) * out_w;
+            const int64_t* idx_row = row_idx.data() + (ih - ih_start) * out_w;
+            for (int64_t ow = 0; ow < out_w; ow++) {
+                if (IsBetter(val_row[ow], out_row[ow])) {
+                    out_row[ow] = val_row[ow];
+                    indices_row[ow] = static_cast<INDICES_T>(idx_row[ow]);
+                }
+            }
+        }
+    }
 }
 
+// 按 (batch x channel) 平面及输出行分块并行, 窗口起止只在调用开始时计算一次
 template <typename SCALAR_T, typename INDICES_T>
-void AdaptiveMaxPool2dOutFrame(const CpuKernelContext& ctx, AdaptiveCalcArgs<SCALAR_T, INDICES_T> args)
+uint32_t AdaptiveMaxPool2dOutFrame(const CpuKernelContext& ctx, const AdaptiveCalcArgs<SCALAR_T, INDICES_T>& args)
 {
-    CpuKernelUtils::ParallelFor(ctx, args.in_size_b, 1, [&](int64_t start, int64_t end) {
-        for (auto b = start; b < end; b++) {
-            AdaptiveCalcArgs<SCALAR_T, INDICES_T> sub_args = args;
-            sub_args.input_data = args.input_data + b * args.in_stride_b;
-            sub_args.output_data = args.output_data + b * args.in_size_d * args.out_size_h * args.out_size_w;
-            sub_args.indices_data = args.indices_data + b * args.in_size_d * args.out_size_h * args.out_size_w;
-
-            AdaptiveMaxPool2dSingleOutFrame<SCALAR_T, INDICES_T>(ctx, sub_args);
+    const AdaptiveWindowTable table_h = BuildWindowTable(args.out_size_h, args.in_size_h);
+    const AdaptiveWindowTable table_w = BuildWindowTable(args.out_size_w, args.in_size_w);
+    const int64_t plane_num = args.in_size_b * args.in_size_d;
+
+    // 直接扫描代价 sum(kh) * sum(kw); 可分离代价为行方向 H * sum(kw) 加列方向 sum(kh) * out_w, 另计中间结果写入
+    const int64_t direct_cost = table_h.span_sum * table_w.span_sum;
+    const int64_t separable_cost =
+        args.in_size_h * table_w.span_sum + table_h.span_sum * args.out_size_w + args.in_size_h * args.out_size_w;
+    const bool use_separable = separable_cost < direct_cost;
+    const int64_t plane_cost = std::min(direct_cost, separable_cost);
+
+    const int64_t cores = std::max<int64_t>(1, static_cast<int64_t>(CpuKernelUtils::GetCPUNum(ctx)));
+    int64_t row_tiles = 1;
+    if (plane_num < cores && plane_num * plane_cost >= kParallelMinCompareNum) {
+        row_tiles = std::min(args.out_size_h, (cores * kRowTilesPerCore + plane_num - 1) / plane_num);
+    }
+    const int64_t unit_num = plane_num * row_tiles;
+
+    auto shard = [&](int64_t start, int64_t end) {
+        std::vector<SCALAR_T> row_val;
+        std::vector<int64_t> row_idx;
+        for (int64_t unit = start; unit < end; unit++) {
+            const int64_t plane = unit / row_tiles;
+            const int64_t tile = unit % row_tiles;
+            const int64_t oh_start = tile * args.out_size_h / row_tiles;
+            const int64_t oh_end = (tile + 1) * args.out_size_h / row_tiles;
+            if (oh_start >= oh_end) {
+                continue;
+            }
+            if (use_separable) {
+                AdaptiveMaxPool2dSeparable(args, table_h, table_w, plane, oh_start, oh_end, row_val, row_idx);
+            } else {
+                AdaptiveMaxPool2dDirect(args, table_h, table_w, plane, oh_start, oh_end);
+            }
         }
-    });
+    };
+
+    if (cores == 1 || plane_num * plane_cost < kParallelMinCompareNum) {
+        shard(0, unit_num);
+        return KERNEL_STATUS_OK;
+    }
+    const int64_t per_unit = std::max<int64_t>(1, unit_num / cores);
+    KERNEL_HANDLE_ERROR(CpuKernelUtils::ParallelFor(ctx, unit_num, per_unit, shard),
+                        "AdaptiveMaxPool2d ParallelFor failed.")
+    return KERNEL_STATUS_OK;
 }
 
 template <typename SCALAR_T, typename INDICES_T>
@@ -235,12 +342,7 @@ uint32_t AdaptiveMaxPool2dOutCpuTemplate(const CpuKernelContext& ctx)
         return KERNEL_STATUS_PARAM_INVALID;
     }
 
-    if (input_dims == 3) {
-        AdaptiveMaxPool2dSingleOutFrame<SCALAR_T>(ctx, args);
-    } else {
-        AdaptiveMaxPool2dOutFrame<SCALAR_T>(ctx, args);
-    }
-    return KERNEL_STATUS_OK;
+    return AdaptiveMaxPool2dOutFrame<SCALAR_T, INDICES_T>(ctx, args);
 }
 
 template <typename SCALAR_T>
@@ -271,3 +271,18 @@ Eigen::half expect_output0_f16_1[] = {Eigen::half(6), Eigen::half(8), Eigen::hal
 int32_t expect_output1_f16_1[] = {5, 7, 13, 15};
 ADPOOL2D_CASE_WITH_SHAPE(adaptive_max_pool2d_float16_succ_1, Eigen::half, DT_FLOAT16, int32_t, DT_INT32, shapes_f16_1,
                          input_f16_1, expect_output0_f16_1, expect_output1_f16_1, list_out_f16_1)
+
+// 新增用例: 行方向窗口高度重叠且列方向窗口较宽, 走行最大值 + 列最大值的可分离路径
+vector<int64_t> list_out_separable_1 = {4, 2};
+vector<vector<int64_t>> shapes_separable_1 = {{2, 5, 12}, {2, 4, 2}};
+float_t input_separable_1[] = {
+    0,  37, 13, 50, 26, 2,  39, 15, 52, 28, 4,  41, 17, 54, 30, 6,  43, 19, 56, 32, 8,  45, 21, 58,
+    34, 10, 47, 23, 60, 36, 12, 49, 25, 1,  38, 14, 51, 27, 3,  40, 16, 53, 29, 5,  42, 18, 55, 31,
+    7,  44, 20, 57, 33, 9,  46, 22, 59, 35, 11, 48, 24, 0,  37, 13, 50, 26, 2,  39, 15, 52, 28, 4,
+    41, 17, 54, 30, 6,  43, 19, 56, 32, 8,  45, 21, 58, 34, 10, 47, 23, 60, 36, 12, 49, 25, 1,  38,
+    14, 51, 27, 3,  40, 16, 53, 29, 5,  42, 18, 55, 31, 7,  44, 20, 57, 33, 9,  46, 22, 59, 35, 11};
+float_t expect_output0_separable_1[] = {54, 58, 60, 58, 60, 55, 57, 59, 54, 56, 60, 56, 60, 55, 57, 59};
+int64_t expect_output1_separable_1[] = {13, 23, 28, 23, 28, 46, 51, 56, 14, 19, 29, 19, 29, 47, 52, 57};
+ADPOOL2D_CASE_WITH_SHAPE(adaptive_max_pool2d_float_separable_succ_1, float_t, DT_FLOAT, int64_t, DT_INT64,
+                         shapes_separable_1, input_separable_1, expect_output0_separable_1,
+                         expect_output1_separable_1, list_out_separable_1)
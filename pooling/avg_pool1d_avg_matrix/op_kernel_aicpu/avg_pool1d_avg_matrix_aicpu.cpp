@@ -11,11 +11,16 @@
 #include "avg_pool1d_avg_matrix_aicpu.h"
 
 #include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
 #include <vector>
 
 #include "Eigen/Core"
 #include "cpu_types.h"
 #include "log.h"
+#include "securec.h"
 #include "status.h"
 #include "unsupported/Eigen/CXX11/Tensor"
 #include "utils/kernel_util.h"
@@ -29,6 +34,8 @@ constexpr int64_t kInputH = 1;
 constexpr int64_t kInputC0 = 16;
 constexpr int64_t kDimSize = 4;
 constexpr int64_t kPadSize = 2;
+// 缓存的平均矩阵个数上限, 超出后整体清空
+constexpr size_t kMaxCachedMatrices = 64;
 
 struct AvgPool1DAvgMatrixParam {
     int64_t wInInput = 1;
@@ -111,47 +118,105 @@ static uint32_t InitAvgPool1DAvgMatrixParam(CpuKernelContext& ctx, AvgPool1DAvgM
     return KERNEL_STATUS_OK;
 }
 
+// 输出只由属性与 W 决定(N/C1/H 固定为 1), 按 (属性, W, dtype) 缓存生成好的 wOutput * C0 矩阵,
+// 重复执行同一个图时直接拷贝
+struct AvgMatrixKey {
+    int64_t wInInput;
+    int64_t kSize;
+    int64_t strides;
+    int64_t padL;
+    int64_t padR;
+    int64_t wOutput;
+    bool countIncludePad;
+    DataType dtype;
+
+    bool operator<(const AvgMatrixKey& other) const
+    {
+        return std::tie(wInInput, kSize, strides, padL, padR, wOutput, countIncludePad, dtype) <
+               std::tie(other.wInInput, other.kSize, other.strides, other.padL, other.padR, other.wOutput,
+                        other.countIncludePad, other.dtype);
+    }
+};
+
+using AvgMatrixBuffer = std::shared_ptr<const std::vector<uint8_t>>;
+
+class AvgMatrixCache {
+public:
+    static AvgMatrixCache& Instance()
+    {
+        static AvgMatrixCache cache;
+        return cache;
+    }
+
+    AvgMatrixBuffer Find(const AvgMatrixKey& key)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto iter = matrices_.find(key);
+        return (iter == matrices_.end()) ? nullptr : iter->second;
+    }
+
+    void Insert(const AvgMatrixKey& key, const AvgMatrixBuffer& matrix)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (matrices_.size() >= kMaxCachedMatrices) {
+            matrices_.clear();
+        }
+        matrices_[key] = matrix;
+    }
+
+private:
+    std::mutex mutex_;
+    std::map<AvgMatrixKey, AvgMatrixBuffer> matrices_;
+};
+
+// 每个输出窗口只计算一次倒数, 再填满该位置的 C0 个元素
 template <typename T>
-static uint32_t FillAvgPool1DAvgMatrixWindow(T* outputData, const AvgPool1DAvgMatrixParam& param, const int64_t n,
-                                             const int64_t c1, const int64_t h, const int64_t w)
+static uint32_t GenerateAvgPool1DAvgMatrix(const AvgPool1DAvgMatrixParam& param, std::vector<uint8_t>& matrix)
 {
-    int64_t start = param.strides * w;
-    int64_t end = param.strides * w + param.kSize;
-    if (!param.countIncludePad) {
-        start = std::max(start, param.padL);
-        end = std::min(end, param.wInInput + param.padL);
-    } else {
-        end = std::min(end, param.wInInput + param.padL + param.padR);
-    }
-    int64_t data_num = end - start;
-    KERNEL_CHECK_FALSE((data_num > 0), KERNEL_STATUS_PARAM_INVALID, "%s data_num [%ld] must be greater than zero.",
-                       kAvgPool1DAvgMatrix, data_num);
-    T tmp = static_cast<T>(1.0 / data_num);
-    for (int64_t c0 = 0; c0 < kInputC0; c0++) {
-        int64_t out_offset_point = n * kInputC1 * kInputH * param.wOutput * kInputC0 +
-                                   c1 * kInputH * param.wOutput * kInputC0 + h * param.wOutput * kInputC0 +
-                                   w * kInputC0 + c0;
-        KERNEL_CHECK_FALSE((out_offset_point < param.outputSize), KERNEL_STATUS_PARAM_INVALID,
-                           "%s out_offset_point [%ld] must < out_put_size [%ld].", kAvgPool1DAvgMatrix,
-                           out_offset_point, param.outputSize);
-        outputData[out_offset_point] = tmp;
+    matrix.resize(static_cast<size_t>(param.wOutput * kInputC0) * sizeof(T));
+    T* row = reinterpret_cast<T*>(matrix.data());
+    for (int64_t w = 0; w < param.wOutput; w++) {
+        int64_t start = param.strides * w;
+        int64_t end = param.strides * w + param.kSize;
+        if (!param.countIncludePad) {
+            start = std::max(start, param.padL);
+            end = std::min(end, param.wInInput + param.padL);
+        } else {
+            end = std::min(end, param.wInInput + param.padL + param.padR);
+        }
+        int64_t data_num = end - start;
+        KERNEL_CHECK_FALSE((data_num > 0), KERNEL_STATUS_PARAM_INVALID,
+                           "%s data_num [%ld] must be greater than zero.", kAvgPool1DAvgMatrix, data_num);
+        std::fill_n(row + w * kInputC0, kInputC0, static_cast<T>(1.0 / data_num));
     }
     return KERNEL_STATUS_OK;
 }
 
 template <typename T>
-static uint32_t FillAvgPool1DAvgMatrix(T* outputData, const AvgPool1DAvgMatrixParam& param)
+static uint32_t FillAvgPool1DAvgMatrix(T* outputData, const AvgPool1DAvgMatrixParam& param, DataType dtype)
 {
-    for (int64_t n = 0; n < kInputN; n++) {
-        for (int64_t c1 = 0; c1 < kInputC1; c1++) {
-            for (int64_t h = 0; h < kInputH; h++) {
-                for (int64_t w = 0; w < param.wOutput; w++) {
-                    uint32_t ret = FillAvgPool1DAvgMatrixWindow(outputData, param, n, c1, h, w);
-                    KERNEL_CHECK_FALSE((ret == KERNEL_STATUS_OK), ret, "Fill AvgPool1DAvgMatrix window failed.");
-                }
-            }
-        }
+    const int64_t matrixSize = kInputN * kInputC1 * kInputH * param.wOutput * kInputC0;
+    if (matrixSize <= 0) {
+        return KERNEL_STATUS_OK;
+    }
+    KERNEL_CHECK_FALSE((matrixSize <= param.outputSize), KERNEL_STATUS_PARAM_INVALID,
+                       "%s matrix size [%ld] must <= out_put_size [%ld].", kAvgPool1DAvgMatrix, matrixSize,
+                       param.outputSize);
+
+    const AvgMatrixKey key{param.wInInput, param.kSize,   param.strides,         param.padL,
+                           param.padR,     param.wOutput, param.countIncludePad, dtype};
+    AvgMatrixBuffer matrix = AvgMatrixCache::Instance().Find(key);
+    if (matrix == nullptr) {
+        auto generated = std::make_shared<std::vector<uint8_t>>();
+        uint32_t ret = GenerateAvgPool1DAvgMatrix<T>(param, *generated);
+        KERNEL_CHECK_FALSE((ret == KERNEL_STATUS_OK), ret, "Generate AvgPool1DAvgMatrix failed.");
+        matrix = generated;
+        AvgMatrixCache::Instance().Insert(key, matrix);
     }
+    auto mem_ret = memcpy_s(outputData, static_cast<size_t>(param.outputSize) * sizeof(T), matrix->data(),
+                            matrix->size());
+    KERNEL_CHECK_FALSE((mem_ret == EOK), KERNEL_STATUS_INNER_ERROR, "%s copy matrix failed, ret [%d].",
+                       kAvgPool1DAvgMatrix, mem_ret);
     return KERNEL_STATUS_OK;
 }
 } // namespace
@@ -192,7 +257,7 @@ uint32_t AvgPool1DAvgMatrixCpuKernel::DoCompute(CpuKernelContext& ctx)
     AvgPool1DAvgMatrixParam param;
     uint32_t ret = InitAvgPool1DAvgMatrixParam(ctx, param);
     KERNEL_CHECK_FALSE((ret == KERNEL_STATUS_OK), ret, "Init AvgPool1DAvgMatrix param failed.");
-    return FillAvgPool1DAvgMatrix(output_data, param);
+    return FillAvgPool1DAvgMatrix(output_data, param, ctx.Input(0)->GetDataType());
 }
 
 uint32_t AvgPool1DAvgMatrixCpuKernel::Compute(CpuKernelContext& ctx)
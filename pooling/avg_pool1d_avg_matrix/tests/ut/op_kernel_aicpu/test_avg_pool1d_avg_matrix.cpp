@@ -205,3 +205,38 @@ TEST_F(TEST_AVGPOOL1D_AVG_MATRIX_UT, OUTPUT_SHAPE_TOO_SMALL_FAIL)
     CREATE_NODEDEF(shapes, dataTypes, datas, 2, 2, std::vector<int64_t>({1, 2}), false, true);
     RUN_KERNEL(nodeDef, HOST, KERNEL_STATUS_PARAM_INVALID);
 }
+
+TEST_F(TEST_AVGPOOL1D_AVG_MATRIX_UT, REPEATED_EXECUTION_SUCCESS)
+{
+    vector<DataType> dataTypes = {DT_FLOAT, DT_FLOAT};
+    vector<vector<int64_t>> shapes = {{1, 1, 1, 4}, {1, 16, 1, 3}};
+    float input[4] = {1, 2, 3, 4};
+    for (int32_t repeat = 0; repeat < 2; repeat++) {
+        {
+            float output[48] = {0};
+            vector<void*> datas = {static_cast<void*>(input), static_cast<void*>(output)};
+            CREATE_NODEDEF(shapes, dataTypes, datas, 2, 2, std::vector<int64_t>({1, 2}), false, true);
+            RUN_KERNEL(nodeDef, HOST, KERNEL_STATUS_OK);
+            for (int32_t i = 0; i < 48; i++) {
+                EXPECT_FLOAT_EQ(output[i], 0.5F);
+            }
+        }
+        {
+            float output[48] = {0};
+            vector<void*> datas = {static_cast<void*>(input), static_cast<void*>(output)};
+            CREATE_NODEDEF(shapes, dataTypes, datas, 2, 2, std::vector<int64_t>({1, 2}), false, false);
+            RUN_KERNEL(nodeDef, HOST, KERNEL_STATUS_OK);
+            EXPECT_FLOAT_EQ(output[15], 1.0F);
+            EXPECT_FLOAT_EQ(output[31], 0.5F);
+            EXPECT_FLOAT_EQ(output[47], 1.0F);
+        }
+    }
+
+    vector<DataType> halfTypes = {DT_FLOAT16, DT_FLOAT16};
+    Eigen::half halfInput[4] = {Eigen::half(1.0F), Eigen::half(2.0F), Eigen::half(3.0F), Eigen::half(4.0F)};
+    Eigen::half halfOutput[48] = {Eigen::half(0.0F)};
+    vector<void*> halfDatas = {static_cast<void*>(halfInput), static_cast<void*>(halfOutput)};
+    CREATE_NODEDEF(shapes, halfTypes, halfDatas, 2, 2, std::vector<int64_t>({1, 2}), false, true);
+    RUN_KERNEL(nodeDef, HOST, KERNEL_STATUS_OK);
+    EXPECT_FLOAT_EQ(static_cast<float>(halfOutput[47]), 0.5F);
+}
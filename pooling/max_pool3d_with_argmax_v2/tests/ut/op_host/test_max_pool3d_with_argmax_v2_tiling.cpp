@@ -20,6 +20,7 @@
 #include "exe_graph/runtime/storage_shape.h"
 #include "platform/platform_infos_def.h"
 #include "tiling/platform/platform_ascendc.h"
+#include "tiling_coverage.h"
 
 using namespace ut_util;
 using namespace std;
@@ -1961,3 +1962,55 @@ TEST_F(MaxPool3DWithArgmaxV2Tiling, MaxPool3DWithArgmaxV2NcTranspose_tiling_fall
     ExecuteTestCase(xShape, yShape, argmaxShape, ksize, strides, pads, dilation, dtype, index_dtype, ceil_mode,
                     data_format, except_tilingkey, expect);
 }
+
+static TilingCoverage::CoverageCase MakeCoverageCase(const std::string& name, const std::vector<int64_t>& xDims,
+                                                     const std::vector<int64_t>& yDims,
+                                                     const std::vector<int64_t>& ksize,
+                                                     const std::vector<int64_t>& strides,
+                                                     const std::vector<int64_t>& pads, ge::DataType dtype)
+{
+    static optiling::MaxPool3DWithArgmaxV2CompileInfo compileInfo = {64, 245760};
+    gert::Shape xShape;
+    gert::Shape yShape;
+    for (auto dim : xDims) {
+        xShape.AppendDim(dim);
+    }
+    for (auto dim : yDims) {
+        yShape.AppendDim(dim);
+    }
+    gert::StorageShape x = {xShape, xShape};
+    gert::StorageShape y = {yShape, yShape};
+    gert::TilingContextPara para(
+        "MaxPool3DWithArgmaxV2", {{x, dtype, ge::FORMAT_ND}},
+        {{y, dtype, ge::FORMAT_ND}, {y, ge::DT_INT32, ge::FORMAT_ND}},
+        {{"ksize", Ops::NN::AnyValue::CreateFrom<std::vector<int64_t>>(ksize)},
+         {"strides", Ops::NN::AnyValue::CreateFrom<std::vector<int64_t>>(strides)},
+         {"pads", Ops::NN::AnyValue::CreateFrom<std::vector<int64_t>>(pads)},
+         {"dilation", Ops::NN::AnyValue::CreateFrom<std::vector<int64_t>>({1, 1, 1})},
+         {"ceil_mode", Ops::NN::AnyValue::CreateFrom<bool>(false)},
+         {"data_format", Ops::NN::AnyValue::CreateFrom<std::string>("NCDHW")},
+         {"dtype", Ops::NN::AnyValue::CreateFrom<int64_t>(3)}},
+        &compileInfo, 64, 245760);
+    return {name, para};
+}
+
+// 覆盖 ksize=1、小核不切分、宽 W、大核与超大核等典型分支的 shape 语料
+static std::vector<TilingCoverage::CoverageCase> MaxPool3DWithArgmaxV2CoverageCorpus()
+{
+    return {
+        MakeCoverageCase("ksize_one", {2, 16, 8, 8, 8}, {2, 16, 8, 8, 8}, {1, 1, 1}, {1, 1, 1}, {0, 0, 0},
+                         ge::DT_FLOAT),
+        MakeCoverageCase("small_kernel", {1, 16, 6, 6, 6}, {1, 16, 3, 3, 3}, {2, 2, 2}, {2, 2, 2}, {0, 0, 0},
+                         ge::DT_FLOAT),
+        MakeCoverageCase("wide_w", {1, 16, 4, 32, 1024}, {1, 16, 2, 16, 512}, {2, 2, 2}, {2, 2, 2}, {0, 0, 0},
+                         ge::DT_FLOAT16),
+        MakeCoverageCase("overlap_pad", {32, 64, 4, 8, 8}, {32, 64, 4, 8, 8}, {3, 3, 3}, {1, 1, 1}, {1, 1, 1},
+                         ge::DT_FLOAT16),
+        MakeCoverageCase("big_kernel", {1, 8, 16, 64, 64}, {1, 8, 1, 4, 4}, {16, 16, 16}, {16, 16, 16}, {0, 0, 0},
+                         ge::DT_FLOAT),
+        MakeCoverageCase("huge_kernel", {1, 4, 64, 256, 256}, {1, 4, 1, 4, 4}, {64, 64, 64}, {64, 64, 64},
+                         {0, 0, 0}, ge::DT_FLOAT),
+    };
+}
+
+REGISTER_TILING_COVERAGE_CORPUS(MaxPool3DWithArgmaxV2, MaxPool3DWithArgmaxV2CoverageCorpus);
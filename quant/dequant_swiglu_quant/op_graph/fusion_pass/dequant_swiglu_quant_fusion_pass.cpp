@@ -0,0 +1,588 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file dequant_swiglu_quant_fusion_pass.cpp
+ * \brief AscendDequant [+ Mul] [+ Add] + SwiGlu + DynamicQuant/AscendQuantV2 -> DequantSwigluQuant fusion pass
+ *
+ *       x(int32)  deq_scale(fp16)
+ *             \    /
+ *         AscendDequant
+ *               |
+ *              Mul  <-- activation_scale (optional, per-token, shape (X..., 1))
+ *               |
+ *              Add  <-- bias (optional, shape (H,))
+ *               |
+ *           SwiGlu(dim=-1)
+ *               |
+ *   DynamicQuant / AscendQuantV2       ======>>>>      DequantSwigluQuant
+ *               |                                             |
+ *          y (, scale)                                   y (, scale)
+ *
+ * x is usually produced by QuantBatchMatmul with int32 output, the chain from its accumulator to the int8
+ * activation of the down projection is then executed in one kernel.
+ *
+ * The key transformation:
+ * - weight_scale = Cast(deq_scale, float). uint64 deq_scale packs extra fields and is not supported
+ * - activation_scale is cast to float when needed, bias is passed through
+ * - DynamicQuant: quant_mode="dynamic", quant_scale = Cast(smooth_scales, float), scale output is kept
+ * - AscendQuantV2: quant_mode="static", quant_scale = 1 / scale, quant_offset = Cast(offset, float).
+ *   The static kernel requires a float quant_offset, so AscendQuantV2 without offset is not fused. Only the
+ *   default round_mode="round" is fused, other modes would silently become the rint of the fused node
+ * - SwiGlu activates the first half of the last axis, so activate_left=true
+ */
+
+#include <algorithm>
+#include <string>
+#include <vector>
+#include "common/inc/error_util.h"
+#include "dequant_swiglu_quant_fusion_pass.h"
+#include "es_nn_ops.h"
+#include "es_math_ops.h"
+#include "platform/platform_info.h"
+#include "ge/ge_utils.h"
+#include "compliant_node_builder.h"
+
+using namespace ge;
+using namespace fe;
+using namespace fusion;
+
+namespace ops {
+
+static const std::string PASS_NAME = "DequantSwigluQuantFusionPass";
+
+static const std::string ASCEND_DEQUANT = "AscendDequant";
+static const std::string MUL = "Mul";
+static const std::string ADD = "Add";
+static const std::string SWIGLU = "SwiGlu";
+static const std::string DYNAMIC_QUANT = "DynamicQuant";
+static const std::string ASCEND_QUANT_V2 = "AscendQuantV2";
+static const std::string DEQUANT_SWIGLU_QUANT = "DequantSwigluQuant";
+
+static const int64_t CAPTURE_IDX_DEQUANT = 0L;
+static const int64_t CAPTURE_IDX_SWIGLU = 1L;
+static const int64_t CAPTURE_IDX_QUANT = 2L;
+
+// AscendDequant (x=0, deq_scale=1), DynamicQuant (x=0, smooth_scales=1, group_index=2),
+// AscendQuantV2 (x=0, scale=1, offset=2)
+static constexpr int32_t PORT_X = 0;
+static constexpr int32_t PORT_SCALE = 1;
+static constexpr int32_t PORT_OFFSET = 2;
+static constexpr int32_t DYNAMIC_QUANT_PORT_GROUP_INDEX = 2;
+static constexpr int32_t DYNAMIC_QUANT_SCALE_OUT_IDX = 1;
+
+// DequantSwigluQuant IR input index
+static constexpr int32_t DSQ_PORT_X = 0;
+static constexpr int32_t DSQ_PORT_WEIGHT_SCALE = 1;
+static constexpr int32_t DSQ_PORT_ACTIVATION_SCALE = 2;
+static constexpr int32_t DSQ_PORT_BIAS = 3;
+static constexpr int32_t DSQ_PORT_QUANT_SCALE = 4;
+static constexpr int32_t DSQ_PORT_QUANT_OFFSET = 5;
+static constexpr int32_t DSQ_Y_OUT_IDX = 0;
+static constexpr int32_t DSQ_SCALE_OUT_IDX = 1;
+
+static constexpr int64_t SWIGLU_LAST_DIM = -1L;
+static constexpr int64_t SWIGLU_SPLIT_NUM = 2L;
+static constexpr size_t X_MIN_DIM = 2;
+static const std::string QUANT_ROUND_MODE = "round";
+
+struct PatternFlags {
+    bool isDynamic;
+    bool hasActScale;
+    bool hasBias;
+    bool hasQuantScale;
+    bool hasQuantOffset;
+};
+
+struct MatchedChain {
+    GNode dequant;
+    GNode swiglu;
+    GNode quant;
+    GNode mul;
+    GNode add;
+    PatternFlags flags{};
+};
+
+static std::string GetNodeType(const GNode& node)
+{
+    AscendString type;
+    if (node.GetType(type) != GRAPH_SUCCESS) {
+        return "";
+    }
+    return type.GetString();
+}
+
+static bool HasInput(const GNode& node, int32_t index)
+{
+    return node.GetInDataNodesAndPortIndexs(index).first != nullptr;
+}
+
+static void GetInputsInfo(const std::vector<SubgraphInput>& subgraphInputs, std::vector<TensorDesc>& inputDescs)
+{
+    for (const auto& subgraphInput : subgraphInputs) {
+        auto matchNode = subgraphInput.GetAllInputs().at(0);
+        TensorDesc tensorDesc;
+        matchNode.node.GetInputDesc(matchNode.index, tensorDesc);
+        inputDescs.emplace_back(tensorDesc);
+    }
+}
+
+static Status InferShape(const std::unique_ptr<Graph>& replaceGraph, const std::vector<SubgraphInput>& subgraphInputs)
+{
+    OPS_LOG_D(PASS_NAME.c_str(), "Begin infershape for replacement.");
+    std::vector<Shape> inputShapes;
+    for (const auto& subgraphInput : subgraphInputs) {
+        auto matchNode = subgraphInput.GetAllInputs().at(0);
+        TensorDesc tensorDesc;
+        matchNode.node.GetInputDesc(matchNode.index, tensorDesc);
+        inputShapes.emplace_back(tensorDesc.GetShape());
+    }
+    return GeUtils::InferShape(*replaceGraph, inputShapes);
+}
+
+static es::EsTensorHolder BuildNode(es::EsGraphBuilder& graphBuilder, const std::string& opType,
+                                    const std::vector<std::string>& inputNames,
+                                    const std::vector<es::EsTensorHolder*>& inputs,
+                                    const std::vector<std::string>& outputNames,
+                                    std::vector<es::EsTensorHolder>* outputs = nullptr)
+{
+    auto graphPtr = graphBuilder.GetCGraphBuilder()->GetGraph();
+    std::vector<es::CompliantNodeBuilder::IrInputDef> irInputs;
+    for (size_t i = 0; i < inputNames.size(); ++i) {
+        // 只有第一个输入为必选, 其余按可选声明, 未连边即视为未输入
+        irInputs.push_back({inputNames[i].c_str(),
+                            i == 0 ? es::CompliantNodeBuilder::kEsIrInputRequired :
+                                     es::CompliantNodeBuilder::kEsIrInputOptional,
+                            ""});
+    }
+    std::vector<es::CompliantNodeBuilder::IrOutputDef> irOutputs;
+    for (const auto& outputName : outputNames) {
+        irOutputs.push_back({outputName.c_str(), es::CompliantNodeBuilder::kEsIrOutputRequired, ""});
+    }
+    auto node = es::CompliantNodeBuilder(graphPtr)
+                    .OpType(opType.c_str())
+                    .Name(opType.c_str())
+                    .IrDefInputs(irInputs)
+                    .IrDefOutputs(irOutputs)
+                    .Build();
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        if (inputs[i] != nullptr) {
+            es::AddEdgeAndUpdatePeerDesc(*graphPtr, *inputs[i]->GetProducer(), inputs[i]->GetProducerOutIndex(), node,
+                                         static_cast<int32_t>(i));
+        }
+    }
+    if (outputs != nullptr) {
+        for (size_t i = 0; i < outputNames.size(); ++i) {
+            outputs->emplace_back(graphBuilder.GetCGraphBuilder()->GetTensorHolderFromNode(node, i));
+        }
+    }
+    return es::EsTensorHolder(graphBuilder.GetCGraphBuilder()->GetTensorHolderFromNode(node, 0));
+}
+
+static void MakePattern(std::vector<PatternUniqPtr>& patternGraphs, const PatternFlags& flags)
+{
+    auto graphBuilder = es::EsGraphBuilder(PASS_NAME.c_str());
+    int64_t inputIdx = 0;
+    auto x = graphBuilder.CreateInput(inputIdx++);
+    auto deqScale = graphBuilder.CreateInput(inputIdx++);
+    auto dequantOut = BuildNode(graphBuilder, ASCEND_DEQUANT, {"x", "deq_scale"}, {&x, &deqScale}, {"y"});
+
+    auto swigluIn = dequantOut;
+    if (flags.hasActScale) {
+        auto actScale = graphBuilder.CreateInput(inputIdx++);
+        swigluIn = BuildNode(graphBuilder, MUL, {"x1", "x2"}, {&swigluIn, &actScale}, {"y"});
+    }
+    if (flags.hasBias) {
+        auto bias = graphBuilder.CreateInput(inputIdx++);
+        swigluIn = BuildNode(graphBuilder, ADD, {"x1", "x2"}, {&swigluIn, &bias}, {"y"});
+    }
+    auto swigluOut = BuildNode(graphBuilder, SWIGLU, {"x"}, {&swigluIn}, {"y"});
+
+    es::EsTensorHolder quantScale;
+    es::EsTensorHolder quantOffset;
+    if (flags.hasQuantScale) {
+        quantScale = graphBuilder.CreateInput(inputIdx++);
+    }
+    if (flags.hasQuantOffset) {
+        quantOffset = graphBuilder.CreateInput(inputIdx++);
+    }
+    std::vector<es::EsTensorHolder> outputs;
+    if (flags.isDynamic) {
+        BuildNode(graphBuilder, DYNAMIC_QUANT, {"x", "smooth_scales", "group_index"},
+                  {&swigluOut, flags.hasQuantScale ? &quantScale : nullptr}, {"y", "scale"}, &outputs);
+    } else {
+        BuildNode(graphBuilder, ASCEND_QUANT_V2, {"x", "scale", "offset"},
+                  {&swigluOut, &quantScale, flags.hasQuantOffset ? &quantOffset : nullptr}, {"y"}, &outputs);
+    }
+    auto graph = graphBuilder.BuildAndReset(outputs);
+
+    auto pattern = std::make_unique<Pattern>(std::move(*graph));
+    pattern->CaptureTensor({*dequantOut.GetProducer(), 0})
+        .CaptureTensor({*swigluOut.GetProducer(), 0})
+        .CaptureTensor({*outputs[0].GetProducer(), 0});
+    patternGraphs.emplace_back(std::move(pattern));
+}
+
+std::vector<PatternUniqPtr> DequantSwigluQuantFusionPass::Patterns()
+{
+    OPS_LOG_D(PASS_NAME.c_str(), "Enter Patterns for DequantSwigluQuantFusionPass");
+    std::vector<PatternUniqPtr> patternGraphs;
+    for (bool hasActScale : {false, true}) {
+        for (bool hasBias : {false, true}) {
+            // DynamicQuant: smooth_scales 可选; AscendQuantV2: scale 必选, 静态量化 kernel 要求 offset 存在
+            MakePattern(patternGraphs, {true, hasActScale, hasBias, false, false});
+            MakePattern(patternGraphs, {true, hasActScale, hasBias, true, false});
+            MakePattern(patternGraphs, {false, hasActScale, hasBias, true, true});
+        }
+    }
+    return patternGraphs;
+}
+
+static bool IsTargetPlatform(bool isDynamic)
+{
+    PlatformInfo platform_info;
+    OptionalInfo optional_info;
+    OP_LOGE_IF(
+        PlatformInfoManager::Instance().GetPlatformInfoWithOutSocVersion(platform_info, optional_info) != SUCCESS,
+        false, PASS_NAME.c_str(), "Get platform_info failed.");
+    const std::string soc = platform_info.str_info.short_soc_version;
+    OPS_LOG_D(PASS_NAME.c_str(), "Platform short soc: %s", soc.c_str());
+    // Ascend950 上 DequantSwigluQuant 仅支持 dynamic 量化
+    if (soc == "Ascend910B" || (soc == "Ascend950" && isDynamic)) {
+        return true;
+    }
+    OPS_LOG_D(PASS_NAME.c_str(), "Platform %s is not support, quant mode dynamic %d.", soc.c_str(), isDynamic);
+    return false;
+}
+
+static bool GetMatchedChain(const std::unique_ptr<MatchResult>& match_result, MatchedChain& chain)
+{
+    NodeIo dequantNodeIo;
+    NodeIo swigluNodeIo;
+    NodeIo quantNodeIo;
+    if (match_result->GetCapturedTensor(CAPTURE_IDX_DEQUANT, dequantNodeIo) != SUCCESS ||
+        match_result->GetCapturedTensor(CAPTURE_IDX_SWIGLU, swigluNodeIo) != SUCCESS ||
+        match_result->GetCapturedTensor(CAPTURE_IDX_QUANT, quantNodeIo) != SUCCESS) {
+        OPS_LOG_E(PASS_NAME.c_str(), "Failed to get captured nodes.");
+        return false;
+    }
+    chain.dequant = dequantNodeIo.node;
+    chain.swiglu = swigluNodeIo.node;
+    chain.quant = quantNodeIo.node;
+
+    // 从 SwiGlu 向上回溯, 识别可选的 Add(bias) 与 Mul(activation_scale)
+    auto producer = chain.swiglu.GetInDataNodesAndPortIndexs(PORT_X).first;
+    if (producer != nullptr && GetNodeType(*producer) == ADD) {
+        chain.add = *producer;
+        chain.flags.hasBias = true;
+        producer = chain.add.GetInDataNodesAndPortIndexs(PORT_X).first;
+    }
+    if (producer != nullptr && GetNodeType(*producer) == MUL) {
+        chain.mul = *producer;
+        chain.flags.hasActScale = true;
+    }
+    chain.flags.isDynamic = GetNodeType(chain.quant) == DYNAMIC_QUANT;
+    chain.flags.hasQuantScale = HasInput(chain.quant, PORT_SCALE);
+    chain.flags.hasQuantOffset = !chain.flags.isDynamic && HasInput(chain.quant, PORT_OFFSET);
+    return true;
+}
+
+// 链上中间结果只能被链内节点消费, 否则融合后仍需落盘
+static bool CheckSingleConsumer(const MatchedChain& chain)
+{
+    std::vector<const GNode*> innerNodes = {&chain.dequant, &chain.swiglu};
+    if (chain.flags.hasActScale) {
+        innerNodes.push_back(&chain.mul);
+    }
+    if (chain.flags.hasBias) {
+        innerNodes.push_back(&chain.add);
+    }
+    for (const auto* node : innerNodes) {
+        size_t consumerNum = node->GetOutDataNodesAndPortIndexs(0).size();
+        if (consumerNum != 1) {
+            OPS_LOG_D(PASS_NAME.c_str(), "%s output has %zu consumers, skip.", GetNodeType(*node).c_str(),
+                      consumerNum);
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool CheckDequant(const GNode& dequant, std::vector<int64_t>& xDims)
+{
+    TensorDesc xDesc;
+    TensorDesc deqScaleDesc;
+    dequant.GetInputDesc(PORT_X, xDesc);
+    dequant.GetInputDesc(PORT_SCALE, deqScaleDesc);
+    if (xDesc.GetDataType() != DT_INT32 || xDesc.GetFormat() != FORMAT_ND) {
+        OPS_LOG_D(PASS_NAME.c_str(), "AscendDequant x dtype %d format %d not satisfied.", xDesc.GetDataType(),
+                  xDesc.GetFormat());
+        return false;
+    }
+    if (deqScaleDesc.GetDataType() != DT_FLOAT16) {
+        OPS_LOG_D(PASS_NAME.c_str(), "AscendDequant deq_scale dtype %d not supported, need float16.",
+                  deqScaleDesc.GetDataType());
+        return false;
+    }
+    bool sqrtMode = false;
+    bool reluFlag = false;
+    (void)dequant.GetAttr("sqrt_mode", sqrtMode);
+    (void)dequant.GetAttr("relu_flag", reluFlag);
+    if (sqrtMode || reluFlag) {
+        OPS_LOG_D(PASS_NAME.c_str(), "AscendDequant sqrt_mode %d relu_flag %d, skip.", sqrtMode, reluFlag);
+        return false;
+    }
+    xDims = xDesc.GetShape().GetDims();
+    if (xDims.size() < X_MIN_DIM || xDims.back() <= 0 || xDims.back() % SWIGLU_SPLIT_NUM != 0) {
+        OPS_LOG_D(PASS_NAME.c_str(), "AscendDequant x last dim must be static and even.");
+        return false;
+    }
+    // weight_scale 需为 (H,) 或 (1, H)
+    const auto scaleDims = deqScaleDesc.GetShape().GetDims();
+    if (scaleDims.empty() || scaleDims.back() != xDims.back() ||
+        std::any_of(scaleDims.begin(), scaleDims.end() - 1, [](int64_t dim) { return dim != 1; })) {
+        OPS_LOG_D(PASS_NAME.c_str(), "AscendDequant deq_scale shape not satisfied.");
+        return false;
+    }
+    return true;
+}
+
+static bool CheckActScaleAndBias(const MatchedChain& chain, const std::vector<int64_t>& xDims)
+{
+    if (chain.flags.hasActScale) {
+        TensorDesc actScaleDesc;
+        chain.mul.GetInputDesc(1, actScaleDesc);
+        const auto dims = actScaleDesc.GetShape().GetDims();
+        // activation_scale 为 per-token: (X..., 1)
+        if (dims.size() != xDims.size() || dims.back() != 1 ||
+            !std::equal(dims.begin(), dims.end() - 1, xDims.begin())) {
+            OPS_LOG_D(PASS_NAME.c_str(), "Mul operand is not a per-token activation scale.");
+            return false;
+        }
+    }
+    if (chain.flags.hasBias) {
+        TensorDesc biasDesc;
+        chain.add.GetInputDesc(1, biasDesc);
+        const auto dims = biasDesc.GetShape().GetDims();
+        if (dims.size() != 1 || dims[0] != xDims.back()) {
+            OPS_LOG_D(PASS_NAME.c_str(), "Add operand is not a bias of shape (H,).");
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool CheckSwiglu(const GNode& swiglu, size_t xRank)
+{
+    int64_t dim = SWIGLU_LAST_DIM;
+    (void)swiglu.GetAttr("dim", dim);
+    if (dim != SWIGLU_LAST_DIM && dim != static_cast<int64_t>(xRank) - 1) {
+        OPS_LOG_D(PASS_NAME.c_str(), "SwiGlu dim %ld is not the last axis.", dim);
+        return false;
+    }
+    return true;
+}
+
+static bool CheckQuant(const MatchedChain& chain, int64_t halfDim)
+{
+    TensorDesc yDesc;
+    chain.quant.GetOutputDesc(0, yDesc);
+    if (yDesc.GetDataType() != DT_INT8) {
+        OPS_LOG_D(PASS_NAME.c_str(), "Quant output dtype %d not supported, need int8.", yDesc.GetDataType());
+        return false;
+    }
+    if (chain.flags.isDynamic) {
+        if (HasInput(chain.quant, DYNAMIC_QUANT_PORT_GROUP_INDEX)) {
+            OPS_LOG_D(PASS_NAME.c_str(), "DynamicQuant with group_index is not supported.");
+            return false;
+        }
+    } else {
+        bool sqrtMode = false;
+        int64_t axis = -1;
+        AscendString roundMode(QUANT_ROUND_MODE.c_str());
+        (void)chain.quant.GetAttr("sqrt_mode", sqrtMode);
+        (void)chain.quant.GetAttr("axis", axis);
+        (void)chain.quant.GetAttr("round_mode", roundMode);
+        if (sqrtMode || axis != -1) {
+            OPS_LOG_D(PASS_NAME.c_str(), "AscendQuantV2 sqrt_mode %d axis %ld not satisfied.", sqrtMode, axis);
+            return false;
+        }
+        if (roundMode.GetString() != QUANT_ROUND_MODE) {
+            OPS_LOG_D(PASS_NAME.c_str(), "AscendQuantV2 round_mode %s not supported, need round.",
+                      roundMode.GetString());
+            return false;
+        }
+        if (!chain.flags.hasQuantOffset) {
+            OPS_LOG_D(PASS_NAME.c_str(), "AscendQuantV2 without offset is not supported.");
+            return false;
+        }
+    }
+    if (!chain.flags.hasQuantScale) {
+        return true;
+    }
+    // quant_scale/quant_offset 沿 SwiGlu 输出的最后一维 (H/2) 逐通道生效
+    for (int32_t port : {PORT_SCALE, PORT_OFFSET}) {
+        if (port == PORT_OFFSET && !chain.flags.hasQuantOffset) {
+            continue;
+        }
+        TensorDesc desc;
+        chain.quant.GetInputDesc(port, desc);
+        const auto dims = desc.GetShape().GetDims();
+        if (dims.size() != 1 || dims[0] != halfDim) {
+            OPS_LOG_D(PASS_NAME.c_str(), "Quant input %d shape must be (%ld,).", port, halfDim);
+            return false;
+        }
+    }
+    return true;
+}
+
+bool DequantSwigluQuantFusionPass::MeetRequirements(const std::unique_ptr<MatchResult>& match_result)
+{
+    OPS_LOG_D(PASS_NAME.c_str(), "Enter MeetRequirements for DequantSwigluQuantFusionPass");
+    MatchedChain chain;
+    if (!GetMatchedChain(match_result, chain)) {
+        return false;
+    }
+    if (!IsTargetPlatform(chain.flags.isDynamic)) {
+        return false;
+    }
+    if (!CheckSingleConsumer(chain)) {
+        return false;
+    }
+    std::vector<int64_t> xDims;
+    if (!CheckDequant(chain.dequant, xDims)) {
+        return false;
+    }
+    if (!CheckActScaleAndBias(chain, xDims) || !CheckSwiglu(chain.swiglu, xDims.size())) {
+        return false;
+    }
+    return CheckQuant(chain, xDims.back() / SWIGLU_SPLIT_NUM);
+}
+
+static es::EsTensorHolder BuildDequantSwigluQuant(es::EsGraphBuilder& graphBuilder,
+                                                  std::vector<es::EsTensorHolder*>& inputs, bool isDynamic,
+                                                  std::vector<es::EsTensorHolder>& outputs)
+{
+    auto graph = graphBuilder.GetCGraphBuilder()->GetGraph();
+    GNode node =
+        es::CompliantNodeBuilder(graph)
+            .OpType(DEQUANT_SWIGLU_QUANT.c_str())
+            .Name(DEQUANT_SWIGLU_QUANT.c_str())
+            .IrDefInputs({{"x", es::CompliantNodeBuilder::kEsIrInputRequired, ""},
+                          {"weight_scale", es::CompliantNodeBuilder::kEsIrInputOptional, ""},
+                          {"activation_scale", es::CompliantNodeBuilder::kEsIrInputOptional, ""},
+                          {"bias", es::CompliantNodeBuilder::kEsIrInputOptional, ""},
+                          {"quant_scale", es::CompliantNodeBuilder::kEsIrInputOptional, ""},
+                          {"quant_offset", es::CompliantNodeBuilder::kEsIrInputOptional, ""},
+                          {"group_index", es::CompliantNodeBuilder::kEsIrInputOptional, ""}})
+            .IrDefOutputs({{"y", es::CompliantNodeBuilder::kEsIrOutputRequired, ""},
+                           {"scale", es::CompliantNodeBuilder::kEsIrOutputRequired, ""}})
+            .IrDefAttrs({{"activate_left", es::CompliantNodeBuilder::kEsAttrOptional, "Bool", es::CreateFrom(true)},
+                         {"quant_mode", es::CompliantNodeBuilder::kEsAttrOptional, "String",
+                          es::CreateFrom(ge::AscendString(isDynamic ? "dynamic" : "static"))},
+                         {"dst_type", es::CompliantNodeBuilder::kEsAttrOptional, "Int",
+                          es::CreateFrom(static_cast<int64_t>(DT_INT8))},
+                         {"round_mode", es::CompliantNodeBuilder::kEsAttrOptional, "String",
+                          es::CreateFrom(ge::AscendString("rint"))},
+                         {"activate_dim", es::CompliantNodeBuilder::kEsAttrOptional, "Int",
+                          es::CreateFrom(SWIGLU_LAST_DIM)}})
+            .Build();
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        if (inputs[i] != nullptr) {
+            es::AddEdgeAndUpdatePeerDesc(*graph, *inputs[i]->GetProducer(), inputs[i]->GetProducerOutIndex(), node,
+                                         static_cast<int32_t>(i));
+        }
+    }
+    outputs.emplace_back(graphBuilder.GetCGraphBuilder()->GetTensorHolderFromNode(node, DSQ_Y_OUT_IDX));
+    if (isDynamic) {
+        outputs.emplace_back(graphBuilder.GetCGraphBuilder()->GetTensorHolderFromNode(node, DSQ_SCALE_OUT_IDX));
+    }
+    return outputs[0];
+}
+
+std::unique_ptr<Graph> DequantSwigluQuantFusionPass::Replacement(const std::unique_ptr<MatchResult>& match_result)
+{
+    OPS_LOG_D(PASS_NAME.c_str(), "Enter Replacement for DequantSwigluQuantFusionPass");
+    MatchedChain chain;
+    if (!GetMatchedChain(match_result, chain)) {
+        return nullptr;
+    }
+    const PatternFlags& flags = chain.flags;
+
+    // 1. 边界输入顺序与 MakePattern 中 CreateInput 的顺序一致
+    std::vector<SubgraphInput> subgraphInputs;
+    match_result->ToSubgraphBoundary()->GetAllInputs(subgraphInputs);
+    std::vector<TensorDesc> inputDescs;
+    GetInputsInfo(subgraphInputs, inputDescs);
+    const size_t expectInputNum = 2U + flags.hasActScale + flags.hasBias + flags.hasQuantScale + flags.hasQuantOffset;
+    if (inputDescs.size() != expectInputNum) {
+        OPS_LOG_E(PASS_NAME.c_str(), "Subgraph input num %zu not equal to %zu.", inputDescs.size(), expectInputNum);
+        return nullptr;
+    }
+
+    auto replaceGraphBuilder = es::EsGraphBuilder("replacement");
+    std::vector<es::EsTensorHolder> rInputs;
+    for (size_t i = 0; i < inputDescs.size(); ++i) {
+        rInputs.emplace_back(replaceGraphBuilder.CreateInput(static_cast<int64_t>(i),
+                                                             ("input_" + std::to_string(i)).c_str(),
+                                                             inputDescs[i].GetDataType(), inputDescs[i].GetFormat(),
+                                                             inputDescs[i].GetShape().GetDims()));
+    }
+
+    // 2. 将各输入转换为 DequantSwigluQuant 需要的形式
+    size_t idx = 0;
+    std::vector<es::EsTensorHolder*> dsqInputs(DSQ_PORT_QUANT_OFFSET + 1, nullptr);
+    dsqInputs[DSQ_PORT_X] = &rInputs[idx++];
+    es::EsTensorHolder weightScale = es::Cast(rInputs[idx++], DT_FLOAT);
+    dsqInputs[DSQ_PORT_WEIGHT_SCALE] = &weightScale;
+    es::EsTensorHolder actScale;
+    if (flags.hasActScale) {
+        actScale = inputDescs[idx].GetDataType() == DT_FLOAT ? rInputs[idx] : es::Cast(rInputs[idx], DT_FLOAT);
+        dsqInputs[DSQ_PORT_ACTIVATION_SCALE] = &actScale;
+        ++idx;
+    }
+    if (flags.hasBias) {
+        dsqInputs[DSQ_PORT_BIAS] = &rInputs[idx++];
+    }
+    // quant_scale/quant_offset 均需为 float
+    es::EsTensorHolder quantScale;
+    if (flags.hasQuantScale) {
+        quantScale = inputDescs[idx].GetDataType() == DT_FLOAT ? rInputs[idx] : es::Cast(rInputs[idx], DT_FLOAT);
+        if (!flags.isDynamic) {
+            // AscendQuantV2 为 x * scale, DequantSwigluQuant 静态量化为 x / quant_scale
+            quantScale = es::Reciprocal(quantScale);
+        }
+        dsqInputs[DSQ_PORT_QUANT_SCALE] = &quantScale;
+        ++idx;
+    }
+    es::EsTensorHolder quantOffset;
+    if (flags.hasQuantOffset) {
+        quantOffset = inputDescs[idx].GetDataType() == DT_FLOAT ? rInputs[idx] : es::Cast(rInputs[idx], DT_FLOAT);
+        dsqInputs[DSQ_PORT_QUANT_OFFSET] = &quantOffset;
+        ++idx;
+    }
+
+    // 3. 构图并推导 shape
+    std::vector<es::EsTensorHolder> outputs;
+    BuildDequantSwigluQuant(replaceGraphBuilder, dsqInputs, flags.isDynamic, outputs);
+    auto replaceGraph = replaceGraphBuilder.BuildAndReset(outputs);
+    if (InferShape(replaceGraph, subgraphInputs) != SUCCESS) {
+        OPS_LOG_E(PASS_NAME.c_str(), "InferShape for replacement failed.");
+        return nullptr;
+    }
+
+    OPS_LOG_I(PASS_NAME.c_str(), "DequantSwigluQuantFusionPass fusion success, quant mode %s, act_scale %d, bias %d.",
+              flags.isDynamic ? "dynamic" : "static", flags.hasActScale, flags.hasBias);
+    return replaceGraph;
+}
+
+REG_FUSION_PASS(DequantSwigluQuantFusionPass).Stage(CustomPassStage::kAfterInferShape);
+
+} // namespace ops
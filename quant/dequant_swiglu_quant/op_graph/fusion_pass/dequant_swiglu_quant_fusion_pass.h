@@ -0,0 +1,55 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef NN_DEQUANT_SWIGLU_QUANT_FUSION_PASS_H
+#define NN_DEQUANT_SWIGLU_QUANT_FUSION_PASS_H
+
+#include "ge/fusion/pass/pattern_fusion_pass.h"
+
+namespace ops {
+using namespace ge;
+using namespace fusion;
+
+/**
+ * @brief AscendDequant [+ Mul(activation_scale)] [+ Add(bias)] + SwiGlu + DynamicQuant/AscendQuantV2
+ *        -> DequantSwigluQuant fusion pass
+ * @details Fusion pattern:
+ *       x(int32)  deq_scale(fp16)
+ *             \    /
+ *         AscendDequant
+ *               |
+ *              Mul  <-- activation_scale (optional)
+ *               |
+ *              Add  <-- bias (optional)
+ *               |
+ *             SwiGlu
+ *               |                                   x, weight_scale, activation_scale, bias, quant_scale, quant_offset
+ *   DynamicQuant(smooth_scales) / AscendQuantV2(scale, offset)  ======>>>>  DequantSwigluQuant
+ *               |                                                                  |
+ *          y (, scale)                                                       y (, scale)
+ *
+ * The key transformation:
+ * - weight_scale = Cast(deq_scale, float), only fp16 deq_scale is supported
+ * - DynamicQuant: quant_mode="dynamic", quant_scale = smooth_scales
+ * - AscendQuantV2: quant_mode="static", quant_scale = 1 / scale (AscendQuantV2 multiplies, DequantSwigluQuant divides)
+ * - SwiGlu activates the first half, so activate_left=true
+ */
+class __attribute__((visibility("default"))) DequantSwigluQuantFusionPass : public PatternFusionPass {
+protected:
+    std::vector<PatternUniqPtr> Patterns() override;
+
+    bool MeetRequirements(const std::unique_ptr<MatchResult>& match_result) override;
+
+    std::unique_ptr<Graph> Replacement(const std::unique_ptr<MatchResult>& match_result) override;
+};
+
+} // namespace ops
+
+#endif // NN_DEQUANT_SWIGLU_QUANT_FUSION_PASS_H
@@ -0,0 +1,311 @@
+/*
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include <iostream>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "platform/platform_infos_def.h"
+#include "platform/platform_info.h"
+#include "ge/es_graph_builder.h"
+#include "es_nn_ops.h"
+#include "compliant_node_builder.h"
+#include "../../../op_graph/fusion_pass/dequant_swiglu_quant_fusion_pass.h"
+
+using namespace std;
+using namespace ge;
+using namespace fe;
+using namespace fusion;
+using namespace es;
+using namespace ops;
+
+namespace {
+constexpr int64_t kTokens = 8;
+constexpr int64_t kHidden = 64;
+// DequantSwigluQuant 输入索引
+constexpr int32_t kDsqWeightScaleIdx = 1;
+constexpr int32_t kDsqActScaleIdx = 2;
+constexpr int32_t kDsqQuantScaleIdx = 4;
+constexpr int32_t kDsqQuantOffsetIdx = 5;
+
+struct ChainParam {
+    bool isDynamic = true;
+    bool hasActScale = false;
+    bool hasBias = false;
+    DataType deqScaleDtype = DT_FLOAT16;
+    bool extraSwigluConsumer = false;
+    bool hasQuantOffset = true;
+    DataType quantParamDtype = DT_FLOAT16;
+    std::string roundMode = "round";
+};
+} // namespace
+
+class DequantSwigluQuantFusionPassTest : public testing::Test {
+protected:
+    void SetUp() override
+    {
+        SetPlatform("Ascend910B");
+    }
+
+    static void SetPlatform(const std::string& soc)
+    {
+        fe::PlatformInfo platformInfo;
+        fe::OptionalInfo optiCompilationInfo;
+        platformInfo.soc_info.ai_core_cnt = 24;
+        platformInfo.str_info.short_soc_version = soc;
+        optiCompilationInfo.soc_version = soc;
+        fe::PlatformInfoManager::Instance().platform_info_map_[soc] = platformInfo;
+        fe::PlatformInfoManager::Instance().SetOptionalCompilationInfo(optiCompilationInfo);
+    }
+
+    static void SetDesc(GNode& node, bool isInput, int32_t index, DataType dtype, const std::vector<int64_t>& dims)
+    {
+        TensorDesc desc;
+        if (isInput) {
+            node.GetInputDesc(index, desc);
+        } else {
+            node.GetOutputDesc(index, desc);
+        }
+        desc.SetDataType(dtype);
+        desc.SetFormat(FORMAT_ND);
+        desc.SetShape(Shape(dims));
+        if (isInput) {
+            node.UpdateInputDesc(index, desc);
+        } else {
+            node.UpdateOutputDesc(index, desc);
+        }
+    }
+
+    static GNode BuildNode(es::EsGraphBuilder& graphBuilder, const char* opType,
+                           const std::vector<es::EsTensorHolder>& inputs, int32_t outputNum = 1)
+    {
+        auto graphPtr = graphBuilder.GetCGraphBuilder()->GetGraph();
+        std::vector<es::CompliantNodeBuilder::IrInputDef> irInputs;
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            irInputs.push_back({("x" + std::to_string(i)).c_str(), es::CompliantNodeBuilder::kEsIrInputRequired, ""});
+        }
+        std::vector<es::CompliantNodeBuilder::IrOutputDef> irOutputs;
+        for (int32_t i = 0; i < outputNum; ++i) {
+            irOutputs.push_back({("y" + std::to_string(i)).c_str(), es::CompliantNodeBuilder::kEsIrOutputRequired, ""});
+        }
+        auto node = es::CompliantNodeBuilder(graphPtr)
+                        .OpType(opType)
+                        .Name(opType)
+                        .IrDefInputs(irInputs)
+                        .IrDefOutputs(irOutputs)
+                        .Build();
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            es::AddEdgeAndUpdatePeerDesc(*graphPtr, *inputs[i].GetProducer(), inputs[i].GetProducerOutIndex(), node,
+                                         static_cast<int32_t>(i));
+        }
+        return node;
+    }
+
+    static es::EsTensorHolder Out(es::EsGraphBuilder& graphBuilder, GNode& node, int32_t index = 0)
+    {
+        return es::EsTensorHolder(graphBuilder.GetCGraphBuilder()->GetTensorHolderFromNode(node, index));
+    }
+
+    static std::shared_ptr<Graph> BuildGraph(const ChainParam& param)
+    {
+        const std::vector<int64_t> xDims = {kTokens, kHidden};
+        const std::vector<int64_t> halfDims = {kTokens, kHidden / 2};
+        auto graphBuilder = es::EsGraphBuilder("dequant_swiglu_quant_fusion_test");
+        int64_t inputIdx = 0;
+        auto x = graphBuilder.CreateInput(inputIdx++, "x", DT_INT32, FORMAT_ND, xDims);
+        auto deqScale = graphBuilder.CreateInput(inputIdx++, "deq_scale", param.deqScaleDtype, FORMAT_ND, {kHidden});
+
+        GNode dequant = BuildNode(graphBuilder, "AscendDequant", {x, deqScale});
+        SetDesc(dequant, true, 0, DT_INT32, xDims);
+        SetDesc(dequant, true, 1, param.deqScaleDtype, {kHidden});
+        SetDesc(dequant, false, 0, DT_FLOAT16, xDims);
+        auto swigluIn = Out(graphBuilder, dequant);
+        if (param.hasActScale) {
+            auto actScale = graphBuilder.CreateInput(inputIdx++, "act_scale", DT_FLOAT16, FORMAT_ND, {kTokens, 1});
+            GNode mul = BuildNode(graphBuilder, "Mul", {swigluIn, actScale});
+            SetDesc(mul, true, 1, DT_FLOAT16, {kTokens, 1});
+            SetDesc(mul, false, 0, DT_FLOAT16, xDims);
+            swigluIn = Out(graphBuilder, mul);
+        }
+        if (param.hasBias) {
+            auto bias = graphBuilder.CreateInput(inputIdx++, "bias", DT_FLOAT16, FORMAT_ND, {kHidden});
+            GNode add = BuildNode(graphBuilder, "Add", {swigluIn, bias});
+            SetDesc(add, true, 1, DT_FLOAT16, {kHidden});
+            SetDesc(add, false, 0, DT_FLOAT16, xDims);
+            swigluIn = Out(graphBuilder, add);
+        }
+        GNode swiglu = BuildNode(graphBuilder, "SwiGlu", {swigluIn});
+        swiglu.SetAttr("dim", static_cast<int64_t>(-1));
+        SetDesc(swiglu, true, 0, DT_FLOAT16, xDims);
+        SetDesc(swiglu, false, 0, DT_FLOAT16, halfDims);
+        auto swigluOut = Out(graphBuilder, swiglu);
+
+        auto quantScale =
+            graphBuilder.CreateInput(inputIdx++, "quant_scale", param.quantParamDtype, FORMAT_ND, {kHidden / 2});
+        std::vector<es::EsTensorHolder> quantInputs = {swigluOut, quantScale};
+        const bool hasQuantOffset = !param.isDynamic && param.hasQuantOffset;
+        if (hasQuantOffset) {
+            quantInputs.emplace_back(
+                graphBuilder.CreateInput(inputIdx++, "quant_offset", param.quantParamDtype, FORMAT_ND, {kHidden / 2}));
+        }
+        GNode quant = BuildNode(graphBuilder, param.isDynamic ? "DynamicQuant" : "AscendQuantV2", quantInputs,
+                                param.isDynamic ? 2 : 1);
+        SetDesc(quant, true, 0, DT_FLOAT16, halfDims);
+        SetDesc(quant, true, 1, param.quantParamDtype, {kHidden / 2});
+        if (hasQuantOffset) {
+            SetDesc(quant, true, 2, param.quantParamDtype, {kHidden / 2});
+        }
+        SetDesc(quant, false, 0, DT_INT8, halfDims);
+        std::vector<es::EsTensorHolder> outputs = {Out(graphBuilder, quant)};
+        if (param.isDynamic) {
+            SetDesc(quant, false, 1, DT_FLOAT, {kTokens});
+            outputs.emplace_back(Out(graphBuilder, quant, 1));
+        } else {
+            quant.SetAttr("sqrt_mode", false);
+            quant.SetAttr("axis", static_cast<int64_t>(-1));
+            quant.SetAttr("round_mode", AscendString(param.roundMode.c_str()));
+        }
+        if (param.extraSwigluConsumer) {
+            outputs.emplace_back(swigluOut);
+        }
+        return graphBuilder.BuildAndReset(outputs);
+    }
+
+    static Status RunPass(std::shared_ptr<Graph>& graph)
+    {
+        CustomPassContext passContext;
+        ops::DequantSwigluQuantFusionPass pass;
+        return pass.Run(graph, passContext);
+    }
+
+    static DataType GetFusedInputDtype(const std::shared_ptr<Graph>& graph, int32_t index)
+    {
+        for (auto node : graph->GetAllNodes()) {
+            AscendString type;
+            node.GetType(type);
+            if (type == "DequantSwigluQuant") {
+                TensorDesc desc;
+                node.GetInputDesc(index, desc);
+                return desc.GetDataType();
+            }
+        }
+        return DT_UNDEFINED;
+    }
+
+    static int CountOpType(const std::shared_ptr<Graph>& graph, const char* opType)
+    {
+        int count = 0;
+        for (auto node : graph->GetAllNodes()) {
+            AscendString type;
+            node.GetType(type);
+            if (type == opType) {
+                count++;
+            }
+        }
+        return count;
+    }
+};
+
+TEST_F(DequantSwigluQuantFusionPassTest, pattern_test)
+{
+    ops::DequantSwigluQuantFusionPass pass;
+    std::vector<PatternUniqPtr> patterns = pass.Patterns();
+    EXPECT_EQ(patterns.size(), 12);
+}
+
+TEST_F(DequantSwigluQuantFusionPassTest, dequant_swiglu_dynamic_quant_fusion_OK)
+{
+    ChainParam param;
+    auto graph = BuildGraph(param);
+    EXPECT_EQ(RunPass(graph), SUCCESS);
+    EXPECT_EQ(CountOpType(graph, "DequantSwigluQuant"), 1);
+    EXPECT_EQ(CountOpType(graph, "SwiGlu"), 0);
+    EXPECT_EQ(CountOpType(graph, "DynamicQuant"), 0);
+    EXPECT_EQ(CountOpType(graph, "AscendDequant"), 0);
+    // fp16 smooth_scales 转为 float 后作为 quant_scale
+    EXPECT_EQ(GetFusedInputDtype(graph, kDsqWeightScaleIdx), DT_FLOAT);
+    EXPECT_EQ(GetFusedInputDtype(graph, kDsqQuantScaleIdx), DT_FLOAT);
+}
+
+TEST_F(DequantSwigluQuantFusionPassTest, dequant_mul_add_swiglu_static_quant_fusion_OK)
+{
+    ChainParam param;
+    param.isDynamic = false;
+    param.hasActScale = true;
+    param.hasBias = true;
+    auto graph = BuildGraph(param);
+    EXPECT_EQ(RunPass(graph), SUCCESS);
+    EXPECT_EQ(CountOpType(graph, "DequantSwigluQuant"), 1);
+    EXPECT_EQ(CountOpType(graph, "Reciprocal"), 1);
+    EXPECT_EQ(CountOpType(graph, "Mul"), 0);
+    EXPECT_EQ(CountOpType(graph, "Add"), 0);
+    EXPECT_EQ(CountOpType(graph, "AscendQuantV2"), 0);
+    EXPECT_EQ(GetFusedInputDtype(graph, kDsqActScaleIdx), DT_FLOAT);
+    EXPECT_EQ(GetFusedInputDtype(graph, kDsqQuantScaleIdx), DT_FLOAT);
+    EXPECT_EQ(GetFusedInputDtype(graph, kDsqQuantOffsetIdx), DT_FLOAT);
+}
+
+TEST_F(DequantSwigluQuantFusionPassTest, static_quant_float_param_fusion_OK)
+{
+    ChainParam param;
+    param.isDynamic = false;
+    param.quantParamDtype = DT_FLOAT;
+    auto graph = BuildGraph(param);
+    EXPECT_EQ(RunPass(graph), SUCCESS);
+    EXPECT_EQ(CountOpType(graph, "DequantSwigluQuant"), 1);
+    EXPECT_EQ(GetFusedInputDtype(graph, kDsqQuantScaleIdx), DT_FLOAT);
+    EXPECT_EQ(GetFusedInputDtype(graph, kDsqQuantOffsetIdx), DT_FLOAT);
+}
+
+TEST_F(DequantSwigluQuantFusionPassTest, static_quant_without_offset_not_fusion)
+{
+    ChainParam param;
+    param.isDynamic = false;
+    param.hasQuantOffset = false;
+    auto graph = BuildGraph(param);
+    EXPECT_EQ(RunPass(graph), GRAPH_NOT_CHANGED);
+    EXPECT_EQ(CountOpType(graph, "DequantSwigluQuant"), 0);
+    EXPECT_EQ(CountOpType(graph, "AscendQuantV2"), 1);
+}
+
+TEST_F(DequantSwigluQuantFusionPassTest, static_quant_round_mode_not_round_not_fusion)
+{
+    for (const char* roundMode : {"floor", "ceil", "trunc"}) {
+        ChainParam param;
+        param.isDynamic = false;
+        param.roundMode = roundMode;
+        auto graph = BuildGraph(param);
+        EXPECT_EQ(RunPass(graph), GRAPH_NOT_CHANGED) << roundMode;
+    }
+}
+
+TEST_F(DequantSwigluQuantFusionPassTest, uint64_deq_scale_not_fusion)
+{
+    ChainParam param;
+    param.deqScaleDtype = DT_UINT64;
+    auto graph = BuildGraph(param);
+    EXPECT_EQ(RunPass(graph), GRAPH_NOT_CHANGED);
+}
+
+TEST_F(DequantSwigluQuantFusionPassTest, swiglu_multi_consumer_not_fusion)
+{
+    ChainParam param;
+    param.extraSwigluConsumer = true;
+    auto graph = BuildGraph(param);
+    EXPECT_EQ(RunPass(graph), GRAPH_NOT_CHANGED);
+}
+
+TEST_F(DequantSwigluQuantFusionPassTest, static_quant_on_950_not_fusion)
+{
+    SetPlatform("Ascend950");
+    ChainParam param;
+    param.isDynamic = false;
+    auto graph = BuildGraph(param);
+    EXPECT_EQ(RunPass(graph), GRAPH_NOT_CHANGED);
+}
@@ -0,0 +1,217 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file test_tiling_coverage.cpp
+ * \brief 基于桩算子 TilingCoverageStub 校验 tiling 覆盖率回放与注册表选择规则一致, 不依赖具体算子
+ */
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "register/op_impl_registry.h"
+#include "op_host/tiling_base.h"
+#include "op_host/tiling_templates_registry.h"
+#include "tiling_coverage.h"
+
+namespace {
+using Ops::NN::Optiling::TilingBaseClass;
+using Ops::NN::Optiling::TilingRegistry;
+
+struct TilingCoverageStubCompileInfo {
+    int64_t rsvd = 0;
+};
+
+// 按输入首维取值决定各模板行为:
+//   优先级 0: 首维不为 1 时 GetShapeAttrsInfo 返回 GRAPH_PARAM_INVALID, 注册表跳过
+//   优先级 1: 仅首维为 2 时 IsCapable
+//   优先级 2: 首维为 3 时 GetShapeAttrsInfo 返回 GRAPH_FAILED, 注册表选中并中止
+//   优先级 3: 总是 IsCapable, 但始终被优先级 2 抢先
+//   优先级 4: 从不 IsCapable
+class TilingCoverageStubBase : public TilingBaseClass {
+public:
+    TilingCoverageStubBase(gert::TilingContext* context, uint64_t key) : TilingBaseClass(context), key_(key) {}
+
+protected:
+    ge::graphStatus GetPlatformInfo() override { return ge::GRAPH_SUCCESS; }
+    ge::graphStatus GetShapeAttrsInfo() override
+    {
+        firstDim_ = context_->GetInputShape(0)->GetStorageShape().GetDim(0);
+        return ge::GRAPH_SUCCESS;
+    }
+    bool IsCapable() override { return true; }
+    ge::graphStatus DoOpTiling() override { return ge::GRAPH_SUCCESS; }
+    ge::graphStatus DoLibApiTiling() override { return ge::GRAPH_SUCCESS; }
+    uint64_t GetTilingKey() const override { return key_; }
+    ge::graphStatus GetWorkspaceSize() override { return ge::GRAPH_SUCCESS; }
+    ge::graphStatus PostTiling() override { return ge::GRAPH_SUCCESS; }
+
+    int64_t firstDim_ = 0;
+
+private:
+    uint64_t key_;
+};
+
+class TilingCoverageStubShapeTiling : public TilingCoverageStubBase {
+public:
+    explicit TilingCoverageStubShapeTiling(gert::TilingContext* context) : TilingCoverageStubBase(context, 100) {}
+
+protected:
+    ge::graphStatus GetShapeAttrsInfo() override
+    {
+        (void)TilingCoverageStubBase::GetShapeAttrsInfo();
+        return firstDim_ == 1 ? ge::GRAPH_SUCCESS : ge::GRAPH_PARAM_INVALID;
+    }
+};
+
+class TilingCoverageStubCapableTiling : public TilingCoverageStubBase {
+public:
+    explicit TilingCoverageStubCapableTiling(gert::TilingContext* context) : TilingCoverageStubBase(context, 101) {}
+
+protected:
+    bool IsCapable() override { return firstDim_ == 2; }
+};
+
+class TilingCoverageStubFailTiling : public TilingCoverageStubBase {
+public:
+    explicit TilingCoverageStubFailTiling(gert::TilingContext* context) : TilingCoverageStubBase(context, 102) {}
+
+protected:
+    ge::graphStatus GetShapeAttrsInfo() override
+    {
+        (void)TilingCoverageStubBase::GetShapeAttrsInfo();
+        return firstDim_ == 3 ? ge::GRAPH_FAILED : ge::GRAPH_SUCCESS;
+    }
+};
+
+class TilingCoverageStubShadowedTiling : public TilingCoverageStubBase {
+public:
+    explicit TilingCoverageStubShadowedTiling(gert::TilingContext* context) : TilingCoverageStubBase(context, 103) {}
+};
+
+class TilingCoverageStubDeadTiling : public TilingCoverageStubBase {
+public:
+    explicit TilingCoverageStubDeadTiling(gert::TilingContext* context) : TilingCoverageStubBase(context, 104) {}
+
+protected:
+    bool IsCapable() override { return false; }
+};
+
+REGISTER_OPS_TILING_TEMPLATE(TilingCoverageStub, TilingCoverageStubShapeTiling, 0);
+REGISTER_OPS_TILING_TEMPLATE(TilingCoverageStub, TilingCoverageStubCapableTiling, 1);
+REGISTER_OPS_TILING_TEMPLATE(TilingCoverageStub, TilingCoverageStubFailTiling, 2);
+REGISTER_OPS_TILING_TEMPLATE(TilingCoverageStub, TilingCoverageStubShadowedTiling, 3);
+REGISTER_OPS_TILING_TEMPLATE(TilingCoverageStub, TilingCoverageStubDeadTiling, 4);
+
+ge::graphStatus Tiling4TilingCoverageStub(gert::TilingContext* context)
+{
+    return TilingRegistry::GetInstance().DoTilingImpl(context);
+}
+
+TilingCoverageStubCompileInfo g_stubCompileInfo;
+
+TilingCoverage::CoverageCase MakeStubCase(const std::string& name, int64_t firstDim)
+{
+    gert::StorageShape shape = {{firstDim, 16}, {firstDim, 16}};
+    gert::TilingContextPara para("TilingCoverageStub", {{shape, ge::DT_FLOAT, ge::FORMAT_ND}},
+                                 {{shape, ge::DT_FLOAT, ge::FORMAT_ND}},
+                                 {{"mode", Ops::NN::AnyValue::CreateFrom<int64_t>(0)}}, &g_stubCompileInfo);
+    return {name, para};
+}
+
+std::vector<TilingCoverage::CoverageCase> StubCorpus()
+{
+    return {MakeStubCase("shape_hit", 1), MakeStubCase("capable_hit", 2), MakeStubCase("shape_failed", 3),
+            MakeStubCase("fallback_hit", 4)};
+}
+
+REGISTER_TILING_COVERAGE_CORPUS(TilingCoverageStub, StubCorpus);
+} // namespace
+
+namespace optiling {
+IMPL_OP_OPTILING(TilingCoverageStub).Tiling(Tiling4TilingCoverageStub);
+} // namespace optiling
+
+class TilingCoverageTest : public testing::Test {
+protected:
+    static void SetUpTestCase() { std::cout << "TilingCoverageTest SetUp" << std::endl; }
+    static void TearDownTestCase() { std::cout << "TilingCoverageTest TearDown" << std::endl; }
+};
+
+TEST_F(TilingCoverageTest, replay_selects_like_registry)
+{
+    auto corpus = TilingCoverage::CorpusRegistry::GetInstance().Build("TilingCoverageStub");
+    ASSERT_EQ(corpus.size(), 4);
+    auto report = TilingCoverage::Replay("TilingCoverageStub", corpus);
+    EXPECT_EQ(report.registry, "op");
+    ASSERT_EQ(report.templates.size(), 5);
+    ASSERT_EQ(report.cases.size(), corpus.size());
+
+    // GetShapeAttrsInfo 返回 GRAPH_FAILED 时注册表不会跳过, 应选中优先级 2 并与算子实际失败一致
+    const std::vector<int32_t> expectPriority = {0, 1, 2, 2};
+    const std::vector<ge::graphStatus> expectStatus = {ge::GRAPH_SUCCESS, ge::GRAPH_SUCCESS, ge::GRAPH_FAILED,
+                                                       ge::GRAPH_SUCCESS};
+    const std::vector<int64_t> expectKey = {100, 101, -1, 102};
+    for (size_t i = 0; i < corpus.size(); i++) {
+        const auto& record = report.cases[i];
+        EXPECT_EQ(record.selectedPriority, expectPriority[i]) << record.name;
+        EXPECT_EQ(record.selectedStatus, expectStatus[i]) << record.name;
+        EXPECT_EQ(record.opTilingKey, expectKey[i]) << record.name;
+        EXPECT_TRUE(record.consistent) << record.name;
+    }
+
+    const auto& shapeStat = report.templates.at(0);
+    EXPECT_NE(shapeStat.className.find("TilingCoverageStubShapeTiling"), std::string::npos);
+    EXPECT_EQ(shapeStat.shapeRejectedCount, 3);
+    EXPECT_EQ(shapeStat.selectedCount, 1);
+    EXPECT_EQ(shapeStat.tilingKeys.at(100), 1);
+    EXPECT_EQ(report.templates.at(1).notCapableCount, 3);
+    EXPECT_EQ(report.templates.at(2).shapeRejectedCount, 1);
+    EXPECT_EQ(report.templates.at(2).selectedCount, 2);
+    EXPECT_EQ(report.templates.at(3).capableCount, 4);
+    EXPECT_EQ(report.templates.at(3).selectedCount, 0);
+    for (const auto& item : report.templates) {
+        EXPECT_EQ(item.second.shapeRejectedCount + item.second.notCapableCount + item.second.capableCount,
+                  corpus.size());
+    }
+    EXPECT_EQ(report.DeadTemplates(), std::vector<int32_t>({4}));
+    EXPECT_EQ(report.ShadowedTemplates(), std::vector<int32_t>({3}));
+
+    auto json = report.ToJson();
+    EXPECT_EQ(json["cases"].size(), corpus.size());
+    EXPECT_EQ(json["cases"][2]["selected_status"], ge::GRAPH_FAILED);
+}
+
+TEST_F(TilingCoverageTest, corpus_registry_and_trace)
+{
+    auto seeds = TilingCoverage::CorpusRegistry::GetInstance().Build("TilingCoverageStub");
+    ASSERT_EQ(seeds.size(), 4);
+    auto trace = nlohmann::json::parse(R"([
+        {"name": "trace_0", "seed": 0, "inputs": [[2, 32]], "outputs": [[2, 32]]},
+        {"seed": 1, "inputs": [[3, 16]], "attrs": {"mode": 1}}
+    ])");
+    std::vector<TilingCoverage::CoverageCase> corpus;
+    ASSERT_TRUE(TilingCoverage::ApplyTrace(trace, seeds, corpus));
+    ASSERT_EQ(corpus.size(), 2);
+    EXPECT_EQ(corpus[0].name, "trace_0");
+    EXPECT_EQ(corpus[1].name, "capable_hit_trace_1");
+    EXPECT_EQ(corpus[0].para.inputTensorDesc_[0].shape_.GetStorageShape().GetDim(1), 32);
+    EXPECT_EQ(corpus[1].para.inputTensorDesc_[0].shape_.GetStorageShape().GetDim(0), 3);
+
+    auto report = TilingCoverage::Replay("TilingCoverageStub", corpus);
+    ASSERT_EQ(report.cases.size(), 2);
+    EXPECT_EQ(report.cases[0].selectedPriority, 1);
+    EXPECT_EQ(report.cases[1].selectedPriority, 2);
+    EXPECT_EQ(report.cases[1].opStatus, ge::GRAPH_FAILED);
+
+    auto badSeed = nlohmann::json::parse(R"([{"seed": 100}])");
+    EXPECT_FALSE(TilingCoverage::ApplyTrace(badSeed, seeds, corpus));
+}
@@ -0,0 +1,177 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file test_tiling_trace.cpp
+ * \brief 基于桩算子 TilingTraceStub 校验 tiling 决策追踪的记录内容、环形缓冲与 json lines 导出
+ */
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <gtest/gtest.h>
+#include "register/op_impl_registry.h"
+#include "op_host/tiling_base.h"
+#include "op_host/tiling_templates_registry.h"
+#include "op_host/tiling_trace.h"
+#include "tiling_case_executor.h"
+
+namespace {
+using Ops::NN::Optiling::TilingBaseClass;
+using Ops::NN::Optiling::TilingRegistry;
+using Ops::NN::Optiling::TilingTraceBuffer;
+
+constexpr uint64_t STUB_TILING_KEY = 7;
+constexpr uint32_t STUB_BLOCK_DIM = 4;
+constexpr uint64_t STUB_WORKSPACE_SIZE = 1024;
+
+struct TilingTraceStubCompileInfo {
+    int64_t rsvd = 0;
+};
+
+class TilingTraceStubBase : public TilingBaseClass {
+public:
+    explicit TilingTraceStubBase(gert::TilingContext* context) : TilingBaseClass(context) {}
+
+protected:
+    ge::graphStatus GetPlatformInfo() override { return ge::GRAPH_SUCCESS; }
+    ge::graphStatus GetShapeAttrsInfo() override { return ge::GRAPH_SUCCESS; }
+    bool IsCapable() override { return true; }
+    ge::graphStatus DoOpTiling() override { return ge::GRAPH_SUCCESS; }
+    ge::graphStatus DoLibApiTiling() override { return ge::GRAPH_SUCCESS; }
+    uint64_t GetTilingKey() const override { return STUB_TILING_KEY; }
+    ge::graphStatus GetWorkspaceSize() override
+    {
+        size_t* workspaces = context_->GetWorkspaceSizes(1);
+        workspaces[0] = STUB_WORKSPACE_SIZE;
+        return ge::GRAPH_SUCCESS;
+    }
+    ge::graphStatus PostTiling() override
+    {
+        context_->SetBlockDim(STUB_BLOCK_DIM);
+        return ge::GRAPH_SUCCESS;
+    }
+};
+
+// 优先级 0 总是拒绝并记录原因, 由优先级 1 完成 tiling
+class TilingTraceStubRejectTiling : public TilingTraceStubBase {
+public:
+    explicit TilingTraceStubRejectTiling(gert::TilingContext* context) : TilingTraceStubBase(context) {}
+
+protected:
+    bool IsCapable() override
+    {
+        OP_TILING_REJECT("TilingTraceStub", "stub reject");
+        return false;
+    }
+};
+
+class TilingTraceStubHitTiling : public TilingTraceStubBase {
+public:
+    explicit TilingTraceStubHitTiling(gert::TilingContext* context) : TilingTraceStubBase(context) {}
+};
+
+REGISTER_OPS_TILING_TEMPLATE(TilingTraceStub, TilingTraceStubRejectTiling, 0);
+REGISTER_OPS_TILING_TEMPLATE(TilingTraceStub, TilingTraceStubHitTiling, 1);
+
+ge::graphStatus Tiling4TilingTraceStub(gert::TilingContext* context)
+{
+    return TilingRegistry::GetInstance().DoTilingImpl(context);
+}
+
+TilingTraceStubCompileInfo g_stubCompileInfo;
+
+gert::TilingContextPara MakeStubPara(int64_t firstDim)
+{
+    gert::StorageShape shape = {{firstDim, 16}, {firstDim, 16}};
+    return gert::TilingContextPara("TilingTraceStub", {{shape, ge::DT_FLOAT16, ge::FORMAT_ND}},
+                                   {{shape, ge::DT_FLOAT16, ge::FORMAT_ND}}, &g_stubCompileInfo);
+}
+
+// 用例结束时恢复全局追踪缓冲的开关与容量, 避免影响同进程内的其他用例
+class TilingTraceBufferGuard {
+public:
+    TilingTraceBufferGuard()
+        : buffer_(TilingTraceBuffer::GetInstance()), enabled_(buffer_.IsEnabled()), capacity_(buffer_.GetCapacity())
+    {}
+
+    ~TilingTraceBufferGuard()
+    {
+        buffer_.SetEnabled(enabled_);
+        buffer_.SetCapacity(capacity_);
+        buffer_.Clear();
+    }
+
+private:
+    TilingTraceBuffer& buffer_;
+    bool enabled_;
+    size_t capacity_;
+};
+} // namespace
+
+namespace optiling {
+IMPL_OP_OPTILING(TilingTraceStub).Tiling(Tiling4TilingTraceStub);
+} // namespace optiling
+
+class TilingTraceTest : public testing::Test {
+protected:
+    static void SetUpTestCase() { std::cout << "TilingTraceTest SetUp" << std::endl; }
+    static void TearDownTestCase() { std::cout << "TilingTraceTest TearDown" << std::endl; }
+};
+
+TEST_F(TilingTraceTest, record_ring_buffer_and_dump)
+{
+    TilingTraceBufferGuard guard;
+    auto& traceBuffer = TilingTraceBuffer::GetInstance();
+    traceBuffer.SetEnabled(true);
+    traceBuffer.SetCapacity(2);
+    traceBuffer.Clear();
+    TilingInfo tilingInfo;
+    for (int64_t firstDim = 1; firstDim <= 3; firstDim++) {
+        ASSERT_TRUE(ExecuteTiling(MakeStubPara(firstDim), tilingInfo));
+    }
+    traceBuffer.SetEnabled(false);
+    (void)ExecuteTiling(MakeStubPara(4), tilingInfo);
+
+    // 容量为 2 时只保留最后两次调用, 关闭追踪后的调用不记录
+    auto records = traceBuffer.Snapshot();
+    ASSERT_EQ(records.size(), 2);
+    EXPECT_EQ(records[1].seq, records[0].seq + 1);
+    const auto& record = records[1];
+    EXPECT_EQ(record.opType, "TilingTraceStub");
+    EXPECT_EQ(record.inputSignature, "DT_FLOAT16:ND:[3,16]");
+    EXPECT_EQ(record.status, ge::GRAPH_SUCCESS);
+    EXPECT_EQ(record.chosenPriority, 1);
+    EXPECT_EQ(record.tilingKey, STUB_TILING_KEY);
+    EXPECT_EQ(record.blockDim, STUB_BLOCK_DIM);
+    EXPECT_EQ(record.workspaceSize, STUB_WORKSPACE_SIZE);
+    ASSERT_EQ(record.templates.size(), 2);
+    EXPECT_EQ(record.templates[0].priority, 0);
+    EXPECT_FALSE(record.templates[0].capable);
+    EXPECT_EQ(record.templates[0].status, ge::GRAPH_PARAM_INVALID);
+    EXPECT_EQ(record.templates[0].rejectReason, "stub reject");
+    EXPECT_EQ(record.templates[1].priority, 1);
+    EXPECT_TRUE(record.templates[1].capable);
+    EXPECT_EQ(record.templates[1].status, ge::GRAPH_SUCCESS);
+
+    std::ostringstream oss;
+    traceBuffer.DumpJsonLines(oss);
+    std::istringstream lines(oss.str());
+    std::string line;
+    size_t lineNum = 0;
+    while (std::getline(lines, line)) {
+        auto json = nlohmann::json::parse(line);
+        EXPECT_EQ(json["op_type"], "TilingTraceStub");
+        EXPECT_EQ(json["chosen_priority"], 1);
+        EXPECT_EQ(json["templates"][0]["reason"], "stub reject");
+        lineNum++;
+    }
+    EXPECT_EQ(lineNum, 2);
+}
@@ -16,7 +16,7 @@
 
 #define STR_IMPL(x) #x
 #define STR(x) STR_IMPL(x)
-#define DO_TILING(tilingContextPara)                                                                                                                                                                                                         \
+#define BUILD_TILING_CONTEXT(tilingContextPara)                                                                                                                                                                                              \
     auto contextFaker = gert::TilingContextFaker();                                                                                                                                                                                          \
     /* 1. input/output information */                                                                                                                                                                                                        \
     size_t inputNum = tilingContextPara.inputTensorDesc_.size();                                                                                                                                                                             \
@@ -149,7 +149,10 @@
     tilingContext->GetPlatformInfo()->SetPlatformRes("AICoreSpec", aicoreSpec);                                                                                                                                                              \
     tilingContext->GetPlatformInfo()->SetCoreNumByCoreType("AICore");                                                                                                                                                                        \
     tilingContext->GetPlatformInfo()->SetPlatformRes("AICoreintrinsicDtypeMap", intrinsics);                                                                                                                                                 \
-    tilingContext->GetPlatformInfo()->SetPlatformRes("version", socversions);                                                                                                                                                                \
+    tilingContext->GetPlatformInfo()->SetPlatformRes("version", socversions);
+
+#define DO_TILING(tilingContextPara)                                                                                                                                                                                                         \
+    BUILD_TILING_CONTEXT(tilingContextPara);                                                                                                                                                                                                 \
     /* 3. get tiling func */                                                                                                                                                                                                                 \
     auto spaceRegistry = gert::DefaultOpImplSpaceRegistryV2::GetInstance().GetSpaceRegistry();                                                                                                                                               \
     if (spaceRegistry == nullptr) {                                                                                                                                                                                                          \
@@ -306,6 +309,12 @@ bool ExecuteTiling(const gert::TilingContextPara& tilingContextPara, TilingInfo&
     return true;
 }
 
+ge::graphStatus ExecuteTilingFunc(const gert::TilingContextPara& tilingContextPara, const TilingFuncProbe& probe)
+{
+    BUILD_TILING_CONTEXT(tilingContextPara);
+    return probe(tilingContext);
+}
+
 static string eleToString(void* buf)
 {
     string result;
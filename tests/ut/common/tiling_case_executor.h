@@ -11,6 +11,7 @@
 #ifndef OPS_NN_TESTS_UT_COMMON_TILING_CASE_EXECUTOR_H
 #define OPS_NN_TESTS_UT_COMMON_TILING_CASE_EXECUTOR_H
 
+#include <functional>
 #include "kernel_run_context_facker.h"
 #include "platform/platform_infos_def.h"
 
@@ -39,4 +40,8 @@ void ExecuteTestCaseForEle(const gert::TilingContextPara& tilingContextPara, ge:
 
 bool ExecuteTiling(const gert::TilingContextPara& tilingContextPara, TilingInfo& tilingInfo);
 
+// 按 tilingContextPara 构造一份全新的 TilingContext, 交给 probe 执行, 不经过算子注册的 tiling 函数
+using TilingFuncProbe = std::function<ge::graphStatus(gert::TilingContext*)>;
+ge::graphStatus ExecuteTilingFunc(const gert::TilingContextPara& tilingContextPara, const TilingFuncProbe& probe);
+
 #endif // OPS_NN_TESTS_UT_COMMON_TILING_CASE_EXECUTOR_H
\ No newline at end of file
@@ -0,0 +1,391 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file tiling_coverage.cpp
+ * \brief
+ */
+
+#include "tiling_coverage.h"
+
+#include <cxxabi.h>
+#include <cstdlib>
+#include <iomanip>
+#include <memory>
+#include <typeinfo>
+#include "op_host/tiling_templates_registry.h"
+
+using Ops::NN::Optiling::TilingClassCase;
+using TilingTemplates = std::map<int32_t, TilingClassCase>;
+
+namespace TilingCoverage {
+namespace {
+const char* const REGISTRY_OP = "op";
+const char* const REGISTRY_ARCH = "arch";
+const char* const REGISTRY_SOC = "soc";
+
+std::string Demangle(const char* name)
+{
+    int status = 0;
+    std::unique_ptr<char, void (*)(void*)> demangled(abi::__cxa_demangle(name, nullptr, nullptr, &status), std::free);
+    return (status == 0 && demangled != nullptr) ? std::string(demangled.get()) : std::string(name);
+}
+
+// 直接查询注册表内部 map, 避免 GetTilingTemplates 未命中时打印错误日志 (依赖 -fno-access-control)
+const TilingTemplates* FindTemplates(gert::TilingContext* context, const std::string& opType, std::string& registry)
+{
+    auto& opRegistry = Ops::NN::Optiling::TilingRegistry::GetInstance().registry_map_;
+    auto opIter = opRegistry.find(opType);
+    if (opIter != opRegistry.end() && opIter->second != nullptr) {
+        registry = REGISTRY_OP;
+        return &opIter->second->GetTilingCases();
+    }
+    auto platformInfoPtr = context->GetPlatformInfo();
+    if (platformInfoPtr == nullptr) {
+        return nullptr;
+    }
+    auto ascendcPlatform = platform_ascendc::PlatformAscendC(platformInfoPtr);
+    auto& archRegistry = Ops::NN::Optiling::TilingRegistryArch::GetInstance().registryMap_;
+    auto archIter = archRegistry.find(static_cast<int32_t>(ascendcPlatform.GetCurNpuArch()));
+    if (archIter != archRegistry.end()) {
+        auto iter = archIter->second.find(opType);
+        if (iter != archIter->second.end() && iter->second != nullptr) {
+            registry = REGISTRY_ARCH;
+            return &iter->second->GetTilingCases();
+        }
+    }
+    auto& socRegistry = Ops::NN::Optiling::TilingRegistryNew::GetInstance().registry_map_;
+    auto socIter = socRegistry.find(static_cast<int32_t>(ascendcPlatform.GetSocVersion()));
+    if (socIter != socRegistry.end()) {
+        auto iter = socIter->second.find(opType);
+        if (iter != socIter->second.end() && iter->second != nullptr) {
+            registry = REGISTRY_SOC;
+            return &iter->second->GetTilingCases();
+        }
+    }
+    return nullptr;
+}
+
+// 按 DoTiling 的阶段拆开执行, 区分 shape 校验失败与 IsCapable 为 false; 可用时在新实例上走完整 DoTiling
+// 返回值与该模板在 DoTilingImpl 中 DoTiling 的返回值一致, 工厂返回空指针时按注册表行为视为跳过
+ge::graphStatus ProbeTemplate(gert::TilingContext* context, TilingClassCase factory, std::string& className,
+                              ProbeResult& result, uint64_t& tilingKey)
+{
+    auto probe = factory(context);
+    if (probe == nullptr) {
+        result = ProbeResult::NOT_CAPABLE;
+        return ge::GRAPH_PARAM_INVALID;
+    }
+    className = Demangle(typeid(*probe).name());
+    ge::graphStatus status = probe->GetShapeAttrsInfo();
+    if (status == ge::GRAPH_SUCCESS) {
+        status = probe->GetPlatformInfo();
+    }
+    if (status != ge::GRAPH_SUCCESS) {
+        result = ProbeResult::SHAPE_REJECTED;
+        return status;
+    }
+    if (!probe->IsCapable()) {
+        result = ProbeResult::NOT_CAPABLE;
+        return ge::GRAPH_PARAM_INVALID;
+    }
+    auto tiling = factory(context);
+    status = (tiling == nullptr) ? ge::GRAPH_PARAM_INVALID : tiling->DoTiling();
+    if (status != ge::GRAPH_SUCCESS) {
+        result = ProbeResult::TILING_FAILED;
+        return status;
+    }
+    result = ProbeResult::HIT;
+    tilingKey = context->GetTilingKey();
+    return status;
+}
+
+void ReplayCase(const CoverageCase& coverageCase, OpCoverageReport& report)
+{
+    CaseRecord record;
+    record.name = coverageCase.name;
+
+    // 先取模板列表, 再对每个模板各自构造一份 context, 防止模板之间通过 context 互相污染
+    std::vector<std::pair<int32_t, TilingClassCase>> templates;
+    (void)ExecuteTilingFunc(coverageCase.para, [&templates, &report](gert::TilingContext* context) {
+        const TilingTemplates* found = FindTemplates(context, report.opType, report.registry);
+        if (found != nullptr) {
+            templates.assign(found->begin(), found->end());
+        }
+        return ge::GRAPH_SUCCESS;
+    });
+
+    uint64_t selectedKey = 0;
+    for (const auto& item : templates) {
+        auto& stat = report.templates[item.first];
+        stat.priority = item.first;
+        ProbeResult result = ProbeResult::TILING_FAILED;
+        ge::graphStatus status = ge::GRAPH_FAILED;
+        uint64_t tilingKey = 0;
+        (void)ExecuteTilingFunc(coverageCase.para, [&](gert::TilingContext* context) {
+            status = ProbeTemplate(context, item.second, stat.className, result, tilingKey);
+            return ge::GRAPH_SUCCESS;
+        });
+        switch (result) {
+            case ProbeResult::SHAPE_REJECTED:
+                stat.shapeRejectedCount++;
+                break;
+            case ProbeResult::NOT_CAPABLE:
+                stat.notCapableCount++;
+                break;
+            case ProbeResult::TILING_FAILED:
+                stat.capableCount++;
+                stat.failedCount++;
+                break;
+            case ProbeResult::HIT:
+                stat.capableCount++;
+                stat.tilingKeys[tilingKey]++;
+                break;
+        }
+        // 与 DoTilingImpl 一致: 按优先级升序, 第一个不返回 GRAPH_PARAM_INVALID 的模板即被选中
+        if (record.selectedPriority < 0 && status != ge::GRAPH_PARAM_INVALID) {
+            record.selectedPriority = item.first;
+            record.selectedStatus = status;
+            selectedKey = tilingKey;
+            stat.selectedCount++;
+        }
+    }
+
+    TilingInfo tilingInfo;
+    if (ExecuteTiling(coverageCase.para, tilingInfo)) {
+        record.opStatus = ge::GRAPH_SUCCESS;
+        record.opTilingKey = tilingInfo.tilingKey;
+        report.opTilingKeys[tilingInfo.tilingKey]++;
+    }
+    if (record.selectedStatus == ge::GRAPH_SUCCESS) {
+        record.consistent = (record.opStatus == ge::GRAPH_SUCCESS) &&
+                            (static_cast<uint64_t>(record.opTilingKey) == selectedKey);
+    } else {
+        record.consistent = (record.opStatus != ge::GRAPH_SUCCESS);
+    }
+    report.cases.push_back(record);
+}
+
+bool OverrideShapes(const nlohmann::json& dims, std::vector<gert::TilingContextPara::TensorDescription>& tensors)
+{
+    if (!dims.is_array() || dims.size() > tensors.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < dims.size(); i++) {
+        if (dims[i].is_null()) {
+            continue;
+        }
+        gert::Shape shape;
+        for (const auto& dim : dims[i]) {
+            shape.AppendDim(dim.get<int64_t>());
+        }
+        tensors[i].shape_ = gert::StorageShape(shape, shape);
+    }
+    return true;
+}
+
+bool OverrideAttr(const nlohmann::json& value, gert::TilingContextPara::OpAttr& attr)
+{
+    using Ops::NN::AnyValue;
+    switch (attr.attr_.type_) {
+        case AnyValue::ValueType::VT_BOOL:
+            attr.attr_ = AnyValue::CreateFrom<bool>(value.get<bool>());
+            return true;
+        case AnyValue::ValueType::VT_INT:
+            attr.attr_ = AnyValue::CreateFrom<int64_t>(value.get<int64_t>());
+            return true;
+        case AnyValue::ValueType::VT_FLOAT:
+            attr.attr_ = AnyValue::CreateFrom<float>(value.get<float>());
+            return true;
+        case AnyValue::ValueType::VT_STRING:
+            attr.attr_ = AnyValue::CreateFrom<std::string>(value.get<std::string>());
+            return true;
+        case AnyValue::ValueType::VT_LIST_INT:
+            attr.attr_ = AnyValue::CreateFrom<std::vector<int64_t>>(value.get<std::vector<int64_t>>());
+            return true;
+        case AnyValue::ValueType::VT_LIST_FLOAT:
+            attr.attr_ = AnyValue::CreateFrom<std::vector<float>>(value.get<std::vector<float>>());
+            return true;
+        default:
+            return false;
+    }
+}
+} // namespace
+
+CorpusRegistry& CorpusRegistry::GetInstance()
+{
+    static CorpusRegistry registry;
+    return registry;
+}
+
+void CorpusRegistry::Register(const std::string& opType, CorpusBuilder builder)
+{
+    builders_[opType].push_back(builder);
+}
+
+std::vector<CoverageCase> CorpusRegistry::Build(const std::string& opType) const
+{
+    std::vector<CoverageCase> corpus;
+    auto iter = builders_.find(opType);
+    if (iter == builders_.end()) {
+        return corpus;
+    }
+    for (auto builder : iter->second) {
+        auto cases = builder();
+        corpus.insert(corpus.end(), cases.begin(), cases.end());
+    }
+    return corpus;
+}
+
+std::vector<std::string> CorpusRegistry::GetOpTypes() const
+{
+    std::vector<std::string> opTypes;
+    for (const auto& item : builders_) {
+        opTypes.push_back(item.first);
+    }
+    return opTypes;
+}
+
+std::vector<int32_t> OpCoverageReport::DeadTemplates() const
+{
+    std::vector<int32_t> priorities;
+    for (const auto& item : templates) {
+        if (item.second.capableCount == 0) {
+            priorities.push_back(item.first);
+        }
+    }
+    return priorities;
+}
+
+std::vector<int32_t> OpCoverageReport::ShadowedTemplates() const
+{
+    std::vector<int32_t> priorities;
+    for (const auto& item : templates) {
+        if (item.second.capableCount > 0 && item.second.selectedCount == 0) {
+            priorities.push_back(item.first);
+        }
+    }
+    return priorities;
+}
+
+void OpCoverageReport::Print(std::ostream& os) const
+{
+    os << "[TilingCoverage] op " << opType << ", registry " << (registry.empty() ? "none" : registry) << ", "
+       << cases.size() << " cases, " << templates.size() << " templates" << std::endl;
+    os << "  priority  selected  capable  failed  notCapable  shapeRejected  template" << std::endl;
+    for (const auto& item : templates) {
+        const auto& stat = item.second;
+        os << "  " << std::setw(8) << stat.priority << "  " << std::setw(8) << stat.selectedCount << "  "
+           << std::setw(7) << stat.capableCount << "  " << std::setw(6) << stat.failedCount << "  " << std::setw(10)
+           << stat.notCapableCount << "  " << std::setw(13) << stat.shapeRejectedCount << "  " << stat.className
+           << std::endl;
+        for (const auto& key : stat.tilingKeys) {
+            os << "            tiling key " << key.first << " x " << key.second << std::endl;
+        }
+    }
+    os << "  op tiling keys:";
+    for (const auto& key : opTilingKeys) {
+        os << " " << key.first << "(x" << key.second << ")";
+    }
+    os << std::endl << "  dead templates (IsCapable never true):";
+    for (auto priority : DeadTemplates()) {
+        os << " " << priority;
+    }
+    os << std::endl << "  shadowed templates (capable but never selected):";
+    for (auto priority : ShadowedTemplates()) {
+        os << " " << priority;
+    }
+    os << std::endl;
+    for (const auto& record : cases) {
+        if (!record.consistent) {
+            os << "  [WARNING] case " << record.name << ": simulated priority " << record.selectedPriority
+               << " does not match op tiling key " << record.opTilingKey << std::endl;
+        }
+    }
+}
+
+nlohmann::json OpCoverageReport::ToJson() const
+{
+    nlohmann::json result;
+    result["op"] = opType;
+    result["registry"] = registry;
+    result["dead_templates"] = DeadTemplates();
+    result["shadowed_templates"] = ShadowedTemplates();
+    for (const auto& item : templates) {
+        const auto& stat = item.second;
+        nlohmann::json keys = nlohmann::json::object();
+        for (const auto& key : stat.tilingKeys) {
+            keys[std::to_string(key.first)] = key.second;
+        }
+        result["templates"].push_back({{"priority", stat.priority},
+                                       {"class", stat.className},
+                                       {"selected", stat.selectedCount},
+                                       {"capable", stat.capableCount},
+                                       {"failed", stat.failedCount},
+                                       {"not_capable", stat.notCapableCount},
+                                       {"shape_rejected", stat.shapeRejectedCount},
+                                       {"tiling_keys", keys}});
+    }
+    for (const auto& key : opTilingKeys) {
+        result["op_tiling_keys"][std::to_string(key.first)] = key.second;
+    }
+    for (const auto& record : cases) {
+        result["cases"].push_back({{"name", record.name},
+                                   {"selected_priority", record.selectedPriority},
+                                   {"selected_status", record.selectedStatus},
+                                   {"op_status", record.opStatus},
+                                   {"op_tiling_key", record.opTilingKey},
+                                   {"consistent", record.consistent}});
+    }
+    return result;
+}
+
+OpCoverageReport Replay(const std::string& opType, const std::vector<CoverageCase>& corpus)
+{
+    OpCoverageReport report;
+    report.opType = opType;
+    for (const auto& coverageCase : corpus) {
+        ReplayCase(coverageCase, report);
+    }
+    return report;
+}
+
+bool ApplyTrace(const nlohmann::json& trace, const std::vector<CoverageCase>& seeds, std::vector<CoverageCase>& corpus)
+{
+    if (!trace.is_array() || seeds.empty()) {
+        return false;
+    }
+    for (size_t index = 0; index < trace.size(); index++) {
+        const auto& entry = trace[index];
+        size_t seedIdx = entry.value("seed", static_cast<size_t>(0));
+        if (seedIdx >= seeds.size()) {
+            return false;
+        }
+        CoverageCase coverageCase = seeds[seedIdx];
+        coverageCase.name = entry.value("name", seeds[seedIdx].name + "_trace_" + std::to_string(index));
+        if (entry.contains("inputs") && !OverrideShapes(entry["inputs"], coverageCase.para.inputTensorDesc_)) {
+            return false;
+        }
+        if (entry.contains("outputs") && !OverrideShapes(entry["outputs"], coverageCase.para.outputTensorDesc_)) {
+            return false;
+        }
+        if (entry.contains("attrs")) {
+            for (auto& attr : coverageCase.para.attrs_) {
+                if (entry["attrs"].contains(attr.attrName_) && !OverrideAttr(entry["attrs"][attr.attrName_], attr)) {
+                    return false;
+                }
+            }
+        }
+        corpus.push_back(coverageCase);
+    }
+    return true;
+}
+
+} // namespace TilingCoverage
@@ -0,0 +1,111 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file tiling_coverage.h
+ * \brief 基于 tiling context faker 回放 shape 语料, 统计 TilingBaseClass 模板命中、tiling key 分布与不可达模板
+ */
+
+#ifndef OPS_NN_TESTS_UT_COMMON_TILING_COVERAGE_H
+#define OPS_NN_TESTS_UT_COMMON_TILING_COVERAGE_H
+
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+#include "tiling_case_executor.h"
+
+namespace TilingCoverage {
+
+// 单个模板在单个用例上的探测结果, 与 TilingBaseClass::DoTiling 的阶段一一对应
+enum class ProbeResult {
+    SHAPE_REJECTED, // GetShapeAttrsInfo/GetPlatformInfo 未通过, 仅返回 GRAPH_PARAM_INVALID 时注册表才会跳过
+    NOT_CAPABLE,    // IsCapable 返回 false (或工厂返回空指针), 注册表跳过
+    TILING_FAILED,  // IsCapable 为 true, 但后续 DoTiling 失败, 仅返回 GRAPH_PARAM_INVALID 时注册表才会跳过
+    HIT             // DoTiling 成功
+};
+
+struct CoverageCase {
+    std::string name;
+    gert::TilingContextPara para;
+};
+
+// 语料构造函数; para 中的 compileInfo/constValue 须指向静态存储, 回放期间保持有效
+using CorpusBuilder = std::vector<CoverageCase> (*)();
+
+struct TemplateStat {
+    int32_t priority = 0;
+    std::string className;
+    uint64_t shapeRejectedCount = 0;
+    uint64_t notCapableCount = 0;
+    uint64_t capableCount = 0;
+    uint64_t failedCount = 0;
+    uint64_t selectedCount = 0;
+    std::map<uint64_t, uint64_t> tilingKeys; // 模板独立执行成功时产生的 tiling key -> 次数
+};
+
+struct CaseRecord {
+    std::string name;
+    int32_t selectedPriority = -1; // 按优先级顺序模拟注册表选择的模板, -1 表示无模板可用
+    ge::graphStatus selectedStatus = ge::GRAPH_FAILED; // 被选中模板 DoTiling 的返回值, 即注册表的返回值
+    ge::graphStatus opStatus = ge::GRAPH_FAILED;
+    int64_t opTilingKey = -1;      // 算子注册的 tiling 函数实际产生的 tiling key
+    bool consistent = true;        // 模拟选择结果与算子实际 tiling 结果一致
+};
+
+struct OpCoverageReport {
+    std::string opType;
+    std::string registry; // 模板所在注册表: "op" / "arch" / "soc"
+    std::map<int32_t, TemplateStat> templates;
+    std::vector<CaseRecord> cases;
+    std::map<int64_t, uint64_t> opTilingKeys;
+
+    // IsCapable 在整个语料上从未返回 true 的模板
+    std::vector<int32_t> DeadTemplates() const;
+    // IsCapable 曾返回 true, 但始终被更高优先级模板抢先的模板
+    std::vector<int32_t> ShadowedTemplates() const;
+    void Print(std::ostream& os) const;
+    nlohmann::json ToJson() const;
+};
+
+class CorpusRegistry {
+public:
+    static CorpusRegistry& GetInstance();
+    void Register(const std::string& opType, CorpusBuilder builder);
+    std::vector<CoverageCase> Build(const std::string& opType) const;
+    std::vector<std::string> GetOpTypes() const;
+
+private:
+    std::map<std::string, std::vector<CorpusBuilder>> builders_;
+};
+
+class CorpusRegister {
+public:
+    CorpusRegister(const std::string& opType, CorpusBuilder builder)
+    {
+        CorpusRegistry::GetInstance().Register(opType, builder);
+    }
+};
+
+// 回放语料: 每个模板在独立构造的 context 上分别探测, 并与算子实际 tiling 结果对照
+OpCoverageReport Replay(const std::string& opType, const std::vector<CoverageCase>& corpus);
+
+// 以已注册的语料为种子, 按 trace 中的 shape/attr 覆盖生成新用例, 用于回放现网 shape 记录
+// trace 每项形如 {"name": "...", "seed": 0, "inputs": [[1, 16, 8, 8, 8]], "outputs": [[...]], "attrs": {...}}
+bool ApplyTrace(const nlohmann::json& trace, const std::vector<CoverageCase>& seeds, std::vector<CoverageCase>& corpus);
+
+} // namespace TilingCoverage
+
+#define REGISTER_TILING_COVERAGE_CORPUS(opType, builder)                                    \
+    static TilingCoverage::CorpusRegister g_tilingCoverageCorpus_##opType##_##builder(#opType, builder)
+
+#endif // OPS_NN_TESTS_UT_COMMON_TILING_COVERAGE_H
@@ -0,0 +1,119 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file tiling_coverage_main.cpp
+ * \brief tiling 模板覆盖率报告工具
+ *
+ * 用法: nn_tiling_coverage [--op=OpA,OpB] [--trace=trace.json] [--json=report.json]
+ *   --op     只回放指定算子, 缺省回放所有注册了 REGISTER_TILING_COVERAGE_CORPUS 的算子
+ *   --trace  现网 shape 记录, 形如 {"OpType": [{"inputs": [[...]], "outputs": [[...]], "attrs": {...}}]},
+ *            以该算子已注册的语料为种子覆盖 shape/attr 后追加回放
+ *   --json   额外输出 json 格式报告
+ */
+
+#include <fstream>
+#include <iostream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "platform/platform_info.h"
+#include "base/registry/op_impl_space_registry_v2.h"
+#include "tiling_coverage.h"
+
+namespace {
+const std::string ARG_OP = "--op=";
+const std::string ARG_TRACE = "--trace=";
+const std::string ARG_JSON = "--json=";
+
+struct Options {
+    std::set<std::string> opTypes;
+    std::string tracePath;
+    std::string jsonPath;
+};
+
+bool ParseOptions(int argc, char** argv, Options& options)
+{
+    for (int i = 1; i < argc; i++) {
+        std::string arg(argv[i]);
+        if (arg.compare(0, ARG_OP.size(), ARG_OP) == 0) {
+            std::stringstream ss(arg.substr(ARG_OP.size()));
+            std::string opType;
+            while (std::getline(ss, opType, ',')) {
+                options.opTypes.insert(opType);
+            }
+        } else if (arg.compare(0, ARG_TRACE.size(), ARG_TRACE) == 0) {
+            options.tracePath = arg.substr(ARG_TRACE.size());
+        } else if (arg.compare(0, ARG_JSON.size(), ARG_JSON) == 0) {
+            options.jsonPath = arg.substr(ARG_JSON.size());
+        } else {
+            std::cerr << "unknown argument " << arg << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+void InitEnvironment()
+{
+    fe::OptionalInfos optiCompilationInfos;
+    optiCompilationInfos.Init();
+    optiCompilationInfos.SetSocVersion("soc_version");
+    fe::PlatformInfoManager::GeInstance().SetOptionalCompilationInfo(optiCompilationInfos);
+    gert::DefaultOpImplSpaceRegistryV2::GetInstance().SetSpaceRegistry(
+        std::make_shared<gert::OpImplSpaceRegistryV2>());
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    Options options;
+    if (!ParseOptions(argc, argv, options)) {
+        return 1;
+    }
+    nlohmann::json trace = nlohmann::json::object();
+    if (!options.tracePath.empty()) {
+        std::ifstream traceFile(options.tracePath);
+        if (!traceFile.is_open()) {
+            std::cerr << "open trace file " << options.tracePath << " failed" << std::endl;
+            return 1;
+        }
+        trace = nlohmann::json::parse(traceFile, nullptr, false);
+        if (!trace.is_object()) {
+            std::cerr << "trace file " << options.tracePath << " is not a json object" << std::endl;
+            return 1;
+        }
+    }
+
+    InitEnvironment();
+    auto& registry = TilingCoverage::CorpusRegistry::GetInstance();
+    nlohmann::json reports = nlohmann::json::array();
+    for (const auto& opType : registry.GetOpTypes()) {
+        if (!options.opTypes.empty() && options.opTypes.count(opType) == 0) {
+            continue;
+        }
+        auto corpus = registry.Build(opType);
+        if (trace.contains(opType) && !TilingCoverage::ApplyTrace(trace[opType], registry.Build(opType), corpus)) {
+            std::cerr << "apply trace of " << opType << " failed" << std::endl;
+            return 1;
+        }
+        auto report = TilingCoverage::Replay(opType, corpus);
+        report.Print(std::cout);
+        reports.push_back(report.ToJson());
+    }
+    gert::DefaultOpImplSpaceRegistryV2::GetInstance().SetSpaceRegistry(nullptr);
+
+    if (!options.jsonPath.empty()) {
+        std::ofstream jsonFile(options.jsonPath);
+        jsonFile << reports.dump(2) << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,294 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "aicpu_benchmark.h"
+
+#include <dirent.h>
+#include <sched.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <sstream>
+
+#include "cpu_kernel_register.h"
+
+namespace {
+// operator new 统计: 每块内存前置 kAllocHeader 字节记录大小
+constexpr size_t kAllocHeader = alignof(std::max_align_t);
+std::atomic<int64_t> g_allocCurrent(0);
+std::atomic<int64_t> g_allocPeak(0);
+
+void* TrackedAlloc(size_t size)
+{
+    void* raw = std::malloc(size + kAllocHeader);
+    if (raw == nullptr) {
+        return nullptr;
+    }
+    *static_cast<size_t*>(raw) = size;
+    const int64_t current = g_allocCurrent.fetch_add(static_cast<int64_t>(size)) + static_cast<int64_t>(size);
+    int64_t peak = g_allocPeak.load();
+    while (current > peak && !g_allocPeak.compare_exchange_weak(peak, current)) {
+    }
+    return static_cast<uint8_t*>(raw) + kAllocHeader;
+}
+
+void TrackedFree(void* ptr)
+{
+    if (ptr == nullptr) {
+        return;
+    }
+    void* raw = static_cast<uint8_t*>(ptr) - kAllocHeader;
+    g_allocCurrent.fetch_sub(static_cast<int64_t>(*static_cast<size_t*>(raw)));
+    std::free(raw);
+}
+} // namespace
+
+void* operator new(size_t size)
+{
+    void* ptr = TrackedAlloc(size);
+    if (ptr == nullptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void* operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+    return TrackedAlloc(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept
+{
+    return TrackedAlloc(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    TrackedFree(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    TrackedFree(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+    TrackedFree(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept
+{
+    TrackedFree(ptr);
+}
+
+namespace aicpu {
+namespace benchmark {
+namespace {
+struct BenchResult {
+    std::string kernel;
+    std::string name;
+    BenchParams params;
+    int64_t threads = 1;
+    uint32_t status = KERNEL_STATUS_OK;
+    double medianUs = 0.0;
+    double minUs = 0.0;
+    double elementsPerSec = 0.0;
+    double gbPerSec = 0.0;
+    double scalingEfficiency = 0.0;
+    int64_t peakScratchBytes = 0;
+};
+
+std::vector<int32_t> AvailableCpus()
+{
+    std::vector<int32_t> cpus;
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    if (sched_getaffinity(0, sizeof(mask), &mask) != 0) {
+        return {0};
+    }
+    for (int32_t cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+        if (CPU_ISSET(cpu, &mask)) {
+            cpus.push_back(cpu);
+        }
+    }
+    return cpus;
+}
+
+// sched_setaffinity(0) 只作用于调用线程, kernel 线程池的工作线程可能已在之前的用例中创建,
+// 因此遍历 /proc/self/task 对进程内所有线程设置; 之后新建的线程继承主线程的亲和性
+bool RestrictCpus(const std::vector<int32_t>& cpus, int64_t threads)
+{
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    const int64_t num = std::min(threads, static_cast<int64_t>(cpus.size()));
+    for (int64_t i = 0; i < num; ++i) {
+        CPU_SET(cpus[i], &mask);
+    }
+    DIR* dir = opendir("/proc/self/task");
+    if (dir == nullptr) {
+        return false;
+    }
+    bool success = true;
+    for (struct dirent* entry = readdir(dir); entry != nullptr; entry = readdir(dir)) {
+        if (entry->d_name[0] == '.') {
+            continue;
+        }
+        const pid_t tid = static_cast<pid_t>(std::atoi(entry->d_name));
+        success = (sched_setaffinity(tid, sizeof(mask), &mask) == 0) && success;
+    }
+    (void)closedir(dir);
+    return success;
+}
+
+std::string ParamsToJson(const BenchParams& params)
+{
+    std::ostringstream oss;
+    oss << "[";
+    for (size_t i = 0; i < params.size(); ++i) {
+        oss << (i == 0 ? "" : ", ") << params[i];
+    }
+    oss << "]";
+    return oss.str();
+}
+
+void RunOne(BenchInstance& instance, int32_t warmup, int32_t repeat, BenchResult& result)
+{
+    CpuKernelContext ctx(HOST);
+    if (ctx.Init(instance.nodeDef.get()) != KERNEL_STATUS_OK) {
+        result.status = KERNEL_STATUS_INNER_ERROR;
+        return;
+    }
+    for (int32_t i = 0; i < warmup; ++i) {
+        result.status = CpuKernelRegister::Instance().RunCpuKernel(ctx);
+        if (result.status != KERNEL_STATUS_OK) {
+            return;
+        }
+    }
+
+    std::vector<double> costs;
+    for (int32_t i = 0; i < repeat; ++i) {
+        const int64_t base = g_allocCurrent.load();
+        g_allocPeak.store(base);
+        auto start = std::chrono::steady_clock::now();
+        result.status = CpuKernelRegister::Instance().RunCpuKernel(ctx);
+        auto end = std::chrono::steady_clock::now();
+        if (result.status != KERNEL_STATUS_OK) {
+            return;
+        }
+        result.peakScratchBytes = std::max(result.peakScratchBytes, g_allocPeak.load() - base);
+        costs.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+    }
+    std::sort(costs.begin(), costs.end());
+    result.minUs = costs.front();
+    result.medianUs = costs[costs.size() / 2];
+    if (result.medianUs > 0.0) {
+        result.elementsPerSec = static_cast<double>(instance.elements) / result.medianUs * 1e6;
+        result.gbPerSec = static_cast<double>(instance.bytes) / result.medianUs * 1e-3;
+    }
+}
+
+void WriteJson(std::ostream& os, const std::vector<BenchResult>& results, const std::vector<int32_t>& cpus)
+{
+    os << "{\n  \"available_cpus\": " << cpus.size() << ",\n  \"results\": [";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const BenchResult& r = results[i];
+        os << (i == 0 ? "\n" : ",\n") << "    {\"kernel\": \"" << r.kernel << "\", \"case\": \"" << r.name
+           << "\", \"params\": " << ParamsToJson(r.params) << ", \"threads\": " << r.threads
+           << ", \"status\": " << r.status << ", \"median_us\": " << r.medianUs << ", \"min_us\": " << r.minUs
+           << ", \"elements_per_sec\": " << r.elementsPerSec << ", \"gb_per_sec\": " << r.gbPerSec
+           << ", \"scaling_efficiency\": " << r.scalingEfficiency
+           << ", \"peak_scratch_bytes\": " << r.peakScratchBytes << "}";
+    }
+    os << "\n  ]\n}\n";
+}
+} // namespace
+
+BenchRegistry& BenchRegistry::Instance()
+{
+    static BenchRegistry registry;
+    return registry;
+}
+
+void BenchRegistry::Register(const BenchCase& benchCase)
+{
+    cases_.push_back(benchCase);
+}
+
+int32_t RunBenchmarks(const BenchOptions& options)
+{
+    const std::vector<int32_t> cpus = AvailableCpus();
+    std::vector<int64_t> threads = options.threads;
+    if (threads.empty()) {
+        for (int64_t t = 1; t < static_cast<int64_t>(cpus.size()); t *= 2) {
+            threads.push_back(t);
+        }
+        threads.push_back(static_cast<int64_t>(cpus.size()));
+    }
+
+    std::vector<BenchResult> results;
+    int32_t failed = 0;
+    for (const BenchCase& benchCase : BenchRegistry::Instance().Cases()) {
+        const std::string fullName = benchCase.kernel + "/" + benchCase.name;
+        if (!options.filter.empty() && fullName.find(options.filter) == std::string::npos) {
+            continue;
+        }
+        for (const BenchParams& params : benchCase.params) {
+            BenchInstance instance;
+            benchCase.builder(params, instance);
+            double singleThreadUs = 0.0;
+            for (int64_t t : threads) {
+                BenchResult result;
+                result.kernel = benchCase.kernel;
+                result.name = benchCase.name;
+                result.params = params;
+                result.threads = t;
+                if (!RestrictCpus(cpus, t)) {
+                    std::cerr << "Restrict cpus to " << t << " failed, run with all available cpus." << std::endl;
+                }
+                RunOne(instance, options.warmup, options.repeat, result);
+                if (result.status != KERNEL_STATUS_OK) {
+                    std::cerr << fullName << " " << ParamsToJson(params) << " failed, status " << result.status
+                              << std::endl;
+                    ++failed;
+                } else if (t == 1) {
+                    singleThreadUs = result.medianUs;
+                }
+                if (singleThreadUs > 0.0 && result.medianUs > 0.0) {
+                    result.scalingEfficiency = singleThreadUs / (static_cast<double>(t) * result.medianUs);
+                }
+                results.push_back(result);
+            }
+        }
+    }
+    (void)RestrictCpus(cpus, static_cast<int64_t>(cpus.size()));
+
+    if (options.output.empty()) {
+        WriteJson(std::cout, results, cpus);
+    } else {
+        std::ofstream ofs(options.output);
+        WriteJson(ofs, results, cpus);
+    }
+    return failed == 0 ? 0 : 1;
+}
+} // namespace benchmark
+} // namespace aicpu
@@ -0,0 +1,114 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/*!
+ * \file aicpu_benchmark.h
+ * \brief AICPU kernel 微基准框架
+ *
+ * 复用 UT 的 NodeDefBuilder / CpuKernelContext 脚手架, 通过 CpuKernelRegister 执行已注册的 kernel.
+ * 每个用例给出一组 shape 参数, 框架对每个 (shape, 线程数) 组合计时, 输出 JSON:
+ *   - 线程数通过 sched_setaffinity 限制进程内所有线程(含已创建的线程池工作线程)可用核数实现,
+ *     与 kernel 内 ParallelFor 的切分策略无关;
+ *   - scaling_efficiency = t(1 线程) / (threads * t(threads));
+ *   - peak_scratch_bytes 为单次执行期间经 operator new 分配的峰值字节数(不含输入输出).
+ */
+
+#ifndef OPS_NN_TESTS_UT_OP_KERNEL_AICPU_BENCHMARK_AICPU_BENCHMARK_H_
+#define OPS_NN_TESTS_UT_OP_KERNEL_AICPU_BENCHMARK_AICPU_BENCHMARK_H_
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "cpu_kernel_utils.h"
+#include "node_def_builder.h"
+
+namespace aicpu {
+namespace benchmark {
+// 单个用例实例: 持有 NodeDef 与其引用的输入输出内存
+struct BenchInstance {
+    std::shared_ptr<NodeDef> nodeDef;
+    std::vector<std::shared_ptr<std::vector<uint8_t>>> buffers;
+    // 单次执行处理的字节数(输入 + 输出), 用于计算带宽
+    int64_t bytes = 0;
+    // 单次执行处理的元素数, 用于计算吞吐
+    int64_t elements = 0;
+
+    // 分配一块 num 个 T 的内存并按 fill(i) 初始化, 返回首地址
+    template <typename T>
+    T* Alloc(int64_t num, const std::function<T(int64_t)>& fill = nullptr)
+    {
+        auto buffer = std::make_shared<std::vector<uint8_t>>(static_cast<size_t>(num) * sizeof(T));
+        T* data = reinterpret_cast<T*>(buffer->data());
+        for (int64_t i = 0; fill != nullptr && i < num; ++i) {
+            data[i] = fill(i);
+        }
+        buffers.push_back(buffer);
+        return data;
+    }
+};
+
+// 一组 shape 参数, 含义由用例自行解释
+using BenchParams = std::vector<int64_t>;
+using BenchBuilder = std::function<void(const BenchParams& params, BenchInstance& instance)>;
+
+struct BenchCase {
+    std::string kernel;
+    std::string name;
+    std::vector<BenchParams> params;
+    BenchBuilder builder;
+};
+
+class BenchRegistry {
+public:
+    static BenchRegistry& Instance();
+    void Register(const BenchCase& benchCase);
+    const std::vector<BenchCase>& Cases() const
+    {
+        return cases_;
+    }
+
+private:
+    std::vector<BenchCase> cases_;
+};
+
+struct BenchRegistrar {
+    BenchRegistrar(const std::string& kernel, const std::string& name, const std::vector<BenchParams>& params,
+                   const BenchBuilder& builder)
+    {
+        BenchRegistry::Instance().Register({kernel, name, params, builder});
+    }
+};
+
+struct BenchOptions {
+    std::vector<int64_t> threads;
+    std::string filter;
+    std::string output;
+    int32_t warmup = 2;
+    int32_t repeat = 10;
+};
+
+// 执行所有匹配 filter 的用例, 结果以 JSON 写入 options.output(为空时写标准输出)
+int32_t RunBenchmarks(const BenchOptions& options);
+} // namespace benchmark
+} // namespace aicpu
+
+#define AICPU_BENCH_CONCAT_INNER(a, b) a##b
+#define AICPU_BENCH_CONCAT(a, b) AICPU_BENCH_CONCAT_INNER(a, b)
+
+// 注册用例: AICPU_BENCHMARK("LogSoftmaxV2", "float32", params, [](const BenchParams&, BenchInstance&) {...});
+// builder 放在可变参数中, lambda 内的逗号不会被拆成多个宏参数
+#define AICPU_BENCHMARK(kernel, name, params, ...)                                                    \
+    static aicpu::benchmark::BenchRegistrar AICPU_BENCH_CONCAT(g_aicpuBenchRegistrar, __COUNTER__)( \
+        kernel, name, params, __VA_ARGS__)
+
+#endif // OPS_NN_TESTS_UT_OP_KERNEL_AICPU_BENCHMARK_AICPU_BENCHMARK_H_
@@ -0,0 +1,247 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "Eigen/Core"
+#include "aicpu_benchmark.h"
+
+using namespace aicpu;
+using namespace aicpu::benchmark;
+
+namespace {
+// 可复现的伪随机数, 避免各次运行输入不同导致结果不可比
+inline uint32_t Hash(int64_t i)
+{
+    uint64_t x = static_cast<uint64_t>(i) * 0x9E3779B97F4A7C15ULL;
+    x ^= x >> 29;
+    return static_cast<uint32_t>(x);
+}
+
+inline float RandomFloat(int64_t i)
+{
+    return static_cast<float>(Hash(i) % 2000) / 100.0F - 10.0F;
+}
+
+// params: {outer, axis_len, inner}, 沿中间维做归一化
+void BuildSoftmaxLike(const std::string& opType, const std::string& inputName, const std::string& outputName,
+                      const BenchParams& params, BenchInstance& instance)
+{
+    const int64_t outer = params[0];
+    const int64_t axisLen = params[1];
+    const int64_t inner = params[2];
+    const int64_t num = outer * axisLen * inner;
+    std::vector<int64_t> shape = {outer, axisLen, inner};
+    float* x = instance.Alloc<float>(num, RandomFloat);
+    float* y = instance.Alloc<float>(num);
+    instance.nodeDef = CpuKernelUtils::CreateNodeDef();
+    NodeDefBuilder(instance.nodeDef.get(), opType, opType)
+        .Input({inputName, DT_FLOAT, shape, x})
+        .Output({outputName, DT_FLOAT, shape, y})
+        .Attr("axes", std::vector<int64_t>({1}));
+    instance.elements = num;
+    instance.bytes = num * static_cast<int64_t>(sizeof(float)) * 2;
+}
+
+const std::vector<BenchParams> kSoftmaxParams = {{1024, 1024, 1}, {4096, 128, 1}, {16, 512, 256}, {1, 8192, 128}};
+
+AICPU_BENCHMARK("LogSoftmaxV2", "float32", kSoftmaxParams, [](const BenchParams& params, BenchInstance& instance) {
+    BuildSoftmaxLike("LogSoftmaxV2", "logits", "logsoftmax", params, instance);
+});
+
+AICPU_BENCHMARK("SoftmaxV2", "float32", kSoftmaxParams, [](const BenchParams& params, BenchInstance& instance) {
+    BuildSoftmaxLike("SoftmaxV2", "x", "y", params, instance);
+});
+
+// params: {rows, cols, update_rows, reduction(0: none, 1: add)}, axis = 0, 索引按哈希分布并存在重复
+AICPU_BENCHMARK("ScatterElements", "axis0", (std::vector<BenchParams>{{4096, 256, 4096, 0}, {4096, 256, 4096, 1},
+                                                                     {64, 65536, 64, 1}, {65536, 16, 262144, 1}}),
+                [](const BenchParams& params, BenchInstance& instance) {
+                    const int64_t rows = params[0];
+                    const int64_t cols = params[1];
+                    const int64_t updateRows = params[2];
+                    const std::string reduction = (params[3] == 0) ? "none" : "add";
+                    const int64_t num = rows * cols;
+                    const int64_t updateNum = updateRows * cols;
+                    float* data = instance.Alloc<float>(num, RandomFloat);
+                    int32_t* indices = instance.Alloc<int32_t>(
+                        updateNum, [rows](int64_t i) { return static_cast<int32_t>(Hash(i) % rows); });
+                    float* updates = instance.Alloc<float>(updateNum, RandomFloat);
+                    float* y = instance.Alloc<float>(num);
+                    instance.nodeDef = CpuKernelUtils::CreateNodeDef();
+                    NodeDefBuilder(instance.nodeDef.get(), "ScatterElements", "ScatterElements")
+                        .Input({"data", DT_FLOAT, {rows, cols}, data})
+                        .Input({"indices", DT_INT32, {updateRows, cols}, indices})
+                        .Input({"updates", DT_FLOAT, {updateRows, cols}, updates})
+                        .Attr("axis", static_cast<int64_t>(0))
+                        .Attr("reduction", reduction)
+                        .Attr("include_self", true)
+                        .Output({"y", DT_FLOAT, {rows, cols}, y});
+                    instance.elements = updateNum;
+                    instance.bytes = (num * 2 + updateNum * 2) * static_cast<int64_t>(sizeof(float));
+                });
+
+// params: {nnz, dense_rows, rank, ordered}
+AICPU_BENCHMARK("SparseFillEmptyRows", "int32_values",
+                (std::vector<BenchParams>{{1 << 20, 1 << 16, 2, 0}, {1 << 20, 1 << 16, 2, 1}, {1 << 16, 1 << 18, 2, 0}}),
+                [](const BenchParams& params, BenchInstance& instance) {
+                    const int64_t nnz = params[0];
+                    const int64_t denseRows = params[1];
+                    const int64_t rank = params[2];
+                    const bool ordered = params[3] != 0;
+                    int64_t* indices = instance.Alloc<int64_t>(nnz * rank, [=](int64_t i) {
+                        const int64_t item = i / rank;
+                        if (i % rank != 0) {
+                            return static_cast<int64_t>(Hash(i) % 1024);
+                        }
+                        return ordered ? item * denseRows / nnz : static_cast<int64_t>(Hash(item) % denseRows);
+                    });
+                    int32_t* values =
+                        instance.Alloc<int32_t>(nnz, [](int64_t i) { return static_cast<int32_t>(i); });
+                    int64_t* denseShape = instance.Alloc<int64_t>(
+                        rank, [denseRows](int64_t i) { return i == 0 ? denseRows : static_cast<int64_t>(1024); });
+                    int32_t* defaultValue = instance.Alloc<int32_t>(1, [](int64_t) { return -1; });
+                    const int64_t outputNum = nnz + denseRows;
+                    int64_t* yIndices = instance.Alloc<int64_t>(outputNum * rank);
+                    int32_t* yValues = instance.Alloc<int32_t>(outputNum);
+                    bool* emptyRowIndicator = instance.Alloc<bool>(denseRows);
+                    int64_t* reverseIndexMap = instance.Alloc<int64_t>(nnz);
+                    instance.nodeDef = CpuKernelUtils::CreateNodeDef();
+                    NodeDefBuilder(instance.nodeDef.get(), "SparseFillEmptyRows", "SparseFillEmptyRows")
+                        .Input({"indices", DT_INT64, {nnz, rank}, indices})
+                        .Input({"values", DT_INT32, {nnz}, values})
+                        .Input({"dense_shape", DT_INT64, {rank}, denseShape})
+                        .Input({"default_value", DT_INT32, {}, defaultValue})
+                        .Output({"y_indices", DT_INT64, {outputNum, rank}, yIndices})
+                        .Output({"y_values", DT_INT32, {outputNum}, yValues})
+                        .Output({"empty_row_indicator", DT_BOOL, {denseRows}, emptyRowIndicator})
+                        .Output({"reverse_index_map", DT_INT64, {nnz}, reverseIndexMap});
+                    instance.elements = nnz;
+                    instance.bytes = nnz * (rank * 16 + 16);
+                });
+
+// params: {numel, count}
+AICPU_BENCHMARK("NonZeroWithValueShape", "float32",
+                (std::vector<BenchParams>{{1 << 22, 1 << 22}, {1 << 22, 1 << 21}, {1 << 22, 1 << 10}}),
+                [](const BenchParams& params, BenchInstance& instance) {
+                    const int64_t numel = params[0];
+                    const int64_t count = params[1];
+                    float* value = instance.Alloc<float>(numel, RandomFloat);
+                    int32_t* index =
+                        instance.Alloc<int32_t>(2 * numel, [](int64_t i) { return static_cast<int32_t>(i); });
+                    int32_t* countData =
+                        instance.Alloc<int32_t>(1, [count](int64_t) { return static_cast<int32_t>(count); });
+                    float* outValue = instance.Alloc<float>(numel);
+                    int32_t* outIndex = instance.Alloc<int32_t>(2 * numel);
+                    instance.nodeDef = CpuKernelUtils::CreateNodeDef();
+                    NodeDefBuilder(instance.nodeDef.get(), "NonZeroWithValueShape", "NonZeroWithValueShape")
+                        .Input({"value", DT_FLOAT, {numel}, value})
+                        .Input({"index", DT_INT32, {2 * numel}, index})
+                        .Input({"count", DT_INT32, {1}, countData})
+                        .Output({"out_value", DT_FLOAT, {numel}, outValue})
+                        .Output({"out_index", DT_INT32, {2 * numel}, outIndex});
+                    instance.elements = count;
+                    instance.bytes = count * 2 * static_cast<int64_t>(sizeof(float) + 2 * sizeof(int32_t));
+                });
+
+// params: {num, attr_mode(0: alpha/scale/input_scale 均为 1, 1: 非默认属性)}
+template <typename T>
+void BuildElu(DataType dataType, const BenchParams& params, BenchInstance& instance)
+{
+    const int64_t num = params[0];
+    const bool defaultAttr = params[1] == 0;
+    T* x = instance.Alloc<T>(num, [](int64_t i) { return static_cast<T>(RandomFloat(i)); });
+    T* y = instance.Alloc<T>(num);
+    instance.nodeDef = CpuKernelUtils::CreateNodeDef();
+    NodeDefBuilder(instance.nodeDef.get(), "Elu", "Elu")
+        .Input({"x", dataType, {num}, x})
+        .Output({"y", dataType, {num}, y})
+        .Attr("alpha", defaultAttr ? 1.0 : 0.2)
+        .Attr("scale", defaultAttr ? 1.0 : 1.05)
+        .Attr("input_scale", defaultAttr ? 1.0 : 0.5);
+    instance.elements = num;
+    instance.bytes = num * static_cast<int64_t>(sizeof(T)) * 2;
+}
+
+const std::vector<BenchParams> kEluParams = {{1 << 14, 0}, {1 << 16, 0}, {1 << 20, 0}, {1 << 20, 1}, {1 << 23, 0}};
+
+AICPU_BENCHMARK("Elu", "float16", kEluParams, [](const BenchParams& params, BenchInstance& instance) {
+    BuildElu<Eigen::half>(DT_FLOAT16, params, instance);
+});
+
+AICPU_BENCHMARK("Elu", "bfloat16", kEluParams, [](const BenchParams& params, BenchInstance& instance) {
+    BuildElu<Eigen::bfloat16>(DT_BFLOAT16, params, instance);
+});
+
+AICPU_BENCHMARK("Elu", "float32", kEluParams, [](const BenchParams& params, BenchInstance& instance) {
+    BuildElu<float>(DT_FLOAT, params, instance);
+});
+
+AICPU_BENCHMARK("Elu", "float64", kEluParams, [](const BenchParams& params, BenchInstance& instance) {
+    BuildElu<double>(DT_DOUBLE, params, instance);
+});
+
+// params: {num}
+template <typename T>
+void BuildSigmoidGrad(DataType dataType, const BenchParams& params, BenchInstance& instance)
+{
+    const int64_t num = params[0];
+    T* y = instance.Alloc<T>(num, [](int64_t i) { return static_cast<T>((RandomFloat(i) + 10.0F) / 20.0F); });
+    T* dy = instance.Alloc<T>(num, [](int64_t i) { return static_cast<T>(RandomFloat(i + 1)); });
+    T* z = instance.Alloc<T>(num);
+    instance.nodeDef = CpuKernelUtils::CreateNodeDef();
+    NodeDefBuilder(instance.nodeDef.get(), "SigmoidGrad", "SigmoidGrad")
+        .Input({"y", dataType, {num}, y})
+        .Input({"dy", dataType, {num}, dy})
+        .Output({"z", dataType, {num}, z})
+        .Attr("complex_conj", false);
+    instance.elements = num;
+    instance.bytes = num * static_cast<int64_t>(sizeof(T)) * 3;
+}
+
+const std::vector<BenchParams> kSigmoidGradParams = {{1 << 14}, {1 << 16}, {1 << 20}, {1 << 23}};
+
+AICPU_BENCHMARK("SigmoidGrad", "float16", kSigmoidGradParams, [](const BenchParams& params, BenchInstance& instance) {
+    BuildSigmoidGrad<Eigen::half>(DT_FLOAT16, params, instance);
+});
+
+AICPU_BENCHMARK("SigmoidGrad", "float32", kSigmoidGradParams, [](const BenchParams& params, BenchInstance& instance) {
+    BuildSigmoidGrad<float>(DT_FLOAT, params, instance);
+});
+
+AICPU_BENCHMARK("SigmoidGrad", "float64", kSigmoidGradParams, [](const BenchParams& params, BenchInstance& instance) {
+    BuildSigmoidGrad<double>(DT_DOUBLE, params, instance);
+});
+
+// params: {batch, channel, in_h, in_w, out_h, out_w}
+AICPU_BENCHMARK("AdaptiveMaxPool2d", "float32",
+                (std::vector<BenchParams>{{32, 64, 56, 56, 7, 7},
+                                          {1, 4, 224, 224, 7, 7},
+                                          {8, 64, 17, 23, 5, 7},
+                                          {4, 64, 65, 1000, 64, 8}}),
+                [](const BenchParams& params, BenchInstance& instance) {
+                    const int64_t inNum = params[0] * params[1] * params[2] * params[3];
+                    const int64_t outNum = params[0] * params[1] * params[4] * params[5];
+                    float* x = instance.Alloc<float>(inNum, RandomFloat);
+                    float* y = instance.Alloc<float>(outNum);
+                    int64_t* argmax = instance.Alloc<int64_t>(outNum);
+                    instance.nodeDef = CpuKernelUtils::CreateNodeDef();
+                    NodeDefBuilder(instance.nodeDef.get(), "AdaptiveMaxPool2d", "AdaptiveMaxPool2d")
+                        .Attr("output_size", std::vector<int64_t>{params[4], params[5]})
+                        .Input({"x", DT_FLOAT, {params[0], params[1], params[2], params[3]}, x, FORMAT_NCHW})
+                        .Output({"y", DT_FLOAT, {params[0], params[1], params[4], params[5]}, y})
+                        .Output({"argmax", DT_INT64, {params[0], params[1], params[4], params[5]}, argmax});
+                    instance.elements = inNum;
+                    instance.bytes = inNum * static_cast<int64_t>(sizeof(float)) +
+                                     outNum * static_cast<int64_t>(sizeof(float) + sizeof(int64_t));
+                });
+} // namespace
@@ -0,0 +1,72 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "aicpu_benchmark.h"
+
+using namespace aicpu::benchmark;
+
+namespace {
+void PrintUsage()
+{
+    std::cout << "Usage: benchmark_op_kernel_aicpu [options]\n"
+              << "  --filter=<str>     only run cases whose \"Kernel/case\" contains str\n"
+              << "  --threads=<list>   comma separated thread counts, default 1,2,4,...,all cpus\n"
+              << "  --repeat=<num>     timed runs per point, default 10\n"
+              << "  --warmup=<num>     warmup runs per point, default 2\n"
+              << "  --output=<file>    write json to file instead of stdout\n";
+}
+
+bool ParseOption(const std::string& arg, const std::string& key, std::string& value)
+{
+    const std::string prefix = "--" + key + "=";
+    if (arg.compare(0, prefix.size(), prefix) != 0) {
+        return false;
+    }
+    value = arg.substr(prefix.size());
+    return true;
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    BenchOptions options;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        std::string value;
+        if (ParseOption(arg, "filter", value)) {
+            options.filter = value;
+        } else if (ParseOption(arg, "output", value)) {
+            options.output = value;
+        } else if (ParseOption(arg, "repeat", value)) {
+            options.repeat = std::max(1, std::atoi(value.c_str()));
+        } else if (ParseOption(arg, "warmup", value)) {
+            options.warmup = std::max(0, std::atoi(value.c_str()));
+        } else if (ParseOption(arg, "threads", value)) {
+            std::stringstream ss(value);
+            std::string item;
+            while (std::getline(ss, item, ',')) {
+                const int64_t threads = std::atoll(item.c_str());
+                if (threads > 0) {
+                    options.threads.push_back(threads);
+                }
+            }
+        } else {
+            PrintUsage();
+            return (arg == "--help" || arg == "-h") ? 0 : 1;
+        }
+    }
+    return RunBenchmarks(options);
+}